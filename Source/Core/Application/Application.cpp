@@ -1,5 +1,8 @@
 #include "Application.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
+#include "../Logging/Logger.h"
+#include "../Memory/FrameMemory.h"
+#include "../Profiling/Profiler.h"
 
 // Static instance
 Application* Application::s_instance = nullptr;
@@ -53,8 +56,15 @@ bool Application::Initialize() {
     SetupEventCallbacks();
 
     // Initialize timer
+    m_timer.GetFrameStats().SetConfig(m_config.frameStats);
     m_timer.Reset();
     m_timer.Start();
+    m_fixedTimestep.SetStepRate(m_config.simulationRate);
+    m_fixedTimestep.SetMaxStepsPerFrame(m_config.maxSimulationStepsPerFrame);
+    m_fixedTimestep.Reset();
+
+    // Frames are drawn from render packets, on the render thread when pipelined
+    m_renderThread.SetRenderFunction([this](const RenderPacket& packet) { RenderFrame(packet); });
 
     // Call derived class initialization
     if (!OnInitialize()) {
@@ -78,9 +88,15 @@ int32 Application::Run() {
     // Show window
     m_window->Show();
 
+    if (m_config.pipelinedRendering && !m_renderThread.Start()) {
+        Platform::OutputDebugMessage("Failed to start render thread, rendering on the main thread\n");
+    }
+
     // Main loop
     MainLoop();
 
+    m_renderThread.Stop();
+
     Platform::OutputDebugMessage("Main loop ended\n");
     return 0;
 }
@@ -92,10 +108,14 @@ void Application::Shutdown() {
 
     Platform::OutputDebugMessage("Shutting down application\n");
 
+    // Nothing may be drawing while the scene and renderer go away
+    m_renderThread.Stop();
+
     // Call derived class shutdown
     OnShutdown();
 
-    // Cleanup camera
+    // Cleanup camera, after the controller that drives it
+    m_cameraController.reset();
     if (m_camera) {
         m_camera.reset();
     }
@@ -112,6 +132,29 @@ void Application::Shutdown() {
         m_window.reset();
     }
 
+    const FrameTimeStats& frameStats = m_timer.GetFrameStats();
+    FrameTimeSummary summary = frameStats.GetSummary();
+    LOG_INFO("Application: Last {} frames p50 {} ms, p95 {} ms, p99 {} ms, max {} ms; {} hitches in {} frames",
+             summary.frameCount, summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.maxMs,
+             frameStats.GetHitchCount(), frameStats.GetFrameCount());
+    Platform::OutputDebugMessage("Frame time histogram:\n" + frameStats.FormatHistogram());
+
+    const FixedTimestepStats& simulationStats = m_fixedTimestep.GetStats();
+    LOG_INFO("Application: {} simulation steps at {} Hz; {} frames clamped, {} s dropped",
+             m_fixedTimestep.GetStepCount(), m_fixedTimestep.GetStepRate(),
+             simulationStats.clampedFrames, simulationStats.droppedSeconds);
+
+    RenderThreadStats renderStats = m_renderThread.GetStats();
+    LOG_INFO("Application: {} frames rendered; simulation waited {} s for the renderer, renderer idle {} s",
+             renderStats.packetsRendered, renderStats.producerWaitSeconds, renderStats.renderIdleSeconds);
+
+    if (!m_config.profileTracePath.empty()) {
+        Profiler::GetGlobal().ExportChromeTrace(m_config.profileTracePath);
+    }
+
+    // Make sure everything logged during shutdown reaches the sinks
+    Logger::GetGlobal().Flush();
+
     m_initialized = false;
     Platform::OutputDebugMessage("Application shutdown complete\n");
 }
@@ -147,12 +190,20 @@ bool Application::CreateCamera() {
     m_config.cameraDesc.aspectRatio = static_cast<float>(m_window->GetWidth()) /
                                      static_cast<float>(m_window->GetHeight());
 
+    // The camera has to write depth the way the renderer clears and tests it
+    m_config.cameraDesc.reverseZ = m_config.rendererConfig.reverseZ;
+
     m_camera = std::make_unique<Camera>(m_config.cameraDesc);
     if (!m_camera) {
         Platform::OutputDebugMessage("Failed to create camera instance\n");
         return false;
     }
 
+    if (m_config.rtsCamera) {
+        m_cameraController = std::make_unique<RtsCameraController>(*m_camera, m_config.rtsCameraDesc);
+        m_cameraController->SetViewportSize(m_window->GetWidth(), m_window->GetHeight());
+    }
+
     Platform::OutputDebugMessage("Camera created successfully\n");
     return true;
 }
@@ -197,23 +248,34 @@ void Application::SetupEventCallbacks() {
 
 void Application::MainLoop() {
     Platform::OutputDebugMessage("Entering main loop\n");
+    Profiler& profiler = Profiler::GetGlobal();
+    profiler.SetThreadName("Main");
 
     while (!m_shouldExit && !m_window->ShouldClose()) {
-        // Poll window events
-        m_window->PollEvents();
-
-        // Double-check if window should close after polling events
-        if (m_window->ShouldClose()) {
-            Platform::OutputDebugMessage("Window should close detected in main loop\n");
-            break;
+        {
+            PROFILE_SCOPE("Application::Frame");
+            FrameMemory::BeginFrame();
+
+            // Poll window events
+            m_window->PollEvents();
+
+            // Double-check if window should close after polling events
+            if (m_window->ShouldClose()) {
+                Platform::OutputDebugMessage("Window should close detected in main loop\n");
+                break;
+            }
+
+            // Update timer
+            m_timer.Tick();
+
+            // Simulate this frame, then hand its snapshot to the renderer. When pipelined the
+            // render thread draws it while the next frame is simulated.
+            Update();
+            RenderPacket& packet = m_renderThread.BeginPacket();
+            BuildRenderPacket(packet);
+            m_renderThread.SubmitPacket();
         }
-
-        // Update timer
-        m_timer.Tick();
-
-        // Update and render
-        Update();
-        Render();
+        profiler.EndFrame();
     }
 
     Platform::OutputDebugMessage("Exiting main loop - shouldExit: " +
@@ -223,28 +285,101 @@ void Application::MainLoop() {
 }
 
 void Application::Update() {
+    PROFILE_SCOPE("Application::Update");
     float32 deltaTime = m_timer.GetDeltaTime();
 
     // Update camera first
-    if (m_camera) {
+    if (m_cameraController) {
+        m_cameraController->Update(deltaTime);
+    } else if (m_camera) {
         m_camera->Update(deltaTime);
     }
 
+    // The simulation advances in fixed steps, independent of the frame rate
+    uint32 steps = m_fixedTimestep.Advance(deltaTime);
+    for (uint32 i = 0; i < steps; ++i) {
+        PROFILE_SCOPE("Application::FixedUpdate");
+        OnFixedUpdate(m_fixedTimestep.GetStepSeconds());
+    }
+
     // Call derived class update
     OnUpdate(deltaTime);
 }
 
-void Application::Render() {
+void Application::BuildRenderPacket(RenderPacket& packet) {
+    PROFILE_SCOPE("Application::BuildRenderPacket");
+    packet.interpolationAlpha = m_fixedTimestep.GetAlpha();
+
+    if (m_camera) {
+        packet.hasView = true;
+        DirectX::XMStoreFloat4x4(&packet.view.view, m_camera->GetViewMatrix());
+        DirectX::XMStoreFloat4x4(&packet.view.projection, m_camera->GetProjectionMatrix());
+        packet.view.position = m_camera->GetPosition();
+        packet.view.fovY = m_camera->GetFOV();
+        packet.view.nearPlane = m_camera->GetNearPlane();
+        packet.view.viewportHeight = static_cast<float32>(m_window->GetHeight());
+
+        // Zoomed out, the RTS view draws farther and settles for less detail
+        if (m_cameraController) {
+            RtsViewParameters parameters = m_cameraController->GetViewParameters();
+            packet.view.cullDistance = parameters.cullDistance;
+            packet.view.lodDistanceScale = parameters.lodDistanceScale;
+        }
+    }
+
+    // Call derived class packet building
+    OnBuildRenderPacket(packet);
+    CullDraws(packet);
+}
+
+void Application::CullDraws(RenderPacket& packet) const {
+    if (!packet.hasView || !m_camera) {
+        return;
+    }
+    PROFILE_SCOPE("Application::CullDraws");
+
+    // Bounding spheres against the camera's frustum, then against the view's cull
+    // distance (measured to the nearest point of the sphere)
+    const Frustum& frustum = m_camera->GetFrustum();
+    const DirectX::XMFLOAT3& eye = packet.view.position;
+    float32 cullDistance = packet.view.cullDistance;
+    std::erase_if(packet.draws, [&frustum, &eye, cullDistance](const RenderDraw& draw) {
+        if (!frustum.IntersectsSphere(draw.boundsCenter, draw.boundsRadius)) {
+            return true;
+        }
+        if (cullDistance <= 0.0f) {
+            return false;
+        }
+
+        float32 dx = draw.boundsCenter.x - eye.x;
+        float32 dy = draw.boundsCenter.y - eye.y;
+        float32 dz = draw.boundsCenter.z - eye.z;
+        float32 limit = cullDistance + draw.boundsRadius;
+        return dx * dx + dy * dy + dz * dz > limit * limit;
+    });
+}
+
+void Application::RenderFrame(const RenderPacket& packet) {
+    PROFILE_SCOPE("Application::Render");
+    {
+        std::lock_guard<std::mutex> lock(m_resizeMutex);
+        if (m_resizePending) {
+            m_renderer->Resize(m_resizeWidth, m_resizeHeight);
+            m_resizePending = false;
+        }
+    }
+
     // Begin frame
     m_renderer->BeginFrame();
 
     // Clear screen
     ClearValues clearValues;
     clearValues.color = { 0.2f, 0.3f, 0.4f, 1.0f }; // Nice blue-gray
+    clearValues.depth = m_config.rendererConfig.GetDepthClearValue();
     m_renderer->Clear(clearValues);
 
     // Call derived class render
-    OnRender();
+    OnRender(packet);
 
     // End frame and present
     m_renderer->EndFrame();
@@ -255,9 +390,12 @@ void Application::HandleWindowResize(const WindowResizeEvent& event) {
     Platform::OutputDebugMessage("Window resize: " +
         std::to_string(event.width) + "x" + std::to_string(event.height) + "\n");
 
-    // Resize renderer
-    if (m_renderer) {
-        m_renderer->Resize(event.width, event.height);
+    // Resize renderer before its next frame; the render thread may be drawing now
+    {
+        std::lock_guard<std::mutex> lock(m_resizeMutex);
+        m_resizePending = true;
+        m_resizeWidth = event.width;
+        m_resizeHeight = event.height;
     }
 
     // Update camera aspect ratio
@@ -265,6 +403,9 @@ void Application::HandleWindowResize(const WindowResizeEvent& event) {
         float aspectRatio = static_cast<float>(event.width) / static_cast<float>(event.height);
         m_camera->SetAspectRatio(aspectRatio);
     }
+    if (m_cameraController) {
+        m_cameraController->SetViewportSize(event.width, event.height);
+    }
 
     OnWindowResize(event.width, event.height);
 
@@ -277,7 +418,9 @@ void Application::HandleWindowClose() {
 
 void Application::HandleKeyEvent(const KeyEvent& event) {
     // Pass to camera first
-    if (m_camera) {
+    if (m_cameraController) {
+        m_cameraController->OnKeyEvent(event);
+    } else if (m_camera) {
         m_camera->OnKeyEvent(event);
     }
 
@@ -286,7 +429,7 @@ void Application::HandleKeyEvent(const KeyEvent& event) {
 
 void Application::HandleMouseButtonEvent(const MouseButtonEvent& event) {
     // Pass to camera first
-    if (m_camera) {
+    if (!m_cameraController && m_camera) {
         m_camera->OnMouseButtonEvent(event);
     }
 
@@ -295,7 +438,9 @@ void Application::HandleMouseButtonEvent(const MouseButtonEvent& event) {
 
 void Application::HandleMouseMoveEvent(const MouseMoveEvent& event) {
     // Pass to camera first
-    if (m_camera) {
+    if (m_cameraController) {
+        m_cameraController->OnMouseMoveEvent(event);
+    } else if (m_camera) {
         m_camera->OnMouseMoveEvent(event);
     }
 
@@ -304,7 +449,9 @@ void Application::HandleMouseMoveEvent(const MouseMoveEvent& event) {
 
 void Application::HandleMouseWheelEvent(const MouseWheelEvent& event) {
     // Pass to camera first
-    if (m_camera) {
+    if (m_cameraController) {
+        m_cameraController->OnMouseWheelEvent(event);
+    } else if (m_camera) {
         m_camera->OnMouseWheelEvent(event);
     }
 
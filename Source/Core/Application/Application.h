@@ -4,16 +4,29 @@
 #include "../../Core/Window/Window.h"
 #include "../../Rendering/Renderer.h"
 #include "../../Rendering/Camera.h"
+#include "../../Rendering/RtsCameraController.h"
+#include "../Threading/RenderThread.h"
+#include "FixedTimestep.h"
 #include "Timer.h"
+#include <mutex>
 
 // Application configuration
 struct ApplicationConfig {
     String name = "RTS Game";
     WindowDesc windowDesc;
     CameraDesc cameraDesc;
+    bool rtsCamera = false;             // Input drives an RtsCameraController instead of the free-fly camera
+    RtsCameraDesc rtsCameraDesc;
 	RendererConfig rendererConfig;
     bool enableDebugLayer = DEBUG_BUILD;
     bool enableValidation = DEBUG_BUILD;
+    String profileTracePath;    // Chrome trace of the last profiled frames, written on shutdown
+    FrameTimeStatsConfig frameStats;    // Rolling window and hitch thresholds
+    float32 simulationRate = FixedTimestep::DEFAULT_STEP_RATE;              // Fixed simulation steps per second
+    uint32 maxSimulationStepsPerFrame = FixedTimestep::DEFAULT_MAX_STEPS_PER_FRAME;  // Catch-up limit
+    // Render on a separate thread one frame behind the simulation. Asset completion and
+    // descriptor recycling run on the render thread, and packets carry no material state.
+    bool pipelinedRendering = true;
 };
 
 // Application interface
@@ -35,7 +48,9 @@ public:
     Window* GetWindow() const { return m_window.get(); }
 	Renderer* GetRenderer() const { return m_renderer.get(); }
 	Camera* GetCamera() const { return m_camera.get(); }
+    RtsCameraController* GetCameraController() const { return m_cameraController.get(); }
     const Timer& GetTimer() const { return m_timer; }
+    const FixedTimestep& GetFixedTimestep() const { return m_fixedTimestep; }
     const ApplicationConfig& GetConfig() const { return m_config; }
 
     // Static instance access
@@ -45,14 +60,19 @@ protected:
     // Virtual methods for derived classes
     virtual bool OnInitialize() { return true; }
     virtual void OnShutdown() {}
-    virtual void OnUpdate(float32 deltaTime) {}
-    virtual void OnRender() {}
+    virtual void OnFixedUpdate(float32 stepSeconds) {}    // Simulation, at simulationRate
+    virtual void OnUpdate(float32 deltaTime) {}           // Once per rendered frame
+    virtual void OnBuildRenderPacket(RenderPacket& packet) {}     // Simulation thread: snapshot what to draw
+    virtual void OnRender(const RenderPacket& packet) {}          // Render thread: draw the snapshot
     virtual void OnWindowResize(uint32 width, uint32 height) {}
     virtual void OnKeyEvent(const KeyEvent& event) {}
     virtual void OnMouseButtonEvent(const MouseButtonEvent& event) {}
     virtual void OnMouseMoveEvent(const MouseMoveEvent& event) {}
     virtual void OnMouseWheelEvent(const MouseWheelEvent& event) {}
 
+    // Let the render thread finish before touching the renderer from the simulation thread
+    void WaitForRenderThread() { m_renderThread.WaitForIdle(); }
+
 private:
     // Internal methods
     bool CreateAppWindow();
@@ -61,7 +81,9 @@ private:
     void SetupEventCallbacks();
     void MainLoop();
     void Update();
-    void Render();
+    void BuildRenderPacket(RenderPacket& packet);
+    void RenderFrame(const RenderPacket& packet);
+    void CullDraws(RenderPacket& packet) const;
 
     // Event handlers
     void HandleWindowResize(const WindowResizeEvent& event);
@@ -80,8 +102,17 @@ private:
     // Core systems
     UniquePtr<Window> m_window;
 	UniquePtr<Camera> m_camera; // TODO: Figure out how to handle camera properly
+    UniquePtr<RtsCameraController> m_cameraController;     // Null for the free-fly camera
 	UniquePtr<Renderer> m_renderer;
     Timer m_timer;
+    FixedTimestep m_fixedTimestep;
+    RenderThread m_renderThread;
+
+    // Window resizes arrive on the simulation thread and are applied by the next rendered frame
+    std::mutex m_resizeMutex;
+    bool m_resizePending = false;
+    uint32 m_resizeWidth = 0;
+    uint32 m_resizeHeight = 0;
 
     // Static instance
     static Application* s_instance;
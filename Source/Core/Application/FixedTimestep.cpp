@@ -0,0 +1,40 @@
+#include "FixedTimestep.h"
+#include <algorithm>
+#include <cmath>
+
+FixedTimestep::FixedTimestep(float32 stepsPerSecond, uint32 maxStepsPerFrame) {
+    SetStepRate(stepsPerSecond);
+    SetMaxStepsPerFrame(maxStepsPerFrame);
+}
+
+void FixedTimestep::SetStepRate(float32 stepsPerSecond) {
+    m_stepSeconds = 1.0 / static_cast<float64>(stepsPerSecond > 0.0f ? stepsPerSecond : DEFAULT_STEP_RATE);
+    m_accumulator = std::fmod(m_accumulator, m_stepSeconds);
+}
+
+void FixedTimestep::Reset() {
+    m_accumulator = 0.0;
+    m_stepCount = 0;
+    m_stats = {};
+}
+
+uint32 FixedTimestep::Advance(float32 frameSeconds) {
+    m_accumulator += std::max(static_cast<float64>(frameSeconds), 0.0);
+
+    uint32 steps = 0;
+    while (m_accumulator >= m_stepSeconds && steps < m_maxStepsPerFrame) {
+        m_accumulator -= m_stepSeconds;
+        ++steps;
+    }
+
+    // Keep only the partial step so the next frames are not spent catching up
+    if (m_accumulator >= m_stepSeconds) {
+        float64 kept = std::fmod(m_accumulator, m_stepSeconds);
+        m_stats.droppedSeconds += m_accumulator - kept;
+        ++m_stats.clampedFrames;
+        m_accumulator = kept;
+    }
+
+    m_stepCount += steps;
+    return steps;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../../Core/Utilities/Types.h"
+
+struct FixedTimestepStats {
+    uint64 clampedFrames = 0;       // Frames that needed more than the step limit
+    float64 droppedSeconds = 0.0;   // Time those frames gave up instead of catching up
+};
+
+// Accumulator that turns variable frame times into a whole number of fixed simulation
+// steps. The simulation always advances by GetStepSeconds(), so its results do not
+// depend on the frame rate; the time left over is exposed as GetAlpha() for rendering
+// between the previous and the current step. A long frame (a hitch, a breakpoint) runs
+// at most maxStepsPerFrame steps and drops the rest, so the simulation slows down for
+// a moment instead of spiralling into ever longer catch-up frames.
+class FixedTimestep {
+public:
+    static constexpr float32 DEFAULT_STEP_RATE = 30.0f;
+    static constexpr uint32 DEFAULT_MAX_STEPS_PER_FRAME = 5;
+
+    explicit FixedTimestep(float32 stepsPerSecond = DEFAULT_STEP_RATE,
+                           uint32 maxStepsPerFrame = DEFAULT_MAX_STEPS_PER_FRAME);
+
+    void SetStepRate(float32 stepsPerSecond);
+    void SetMaxStepsPerFrame(uint32 maxSteps) { m_maxStepsPerFrame = maxSteps > 0 ? maxSteps : 1; }
+    void Reset();
+
+    // Add a frame's time; returns the number of steps to run before rendering it
+    uint32 Advance(float32 frameSeconds);
+
+    float32 GetStepSeconds() const { return static_cast<float32>(m_stepSeconds); }
+    float32 GetStepRate() const { return static_cast<float32>(1.0 / m_stepSeconds); }
+    uint32 GetMaxStepsPerFrame() const { return m_maxStepsPerFrame; }
+
+    // Fraction of a step accumulated since the last one, in [0, 1)
+    float32 GetAlpha() const { return static_cast<float32>(m_accumulator / m_stepSeconds); }
+
+    // Steps run since Reset and the simulated time they cover
+    uint64 GetStepCount() const { return m_stepCount; }
+    float64 GetSimulationTime() const { return static_cast<float64>(m_stepCount) * m_stepSeconds; }
+
+    const FixedTimestepStats& GetStats() const { return m_stats; }
+
+private:
+    float64 m_stepSeconds = 1.0 / DEFAULT_STEP_RATE;
+    uint32 m_maxStepsPerFrame = DEFAULT_MAX_STEPS_PER_FRAME;
+    float64 m_accumulator = 0.0;
+    uint64 m_stepCount = 0;
+    FixedTimestepStats m_stats;
+};
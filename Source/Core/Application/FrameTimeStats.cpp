@@ -0,0 +1,176 @@
+#include "FrameTimeStats.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+    // Nearest rank: index of the smallest value with at least percentile% of values at or below it
+    size_t NearestRank(float32 percentile, size_t count) {
+        double rank = std::ceil(std::clamp(percentile, 0.0f, 100.0f) / 100.0 * static_cast<double>(count));
+        return std::clamp<size_t>(static_cast<size_t>(rank), 1, count) - 1;
+    }
+}
+
+FrameTimeStats::FrameTimeStats(const FrameTimeStatsConfig& config) {
+    SetConfig(config);
+}
+
+void FrameTimeStats::SetConfig(const FrameTimeStatsConfig& config) {
+    m_config = config;
+    m_config.windowSize = std::max(m_config.windowSize, 1u);
+    m_config.histogramBucketCount = std::max(m_config.histogramBucketCount, 1u);
+    if (m_config.histogramBucketMs <= 0.0f) {
+        m_config.histogramBucketMs = 1.0f;
+    }
+    Reset();
+}
+
+void FrameTimeStats::Reset() {
+    m_window.clear();
+    m_windowSum = 0.0;
+    m_histogram.assign(m_config.histogramBucketCount, 0);
+    m_frameIndex = 0;
+    m_hitchCount = 0;
+    m_recentHitches.clear();
+}
+
+bool FrameTimeStats::AddFrame(float32 frameTimeMs, const ProfileFrame* profile) {
+    frameTimeMs = std::max(frameTimeMs, 0.0f);
+    uint64 frameIndex = m_frameIndex++;
+
+    // Compare against the window before this frame joins it
+    float32 thresholdMs = m_config.hitchThresholdMs;
+    if (m_config.hitchAverageRatio > 0.0f && !m_window.empty()) {
+        float32 averageMs = static_cast<float32>(m_windowSum / static_cast<double>(m_window.size()));
+        if (averageMs > 0.0f) {
+            thresholdMs = std::min(thresholdMs, averageMs * m_config.hitchAverageRatio);
+        }
+    }
+    bool hitch = frameTimeMs >= thresholdMs;
+
+    if (m_window.size() >= m_config.windowSize) {
+        float32 oldest = m_window.front();
+        m_window.pop_front();
+        m_windowSum -= oldest;
+        --m_histogram[GetBucket(oldest)];
+    }
+    m_window.push_back(frameTimeMs);
+    m_windowSum += frameTimeMs;
+    ++m_histogram[GetBucket(frameTimeMs)];
+
+    if (!hitch) {
+        return false;
+    }
+
+    FrameHitch record;
+    record.frameIndex = frameIndex;
+    record.frameTimeMs = frameTimeMs;
+    record.thresholdMs = thresholdMs;
+    if (profile) {
+        record.zone = FindSlowestZone(*profile, record.zoneSelfMs);
+    }
+
+    ++m_hitchCount;
+    m_recentHitches.push_back(record);
+    while (m_recentHitches.size() > m_config.hitchHistory) {
+        m_recentHitches.pop_front();
+    }
+    return true;
+}
+
+FrameTimeSummary FrameTimeStats::GetSummary() const {
+    FrameTimeSummary summary;
+    summary.frameCount = static_cast<uint32>(m_window.size());
+    if (m_window.empty()) {
+        return summary;
+    }
+
+    Vector<float32> sorted(m_window.begin(), m_window.end());
+    std::sort(sorted.begin(), sorted.end());
+
+    summary.averageMs = static_cast<float32>(m_windowSum / static_cast<double>(sorted.size()));
+    summary.p50Ms = sorted[NearestRank(50.0f, sorted.size())];
+    summary.p95Ms = sorted[NearestRank(95.0f, sorted.size())];
+    summary.p99Ms = sorted[NearestRank(99.0f, sorted.size())];
+    summary.maxMs = sorted.back();
+    return summary;
+}
+
+float32 FrameTimeStats::GetPercentile(float32 percentile) const {
+    if (m_window.empty()) {
+        return 0.0f;
+    }
+
+    Vector<float32> values(m_window.begin(), m_window.end());
+    size_t index = NearestRank(percentile, values.size());
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+String FrameTimeStats::FormatHistogram() const {
+    uint32 largest = 1;
+    for (uint32 count : m_histogram) {
+        largest = std::max(largest, count);
+    }
+
+    String text;
+    char line[128];
+    for (uint32 i = 0; i < m_histogram.size(); ++i) {
+        if (m_histogram[i] == 0) {
+            continue;
+        }
+
+        float32 begin = static_cast<float32>(i) * m_config.histogramBucketMs;
+        bool last = i + 1 == m_histogram.size();
+        if (last) {
+            std::snprintf(line, sizeof(line), "  %6.1f+      ms %6u ", begin, m_histogram[i]);
+        } else {
+            std::snprintf(line, sizeof(line), "  %6.1f-%-6.1f ms %6u ", begin, begin + m_config.histogramBucketMs, m_histogram[i]);
+        }
+        text += line;
+        text.append(static_cast<size_t>(m_histogram[i]) * 40 / largest, '#');
+        text += "\n";
+    }
+    return text;
+}
+
+const char* FrameTimeStats::FindSlowestZone(const ProfileFrame& profile, float32& outSelfMs) {
+    outSelfMs = 0.0f;
+
+    const ProfileThreadFrame* slowestThread = nullptr;
+    uint64 slowestThreadTicks = 0;
+    for (const ProfileThreadFrame& thread : profile.threads) {
+        uint64 ticks = 0;
+        for (const ProfileNode& node : thread.nodes) {
+            if (node.parent == ProfileNode::NO_PARENT) {
+                ticks += node.totalTicks;
+            }
+        }
+        if (!slowestThread || ticks > slowestThreadTicks) {
+            slowestThread = &thread;
+            slowestThreadTicks = ticks;
+        }
+    }
+    if (!slowestThread) {
+        return nullptr;
+    }
+
+    const ProfileNode* slowest = nullptr;
+    for (const ProfileNode& node : slowestThread->nodes) {
+        if (!slowest || node.selfTicks > slowest->selfTicks) {
+            slowest = &node;
+        }
+    }
+    if (!slowest) {
+        return nullptr;
+    }
+
+    outSelfMs = static_cast<float32>(Profiler::GetGlobal().TicksToMicroseconds(slowest->selfTicks) / 1000.0);
+    return slowest->name;
+}
+
+uint32 FrameTimeStats::GetBucket(float32 frameTimeMs) const {
+    uint32 bucket = static_cast<uint32>(frameTimeMs / m_config.histogramBucketMs);
+    return std::min(bucket, m_config.histogramBucketCount - 1);
+}
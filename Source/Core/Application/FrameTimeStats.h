@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../../Core/Utilities/Types.h"
+#include <deque>
+
+struct ProfileFrame;
+
+struct FrameTimeStatsConfig {
+    uint32 windowSize = 600;            // Frames kept for percentiles and the histogram
+    float32 hitchThresholdMs = 50.0f;   // A frame at least this long is a hitch...
+    float32 hitchAverageRatio = 3.0f;   // ...as is one this many times the window average (0 disables)
+    float32 histogramBucketMs = 2.0f;
+    uint32 histogramBucketCount = 32;   // The last bucket also takes everything longer
+    uint32 hitchHistory = 32;           // Recent hitches kept for inspection
+};
+
+struct FrameTimeSummary {
+    uint32 frameCount = 0;
+    float32 averageMs = 0.0f;
+    float32 p50Ms = 0.0f;
+    float32 p95Ms = 0.0f;
+    float32 p99Ms = 0.0f;
+    float32 maxMs = 0.0f;
+};
+
+struct FrameHitch {
+    uint64 frameIndex = 0;
+    float32 frameTimeMs = 0.0f;
+    float32 thresholdMs = 0.0f;
+    const char* zone = nullptr;         // Profiler zone with the most self time, if profiled
+    float32 zoneSelfMs = 0.0f;
+};
+
+// Rolling window of frame times. Percentiles use the nearest-rank method over the
+// window; the histogram is kept up to date as frames enter and leave it. Hitches
+// are counted over the whole run and, when the frame was profiled, attributed to
+// the zone that spent the most time itself.
+class FrameTimeStats {
+public:
+    explicit FrameTimeStats(const FrameTimeStatsConfig& config = {});
+    ~FrameTimeStats() = default;
+
+    void SetConfig(const FrameTimeStatsConfig& config);
+    const FrameTimeStatsConfig& GetConfig() const { return m_config; }
+    void Reset();
+
+    // Returns true if the frame was a hitch. profile (optional) is the same frame's profile.
+    bool AddFrame(float32 frameTimeMs, const ProfileFrame* profile = nullptr);
+
+    FrameTimeSummary GetSummary() const;
+    float32 GetPercentile(float32 percentile) const;
+
+    // Frames per bucket over the window; bucket i covers [i, i + 1) * histogramBucketMs
+    const Vector<uint32>& GetHistogram() const { return m_histogram; }
+    String FormatHistogram() const;
+
+    uint64 GetFrameCount() const { return m_frameIndex; }
+    uint64 GetHitchCount() const { return m_hitchCount; }
+    const std::deque<FrameHitch>& GetRecentHitches() const { return m_recentHitches; }
+
+    // Zone that spent the most time itself on the thread with the longest top-level
+    // zones (the one the frame waited on); nullptr if none. Timed by the global profiler.
+    static const char* FindSlowestZone(const ProfileFrame& profile, float32& outSelfMs);
+
+private:
+    uint32 GetBucket(float32 frameTimeMs) const;
+
+private:
+    FrameTimeStatsConfig m_config;
+    std::deque<float32> m_window;
+    double m_windowSum = 0.0;
+    Vector<uint32> m_histogram;
+
+    uint64 m_frameIndex = 0;
+    uint64 m_hitchCount = 0;
+    std::deque<FrameHitch> m_recentHitches;
+};
@@ -1,5 +1,7 @@
 #include "Timer.h"
-#include "../../Platform/Windows/WindowsPlatform.h"
+#include "../Logging/Logger.h"
+#include "../Profiling/Profiler.h"
+#include <chrono>
 
 // Static members
 int64 Timer::s_frequency = 0;
@@ -40,6 +42,11 @@ void Timer::Reset() {
     m_frameCount = 0;
     m_fpsFrameCount = 0;
     m_fpsTimeElapsed = 0.0f;
+    m_frameStats.Reset();
+
+    // Profiler frames that ended before the reset belong to no timed frame
+    const ProfileFrame* lastFrame = Profiler::IsEnabled() ? Profiler::GetGlobal().GetLastFrame() : nullptr;
+    m_lastProfileFrame = lastFrame ? lastFrame->frameIndex : ~0ull;
 }
 
 void Timer::Tick() {
@@ -67,6 +74,7 @@ void Timer::Tick() {
 
     // Update FPS
     UpdateFPS();
+    UpdateFrameStats();
 
     // Update previous time
     m_prevTime = m_currTime;
@@ -84,17 +92,40 @@ void Timer::UpdateFPS() {
     }
 }
 
+void Timer::UpdateFrameStats() {
+    // The main loop ends the profiler frame before the next Tick, so the last profiled
+    // frame is the one just measured; skip it if nothing was profiled since
+    const ProfileFrame* profile = nullptr;
+    if (Profiler::IsEnabled()) {
+        const ProfileFrame* lastFrame = Profiler::GetGlobal().GetLastFrame();
+        if (lastFrame && lastFrame->frameIndex != m_lastProfileFrame) {
+            profile = lastFrame;
+            m_lastProfileFrame = lastFrame->frameIndex;
+        }
+    }
+
+    if (!m_frameStats.AddFrame(m_deltaTime * 1000.0f, profile)) {
+        return;
+    }
+
+    const FrameHitch& hitch = m_frameStats.GetRecentHitches().back();
+    if (hitch.zone) {
+        LOG_WARNING("Timer: Hitch of {} ms on frame {} (threshold {} ms), slowest zone {} ({} ms self)",
+                    hitch.frameTimeMs, hitch.frameIndex, hitch.thresholdMs, hitch.zone, hitch.zoneSelfMs);
+    } else {
+        LOG_WARNING("Timer: Hitch of {} ms on frame {} (threshold {} ms)",
+                    hitch.frameTimeMs, hitch.frameIndex, hitch.thresholdMs);
+    }
+}
+
 int64 Timer::GetPerformanceCounter() {
-    LARGE_INTEGER counter;
-    QueryPerformanceCounter(&counter);
-    return counter.QuadPart;
+    return std::chrono::steady_clock::now().time_since_epoch().count();
 }
 
 void Timer::InitializeFrequency() {
     if (!s_frequencyInitialized) {
-        LARGE_INTEGER frequency;
-        QueryPerformanceFrequency(&frequency);
-        s_frequency = frequency.QuadPart;
+        using Period = std::chrono::steady_clock::period;
+        s_frequency = static_cast<int64>(Period::den / Period::num);
         s_frequencyInitialized = true;
     }
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
 #include "../../Core/Utilities/Types.h"
+#include "FrameTimeStats.h"
 
+// Frame timer on std::chrono::steady_clock. Every Tick also feeds the frame time
+// into a rolling FrameTimeStats window; hitches are logged with the profiler zone
+// that took the most time in that frame, when the frame was profiled.
 class Timer {
 public:
     Timer();
@@ -18,12 +22,17 @@ public:
     uint64 GetFrameCount() const { return m_frameCount; }
     float32 GetFPS() const { return m_fps; }
 
+    // Percentiles, histogram and hitches over the last frames
+    const FrameTimeStats& GetFrameStats() const { return m_frameStats; }
+    FrameTimeStats& GetFrameStats() { return m_frameStats; }
+
     // State queries
     bool IsRunning() const { return !m_stopped; }
     bool IsStopped() const { return m_stopped; }
 
 private:
     void UpdateFPS();
+    void UpdateFrameStats();
 
 private:
     // Time tracking
@@ -43,14 +52,18 @@ private:
     uint32 m_fpsFrameCount = 0;
     float32 m_fpsTimeElapsed = 0.0f;
 
+    // Frame time statistics
+    FrameTimeStats m_frameStats;
+    uint64 m_lastProfileFrame = ~0ull;  // Profiler frame already attributed
+
     // Timer state
     bool m_stopped = false;
 
-    // Performance counter frequency
+    // Clock ticks per second
     static int64 s_frequency;
     static bool s_frequencyInitialized;
 
     // Helper methods
     static int64 GetPerformanceCounter();
     static void InitializeFrequency();
-};
\ No newline at end of file
+};
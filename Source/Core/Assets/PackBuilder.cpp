@@ -0,0 +1,174 @@
+#include "PackBuilder.h"
+#include "../Utilities/FileSystem.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    uint64 AlignUp(uint64 value, uint64 alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void WritePadding(std::ofstream& file, uint64 currentOffset, uint64 targetOffset) {
+        static const char zeros[256] = {};
+        while (currentOffset < targetOffset) {
+            uint64 chunk = std::min<uint64>(sizeof(zeros), targetOffset - currentOffset);
+            file.write(zeros, static_cast<std::streamsize>(chunk));
+            currentOffset += chunk;
+        }
+    }
+}
+
+bool PackBuilder::AddFile(const String& sourcePath, const String& packPath) {
+    Input input;
+    input.sourcePath = sourcePath;
+    input.packPath = PackFormat::NormalizePath(packPath);
+    input.pathHash = PackFormat::HashPath(input.packPath);
+
+    if (input.packPath.empty() || input.packPath.size() > UINT16_MAX) {
+        Platform::OutputDebugMessage("PackBuilder: Invalid pack path for " + sourcePath + "\n");
+        return false;
+    }
+
+    for (const Input& existing : m_inputs) {
+        if (existing.packPath == input.packPath) {
+            Platform::OutputDebugMessage("PackBuilder: Duplicate pack path " + input.packPath + "\n");
+            return false;
+        }
+    }
+
+    m_inputs.push_back(std::move(input));
+    return true;
+}
+
+bool PackBuilder::AddDirectory(const String& directoryPath, const String& packPrefix) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    if (!fs::is_directory(directoryPath, error)) {
+        Platform::OutputDebugMessage("PackBuilder: Not a directory: " + directoryPath + "\n");
+        return false;
+    }
+
+    // Collect first so the order does not depend on the directory iterator
+    Vector<fs::path> files;
+    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(directoryPath, error)) {
+        if (entry.is_regular_file()) {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    bool success = true;
+    for (const fs::path& file : files) {
+        String relative = fs::relative(file, directoryPath).generic_string();
+        String packPath = packPrefix.empty() ? relative : packPrefix + "/" + relative;
+        success &= AddFile(file.string(), packPath);
+    }
+
+    return success;
+}
+
+bool PackBuilder::Write(const String& outputPath, PackBuildStats* outStats) {
+    if (m_alignment == 0 || (m_alignment & (m_alignment - 1)) != 0) {
+        Platform::OutputDebugMessage("PackBuilder: Alignment must be a power of two\n");
+        return false;
+    }
+
+    if (!PackFormat::IsCompressionSupported(m_compression)) {
+        Platform::OutputDebugMessage(String("PackBuilder: Compression '") +
+                                     PackFormat::GetCompressionName(m_compression) + "' is not available in this build\n");
+        return false;
+    }
+
+    // Sort by hash so the reader can binary search; ties broken by path keep the output deterministic
+    std::sort(m_inputs.begin(), m_inputs.end(), [](const Input& a, const Input& b) {
+        return a.pathHash != b.pathHash ? a.pathHash < b.pathHash : a.packPath < b.packPath;
+    });
+
+    PackHeader header;
+    header.entryCount = static_cast<uint32>(m_inputs.size());
+    header.alignment = m_alignment;
+
+    Vector<PackTocEntry> toc(m_inputs.size());
+    String stringTable;
+    for (size_t i = 0; i < m_inputs.size(); ++i) {
+        toc[i].pathHash = m_inputs[i].pathHash;
+        toc[i].pathOffset = static_cast<uint32>(stringTable.size());
+        toc[i].pathLength = static_cast<uint16>(m_inputs[i].packPath.size());
+        stringTable += m_inputs[i].packPath;
+    }
+
+    header.tocOffset = sizeof(PackHeader);
+    header.stringTableOffset = header.tocOffset + toc.size() * sizeof(PackTocEntry);
+    header.stringTableSize = stringTable.size();
+    header.dataOffset = AlignUp(header.stringTableOffset + header.stringTableSize, m_alignment);
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        Platform::OutputDebugMessage("PackBuilder: Failed to create " + outputPath + "\n");
+        return false;
+    }
+
+    // Entry data first; the header and TOC are written once all offsets are known
+    PackBuildStats stats;
+    uint64 offset = header.dataOffset;
+    file.seekp(static_cast<std::streamoff>(offset));
+
+    Vector<uint8> source;
+    Vector<uint8> compressed;
+    for (size_t i = 0; i < m_inputs.size(); ++i) {
+        if (!FileSystem::ReadFile(m_inputs[i].sourcePath, source)) {
+            Platform::OutputDebugMessage("PackBuilder: Failed to read " + m_inputs[i].sourcePath + "\n");
+            return false;
+        }
+
+        PackCompression compression = m_compression;
+        const Vector<uint8>* stored = &source;
+        if (compression != PackCompression::None && !source.empty()) {
+            if (PackFormat::Compress(compression, source.data(), source.size(), compressed) &&
+                compressed.size() < source.size()) {
+                stored = &compressed;
+            } else {
+                // Incompressible data is cheaper to read raw
+                compression = PackCompression::None;
+            }
+        } else {
+            compression = PackCompression::None;
+        }
+
+        uint64 alignedOffset = AlignUp(offset, m_alignment);
+        WritePadding(file, offset, alignedOffset);
+        offset = alignedOffset;
+
+        toc[i].offset = offset;
+        toc[i].storedSize = stored->size();
+        toc[i].originalSize = source.size();
+        toc[i].compression = compression;
+
+        file.write(reinterpret_cast<const char*>(stored->data()), static_cast<std::streamsize>(stored->size()));
+        offset += stored->size();
+
+        stats.originalBytes += source.size();
+        stats.storedBytes += stored->size();
+        stats.compressedEntries += compression != PackCompression::None ? 1 : 0;
+    }
+    stats.entryCount = header.entryCount;
+
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(toc.data()), static_cast<std::streamsize>(toc.size() * sizeof(PackTocEntry)));
+    file.write(stringTable.data(), static_cast<std::streamsize>(stringTable.size()));
+    WritePadding(file, header.stringTableOffset + header.stringTableSize, header.dataOffset);
+
+    if (!file.good()) {
+        Platform::OutputDebugMessage("PackBuilder: Write error on " + outputPath + "\n");
+        return false;
+    }
+
+    if (outStats) {
+        *outStats = stats;
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "PackFormat.h"
+
+struct PackBuildStats {
+    uint32 entryCount = 0;
+    uint32 compressedEntries = 0;
+    uint64 originalBytes = 0;
+    uint64 storedBytes = 0;
+};
+
+// Offline writer for .pak archives (used by Tools/PackBuilder)
+class PackBuilder {
+public:
+    PackBuilder() = default;
+    ~PackBuilder() = default;
+
+    void SetCompression(PackCompression compression) { m_compression = compression; }
+    void SetAlignment(uint32 alignment) { m_alignment = alignment; }
+
+    // Add a single file under the given pack path, or every file below a directory
+    // (pack paths are relative to the directory, prefixed with packPrefix)
+    bool AddFile(const String& sourcePath, const String& packPath);
+    bool AddDirectory(const String& directoryPath, const String& packPrefix = String());
+
+    bool Write(const String& outputPath, PackBuildStats* outStats = nullptr);
+
+    uint32 GetEntryCount() const { return static_cast<uint32>(m_inputs.size()); }
+
+private:
+    struct Input {
+        String sourcePath;
+        String packPath;
+        uint64 pathHash = 0;
+    };
+
+private:
+    Vector<Input> m_inputs;
+    PackCompression m_compression = PackCompression::None;
+    uint32 m_alignment = PACK_DEFAULT_ALIGNMENT;
+
+    DECLARE_NON_COPYABLE(PackBuilder);
+};
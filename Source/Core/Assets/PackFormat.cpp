@@ -0,0 +1,126 @@
+#include "PackFormat.h"
+#include "../Utilities/Hash.h"
+#include <algorithm>
+#include <cctype>
+
+#ifdef PACK_HAS_LZ4
+#include <lz4.h>
+#endif
+
+#ifdef PACK_HAS_ZSTD
+#include <zstd.h>
+#endif
+
+namespace PackFormat {
+
+String NormalizePath(const String& path) {
+    String normalized;
+    normalized.reserve(path.size());
+
+    for (char c : path) {
+        normalized.push_back(c == '\\' ? '/' : static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+
+    while (normalized.rfind("./", 0) == 0) {
+        normalized.erase(0, 2);
+    }
+
+    return normalized;
+}
+
+uint64 HashPath(const String& normalizedPath) {
+    return HashString(normalizedPath);
+}
+
+const char* GetCompressionName(PackCompression compression) {
+    switch (compression) {
+        case PackCompression::None: return "none";
+        case PackCompression::LZ4:  return "lz4";
+        case PackCompression::Zstd: return "zstd";
+        default:                    return "unknown";
+    }
+}
+
+bool IsCompressionSupported(PackCompression compression) {
+    switch (compression) {
+        case PackCompression::None:
+            return true;
+#ifdef PACK_HAS_LZ4
+        case PackCompression::LZ4:
+            return true;
+#endif
+#ifdef PACK_HAS_ZSTD
+        case PackCompression::Zstd:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+bool Compress(PackCompression compression, const uint8* data, size_t size, Vector<uint8>& outData) {
+    switch (compression) {
+        case PackCompression::None:
+            outData.assign(data, data + size);
+            return true;
+
+#ifdef PACK_HAS_LZ4
+        case PackCompression::LZ4: {
+            outData.resize(static_cast<size_t>(LZ4_compressBound(static_cast<int>(size))));
+            int written = LZ4_compress_default(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(outData.data()),
+                                               static_cast<int>(size), static_cast<int>(outData.size()));
+            if (written <= 0) {
+                return false;
+            }
+            outData.resize(static_cast<size_t>(written));
+            return true;
+        }
+#endif
+
+#ifdef PACK_HAS_ZSTD
+        case PackCompression::Zstd: {
+            outData.resize(ZSTD_compressBound(size));
+            size_t written = ZSTD_compress(outData.data(), outData.size(), data, size, 19);
+            if (ZSTD_isError(written)) {
+                return false;
+            }
+            outData.resize(written);
+            return true;
+        }
+#endif
+
+        default:
+            return false;
+    }
+}
+
+bool Decompress(PackCompression compression, const uint8* data, size_t size, uint8* outData, size_t originalSize) {
+    switch (compression) {
+        case PackCompression::None:
+            if (size != originalSize) {
+                return false;
+            }
+            std::copy(data, data + size, outData);
+            return true;
+
+#ifdef PACK_HAS_LZ4
+        case PackCompression::LZ4: {
+            int read = LZ4_decompress_safe(reinterpret_cast<const char*>(data), reinterpret_cast<char*>(outData),
+                                           static_cast<int>(size), static_cast<int>(originalSize));
+            return read >= 0 && static_cast<size_t>(read) == originalSize;
+        }
+#endif
+
+#ifdef PACK_HAS_ZSTD
+        case PackCompression::Zstd: {
+            size_t read = ZSTD_decompress(outData, originalSize, data, size);
+            return !ZSTD_isError(read) && read == originalSize;
+        }
+#endif
+
+        default:
+            return false;
+    }
+}
+
+} // namespace PackFormat
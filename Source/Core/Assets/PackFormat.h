@@ -0,0 +1,65 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+
+// On-disk layout of a .pak archive (little endian):
+//
+//   PackHeader
+//   PackTocEntry[entryCount]   sorted by (pathHash, path)
+//   string table               entry paths, not null terminated
+//   entry data                 each entry starts on a header.alignment boundary
+//
+// Entry paths are normalized with PackFormat::NormalizePath before hashing.
+
+constexpr uint32 PACK_MAGIC = 0x4B415052; // "RPAK"
+constexpr uint16 PACK_VERSION = 1;
+constexpr uint32 PACK_DEFAULT_ALIGNMENT = 16;
+
+enum class PackCompression : uint8 {
+    None = 0,
+    LZ4 = 1,
+    Zstd = 2
+};
+
+#pragma pack(push, 1)
+struct PackHeader {
+    uint32 magic = PACK_MAGIC;
+    uint16 version = PACK_VERSION;
+    uint16 flags = 0;
+    uint32 entryCount = 0;
+    uint32 alignment = PACK_DEFAULT_ALIGNMENT;
+    uint64 tocOffset = 0;
+    uint64 stringTableOffset = 0;
+    uint64 stringTableSize = 0;
+    uint64 dataOffset = 0;
+    uint64 reserved[2] = {};
+};
+
+struct PackTocEntry {
+    uint64 pathHash = 0;      // HashString(normalized path)
+    uint64 offset = 0;        // From the start of the file
+    uint64 storedSize = 0;    // Bytes on disk
+    uint64 originalSize = 0;  // Bytes after decompression
+    uint32 pathOffset = 0;    // Into the string table
+    uint16 pathLength = 0;
+    PackCompression compression = PackCompression::None;
+    uint8 reserved = 0;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(PackHeader) == 64, "PackHeader layout changed");
+static_assert(sizeof(PackTocEntry) == 40, "PackTocEntry layout changed");
+
+namespace PackFormat {
+    // Forward slashes, lower case, no leading "./"
+    String NormalizePath(const String& path);
+
+    uint64 HashPath(const String& normalizedPath);
+
+    const char* GetCompressionName(PackCompression compression);
+
+    // Codec support depends on which libraries were found at build time
+    bool IsCompressionSupported(PackCompression compression);
+    bool Compress(PackCompression compression, const uint8* data, size_t size, Vector<uint8>& outData);
+    bool Decompress(PackCompression compression, const uint8* data, size_t size, uint8* outData, size_t originalSize);
+}
@@ -0,0 +1,140 @@
+#include "PackReader.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <cstring>
+
+bool PackReader::Open(const String& packPath) {
+    Close();
+
+    if (!m_file.Open(packPath)) {
+        Platform::OutputDebugMessage("PackReader: Failed to map " + packPath + "\n");
+        return false;
+    }
+
+    if (m_file.GetSize() < sizeof(PackHeader)) {
+        Platform::OutputDebugMessage("PackReader: File too small to be a pack: " + packPath + "\n");
+        m_file.Close();
+        return false;
+    }
+
+    m_header = reinterpret_cast<const PackHeader*>(m_file.GetData());
+    if (m_header->magic != PACK_MAGIC || m_header->version != PACK_VERSION) {
+        Platform::OutputDebugMessage("PackReader: Bad magic or unsupported version in " + packPath + "\n");
+        Close();
+        return false;
+    }
+
+    if (!ValidateLayout()) {
+        Platform::OutputDebugMessage("PackReader: Corrupt table of contents in " + packPath + "\n");
+        Close();
+        return false;
+    }
+
+    m_toc = reinterpret_cast<const PackTocEntry*>(m_file.GetData() + m_header->tocOffset);
+    m_strings = reinterpret_cast<const char*>(m_file.GetData() + m_header->stringTableOffset);
+    m_packPath = packPath;
+
+    Platform::OutputDebugMessage("PackReader: Mounted " + packPath + " (" +
+                                 std::to_string(m_header->entryCount) + " entries)\n");
+    return true;
+}
+
+void PackReader::Close() {
+    m_header = nullptr;
+    m_toc = nullptr;
+    m_strings = nullptr;
+    m_packPath.clear();
+    m_file.Close();
+}
+
+bool PackReader::ValidateLayout() const {
+    const uint64 fileSize = m_file.GetSize();
+    const uint64 tocSize = static_cast<uint64>(m_header->entryCount) * sizeof(PackTocEntry);
+
+    if (m_header->tocOffset > fileSize || tocSize > fileSize - m_header->tocOffset) {
+        return false;
+    }
+    if (m_header->stringTableOffset > fileSize || m_header->stringTableSize > fileSize - m_header->stringTableOffset) {
+        return false;
+    }
+
+    // Every entry must point inside the file and name a valid string
+    const PackTocEntry* toc = reinterpret_cast<const PackTocEntry*>(m_file.GetData() + m_header->tocOffset);
+    for (uint32 i = 0; i < m_header->entryCount; ++i) {
+        const PackTocEntry& entry = toc[i];
+        if (entry.offset > fileSize || entry.storedSize > fileSize - entry.offset) {
+            return false;
+        }
+        if (static_cast<uint64>(entry.pathOffset) + entry.pathLength > m_header->stringTableSize) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const PackTocEntry* PackReader::FindEntry(const String& path) const {
+    if (!IsOpen()) {
+        return nullptr;
+    }
+
+    const String normalized = PackFormat::NormalizePath(path);
+    const uint64 hash = PackFormat::HashPath(normalized);
+
+    const PackTocEntry* begin = m_toc;
+    const PackTocEntry* end = m_toc + m_header->entryCount;
+    const PackTocEntry* it = std::lower_bound(begin, end, hash,
+        [](const PackTocEntry& entry, uint64 value) { return entry.pathHash < value; });
+
+    // Walk the (rare) run of colliding hashes and compare the stored paths
+    for (; it != end && it->pathHash == hash; ++it) {
+        if (it->pathLength == normalized.size() &&
+            std::memcmp(m_strings + it->pathOffset, normalized.data(), normalized.size()) == 0) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+bool PackReader::ReadEntry(const String& path, Vector<uint8>& outData) const {
+    const PackTocEntry* entry = FindEntry(path);
+    return entry && ReadEntry(*entry, outData);
+}
+
+bool PackReader::ReadEntry(const PackTocEntry& entry, Vector<uint8>& outData) const {
+    if (!IsOpen()) {
+        return false;
+    }
+
+    if (!PackFormat::IsCompressionSupported(entry.compression)) {
+        Platform::OutputDebugMessage("PackReader: " + GetEntryPath(entry) + " uses unsupported compression '" +
+                                     PackFormat::GetCompressionName(entry.compression) + "'\n");
+        return false;
+    }
+
+    outData.resize(static_cast<size_t>(entry.originalSize));
+    const uint8* stored = m_file.GetData() + entry.offset;
+    if (!PackFormat::Decompress(entry.compression, stored, static_cast<size_t>(entry.storedSize),
+                                outData.data(), outData.size())) {
+        Platform::OutputDebugMessage("PackReader: Failed to decompress " + GetEntryPath(entry) + "\n");
+        outData.clear();
+        return false;
+    }
+
+    return true;
+}
+
+const uint8* PackReader::GetEntryData(const PackTocEntry& entry) const {
+    if (!IsOpen() || entry.compression != PackCompression::None) {
+        return nullptr;
+    }
+    return m_file.GetData() + entry.offset;
+}
+
+String PackReader::GetEntryPath(const PackTocEntry& entry) const {
+    if (!IsOpen()) {
+        return String();
+    }
+    return String(m_strings + entry.pathOffset, entry.pathLength);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "PackFormat.h"
+#include "../../Platform/MappedFile.h"
+
+// Memory-mapped, read-only view of a .pak archive.
+// Lookups binary-search the sorted table of contents; reads are thread-safe.
+class PackReader {
+public:
+    PackReader() = default;
+    ~PackReader() = default;
+
+    bool Open(const String& packPath);
+    void Close();
+
+    // Lookup (path is normalized internally)
+    const PackTocEntry* FindEntry(const String& path) const;
+    bool Contains(const String& path) const { return FindEntry(path) != nullptr; }
+
+    // Copy (and decompress) an entry
+    bool ReadEntry(const String& path, Vector<uint8>& outData) const;
+    bool ReadEntry(const PackTocEntry& entry, Vector<uint8>& outData) const;
+
+    // Zero-copy access to uncompressed entries; returns nullptr for compressed ones
+    const uint8* GetEntryData(const PackTocEntry& entry) const;
+
+    String GetEntryPath(const PackTocEntry& entry) const;
+
+    // Accessors
+    bool IsOpen() const { return m_header != nullptr; }
+    const String& GetPackPath() const { return m_packPath; }
+    uint32 GetEntryCount() const { return m_header ? m_header->entryCount : 0; }
+    const PackTocEntry* GetEntries() const { return m_toc; }
+
+private:
+    bool ValidateLayout() const;
+
+private:
+    String m_packPath;
+    MappedFile m_file;
+    const PackHeader* m_header = nullptr;
+    const PackTocEntry* m_toc = nullptr;
+    const char* m_strings = nullptr;
+
+    DECLARE_NON_COPYABLE(PackReader);
+};
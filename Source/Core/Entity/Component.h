@@ -5,6 +5,8 @@
 // Forward declarations
 class Entity;
 class DX12Renderer;
+class IRHIContext;
+struct RenderPacket;
 
 class Component {
 public:
@@ -17,6 +19,10 @@ public:
     virtual void EndPlay() {}
     virtual void Update(float deltaTime) {}
     virtual void Render(DX12Renderer* renderer) {}
+    virtual void Render(IRHIContext& context) {}
+
+    // Add what this component draws to a frame's packet (simulation thread)
+    virtual void BuildRenderPacket(RenderPacket& packet) const {}
 
     // Owner management
     Entity* GetOwner() const { return m_owner; }
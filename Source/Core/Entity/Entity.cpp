@@ -1,6 +1,6 @@
 #include "Entity.h"
 #include "Component.h"
-#include "../../Platform/Windows/WindowsPlatform.h"
+#include "../../Platform/Platform.h"
 
 Entity::Entity(EntityID id) : m_id(id) {
     if (id == 0) {
@@ -11,7 +11,7 @@ Entity::Entity(EntityID id) : m_id(id) {
 }
 
 Entity::~Entity() {
-    // Components are automatically destroyed by unique_ptr
+    // Components go back to their pools with m_components
 }
 
 void Entity::Update(float deltaTime) {
@@ -35,11 +35,45 @@ void Entity::Render(DX12Renderer* renderer) {
     }
 }
 
-void Entity::RegisterComponent(std::type_index type, UniquePtr<Component> component) {
-    m_components[type] = std::move(component);
+void Entity::Render(IRHIContext& context) {
+    if (!m_isActive) return;
+
+    for (auto& [type, component] : m_components) {
+        if (component && component->IsActive()) {
+            component->Render(context);
+        }
+    }
+}
+
+void Entity::BuildRenderPacket(RenderPacket& packet) const {
+    if (!m_isActive) return;
+
+    for (auto& [type, component] : m_components) {
+        if (component && component->IsActive()) {
+            component->BuildRenderPacket(packet);
+        }
+    }
+}
+
+void Entity::RegisterComponent(std::type_index type, PoolPtr<Component> component) {
+    m_components.push_back({ type, std::move(component) });
 }
 
 Component* Entity::GetComponentByType(std::type_index type) const {
-    auto it = m_components.find(type);
-    return (it != m_components.end()) ? it->second.get() : nullptr;
+    for (const ComponentEntry& entry : m_components) {
+        if (entry.type == type) {
+            return entry.component.get();
+        }
+    }
+    return nullptr;
+}
+
+bool Entity::UnregisterComponent(std::type_index type) {
+    for (auto it = m_components.begin(); it != m_components.end(); ++it) {
+        if (it->type == type) {
+            m_components.erase(it);
+            return true;
+        }
+    }
+    return false;
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
 #pragma once
 
 #include "../Utilities/Types.h"
+#include "../Memory/ObjectPool.h"
 #include <DirectXMath.h>
 #include <memory>
 #include <vector>
 #include <typeindex>
-#include <unordered_map>
 
 // Forward declarations
 class Component;
@@ -47,10 +47,13 @@ public:
     virtual void EndPlay() {}
     virtual void Update(float deltaTime);
     virtual void Render(class DX12Renderer* renderer);
+    virtual void Render(class IRHIContext& context);
+    virtual void BuildRenderPacket(struct RenderPacket& packet) const;
 
 protected:
-    void RegisterComponent(std::type_index type, UniquePtr<Component> component);
+    void RegisterComponent(std::type_index type, PoolPtr<Component> component);
     Component* GetComponentByType(std::type_index type) const;
+    bool UnregisterComponent(std::type_index type);
 
 private:
     EntityID m_id;
@@ -58,8 +61,13 @@ private:
     bool m_isActive = true;
     Scene* m_scene = nullptr;
 
-    // Component storage
-    std::unordered_map<std::type_index, UniquePtr<Component>> m_components;
+    // Component storage: a handful per entity, so a linear search beats a hash map.
+    // Components come from per-type pools and update in the order they were added.
+    struct ComponentEntry {
+        std::type_index type;
+        PoolPtr<Component> component;
+    };
+    Vector<ComponentEntry> m_components;
 
     DECLARE_NON_COPYABLE(Entity);
 };
@@ -72,12 +80,12 @@ T* Entity::AddComponent(Args&&... args) {
     std::type_index typeIndex(typeid(T));
 
     // Check if component already exists
-    if (m_components.find(typeIndex) != m_components.end()) {
-        return static_cast<T*>(m_components[typeIndex].get());
+    if (Component* existing = GetComponentByType(typeIndex)) {
+        return static_cast<T*>(existing);
     }
 
     // Create new component
-    auto component = std::make_unique<T>(std::forward<Args>(args)...);
+    PoolPtr<T> component = MakePooled<T>(MemoryTag::Components, std::forward<Args>(args)...);
     T* componentPtr = component.get();
 
     // Set owner
@@ -108,13 +116,5 @@ template<typename T>
 bool Entity::RemoveComponent() {
     static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-    std::type_index typeIndex(typeid(T));
-    auto it = m_components.find(typeIndex);
-
-    if (it != m_components.end()) {
-        m_components.erase(it);
-        return true;
-    }
-
-    return false;
+    return UnregisterComponent(std::type_index(typeid(T)));
 }
\ No newline at end of file
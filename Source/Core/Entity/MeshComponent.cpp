@@ -6,8 +6,15 @@
 #include "../../Rendering/RHI/DX12RHIContext.h"
 #include "../../Rendering/Material.h"
 #include "../../Rendering/Bindable/Texture.h"
+#include "../../Rendering/TextureStreamer.h"
 #include "../Scene/Scene.h"
+#include "../Scene/RenderPacket.h"
+#include "../Logging/Logger.h"
+#include "../Profiling/Profiler.h"
+#include "../Memory/FrameMemory.h"
+#include "../Threading/JobSystem.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
+#include <algorithm>
 
 MeshComponent::MeshComponent() {
     Platform::OutputDebugMessage("MeshComponent created\n");
@@ -19,96 +26,176 @@ void MeshComponent::Initialize() {
     Platform::OutputDebugMessage("MeshComponent initialized\n");
 }
 
-void MeshComponent::Render(DX12Renderer* renderer) {
-    if (!m_isVisible || !m_mesh || !renderer) return;
+void MeshComponent::Update(float deltaTime) {
+    // Pick up an asynchronously loaded mesh
+    if (!m_mesh && m_meshHandle.IsReady()) {
+        m_mesh = m_meshHandle.Get();
+        Platform::OutputDebugMessage("MeshComponent: Async mesh load finished\n");
+    }
 
-    TransformComponent* transform = GetTransformComponent();
-    if (!transform) return;
+    if (!m_textureApplied && m_textureHandle.IsValid()) {
+        ApplyLoadedTexture();
+    }
+}
+
+void MeshComponent::Render(DX12Renderer* renderer) {
+    if (!renderer) return;
 
     Entity* owner = GetOwner();
     if (!owner || !owner->GetScene()) return;
 
-    // Upload mesh data if needed
-    if (m_mesh->NeedsUpload()) {
-        m_mesh->UploadData(renderer);
+    // Same path as the render thread, without the packet
+    RenderDraw draw;
+    if (BuildDraw(draw, owner->GetScene()->GetInterpolationAlpha())) {
+        Draw(renderer, draw);
     }
+}
 
-    ID3D12GraphicsCommandList* commandList = renderer->GetCommandList();
+void MeshComponent::BuildRenderPacket(RenderPacket& packet) const {
+    RenderDraw& draw = packet.draws.emplace_back();
+    if (!BuildDraw(draw, packet.interpolationAlpha)) {
+        packet.draws.pop_back();
+    }
+}
 
-    uint32 objectIndex = renderer->AllocateObjectIndex();
+bool MeshComponent::BuildDraw(RenderDraw& draw, float interpolationAlpha) const {
+    if (!m_isVisible || !m_mesh) return false;
 
-    DirectX::XMMATRIX modelMatrix = transform->GetWorldMatrix();
-    renderer->UpdateModelConstants(modelMatrix, objectIndex);
-    
-    Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " assigned objectIndex=" + std::to_string(objectIndex) + "\n");
+    TransformComponent* transform = GetTransformComponent();
+    Entity* owner = GetOwner();
+    if (!transform || !owner) return false;
+
+    draw.mesh = m_mesh;
+    draw.entity = owner->GetID();
+
+    // Between simulation steps, drawn where the entity is at this frame's point in time
+    DirectX::XMMATRIX worldMatrix = transform->GetInterpolatedWorldMatrix(interpolationAlpha);
+    DirectX::XMStoreFloat4x4(&draw.world, worldMatrix);
+    ComputeWorldBounds(*m_mesh, worldMatrix, draw.boundsCenter, draw.boundsRadius);
 
-    // Choose appropriate rendering pipeline based on material
+    // Choose the pipeline and snapshot what it reads from the material, which the
+    // simulation may change while the render thread draws
     bool hasMaterial = m_material && m_material->IsValid();
-    bool hasTextures = hasMaterial && m_material->GetTexture("DiffuseTexture") != nullptr;
-    bool isEmissive = hasMaterial && (m_material->GetName().find("Light") != String::npos || 
+    SharedPtr<Texture> diffuseTexture = hasMaterial ? m_material->GetTexture(m_diffuseTextureParameter) : nullptr;
+    bool isEmissive = hasMaterial && (m_material->GetName().find("Light") != String::npos ||
                                      m_material->GetName().find("Emissive") != String::npos);
-    
+
     if (isEmissive) {
-        Platform::OutputDebugMessage("MeshComponent: Rendering with emissive material: " + m_material->GetName() + "\n");
-        
-        // Extract color from material and update material constants
-        DirectX::XMFLOAT4 materialColor;
-        if (m_material->GetParameter("Color", materialColor)) {
-            DirectX::XMFLOAT3 baseColor = {materialColor.x, materialColor.y, materialColor.z};
-            renderer->UpdateMaterialConstants(baseColor, objectIndex);
-            Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " objectIndex=" + std::to_string(objectIndex) + 
-                                        " updated emissive color: (" + 
-                                        std::to_string(baseColor.x) + ", " + 
-                                        std::to_string(baseColor.y) + ", " + 
-                                        std::to_string(baseColor.z) + ")\n");
-        } else {
-            // Default bright white for emissive if no color parameter
-            renderer->UpdateMaterialConstants({1.0f, 1.0f, 1.0f}, objectIndex);
-            Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " objectIndex=" + std::to_string(objectIndex) + 
-                                        " using default emissive white\n");
-        }
-        renderer->BindForEmissiveMeshRendering(commandList, objectIndex);
-    } else if (hasTextures) {
-        Platform::OutputDebugMessage("MeshComponent: Rendering with textured material: " + m_material->GetName() + "\n");
-        
-        // Use textured pipeline
-        renderer->BindForTexturedMeshRendering(commandList, objectIndex);
-        
-        // Bind material (textures and samplers) - SRV descriptor heap is now implemented
-        Platform::OutputDebugMessage("MeshComponent: Binding material with SRV descriptor heap\n");
-        DX12RHIContext rhiContext(renderer);
-        m_material->Bind(rhiContext);
+        draw.pipeline = RenderDrawPipeline::Emissive;
+    } else if (diffuseTexture) {
+        draw.pipeline = RenderDrawPipeline::Textured;
+        draw.diffuseTexture = std::move(diffuseTexture);
+        draw.diffuseTextureSlot = m_material->GetLayout().GetEntry(m_diffuseTextureParameter).textureSlot;
     } else {
-        // Use basic non-textured pipeline
-        if (hasMaterial) {
-            Platform::OutputDebugMessage("MeshComponent: Rendering with non-textured material: " + m_material->GetName() + "\n");
-            
-            // Extract color from material and update material constants
-            DirectX::XMFLOAT4 materialColor;
-            if (m_material->GetParameter("Color", materialColor)) {
-                DirectX::XMFLOAT3 baseColor = {materialColor.x, materialColor.y, materialColor.z};
-                renderer->UpdateMaterialConstants(baseColor, objectIndex);
-                Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " objectIndex=" + std::to_string(objectIndex) + 
-                                            " updated material color: (" + 
-                                            std::to_string(baseColor.x) + ", " + 
-                                            std::to_string(baseColor.y) + ", " + 
-                                            std::to_string(baseColor.z) + ")\n");
-            } else {
-                // Default white color if no color parameter found
-                renderer->UpdateMaterialConstants({1.0f, 1.0f, 1.0f}, objectIndex);
-                Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " objectIndex=" + std::to_string(objectIndex) + 
-                                            " using default white color\n");
+        draw.pipeline = RenderDrawPipeline::Basic;
+    }
+
+    DirectX::XMFLOAT4 materialColor;
+    if (hasMaterial && m_material->GetParameter(m_colorParameter, materialColor)) {
+        draw.color = { materialColor.x, materialColor.y, materialColor.z };
+    } else {
+        // White for materials without a color, gray for meshes without a material
+        draw.color = hasMaterial ? DirectX::XMFLOAT3{ 1.0f, 1.0f, 1.0f } : DirectX::XMFLOAT3{ 0.7f, 0.7f, 0.7f };
+    }
+
+    // Changed parameters reach the material's constant slot here, on the thread that sets them
+    if (hasMaterial) {
+        m_material->UpdateParameters();
+    }
+    return true;
+}
+
+void MeshComponent::Draw(DX12Renderer* renderer, const RenderDraw& draw) {
+    if (!renderer || !draw.mesh) return;
+
+    uint32 objectIndex = PrepareDraw(renderer, draw);
+    DX12RHIContext rhiContext(renderer);
+    RecordDraw(renderer, rhiContext, draw, objectIndex);
+}
+
+void MeshComponent::DrawAll(DX12Renderer* renderer, const Vector<RenderDraw>& draws, JobSystem& jobSystem) {
+    if (!renderer || draws.empty()) return;
+    PROFILE_SCOPE("MeshComponent::DrawAll");
+
+    // Object indices, uploads and streaming requests are renderer state, so they are
+    // settled here before any worker records
+    ScratchScope scratch;
+    uint32 drawCount = static_cast<uint32>(draws.size());
+    uint32* objectIndices = scratch.Allocate<uint32>(drawCount);
+    for (uint32 i = 0; i < drawCount; ++i) {
+        objectIndices[i] = draws[i].mesh ? PrepareDraw(renderer, draws[i]) : 0;
+    }
+
+    // Too few draws to pay for another submission: record on the main list
+    uint32 minDrawsPerContext = renderer->GetConfig().minDrawsPerRecordingContext;
+    if (JobSystem::GetPartitionCount(drawCount, jobSystem.GetWorkerCount() + 1, minDrawsPerContext) <= 1) {
+        DX12RHIContext rhiContext(renderer);
+        for (uint32 i = 0; i < drawCount; ++i) {
+            if (draws[i].mesh) {
+                RecordDraw(renderer, rhiContext, draws[i], objectIndices[i]);
             }
-        } else {
-            Platform::OutputDebugMessage("MeshComponent: " + owner->GetName() + " objectIndex=" + std::to_string(objectIndex) + 
-                                        " rendering without material\n");
-            // Default gray color for objects without material
-            renderer->UpdateMaterialConstants({0.7f, 0.7f, 0.7f}, objectIndex);
         }
-        renderer->BindForMeshRendering(commandList, objectIndex);
+        return;
+    }
+
+    renderer->GetRHIContextPool().RecordParallel(jobSystem, drawCount, minDrawsPerContext,
+        [renderer, &draws, objectIndices](IRHIContext& context, JobRange range) {
+            PROFILE_SCOPE("MeshComponent::RecordDraws");
+            DX12RHIContext& rhiContext = static_cast<DX12RHIContext&>(context);
+            for (uint32 i = range.begin; i < range.end; ++i) {
+                if (draws[i].mesh) {
+                    RecordDraw(renderer, rhiContext, draws[i], objectIndices[i]);
+                }
+            }
+        });
+}
+
+uint32 MeshComponent::PrepareDraw(DX12Renderer* renderer, const RenderDraw& draw) {
+    // Upload mesh data if needed
+    if (draw.mesh->NeedsUpload()) {
+        draw.mesh->UploadData(renderer);
+    }
+
+    uint32 objectIndex = renderer->AllocateObjectIndex();
+
+    DirectX::XMMATRIX modelMatrix = DirectX::XMLoadFloat4x4(&draw.world);
+    renderer->UpdateModelConstants(modelMatrix, objectIndex);
+
+    LOG_TRACE("MeshComponent: Entity {} assigned objectIndex={}", draw.entity, objectIndex);
+
+    if (draw.pipeline == RenderDrawPipeline::Textured) {
+        RequestTextureDetail(renderer, draw);
+    } else {
+        LOG_TRACE("MeshComponent: Entity {} objectIndex={} color: ({}, {}, {})",
+                  draw.entity, objectIndex, draw.color.x, draw.color.y, draw.color.z);
+        renderer->UpdateMaterialConstants(draw.color, objectIndex);
+    }
+    return objectIndex;
+}
+
+void MeshComponent::RecordDraw(DX12Renderer* renderer, DX12RHIContext& context, const RenderDraw& draw, uint32 objectIndex) {
+    ID3D12GraphicsCommandList* commandList = context.GetCommandList();
+
+    switch (draw.pipeline) {
+        case RenderDrawPipeline::Emissive:
+            renderer->BindForEmissiveMeshRendering(commandList, objectIndex);
+            break;
+
+        case RenderDrawPipeline::Textured:
+            LOG_TRACE("MeshComponent: Entity {} objectIndex={} textured, slot {}",
+                      draw.entity, objectIndex, draw.diffuseTextureSlot);
+
+            // Use textured pipeline, then bind the diffuse texture where the material would
+            renderer->BindForTexturedMeshRendering(commandList, objectIndex);
+            draw.diffuseTexture->Bind(context, draw.diffuseTextureSlot);
+            break;
+
+        default:
+            renderer->BindForMeshRendering(commandList, objectIndex);
+            break;
     }
 
-    m_mesh->Draw(commandList);
+    draw.mesh->Draw(commandList);
 }
 
 void MeshComponent::Render(IRHIContext& context) {
@@ -128,11 +215,12 @@ void MeshComponent::Render(IRHIContext& context) {
     // TODO: Update constant buffers for transform
     // This will need to be implemented when ShaderManager is updated
     
-    // Draw using RHI context
-    context.DrawIndexed(m_mesh->GetIndexCount());
+    // Draw every submesh using RHI context
+    m_mesh->Draw(context);
 }
 
 void MeshComponent::SetMesh(SharedPtr<Mesh> mesh) {
+    m_meshHandle.Reset();
     m_mesh = mesh;
     Platform::OutputDebugMessage("MeshComponent: Mesh set\n");
 }
@@ -145,10 +233,12 @@ bool MeshComponent::CreateCube(DX12Renderer* renderer) {
 
     Platform::OutputDebugMessage("MeshComponent: Creating cube mesh...\n");
 
-    m_mesh = std::make_shared<Mesh>();
-    if (!m_mesh->CreateCube(renderer)) {
+    // Every cube shares one mesh owned by the AssetManager
+    m_meshHandle = renderer->GetAssetManager().CreateCube();
+    m_mesh = m_meshHandle.Get();
+    if (!m_mesh) {
         Platform::OutputDebugMessage("MeshComponent: Failed to create cube mesh\n");
-        m_mesh.reset();
+        m_meshHandle.Reset();
         return false;
     }
 
@@ -164,10 +254,11 @@ bool MeshComponent::CreateSphere(DX12Renderer* renderer, uint32 stacks, uint32 s
 
     Platform::OutputDebugMessage("MeshComponent: Creating sphere mesh...\n");
 
-    m_mesh = std::make_shared<Mesh>();
-    if (!m_mesh->CreateSphere(renderer, stacks, slices)) {
+    m_meshHandle = renderer->GetAssetManager().CreateSphere(stacks, slices);
+    m_mesh = m_meshHandle.Get();
+    if (!m_mesh) {
         Platform::OutputDebugMessage("MeshComponent: Failed to create sphere mesh\n");
-        m_mesh.reset();
+        m_meshHandle.Reset();
         return false;
     }
 
@@ -183,22 +274,44 @@ bool MeshComponent::LoadFromFile(DX12Renderer* renderer, const String& filePath)
 
     Platform::OutputDebugMessage("MeshComponent: Loading mesh from file: " + filePath + "\n");
 
-    m_mesh = std::make_shared<Mesh>();
-    if (!m_mesh->LoadFromFile(filePath, renderer)) {
+    AssetManager& assetManager = renderer->GetAssetManager();
+    m_meshHandle = assetManager.LoadMesh(filePath);
+    if (!assetManager.Wait(m_meshHandle)) {
         Platform::OutputDebugMessage("MeshComponent: Failed to load mesh from file: " + filePath + "\n");
+        m_meshHandle.Reset();
         m_mesh.reset();
         return false;
     }
+    m_mesh = m_meshHandle.Get();
 
     Platform::OutputDebugMessage("MeshComponent: Mesh loaded successfully from file\n");
     return true;
 }
 
+bool MeshComponent::LoadFromFileAsync(DX12Renderer* renderer, const String& filePath) {
+    if (!renderer) {
+        Platform::OutputDebugMessage("MeshComponent: Invalid renderer for file loading\n");
+        return false;
+    }
+
+    Platform::OutputDebugMessage("MeshComponent: Loading mesh asynchronously from file: " + filePath + "\n");
+
+    m_mesh.reset();
+    m_meshHandle = renderer->GetAssetManager().LoadMesh(filePath);
+    return m_meshHandle.IsValid();
+}
+
 void MeshComponent::SetMaterial(SharedPtr<Material> material) {
     m_material = material;
+    ResolveMaterialParameters();
     Platform::OutputDebugMessage("MeshComponent: Material set\n");
 }
 
+void MeshComponent::ResolveMaterialParameters() {
+    m_colorParameter = m_material ? m_material->FindParameterId("Color") : INVALID_MATERIAL_PARAMETER;
+    m_diffuseTextureParameter = m_material ? m_material->FindParameterId("DiffuseTexture") : INVALID_MATERIAL_PARAMETER;
+}
+
 void MeshComponent::SetTexture(const String& texturePath, DX12Renderer* renderer) {
     if (!renderer) {
         Platform::OutputDebugMessage("MeshComponent: Invalid renderer for texture loading\n");
@@ -207,28 +320,37 @@ void MeshComponent::SetTexture(const String& texturePath, DX12Renderer* renderer
     
     Platform::OutputDebugMessage("MeshComponent: Loading texture from: " + texturePath + "\n");
     
+    // Repeated paths resolve to the same cached texture
+    m_textureHandle = renderer->GetAssetManager().LoadTexture(texturePath);
+    m_textureRenderer = renderer;
+    m_textureApplied = false;
+    ApplyLoadedTexture();
+}
+
+void MeshComponent::ApplyLoadedTexture() {
+    if (m_textureHandle.IsFailed()) {
+        Platform::OutputDebugMessage("MeshComponent: Failed to load texture\n");
+        m_textureHandle.Reset();
+        return;
+    }
+
+    SharedPtr<Texture> texture = m_textureHandle.Get();
+    if (!texture || !m_textureRenderer) {
+        return; // Still loading
+    }
+
     try {
-        // Create texture using the Texture factory method
-        auto texture = Texture::CreateFromFile(*renderer, texturePath, false, "MeshTexture");
-        
-        if (!texture || !texture->IsValid()) {
-            Platform::OutputDebugMessage("MeshComponent: Failed to load texture from: " + texturePath + "\n");
-            return;
-        }
-        
-        Platform::OutputDebugMessage("MeshComponent: Texture loaded successfully\n");
-        
         // If no material exists, create a default textured material
         if (!m_material) {
             Platform::OutputDebugMessage("MeshComponent: Creating new textured material\n");
-            m_material = Material::CreateTextured(*renderer, std::move(texture), "AutoGeneratedMaterial");
-            Platform::OutputDebugMessage("MeshComponent: Created new textured material\n");
+            m_material = Material::CreateTextured(*m_textureRenderer, texture, "AutoGeneratedMaterial");
+            ResolveMaterialParameters();
         } else {
             // Set texture on existing material
             Platform::OutputDebugMessage("MeshComponent: Applying texture to existing material\n");
-            m_material->SetTexture("DiffuseTexture", std::move(texture));
-            Platform::OutputDebugMessage("MeshComponent: Applied texture to existing material\n");
+            m_material->SetTexture("DiffuseTexture", texture);
         }
+        m_textureApplied = true;
     } catch (const std::exception& e) {
         Platform::OutputDebugMessage("MeshComponent: Exception in SetTexture: " + String(e.what()) + "\n");
     } catch (...) {
@@ -236,6 +358,37 @@ void MeshComponent::SetTexture(const String& texturePath, DX12Renderer* renderer
     }
 }
 
+bool MeshComponent::GetWorldBounds(DirectX::XMFLOAT3& outCenter, float& outRadius) const {
+    TransformComponent* transform = GetTransformComponent();
+    if (!m_mesh || !transform) {
+        return false;
+    }
+
+    ComputeWorldBounds(*m_mesh, transform->GetWorldMatrix(), outCenter, outRadius);
+    return true;
+}
+
+void MeshComponent::ComputeWorldBounds(const Mesh& mesh, const DirectX::XMMATRIX& worldMatrix,
+                                       DirectX::XMFLOAT3& outCenter, float& outRadius) {
+    DirectX::XMStoreFloat3(&outCenter, DirectX::XMVector3Transform(DirectX::XMLoadFloat3(&mesh.GetBoundsCenter()), worldMatrix));
+
+    float maxScale = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+        maxScale = std::max(maxScale, DirectX::XMVectorGetX(DirectX::XMVector3Length(worldMatrix.r[axis])));
+    }
+    outRadius = mesh.GetBoundsRadius() * maxScale;
+}
+
+void MeshComponent::RequestTextureDetail(DX12Renderer* renderer, const RenderDraw& draw) {
+    TextureStreamer* streamer = renderer->GetTextureStreamer();
+    Texture* texture = draw.diffuseTexture.get();
+    if (!streamer || !texture || !texture->IsStreaming()) {
+        return;
+    }
+
+    streamer->RequestMip(texture, draw.boundsCenter, draw.boundsRadius);
+}
+
 TransformComponent* MeshComponent::GetTransformComponent() const {
     if (m_cachedTransform) {
         return m_cachedTransform;
@@ -2,10 +2,14 @@
 
 #include "Component.h"
 #include "../../Rendering/Mesh.h"
+#include "../../Rendering/AssetManager.h"
+#include "../../Rendering/MaterialLayout.h"
 #include <memory>
 
 // Forward declarations
 class DX12Renderer;
+class DX12RHIContext;
+class JobSystem;
 class TransformComponent;
 
 class MeshComponent : public Component {
@@ -15,8 +19,22 @@ public:
 
     // Component lifecycle
     void Initialize() override;
+    void Update(float deltaTime) override;
     void Render(DX12Renderer* renderer) override;
-    void Render(class IRHIContext& context);
+    void Render(class IRHIContext& context) override;
+    void BuildRenderPacket(struct RenderPacket& packet) const override;
+
+    // Draw one packet entry on the main command list; called on the render thread, reads
+    // nothing but the draw
+    static void Draw(DX12Renderer* renderer, const struct RenderDraw& draw);
+
+    // Draw a packet's entries in order, split across the renderer's worker command lists
+    // once there are RendererConfig::minDrawsPerRecordingContext per list. Constants and
+    // uploads are written on the calling render thread first; workers only bind and draw.
+    static void DrawAll(DX12Renderer* renderer, const Vector<struct RenderDraw>& draws, JobSystem& jobSystem);
+
+    // World-space bounding sphere of the mesh at the current transform; false without one
+    bool GetWorldBounds(DirectX::XMFLOAT3& outCenter, float& outRadius) const;
 
     // Mesh management
     void SetMesh(SharedPtr<Mesh> mesh);
@@ -28,7 +46,7 @@ public:
     SharedPtr<class Material> GetMaterial() const { return m_material; }
     bool HasMaterial() const { return m_material != nullptr; }
     
-    // Texture shortcuts
+    // Texture shortcuts (loaded through the renderer's AssetManager, applied once ready)
     void SetTexture(const String& texturePath, DX12Renderer* renderer);
 
     // Factory methods for common meshes
@@ -36,6 +54,10 @@ public:
     bool CreateSphere(DX12Renderer* renderer, uint32 stacks = 20, uint32 slices = 20);
     bool LoadFromFile(DX12Renderer* renderer, const String& filePath);
 
+    // Load through the AssetManager without blocking; the mesh is picked up in Update once ready
+    bool LoadFromFileAsync(DX12Renderer* renderer, const String& filePath);
+    bool IsLoading() const { return m_meshHandle.IsValid() && !m_meshHandle.IsReady() && !m_meshHandle.IsFailed(); }
+
     // Rendering properties
     bool IsVisible() const { return m_isVisible; }
     void SetVisible(bool visible) { m_isVisible = visible; }
@@ -51,10 +73,39 @@ public:
 private:
     SharedPtr<Mesh> m_mesh;
     SharedPtr<class Material> m_material;
+    MaterialParameterId m_colorParameter = INVALID_MATERIAL_PARAMETER;
+    MaterialParameterId m_diffuseTextureParameter = INVALID_MATERIAL_PARAMETER;
     bool m_isVisible = true;
     bool m_castsShadows = true;
     DirectX::XMFLOAT3 m_color = {1.0f, 1.0f, 1.0f}; // White by default
 
+    // Cached assets (the handles keep them resident in the AssetManager)
+    MeshHandle m_meshHandle;
+    TextureHandle m_textureHandle;
+    DX12Renderer* m_textureRenderer = nullptr;
+    bool m_textureApplied = false;
+
+    void ApplyLoadedTexture();
+
+    // Fill a packet entry from the current state; false if there is nothing to draw
+    bool BuildDraw(struct RenderDraw& draw, float interpolationAlpha) const;
+
+    // Resolve the parameters read per draw whenever the material changes
+    void ResolveMaterialParameters();
+
+    // Upload the mesh and write the draw's constants; returns the object index to bind
+    static uint32 PrepareDraw(DX12Renderer* renderer, const struct RenderDraw& draw);
+
+    // Bind a prepared draw's pipeline and constants and draw it; safe on worker lists
+    static void RecordDraw(DX12Renderer* renderer, DX12RHIContext& context, const struct RenderDraw& draw, uint32 objectIndex);
+
+    // Bounding sphere of mesh under world; the radius grows with the largest axis scale
+    static void ComputeWorldBounds(const Mesh& mesh, const DirectX::XMMATRIX& worldMatrix,
+                                   DirectX::XMFLOAT3& outCenter, float& outRadius);
+
+    // Report the diffuse texture's on-screen size to the TextureStreamer
+    static void RequestTextureDetail(DX12Renderer* renderer, const struct RenderDraw& draw);
+
     // Cached transform component for performance
     mutable TransformComponent* m_cachedTransform = nullptr;
     TransformComponent* GetTransformComponent() const;
@@ -1,5 +1,6 @@
 #include "TransformComponent.h"
 #include <cmath>
+#include <cstring>
 
 using namespace DirectX;
 
@@ -86,6 +87,37 @@ XMMATRIX TransformComponent::GetScaleMatrix() const {
     return XMMatrixScaling(m_scale.x, m_scale.y, m_scale.z);
 }
 
+void TransformComponent::SavePreviousState() {
+    m_previousPosition = m_position;
+    m_previousRotation = m_rotation;
+    m_previousScale = m_scale;
+    m_hasPreviousState = true;
+}
+
+void TransformComponent::ResetInterpolation() {
+    SavePreviousState();
+}
+
+XMMATRIX TransformComponent::GetInterpolatedWorldMatrix(float alpha) const {
+    // Objects that did not move this step keep using the cached matrix
+    bool moved = std::memcmp(&m_previousPosition, &m_position, sizeof(XMFLOAT3)) != 0 ||
+                 std::memcmp(&m_previousRotation, &m_rotation, sizeof(XMFLOAT3)) != 0 ||
+                 std::memcmp(&m_previousScale, &m_scale, sizeof(XMFLOAT3)) != 0;
+    if (!m_hasPreviousState || !moved || alpha >= 1.0f) {
+        return GetWorldMatrix();
+    }
+    alpha = alpha > 0.0f ? alpha : 0.0f;
+
+    // Euler angles wrap, so blend the orientations as quaternions
+    XMVECTOR rotation = XMQuaternionSlerp(
+        XMQuaternionRotationRollPitchYaw(m_previousRotation.x, m_previousRotation.y, m_previousRotation.z),
+        XMQuaternionRotationRollPitchYaw(m_rotation.x, m_rotation.y, m_rotation.z), alpha);
+    XMVECTOR position = XMVectorLerp(XMLoadFloat3(&m_previousPosition), XMLoadFloat3(&m_position), alpha);
+    XMVECTOR scale = XMVectorLerp(XMLoadFloat3(&m_previousScale), XMLoadFloat3(&m_scale), alpha);
+
+    return XMMatrixAffineTransformation(scale, XMVectorZero(), rotation, position);
+}
+
 XMFLOAT3 TransformComponent::GetForward() const {
     XMMATRIX rotMatrix = GetRotationMatrix();
     XMVECTOR forward = XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
@@ -37,6 +37,12 @@ public:
     DirectX::XMMATRIX GetRotationMatrix() const;
     DirectX::XMMATRIX GetScaleMatrix() const;
 
+    // Interpolation between simulation steps. SavePreviousState runs at the start of
+    // each fixed step; rendering then blends from that state to the current one.
+    void SavePreviousState();
+    void ResetInterpolation();  // Render the current state only (after teleports)
+    DirectX::XMMATRIX GetInterpolatedWorldMatrix(float alpha) const;
+
     // Direction vectors
     DirectX::XMFLOAT3 GetForward() const;
     DirectX::XMFLOAT3 GetRight() const;
@@ -47,6 +53,11 @@ private:
     DirectX::XMFLOAT3 m_rotation = {0.0f, 0.0f, 0.0f}; // Roll, Pitch, Yaw in radians
     DirectX::XMFLOAT3 m_scale = {1.0f, 1.0f, 1.0f};
     
+    DirectX::XMFLOAT3 m_previousPosition = {0.0f, 0.0f, 0.0f};
+    DirectX::XMFLOAT3 m_previousRotation = {0.0f, 0.0f, 0.0f};
+    DirectX::XMFLOAT3 m_previousScale = {1.0f, 1.0f, 1.0f};
+    bool m_hasPreviousState = false;    // Spawned since the last step: nothing to blend from
+
     mutable bool m_worldMatrixDirty = true;
     mutable DirectX::XMFLOAT4X4 m_cachedWorldMatrix;
 };
\ No newline at end of file
@@ -0,0 +1,329 @@
+#include "Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+    // How long the drain thread sleeps when the ring is empty. Producers only wake it
+    // once per half ring, so this bounds the delay before a message shows up.
+    constexpr auto DRAIN_INTERVAL = std::chrono::milliseconds(5);
+}
+
+Logger::Logger(uint32 capacity) {
+    uint32 slotCount = 2;
+    while (slotCount < capacity) {
+        slotCount <<= 1;
+    }
+
+    m_slots = Vector<Slot>(slotCount);
+    for (uint32 i = 0; i < slotCount; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_mask = slotCount - 1;
+
+    m_startCounter = Platform::GetPerformanceCounter();
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread(&Logger::DrainMain, this);
+}
+
+Logger::~Logger() {
+    Shutdown();
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+Logger& Logger::GetGlobal() {
+    static Logger* s_logger = []() {
+        Logger* logger = new Logger();
+        std::atexit([]() { GetGlobal().Shutdown(); });
+        return logger;
+    }();
+    return *s_logger;
+}
+
+void Logger::SetSinks(uint32 sinks) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    m_sinks = sinks;
+}
+
+bool Logger::OpenFile(const String& path) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (m_file) {
+        std::fclose(m_file);
+    }
+
+    m_file = std::fopen(path.c_str(), "w");
+    if (!m_file) {
+        Platform::OutputDebugMessage("Logger: Failed to open log file " + path + "\n");
+        m_sinks &= ~static_cast<uint32>(LogSink::File);
+        return false;
+    }
+    m_sinks |= LogSink::File;
+    return true;
+}
+
+void Logger::Flush() {
+    uint64 target = m_enqueuePosition.load(std::memory_order_acquire);
+
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    if (!m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+    m_flushRequested = true;
+    m_wakeCondition.notify_one();
+    m_drainedCondition.wait(lock, [this, target]() {
+        return m_drainedPosition.load(std::memory_order_acquire) >= target || !m_running.load(std::memory_order_acquire);
+    });
+}
+
+void Logger::Shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (!m_running.load(std::memory_order_acquire)) {
+            return;
+        }
+        // New messages go straight to the sinks from here on
+        m_running.store(false, std::memory_order_release);
+        m_stopRequested = true;
+    }
+    m_wakeCondition.notify_one();
+    m_drainedCondition.notify_all();
+    m_thread.join();
+
+    // Records committed while the thread was stopping
+    while (DrainOne()) {
+    }
+    ReportDropped();
+    FlushSinks();
+}
+
+LoggerStats Logger::GetStats() const {
+    LoggerStats stats;
+    stats.written = m_written.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* Logger::GetLevelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace:   return "Trace";
+        case LogLevel::Debug:   return "Debug";
+        case LogLevel::Info:    return "Info";
+        case LogLevel::Warning: return "Warning";
+        case LogLevel::Error:   return "Error";
+        default:                return "Off";
+    }
+}
+
+String Logger::FormatMessage(const char* format, const uint8* arguments, uint32 argumentCount) {
+    String text;
+    text.reserve(128);
+
+    const uint8* argument = arguments;
+    uint32 remaining = argumentCount;
+    for (const char* c = format; *c; ++c) {
+        // Placeholders without a matching argument are kept as written
+        if (c[0] == '{' && c[1] == '}' && remaining > 0) {
+            argument = AppendArgument(text, argument);
+            --remaining;
+            ++c;
+        } else {
+            text.push_back(*c);
+        }
+    }
+    return text;
+}
+
+const uint8* Logger::AppendArgument(String& text, const uint8* argument) {
+    ArgumentType type = static_cast<ArgumentType>(argument[0]);
+    const uint8* data = argument + 1;
+    char buffer[32];
+
+    switch (type) {
+        case ArgumentType::Bool:
+            text += data[0] ? "true" : "false";
+            return data + 1;
+        case ArgumentType::Int: {
+            int64 value;
+            std::memcpy(&value, data, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), "%lld", static_cast<long long>(value));
+            text += buffer;
+            return data + sizeof(value);
+        }
+        case ArgumentType::UInt: {
+            uint64 value;
+            std::memcpy(&value, data, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), "%llu", static_cast<unsigned long long>(value));
+            text += buffer;
+            return data + sizeof(value);
+        }
+        case ArgumentType::Float: {
+            double value;
+            std::memcpy(&value, data, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), "%g", value);
+            text += buffer;
+            return data + sizeof(value);
+        }
+        case ArgumentType::Pointer: {
+            uint64 value;
+            std::memcpy(&value, data, sizeof(value));
+            std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(value));
+            text += buffer;
+            return data + sizeof(value);
+        }
+        case ArgumentType::String:
+        default: {
+            uint16 length;
+            std::memcpy(&length, data, sizeof(length));
+            text.append(reinterpret_cast<const char*>(data + sizeof(length)), length);
+            return data + sizeof(length) + length;
+        }
+    }
+}
+
+void Logger::ArgumentWriter::WriteRaw(ArgumentType type, const void* data, uint32 size) {
+    if (m_full || m_record.payloadSize + 1 + size > sizeof(m_record.payload)) {
+        m_full = true;
+        return;
+    }
+
+    uint8* out = m_record.payload + m_record.payloadSize;
+    out[0] = static_cast<uint8>(type);
+    std::memcpy(out + 1, data, size);
+    m_record.payloadSize = static_cast<uint16>(m_record.payloadSize + 1 + size);
+    ++m_record.argumentCount;
+}
+
+void Logger::ArgumentWriter::WriteString(const char* text, size_t length) {
+    constexpr uint32 header = 1 + sizeof(uint16);
+    uint32 available = static_cast<uint32>(sizeof(m_record.payload)) - m_record.payloadSize;
+    if (m_full || available < header) {
+        m_full = true;
+        return;
+    }
+
+    // Long strings are cut to what is left of the record; later arguments are dropped
+    uint16 stored = static_cast<uint16>(std::min<size_t>(length, available - header));
+    uint8* out = m_record.payload + m_record.payloadSize;
+    out[0] = static_cast<uint8>(ArgumentType::String);
+    std::memcpy(out + 1, &stored, sizeof(stored));
+    std::memcpy(out + header, text, stored);
+    m_record.payloadSize = static_cast<uint16>(m_record.payloadSize + header + stored);
+    ++m_record.argumentCount;
+    m_full = stored < length;
+}
+
+Logger::Record* Logger::Claim(uint64& position) {
+    position = m_enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = m_slots[position & m_mask];
+        uint64 sequence = slot.sequence.load(std::memory_order_acquire);
+        int64 difference = static_cast<int64>(sequence) - static_cast<int64>(position);
+        if (difference == 0) {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return &slot.record;
+            }
+        } else if (difference < 0) {
+            // The drain thread has not released this slot yet: the ring is full
+            return nullptr;
+        } else {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::Commit(uint64 position) {
+    m_slots[position & m_mask].sequence.store(position + 1, std::memory_order_release);
+}
+
+void Logger::DrainMain() {
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    for (;;) {
+        bool stopping = m_stopRequested;
+        m_flushRequested = false;
+        lock.unlock();
+
+        bool drained = false;
+        while (DrainOne()) {
+            drained = true;
+        }
+        ReportDropped();
+        if (drained) {
+            FlushSinks();
+        }
+
+        lock.lock();
+        m_drainedPosition.store(m_dequeuePosition, std::memory_order_release);
+        m_drainedCondition.notify_all();
+        if (stopping) {
+            break;
+        }
+        if (!drained) {
+            m_wakeCondition.wait_for(lock, DRAIN_INTERVAL, [this]() {
+                return m_stopRequested || m_flushRequested || HasPending();
+            });
+        }
+    }
+}
+
+bool Logger::DrainOne() {
+    Slot& slot = m_slots[m_dequeuePosition & m_mask];
+    if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) {
+        return false;
+    }
+
+    Emit(slot.record);
+    slot.sequence.store(m_dequeuePosition + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePosition;
+    return true;
+}
+
+bool Logger::HasPending() const {
+    return m_slots[m_dequeuePosition & m_mask].sequence.load(std::memory_order_acquire) == m_dequeuePosition + 1;
+}
+
+void Logger::ReportDropped() {
+    uint64 dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_droppedReported) {
+        EmitLine("Logger: " + std::to_string(dropped - m_droppedReported) + " messages dropped, ring full\n");
+        m_droppedReported = dropped;
+    }
+}
+
+void Logger::FlushSinks() {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (m_sinks & LogSink::Stdout) {
+        std::fflush(stdout);
+    }
+    if ((m_sinks & LogSink::File) && m_file) {
+        std::fflush(m_file);
+    }
+}
+
+void Logger::Emit(const Record& record) {
+    double seconds = static_cast<double>(record.timestamp - m_startCounter) /
+                     static_cast<double>(Platform::GetPerformanceFrequency());
+    char prefix[48];
+    std::snprintf(prefix, sizeof(prefix), "[%9.3f %-7s] ", seconds, GetLevelName(record.level));
+
+    String line = prefix;
+    line += FormatMessage(record.format, record.payload, record.argumentCount);
+    line += '\n';
+    EmitLine(line);
+    m_written.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Logger::EmitLine(const String& line) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (m_sinks & LogSink::DebugOutput) {
+        Platform::OutputDebugMessage(line);
+    }
+    if (m_sinks & LogSink::Stdout) {
+        std::fputs(line.c_str(), stdout);
+    }
+    if ((m_sinks & LogSink::File) && m_file) {
+        std::fputs(line.c_str(), m_file);
+    }
+}
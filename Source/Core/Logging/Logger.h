@@ -0,0 +1,259 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include "../../Platform/Platform.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+enum class LogLevel : uint8 {
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Off
+};
+
+// Levels below this are compiled out entirely (their arguments are never evaluated).
+// Override per target with e.g. LOG_COMPILED_LEVEL=3 to keep only warnings and errors.
+#ifndef LOG_COMPILED_LEVEL
+    #if DEBUG_BUILD
+        #define LOG_COMPILED_LEVEL 0    // Trace
+    #else
+        #define LOG_COMPILED_LEVEL 2    // Info
+    #endif
+#endif
+
+// Where drained messages go; combine with |
+namespace LogSink {
+    enum : uint32 {
+        DebugOutput = BIT(0),   // Platform::OutputDebugMessage
+        Stdout      = BIT(1),
+        File        = BIT(2)    // see Logger::OpenFile
+    };
+}
+
+struct LoggerStats {
+    uint64 written = 0;     // Records drained to the sinks
+    uint64 dropped = 0;     // Records lost because the ring was full
+};
+
+// Asynchronous logger. Callers only claim a fixed-size record in a lock-free
+// multi-producer ring and copy the format pointer and raw arguments into it; the
+// text is built and written by a background thread. A full ring drops the record
+// (counted and reported) instead of blocking the caller.
+//
+// Format strings use {} placeholders and must outlive the logger (string literals);
+// string arguments are copied and truncated to fit the record.
+class Logger {
+public:
+    static constexpr uint32 RECORD_SIZE = 256;
+    static constexpr uint32 DEFAULT_CAPACITY = 4096;     // Records, power of two
+
+    explicit Logger(uint32 capacity = DEFAULT_CAPACITY);
+    ~Logger();
+
+    // Process-wide logger used by the LOG_* macros. Never destroyed, so logging from
+    // static destructors stays valid; it is drained and stopped at exit.
+    static Logger& GetGlobal();
+
+    void SetLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+    LogLevel GetLevel() const { return m_level.load(std::memory_order_relaxed); }
+    bool IsEnabled(LogLevel level) const { return level >= m_level.load(std::memory_order_relaxed); }
+
+    void SetSinks(uint32 sinks);
+    bool OpenFile(const String& path);
+
+    template<typename... Args>
+    void Write(LogLevel level, const char* format, const Args&... args);
+
+    // Block until everything logged before the call has been written
+    void Flush();
+
+    // Drain and stop the background thread; later messages are written synchronously
+    void Shutdown();
+
+    LoggerStats GetStats() const;
+
+    // Text of a drained record, without the level prefix (exposed for tests and tools)
+    static String FormatMessage(const char* format, const uint8* arguments, uint32 argumentCount);
+    static const char* GetLevelName(LogLevel level);
+
+private:
+    enum class ArgumentType : uint8 {
+        Bool,
+        Int,
+        UInt,
+        Float,
+        String,
+        Pointer
+    };
+
+    struct Record {
+        int64 timestamp;
+        const char* format;
+        LogLevel level;
+        uint8 argumentCount;
+        uint16 payloadSize;
+        uint8 payload[RECORD_SIZE - 20];
+    };
+    static_assert(sizeof(Record) == RECORD_SIZE, "Log record must fill its slot");
+
+    struct alignas(64) Slot {
+        std::atomic<uint64> sequence;
+        Record record;
+    };
+
+    // Appends tagged arguments to a record payload; stops at the first one that does not fit
+    class ArgumentWriter {
+    public:
+        explicit ArgumentWriter(Record& record) : m_record(record) {}
+
+        template<typename T>
+        void Write(const T& value);
+
+    private:
+        void WriteRaw(ArgumentType type, const void* data, uint32 size);
+        void WriteString(const char* text, size_t length);
+
+        Record& m_record;
+        bool m_full = false;
+    };
+
+    template<typename... Args>
+    static void Encode(Record& record, LogLevel level, const char* format, const Args&... args);
+
+    Record* Claim(uint64& position);
+    void Commit(uint64 position);
+
+    void DrainMain();
+    bool DrainOne();
+    bool HasPending() const;
+    void ReportDropped();
+    void FlushSinks();
+    void Emit(const Record& record);
+    void EmitLine(const String& line);
+
+    static const uint8* AppendArgument(String& text, const uint8* argument);
+
+private:
+    Vector<Slot> m_slots;
+    uint64 m_mask = 0;
+    alignas(64) std::atomic<uint64> m_enqueuePosition{ 0 };
+    alignas(64) uint64 m_dequeuePosition = 0;          // Drain thread only
+    std::atomic<uint64> m_drainedPosition{ 0 };
+    std::atomic<uint64> m_dropped{ 0 };
+    std::atomic<uint64> m_written{ 0 };
+    uint64 m_droppedReported = 0;
+
+    std::atomic<LogLevel> m_level{ DEBUG_BUILD ? LogLevel::Debug : LogLevel::Info };
+    std::atomic<bool> m_running{ false };
+    int64 m_startCounter = 0;
+
+    // Written by the drain thread, or by the callers themselves after Shutdown
+    std::mutex m_sinkMutex;
+    uint32 m_sinks = LogSink::DebugOutput;
+    FILE* m_file = nullptr;
+
+    std::thread m_thread;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_drainedCondition;
+    bool m_stopRequested = false;
+    bool m_flushRequested = false;
+
+    DECLARE_NON_COPYABLE(Logger);
+};
+
+template<typename T>
+void Logger::ArgumentWriter::Write(const T& value) {
+    using Type = std::decay_t<T>;
+    if constexpr (std::is_array_v<T>) {
+        WriteString(value, std::strlen(value));
+    } else if constexpr (std::is_same_v<Type, bool>) {
+        uint8 data = value ? 1 : 0;
+        WriteRaw(ArgumentType::Bool, &data, sizeof(data));
+    } else if constexpr (std::is_enum_v<Type>) {
+        Write(static_cast<std::underlying_type_t<Type>>(value));
+    } else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>) {
+        int64 data = value;
+        WriteRaw(ArgumentType::Int, &data, sizeof(data));
+    } else if constexpr (std::is_integral_v<Type>) {
+        uint64 data = value;
+        WriteRaw(ArgumentType::UInt, &data, sizeof(data));
+    } else if constexpr (std::is_floating_point_v<Type>) {
+        double data = value;
+        WriteRaw(ArgumentType::Float, &data, sizeof(data));
+    } else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+        WriteString(value ? value : "(null)", value ? std::strlen(value) : 6);
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        std::string_view view = value;
+        WriteString(view.data(), view.size());
+    } else if constexpr (std::is_pointer_v<Type>) {
+        uint64 data = reinterpret_cast<uintptr_t>(value);
+        WriteRaw(ArgumentType::Pointer, &data, sizeof(data));
+    } else {
+        static_assert(std::is_pointer_v<Type>, "Unsupported log argument type");
+    }
+}
+
+template<typename... Args>
+void Logger::Encode(Record& record, LogLevel level, const char* format, const Args&... args) {
+    record.timestamp = Platform::GetPerformanceCounter();
+    record.format = format;
+    record.level = level;
+    record.argumentCount = 0;
+    record.payloadSize = 0;
+    ArgumentWriter writer(record);
+    (writer.Write(args), ...);
+}
+
+template<typename... Args>
+void Logger::Write(LogLevel level, const char* format, const Args&... args) {
+    static_assert(sizeof...(Args) < 256, "Too many log arguments");
+
+    if (!m_running.load(std::memory_order_relaxed)) {
+        Record record;
+        Encode(record, level, format, args...);
+        Emit(record);
+        return;
+    }
+
+    uint64 position = 0;
+    Record* record = Claim(position);
+    if (!record) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Encode(*record, level, format, args...);
+    Commit(position);
+
+    // Wake the drain thread early when a burst has filled half the ring
+    if ((position & (m_mask >> 1)) == 0) {
+        m_wakeCondition.notify_one();
+    }
+}
+
+// Logging macros. Disabled levels cost one relaxed load; levels below
+// LOG_COMPILED_LEVEL compile to nothing.
+#define LOG_AT_LEVEL(level, ...) \
+    do { \
+        if constexpr (static_cast<int>(level) >= LOG_COMPILED_LEVEL) { \
+            Logger& logger_ = Logger::GetGlobal(); \
+            if (logger_.IsEnabled(level)) { \
+                logger_.Write(level, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define LOG_TRACE(...)   LOG_AT_LEVEL(LogLevel::Trace, __VA_ARGS__)
+#define LOG_DEBUG(...)   LOG_AT_LEVEL(LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...)    LOG_AT_LEVEL(LogLevel::Info, __VA_ARGS__)
+#define LOG_WARNING(...) LOG_AT_LEVEL(LogLevel::Warning, __VA_ARGS__)
+#define LOG_ERROR(...)   LOG_AT_LEVEL(LogLevel::Error, __VA_ARGS__)
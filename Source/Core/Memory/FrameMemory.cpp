@@ -0,0 +1,59 @@
+#include "FrameMemory.h"
+
+namespace {
+    constexpr size_t FRAME_BLOCK_SIZE = 1024 * 1024;
+    constexpr size_t SCRATCH_BLOCK_SIZE = 256 * 1024;
+
+    struct ThreadFrameMemory {
+        LinearArena frameArena{ FRAME_BLOCK_SIZE };
+        LinearArena scratchArena{ SCRATCH_BLOCK_SIZE };
+        ArenaMemoryResource frameResource{ frameArena };
+        uint32 scratchDepth = 0;
+    };
+
+    // Created on a thread's first use, so threads that never ask cost nothing
+    ThreadFrameMemory& GetThreadMemory() {
+        thread_local ThreadFrameMemory s_memory;
+        return s_memory;
+    }
+}
+
+namespace FrameMemory {
+    void BeginFrame() {
+        ThreadFrameMemory& memory = GetThreadMemory();
+        memory.frameArena.Reset();
+
+        // Scopes rewind themselves; resetting also merges blocks an overflow added
+        if (memory.scratchDepth == 0) {
+            memory.scratchArena.Reset();
+        }
+    }
+
+    LinearArena& GetFrameArena() {
+        return GetThreadMemory().frameArena;
+    }
+
+    std::pmr::memory_resource* GetFrameResource() {
+        return &GetThreadMemory().frameResource;
+    }
+
+    LinearArena& GetScratchArena() {
+        return GetThreadMemory().scratchArena;
+    }
+
+    uint32 GetScratchDepth() {
+        return GetThreadMemory().scratchDepth;
+    }
+}
+
+ScratchScope::ScratchScope()
+    : m_arena(FrameMemory::GetScratchArena())
+    , m_marker(m_arena.GetMarker())
+    , m_resource(m_arena) {
+    ++GetThreadMemory().scratchDepth;
+}
+
+ScratchScope::~ScratchScope() {
+    m_arena.Rewind(m_marker);
+    --GetThreadMemory().scratchDepth;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "LinearArena.h"
+#include <memory_resource>
+#include <vector>
+
+// Vector whose storage comes from an arena (see ScratchScope::GetResource)
+template<typename T>
+using ScratchVector = std::pmr::vector<T>;
+
+// Per-thread arenas for memory that dies with the frame or with the function using it.
+//
+// Frame memory lives until the thread's next BeginFrame. Each thread that runs a frame
+// loop (the main loop, the render thread) calls BeginFrame at the top of its frame, so
+// a thread never resets memory another thread is still reading.
+//
+// Scratch memory is for temporaries inside one call: open a ScratchScope, allocate
+// from it, and everything is released when the scope closes. Scopes nest, and work on
+// any thread, including job workers that have no frame of their own.
+namespace FrameMemory {
+    // Release this thread's frame memory and tidy its arenas for the next frame
+    void BeginFrame();
+
+    LinearArena& GetFrameArena();
+    std::pmr::memory_resource* GetFrameResource();
+
+    LinearArena& GetScratchArena();
+
+    // Open ScratchScopes on this thread
+    uint32 GetScratchDepth();
+}
+
+// Scratch allocations released when the scope ends. Containers built on GetResource
+// must be declared after the scope so they are destroyed first.
+class ScratchScope {
+public:
+    ScratchScope();
+    ~ScratchScope();
+
+    std::pmr::memory_resource* GetResource() { return &m_resource; }
+
+    template<typename T>
+    T* Allocate(size_t count) { return m_arena.AllocateArray<T>(count); }
+
+private:
+    LinearArena& m_arena;
+    LinearArena::Marker m_marker;
+    ArenaMemoryResource m_resource;
+
+    DECLARE_NON_COPYABLE(ScratchScope);
+};
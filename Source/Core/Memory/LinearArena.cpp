@@ -0,0 +1,102 @@
+#include "LinearArena.h"
+#include "MemoryTracker.h"
+#include <algorithm>
+#include <new>
+
+LinearArena::LinearArena(size_t blockSize)
+    : m_blockSize(std::max<size_t>(blockSize, 1024)) {
+}
+
+LinearArena::~LinearArena() {
+    FreeBlocks();
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment) {
+    ASSERT(alignment != 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+    size = std::max<size_t>(size, 1);
+
+    // Current block, then blocks kept from earlier frames, then a new one
+    void* pointer = nullptr;
+    for (uint32 block = m_currentBlock; block < m_blocks.size(); ++block) {
+        if (TryAllocateFrom(block, size, alignment, pointer)) {
+            return pointer;
+        }
+    }
+
+    AddBlock(size + alignment);
+    [[maybe_unused]] bool fits = TryAllocateFrom(static_cast<uint32>(m_blocks.size() - 1), size, alignment, pointer);
+    ASSERT(fits, "New arena block is too small");
+    return pointer;
+}
+
+bool LinearArena::TryAllocateFrom(uint32 blockIndex, size_t size, size_t alignment, void*& outPointer) {
+    const Block& block = m_blocks[blockIndex];
+    size_t offset = blockIndex == m_currentBlock ? m_offset : 0;
+    uintptr_t address = reinterpret_cast<uintptr_t>(block.data) + offset;
+    size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+    if (offset + padding + size > block.size) {
+        return false;
+    }
+
+    // Moving on to a later block abandons the rest of the current one
+    if (blockIndex != m_currentBlock) {
+        m_stats.usedBytes += m_blocks[m_currentBlock].size - m_offset;
+        m_currentBlock = blockIndex;
+    }
+
+    outPointer = block.data + offset + padding;
+    m_offset = offset + padding + size;
+    m_stats.usedBytes += padding + size;
+    m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.usedBytes);
+    return true;
+}
+
+LinearArena::Marker LinearArena::GetMarker() const {
+    Marker marker;
+    marker.block = m_currentBlock;
+    marker.offset = m_offset;
+    marker.usedBytes = m_stats.usedBytes;
+    return marker;
+}
+
+void LinearArena::Rewind(const Marker& marker) {
+    ASSERT(marker.block < m_currentBlock || (marker.block == m_currentBlock && marker.offset <= m_offset),
+           "Arena markers must be rewound in reverse order");
+    m_currentBlock = marker.block;
+    m_offset = marker.offset;
+    m_stats.usedBytes = marker.usedBytes;
+}
+
+void LinearArena::Reset() {
+    // Overflowed into several blocks: replace them with one that holds it all next time
+    if (m_blocks.size() > 1) {
+        size_t capacity = static_cast<size_t>(m_stats.capacityBytes);
+        FreeBlocks();
+        AddBlock(capacity);
+    }
+
+    m_currentBlock = 0;
+    m_offset = 0;
+    m_stats.usedBytes = 0;
+}
+
+void LinearArena::AddBlock(size_t minimumSize) {
+    Block block;
+    block.size = std::max(m_blockSize, minimumSize);
+    block.data = static_cast<uint8*>(::operator new(block.size));
+    m_blocks.push_back(block);
+    m_stats.capacityBytes += block.size;
+    ++m_stats.blockAllocations;
+    MemoryTracker::RecordAllocation(MemoryTag::Arenas, block.size);
+}
+
+void LinearArena::FreeBlocks() {
+    for (Block& block : m_blocks) {
+        ::operator delete(block.data);
+        MemoryTracker::RecordFree(MemoryTag::Arenas, block.size);
+    }
+    m_blocks.clear();
+    m_currentBlock = 0;
+    m_offset = 0;
+    m_stats.capacityBytes = 0;
+}
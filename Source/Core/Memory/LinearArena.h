@@ -0,0 +1,88 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+
+struct LinearArenaStats {
+    uint64 usedBytes = 0;       // Handed out since the last reset, alignment included
+    uint64 peakBytes = 0;       // Most ever in use at once
+    uint64 capacityBytes = 0;   // Reserved in blocks
+    uint64 blockAllocations = 0;    // Blocks taken from the heap; flat once the arena has warmed up
+};
+
+// Bump allocator over a list of blocks. Allocation is a pointer increment; nothing is
+// freed individually. Memory comes back all at once with Reset, or down to a marker
+// with Rewind, so it suits temporaries with a clear end (a frame, a function call).
+// Blocks are kept across resets, and a reset after an overflow merges them into one
+// block big enough for the whole previous use, so a steady workload stops touching
+// the heap after its first frames. Not thread-safe: one arena per thread.
+class LinearArena {
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+    struct Marker {
+        uint32 block = 0;
+        size_t offset = 0;
+        uint64 usedBytes = 0;
+    };
+
+    explicit LinearArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+    ~LinearArena();
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    // Uninitialized storage for count objects; only for types that need no destructor
+    template<typename T>
+    T* AllocateArray(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena memory is never destroyed");
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Everything allocated after GetMarker is released by Rewind to it (LIFO)
+    Marker GetMarker() const;
+    void Rewind(const Marker& marker);
+
+    // Release everything; invalidates every pointer the arena handed out
+    void Reset();
+
+    const LinearArenaStats& GetStats() const { return m_stats; }
+
+private:
+    struct Block {
+        uint8* data = nullptr;
+        size_t size = 0;
+    };
+
+    bool TryAllocateFrom(uint32 blockIndex, size_t size, size_t alignment, void*& outPointer);
+    void AddBlock(size_t minimumSize);
+    void FreeBlocks();
+
+private:
+    size_t m_blockSize;
+    Vector<Block> m_blocks;
+    uint32 m_currentBlock = 0;
+    size_t m_offset = 0;
+    LinearArenaStats m_stats;
+
+    DECLARE_NON_COPYABLE(LinearArena);
+};
+
+// std::pmr adapter, so standard containers can take their storage from an arena.
+// Deallocation is a no-op; the arena's Reset or Rewind releases the memory, so the
+// container must not outlive that point.
+class ArenaMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit ArenaMemoryResource(LinearArena& arena) : m_arena(arena) {}
+
+    LinearArena& GetArena() const { return m_arena; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override { return m_arena.Allocate(bytes, alignment); }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+private:
+    LinearArena& m_arena;
+};
@@ -0,0 +1,81 @@
+#include "MemoryTracker.h"
+#include "ObjectPool.h"
+#include <atomic>
+#include <cstdio>
+
+namespace {
+    constexpr uint32 TAG_COUNT = static_cast<uint32>(MemoryTag::COUNT);
+
+    const char* s_tagNames[TAG_COUNT] = {
+        "General",
+        "Entities",
+        "Components",
+        "Arenas",
+    };
+
+    struct TagCounters {
+        std::atomic<uint64> liveBytes{ 0 };
+        std::atomic<uint64> peakBytes{ 0 };
+        std::atomic<uint64> liveAllocations{ 0 };
+        std::atomic<uint64> totalAllocations{ 0 };
+    };
+
+    TagCounters s_counters[TAG_COUNT];
+}
+
+namespace MemoryTracker {
+    void RecordAllocation(MemoryTag tag, uint64 bytes) {
+        TagCounters& counters = s_counters[static_cast<uint32>(tag)];
+        uint64 live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        uint64 peak = counters.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+        counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+        counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void RecordFree(MemoryTag tag, uint64 bytes) {
+        TagCounters& counters = s_counters[static_cast<uint32>(tag)];
+        counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    MemoryTagStats GetStats(MemoryTag tag) {
+        const TagCounters& counters = s_counters[static_cast<uint32>(tag)];
+        MemoryTagStats stats;
+        stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+        stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+        stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+        stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    const char* GetTagName(MemoryTag tag) {
+        return tag < MemoryTag::COUNT ? s_tagNames[static_cast<uint32>(tag)] : "Unknown";
+    }
+
+    String FormatReport() {
+        char line[256];
+        String report;
+        for (uint32 i = 0; i < TAG_COUNT; ++i) {
+            MemoryTagStats stats = GetStats(static_cast<MemoryTag>(i));
+            std::snprintf(line, sizeof(line), "  %-11s %10.1f KB live, %10.1f KB peak, %8llu live, %10llu total\n",
+                          s_tagNames[i], stats.liveBytes / 1024.0, stats.peakBytes / 1024.0,
+                          static_cast<unsigned long long>(stats.liveAllocations),
+                          static_cast<unsigned long long>(stats.totalAllocations));
+            report += line;
+        }
+
+        for (const ObjectPool* pool : ObjectPool::GetPools()) {
+            ObjectPoolStats stats = pool->GetStats();
+            std::snprintf(line, sizeof(line), "  pool %-30s %4zu bytes, %8llu live, %8llu peak, %8llu slots in %llu chunks\n",
+                          pool->GetName(), pool->GetObjectSize(),
+                          static_cast<unsigned long long>(stats.liveObjects),
+                          static_cast<unsigned long long>(stats.peakObjects),
+                          static_cast<unsigned long long>(stats.capacity),
+                          static_cast<unsigned long long>(stats.chunks));
+            report += line;
+        }
+        return report;
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+
+// What tracked memory is for. Add a tag before COUNT and a name in MemoryTracker.cpp.
+enum class MemoryTag : uint8 {
+    General,
+    Entities,
+    Components,
+    Arenas,
+    COUNT
+};
+
+struct MemoryTagStats {
+    uint64 liveBytes = 0;
+    uint64 peakBytes = 0;           // Most live at once
+    uint64 liveAllocations = 0;
+    uint64 totalAllocations = 0;    // Since startup
+};
+
+// Process-wide counters for the engine's own allocators. Object pools report every
+// object they hand out, arenas every block they take from the heap. Lock-free, so
+// any thread may record, and reading while others record is fine (each counter is
+// exact, a tag's counters together are only approximately consistent).
+namespace MemoryTracker {
+    void RecordAllocation(MemoryTag tag, uint64 bytes);
+    void RecordFree(MemoryTag tag, uint64 bytes);
+
+    MemoryTagStats GetStats(MemoryTag tag);
+    const char* GetTagName(MemoryTag tag);
+
+    // One line per tag and per object pool, for logs and benchmark reports
+    String FormatReport();
+}
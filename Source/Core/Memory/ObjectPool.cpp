@@ -0,0 +1,104 @@
+#include "ObjectPool.h"
+#include <algorithm>
+
+namespace {
+    struct PoolRegistry {
+        std::mutex mutex;
+        Vector<const ObjectPool*> pools;
+    };
+
+    // Leaked like the pools themselves
+    PoolRegistry& GetRegistry() {
+        static PoolRegistry* s_registry = new PoolRegistry();
+        return *s_registry;
+    }
+}
+
+ObjectPool::ObjectPool(const char* name, size_t objectSize, size_t alignment, MemoryTag tag)
+    : m_name(name)
+    , m_alignment(std::max(alignment, alignof(FreeSlot)))
+    , m_tag(tag) {
+    // Slots hold a free-list link when empty and stay aligned back to back
+    size_t size = std::max(objectSize, sizeof(FreeSlot));
+    m_slotSize = (size + m_alignment - 1) & ~(m_alignment - 1);
+
+    PoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.pools.push_back(this);
+}
+
+ObjectPool::~ObjectPool() {
+    {
+        PoolRegistry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.pools.erase(std::remove(registry.pools.begin(), registry.pools.end(), this), registry.pools.end());
+    }
+
+    ASSERT(m_stats.liveObjects == 0, "Object pool destroyed with live objects");
+    for (void* chunk : m_chunks) {
+        if (m_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+            ::operator delete(chunk, std::align_val_t(m_alignment));
+        } else {
+            ::operator delete(chunk);
+        }
+    }
+}
+
+void* ObjectPool::Allocate() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_freeList) {
+        AddChunk();
+    }
+
+    FreeSlot* slot = m_freeList;
+    m_freeList = slot->next;
+    ++m_stats.liveObjects;
+    m_stats.peakObjects = std::max(m_stats.peakObjects, m_stats.liveObjects);
+    MemoryTracker::RecordAllocation(m_tag, m_slotSize);
+    return slot;
+}
+
+void ObjectPool::Free(void* object) {
+    if (!object) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ASSERT(m_stats.liveObjects > 0, "Object freed to a pool it did not come from");
+    FreeSlot* slot = static_cast<FreeSlot*>(object);
+    slot->next = m_freeList;
+    m_freeList = slot;
+    --m_stats.liveObjects;
+    MemoryTracker::RecordFree(m_tag, m_slotSize);
+}
+
+ObjectPoolStats ObjectPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+Vector<const ObjectPool*> ObjectPool::GetPools() {
+    PoolRegistry& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.pools;
+}
+
+void ObjectPool::AddChunk() {
+    uint32 objectCount = m_nextChunkObjects;
+    m_nextChunkObjects = std::min(m_nextChunkObjects * 2, MAX_CHUNK_OBJECTS);
+
+    size_t chunkSize = m_slotSize * objectCount;
+    void* memory = m_alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? ::operator new(chunkSize, std::align_val_t(m_alignment))
+                                                                  : ::operator new(chunkSize);
+    uint8* chunk = static_cast<uint8*>(memory);
+    m_chunks.push_back(chunk);
+    ++m_stats.chunks;
+    m_stats.capacity += objectCount;
+
+    // Link back to front so slots are handed out in address order
+    for (uint32 i = objectCount; i-- > 0;) {
+        FreeSlot* slot = reinterpret_cast<FreeSlot*>(chunk + i * m_slotSize);
+        slot->next = m_freeList;
+        m_freeList = slot;
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include "MemoryTracker.h"
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+
+struct ObjectPoolStats {
+    uint64 liveObjects = 0;
+    uint64 peakObjects = 0;
+    uint64 capacity = 0;    // Slots in all chunks
+    uint64 chunks = 0;
+};
+
+// Fixed-size slots for one object type, carved from chunks that double in size up to
+// MAX_CHUNK_OBJECTS. Freed slots go on a free list and are reused before the pool grows;
+// chunks are kept until the process ends. Objects of a type end up packed together
+// instead of spread across the heap between everything else. Thread-safe.
+class ObjectPool {
+public:
+    static constexpr uint32 FIRST_CHUNK_OBJECTS = 64;
+    static constexpr uint32 MAX_CHUNK_OBJECTS = 4096;
+
+    ObjectPool(const char* name, size_t objectSize, size_t alignment, MemoryTag tag);
+    ~ObjectPool();
+
+    // Uninitialized slot of GetObjectSize bytes
+    void* Allocate();
+    void Free(void* object);
+
+    // The pool for T. Created on first use and never destroyed, so objects released
+    // during static destruction still have somewhere to go; the first call's tag sticks.
+    template<typename T>
+    static ObjectPool& Get(MemoryTag tag) {
+        static ObjectPool* s_pool = new ObjectPool(typeid(T).name(), sizeof(T), alignof(T), tag);
+        return *s_pool;
+    }
+
+    // Every pool created so far, for reports
+    static Vector<const ObjectPool*> GetPools();
+
+    const char* GetName() const { return m_name; }
+    size_t GetObjectSize() const { return m_slotSize; }
+    MemoryTag GetTag() const { return m_tag; }
+    ObjectPoolStats GetStats() const;
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    void AddChunk();
+
+private:
+    const char* m_name;
+    size_t m_slotSize;
+    size_t m_alignment;
+    MemoryTag m_tag;
+
+    mutable std::mutex m_mutex;
+    FreeSlot* m_freeList = nullptr;
+    Vector<void*> m_chunks;
+    uint32 m_nextChunkObjects = FIRST_CHUNK_OBJECTS;
+    ObjectPoolStats m_stats;
+
+    DECLARE_NON_COPYABLE(ObjectPool);
+};
+
+// Returns a pooled object to the pool it came from. Works through a base-class pointer
+// when the base has a virtual destructor.
+struct PoolDeleter {
+    ObjectPool* pool = nullptr;
+
+    template<typename T>
+    void operator()(T* object) const {
+        void* memory = object;
+        if constexpr (std::is_polymorphic_v<T>) {
+            memory = dynamic_cast<void*>(object);
+        }
+        object->~T();
+        pool->Free(memory);
+    }
+};
+
+template<typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter>;
+
+template<typename T, typename... Args>
+PoolPtr<T> MakePooled(MemoryTag tag, Args&&... args) {
+    ObjectPool& pool = ObjectPool::Get<T>(tag);
+    void* memory = pool.Allocate();
+    T* object;
+    try {
+        object = new (memory) T(std::forward<Args>(args)...);
+    } catch (...) {
+        pool.Free(memory);
+        throw;
+    }
+    return PoolPtr<T>(object, PoolDeleter{ &pool });
+}
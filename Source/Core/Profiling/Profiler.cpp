@@ -0,0 +1,264 @@
+#include "Profiler.h"
+#include "../Memory/FrameMemory.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    void AppendJsonString(String& out, const char* text) {
+        out.push_back('"');
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out.push_back('\\');
+                out.push_back(*c);
+            } else if (static_cast<uint8>(*c) < 0x20) {
+                out.push_back(' ');
+            } else {
+                out.push_back(*c);
+            }
+        }
+        out.push_back('"');
+    }
+}
+
+Profiler::Profiler() {
+    m_baseTicks = GetTicks();
+    m_baseCounter = Platform::GetPerformanceCounter();
+    m_frameBegin = m_baseTicks;
+
+#if PROFILER_USE_TSC
+    // Rough rate until EndFrame has a longer interval to measure over
+    int64 frequency = Platform::GetPerformanceFrequency();
+    int64 target = m_baseCounter + frequency / 200;
+    while (Platform::GetPerformanceCounter() < target) {
+    }
+    Calibrate();
+#else
+    m_microsecondsPerTick = 1.0e6 / static_cast<double>(Platform::GetPerformanceFrequency());
+#endif
+}
+
+Profiler& Profiler::GetGlobal() {
+    static Profiler* s_profiler = new Profiler();
+    return *s_profiler;
+}
+
+void Profiler::Calibrate() {
+#if PROFILER_USE_TSC
+    uint64 ticks = GetTicks() - m_baseTicks;
+    int64 counter = Platform::GetPerformanceCounter() - m_baseCounter;
+    if (ticks > 0 && counter > 0) {
+        double seconds = static_cast<double>(counter) / static_cast<double>(Platform::GetPerformanceFrequency());
+        m_microsecondsPerTick = seconds * 1.0e6 / static_cast<double>(ticks);
+    }
+#endif
+}
+
+ProfileThreadBuffer& Profiler::RegisterThread() {
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    auto buffer = std::make_unique<ProfileThreadBuffer>();
+    buffer->records.resize(ProfileThreadBuffer::CAPACITY);
+    buffer->threadIndex = static_cast<uint32>(m_threadBuffers.size());
+
+    s_threadBuffer = buffer.get();
+    m_threadNames.push_back("Thread " + std::to_string(buffer->threadIndex));
+    m_threadBuffers.push_back(std::move(buffer));
+    return *s_threadBuffer;
+}
+
+void Profiler::SetThreadName(const String& name) {
+    ProfileThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    m_threadNames[buffer.threadIndex] = name;
+}
+
+String Profiler::GetThreadName(uint32 threadIndex) const {
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    return threadIndex < m_threadNames.size() ? m_threadNames[threadIndex] : String();
+}
+
+void Profiler::EndFrame() {
+    // Once the history is full, the frame falling out of it lends its vectors to the new one
+    ProfileFrame frame;
+    if (!m_frames.empty() && m_frames.size() >= m_frameHistory) {
+        frame = std::move(m_frames.front());
+        m_frames.pop_front();
+    }
+    uint32 threadCount = 0;
+    frame.frameIndex = m_frameIndex++;
+    frame.begin = m_frameBegin;
+    frame.end = GetTicks();
+    m_frameBegin = frame.end;
+
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        for (const UniquePtr<ProfileThreadBuffer>& buffer : m_threadBuffers) {
+            uint64 tail = buffer->tail.load(std::memory_order_relaxed);
+            uint64 head = buffer->head.load(std::memory_order_acquire);
+            if (head == tail) {
+                continue;
+            }
+
+            if (threadCount == frame.threads.size()) {
+                frame.threads.emplace_back();
+            }
+            ProfileThreadFrame& thread = frame.threads[threadCount++];
+            thread.threadIndex = buffer->threadIndex;
+            thread.zones.clear();
+            thread.nodes.clear();
+            thread.zones.reserve(head - tail);
+            for (uint64 i = tail; i < head; ++i) {
+                thread.zones.push_back(buffer->records[i & (ProfileThreadBuffer::CAPACITY - 1)]);
+            }
+            buffer->tail.store(head, std::memory_order_release);
+
+            m_zonesRecorded += head - tail;
+            BuildHierarchy(thread);
+        }
+    }
+    frame.threads.resize(threadCount);
+
+    m_frames.push_back(std::move(frame));
+    while (m_frames.size() > m_frameHistory) {
+        m_frames.pop_front();
+    }
+
+    Calibrate();
+}
+
+void Profiler::BuildHierarchy(ProfileThreadFrame& thread) {
+    // Zones are pushed when they end (children first); order parents before children
+    std::sort(thread.zones.begin(), thread.zones.end(), [](const ProfileZoneRecord& a, const ProfileZoneRecord& b) {
+        return a.begin != b.begin ? a.begin < b.begin : a.depth < b.depth;
+    });
+
+    ScratchScope scratch;
+    ScratchVector<uint32> stack(scratch.GetResource());
+    for (const ProfileZoneRecord& zone : thread.zones) {
+        // Zones that began in an earlier frame have no parent here; they start at the top
+        while (stack.size() > zone.depth ||
+               (!stack.empty() && thread.nodes[stack.back()].depth >= zone.depth)) {
+            stack.pop_back();
+        }
+        uint32 parent = stack.empty() ? ProfileNode::NO_PARENT : stack.back();
+
+        uint32 index = ProfileNode::NO_PARENT;
+        for (uint32 i = parent == ProfileNode::NO_PARENT ? 0 : parent + 1; i < thread.nodes.size(); ++i) {
+            const ProfileNode& node = thread.nodes[i];
+            if (node.parent == parent && std::strcmp(node.name, zone.name) == 0) {
+                index = i;
+                break;
+            }
+        }
+        if (index == ProfileNode::NO_PARENT) {
+            ProfileNode node;
+            node.name = zone.name;
+            node.parent = parent;
+            node.depth = zone.depth;
+            index = static_cast<uint32>(thread.nodes.size());
+            thread.nodes.push_back(node);
+        }
+
+        ProfileNode& node = thread.nodes[index];
+        uint64 duration = zone.end - zone.begin;
+        ++node.calls;
+        node.totalTicks += duration;
+        node.selfTicks += duration;
+        if (parent != ProfileNode::NO_PARENT) {
+            ProfileNode& parentNode = thread.nodes[parent];
+            parentNode.selfTicks -= std::min(parentNode.selfTicks, duration);
+        }
+        stack.push_back(index);
+    }
+}
+
+ProfilerStats Profiler::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_threadMutex);
+    ProfilerStats stats;
+    stats.zonesRecorded = m_zonesRecorded;
+    stats.threadCount = static_cast<uint32>(m_threadBuffers.size());
+    for (const UniquePtr<ProfileThreadBuffer>& buffer : m_threadBuffers) {
+        stats.zonesDropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+String Profiler::FormatFrame(const ProfileFrame& frame) const {
+    char line[256];
+    std::snprintf(line, sizeof(line), "Frame %llu: %.3f ms\n", static_cast<unsigned long long>(frame.frameIndex),
+                  TicksToMicroseconds(frame.end - frame.begin) / 1000.0);
+    String text = line;
+
+    for (const ProfileThreadFrame& thread : frame.threads) {
+        text += "  " + GetThreadName(thread.threadIndex) + "\n";
+
+        // Depth-first, children in first-seen order
+        Vector<uint32> pending;
+        for (uint32 i = static_cast<uint32>(thread.nodes.size()); i-- > 0;) {
+            if (thread.nodes[i].parent == ProfileNode::NO_PARENT) {
+                pending.push_back(i);
+            }
+        }
+        while (!pending.empty()) {
+            uint32 index = pending.back();
+            pending.pop_back();
+            const ProfileNode& node = thread.nodes[index];
+
+            std::snprintf(line, sizeof(line), "    %*s%-*s %9.3f ms total %9.3f ms self %6u calls\n",
+                          static_cast<int>(node.depth * 2), "", std::max(1, 40 - static_cast<int>(node.depth * 2)), node.name,
+                          TicksToMicroseconds(node.totalTicks) / 1000.0, TicksToMicroseconds(node.selfTicks) / 1000.0, node.calls);
+            text += line;
+
+            for (uint32 i = static_cast<uint32>(thread.nodes.size()); i-- > index + 1;) {
+                if (thread.nodes[i].parent == index) {
+                    pending.push_back(i);
+                }
+            }
+        }
+    }
+    return text;
+}
+
+bool Profiler::ExportChromeTrace(const String& filePath) const {
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        Platform::OutputDebugMessage("Profiler: Failed to open " + filePath + "\n");
+        return false;
+    }
+
+    String json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    char number[96];
+
+    {
+        std::lock_guard<std::mutex> lock(m_threadMutex);
+        for (size_t i = 0; i < m_threadNames.size(); ++i) {
+            json += first ? "" : ",\n";
+            first = false;
+            std::snprintf(number, sizeof(number), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":", i);
+            json += number;
+            AppendJsonString(json, m_threadNames[i].c_str());
+            json += "}}";
+        }
+    }
+
+    for (const ProfileFrame& frame : m_frames) {
+        for (const ProfileThreadFrame& thread : frame.threads) {
+            for (const ProfileZoneRecord& zone : thread.zones) {
+                json += first ? "" : ",\n";
+                first = false;
+                json += "{\"name\":";
+                AppendJsonString(json, zone.name);
+                std::snprintf(number, sizeof(number), ",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                              TicksToMicroseconds(zone.begin - m_baseTicks), TicksToMicroseconds(zone.end - zone.begin),
+                              thread.threadIndex);
+                json += number;
+            }
+        }
+    }
+    json += "\n]}\n";
+
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include "../../Platform/Platform.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define PROFILER_USE_TSC 1
+#else
+    #define PROFILER_USE_TSC 0
+#endif
+
+// Zones compile to nothing when this is 0
+#ifndef ENABLE_PROFILER
+    #define ENABLE_PROFILER 1
+#endif
+
+// A finished zone. Names are string literals; depth is the nesting level on its thread.
+struct ProfileZoneRecord {
+    const char* name = nullptr;
+    uint64 begin = 0;
+    uint64 end = 0;
+    uint32 depth = 0;
+};
+
+// Zones with the same name under the same parent, merged
+struct ProfileNode {
+    static constexpr uint32 NO_PARENT = ~0u;
+
+    const char* name = nullptr;
+    uint32 parent = NO_PARENT;
+    uint32 depth = 0;
+    uint32 calls = 0;
+    uint64 totalTicks = 0;
+    uint64 selfTicks = 0;
+};
+
+struct ProfileThreadFrame {
+    uint32 threadIndex = 0;
+    Vector<ProfileZoneRecord> zones;    // In begin order (parents before children)
+    Vector<ProfileNode> nodes;          // Hierarchy, parents before children
+};
+
+struct ProfileFrame {
+    uint64 frameIndex = 0;
+    uint64 begin = 0;
+    uint64 end = 0;
+    Vector<ProfileThreadFrame> threads; // Threads that finished a zone this frame
+};
+
+struct ProfilerStats {
+    uint64 zonesRecorded = 0;
+    uint64 zonesDropped = 0;            // Thread buffer was full (EndFrame not called often enough)
+    uint32 threadCount = 0;
+};
+
+// Per-thread single-producer ring of finished zones; EndFrame is the only consumer
+struct ProfileThreadBuffer {
+    static constexpr uint32 CAPACITY = 8192;    // Zones between two EndFrame calls
+
+    Vector<ProfileZoneRecord> records;
+    alignas(64) std::atomic<uint64> head{ 0 };  // Owning thread
+    alignas(64) std::atomic<uint64> tail{ 0 };  // EndFrame
+    std::atomic<uint64> dropped{ 0 };
+    uint32 depth = 0;                           // Owning thread
+    uint32 threadIndex = 0;
+
+    void Push(const ProfileZoneRecord& record) {
+        uint64 position = head.load(std::memory_order_relaxed);
+        if (position - tail.load(std::memory_order_acquire) >= CAPACITY) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        records[position & (CAPACITY - 1)] = record;
+        head.store(position + 1, std::memory_order_release);
+    }
+};
+
+// CPU profiler. Scoped zones (PROFILE_SCOPE) read the timestamp counter on entry and
+// exit and push one record into a buffer owned by the calling thread, with no locks
+// or shared writes. Once per frame EndFrame collects every thread's zones, rebuilds
+// the per-thread hierarchy and keeps the last frames for inspection and for export
+// as Chrome trace JSON (chrome://tracing, ui.perfetto.dev).
+class Profiler {
+public:
+    static constexpr uint32 DEFAULT_FRAME_HISTORY = 300;
+
+    Profiler();
+    ~Profiler() = default;
+
+    // Process-wide profiler used by PROFILE_SCOPE. Never destroyed, like the logger.
+    static Profiler& GetGlobal();
+
+    // Raw timestamp used by zones; convert with TicksToMicroseconds
+    static uint64 GetTicks() {
+#if PROFILER_USE_TSC
+        return __rdtsc();
+#else
+        return static_cast<uint64>(Platform::GetPerformanceCounter());
+#endif
+    }
+
+    static void SetEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    // Buffer of the calling thread, registered on first use
+    static ProfileThreadBuffer& GetThreadBuffer() {
+        return s_threadBuffer ? *s_threadBuffer : GetGlobal().RegisterThread();
+    }
+
+    // Shown as the thread's track name in traces
+    void SetThreadName(const String& name);
+    String GetThreadName(uint32 threadIndex) const;
+
+    // Close the current frame: collect every thread's finished zones. Main thread only.
+    void EndFrame();
+
+    void SetFrameHistory(uint32 frameCount) { m_frameHistory = frameCount > 0 ? frameCount : 1; }
+    const std::deque<ProfileFrame>& GetFrames() const { return m_frames; }
+    const ProfileFrame* GetLastFrame() const { return m_frames.empty() ? nullptr : &m_frames.back(); }
+
+    double TicksToMicroseconds(uint64 ticks) const { return static_cast<double>(ticks) * m_microsecondsPerTick; }
+    ProfilerStats GetStats() const;
+
+    // Indented per-thread hierarchy with total and self times
+    String FormatFrame(const ProfileFrame& frame) const;
+
+    // Every kept frame as complete ("X") events, one track per thread
+    bool ExportChromeTrace(const String& filePath) const;
+
+private:
+    ProfileThreadBuffer& RegisterThread();
+    void Calibrate();
+    static void BuildHierarchy(ProfileThreadFrame& thread);
+
+private:
+    static inline std::atomic<bool> s_enabled{ true };
+    static inline thread_local ProfileThreadBuffer* s_threadBuffer = nullptr;
+
+    mutable std::mutex m_threadMutex;
+    Vector<UniquePtr<ProfileThreadBuffer>> m_threadBuffers;
+    Vector<String> m_threadNames;
+
+    std::deque<ProfileFrame> m_frames;
+    uint32 m_frameHistory = DEFAULT_FRAME_HISTORY;
+    uint64 m_frameIndex = 0;
+    uint64 m_frameBegin = 0;
+    uint64 m_zonesRecorded = 0;
+
+    // Tick rate, measured against the platform clock and refined every frame
+    uint64 m_baseTicks = 0;
+    int64 m_baseCounter = 0;
+    double m_microsecondsPerTick = 0.0;
+
+    DECLARE_NON_COPYABLE(Profiler);
+};
+
+// Records the enclosing scope as a zone on the calling thread
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name) {
+        if (Profiler::IsEnabled()) {
+            m_buffer = &Profiler::GetThreadBuffer();
+            m_name = name;
+            m_depth = m_buffer->depth++;
+            m_begin = Profiler::GetTicks();
+        }
+    }
+
+    ~ProfileZone() {
+        if (m_buffer) {
+            uint64 end = Profiler::GetTicks();
+            --m_buffer->depth;
+            m_buffer->Push({ m_name, m_begin, end, m_depth });
+        }
+    }
+
+private:
+    ProfileThreadBuffer* m_buffer = nullptr;
+    const char* m_name = nullptr;
+    uint64 m_begin = 0;
+    uint32 m_depth = 0;
+
+    DECLARE_NON_COPYABLE(ProfileZone);
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+
+#if ENABLE_PROFILER
+    #define PROFILE_SCOPE(name) ProfileZone PROFILE_CONCAT(profileZone_, __LINE__)(name)
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+#else
+    #define PROFILE_SCOPE(name) ((void)0)
+    #define PROFILE_FUNCTION() ((void)0)
+#endif
@@ -0,0 +1,219 @@
+#include "Heightfield.h"
+#include "../Logging/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr float32 LOWEST_HEIGHT = std::numeric_limits<float32>::lowest();
+
+    // Triangles this thin in xz are walls: they raise cell maxima but cover no sample
+    constexpr float32 MIN_TRIANGLE_AREA = 1.0e-8f;
+
+    // Widens every value to the maximum of its neighbours up to radius steps away, in place
+    void MaxFilter(Vector<float32>& values, Vector<float32>& scratch, uint32 count, uint32 stride,
+                   uint32 lineCount, uint32 lineStride, uint32 radius) {
+        scratch.resize(count);
+        for (uint32 line = 0; line < lineCount; ++line) {
+            float32* first = values.data() + line * lineStride;
+            for (uint32 i = 0; i < count; ++i) {
+                uint32 begin = i > radius ? i - radius : 0;
+                uint32 end = std::min(i + radius, count - 1);
+                float32 highest = LOWEST_HEIGHT;
+                for (uint32 j = begin; j <= end; ++j) {
+                    highest = std::max(highest, first[j * stride]);
+                }
+                scratch[i] = highest;
+            }
+            for (uint32 i = 0; i < count; ++i) {
+                first[i * stride] = scratch[i];
+            }
+        }
+    }
+}
+
+bool Heightfield::Build(const HeightfieldDesc& desc, const Function<float32(float32, float32)>& heightAt) {
+    if (!heightAt || !Initialize(desc)) {
+        return false;
+    }
+
+    for (uint32 row = 0; row < m_desc.rows; ++row) {
+        float32 z = m_desc.originZ + m_desc.cellSize * static_cast<float32>(row);
+        for (uint32 column = 0; column < m_desc.columns; ++column) {
+            float32 x = m_desc.originX + m_desc.cellSize * static_cast<float32>(column);
+            m_heights[row * m_desc.columns + column] = heightAt(x, z);
+        }
+    }
+
+    BuildMaxHeights();
+    return true;
+}
+
+bool Heightfield::BuildFromMesh(const HeightfieldDesc& desc, const MeshData& mesh) {
+    if (mesh.vertices.empty() || mesh.indices.size() < 3) {
+        LOG_ERROR("Heightfield: Mesh has no triangles");
+        return false;
+    }
+    if (!Initialize(desc)) {
+        return false;
+    }
+
+    // Meshes without sub-meshes are one range over every index
+    Vector<SubMesh> ranges = mesh.subMeshes;
+    if (ranges.empty()) {
+        SubMesh whole;
+        whole.indexCount = static_cast<uint32>(mesh.indices.size());
+        ranges.push_back(whole);
+    }
+
+    std::fill(m_heights.begin(), m_heights.end(), LOWEST_HEIGHT);
+    const float32 inverseCellSize = 1.0f / m_desc.cellSize;
+    const int32 lastColumn = static_cast<int32>(m_desc.columns - 1);
+    const int32 lastRow = static_cast<int32>(m_desc.rows - 1);
+
+    for (const SubMesh& range : ranges) {
+        uint32 indexEnd = std::min(range.indexStart + range.indexCount, static_cast<uint32>(mesh.indices.size()));
+        for (uint32 i = range.indexStart; i + 2 < indexEnd; i += 3) {
+            uint32 i0 = range.baseVertex + mesh.indices[i];
+            uint32 i1 = range.baseVertex + mesh.indices[i + 1];
+            uint32 i2 = range.baseVertex + mesh.indices[i + 2];
+            if (i0 >= mesh.vertices.size() || i1 >= mesh.vertices.size() || i2 >= mesh.vertices.size()) {
+                continue;
+            }
+            const DirectX::XMFLOAT3& a = mesh.vertices[i0].position;
+            const DirectX::XMFLOAT3& b = mesh.vertices[i1].position;
+            const DirectX::XMFLOAT3& c = mesh.vertices[i2].position;
+
+            // Bounds in grid units
+            float32 minX = (std::min({ a.x, b.x, c.x }) - m_desc.originX) * inverseCellSize;
+            float32 maxX = (std::max({ a.x, b.x, c.x }) - m_desc.originX) * inverseCellSize;
+            float32 minZ = (std::min({ a.z, b.z, c.z }) - m_desc.originZ) * inverseCellSize;
+            float32 maxZ = (std::max({ a.z, b.z, c.z }) - m_desc.originZ) * inverseCellSize;
+            if (maxX < 0.0f || maxZ < 0.0f || minX > static_cast<float32>(lastColumn) || minZ > static_cast<float32>(lastRow)) {
+                continue;
+            }
+
+            // Cells under the bounds keep the triangle's top
+            float32 top = std::max({ a.y, b.y, c.y });
+            int32 cellBeginX = std::clamp(static_cast<int32>(std::floor(minX)), 0, lastColumn - 1);
+            int32 cellEndX = std::clamp(static_cast<int32>(std::floor(maxX)), 0, lastColumn - 1);
+            int32 cellBeginZ = std::clamp(static_cast<int32>(std::floor(minZ)), 0, lastRow - 1);
+            int32 cellEndZ = std::clamp(static_cast<int32>(std::floor(maxZ)), 0, lastRow - 1);
+            for (int32 row = cellBeginZ; row <= cellEndZ; ++row) {
+                for (int32 column = cellBeginX; column <= cellEndX; ++column) {
+                    float32& cellMax = m_maxHeights[row * m_cellColumns + column];
+                    cellMax = std::max(cellMax, top);
+                }
+            }
+
+            // Samples inside the triangle, seen from above
+            float32 area = (b.x - a.x) * (c.z - a.z) - (c.x - a.x) * (b.z - a.z);
+            if (std::fabs(area) < MIN_TRIANGLE_AREA) {
+                continue;
+            }
+            float32 inverseArea = 1.0f / area;
+            int32 beginX = std::max(static_cast<int32>(std::ceil(minX)), 0);
+            int32 endX = std::min(static_cast<int32>(std::floor(maxX)), lastColumn);
+            int32 beginZ = std::max(static_cast<int32>(std::ceil(minZ)), 0);
+            int32 endZ = std::min(static_cast<int32>(std::floor(maxZ)), lastRow);
+            for (int32 row = beginZ; row <= endZ; ++row) {
+                float32 z = m_desc.originZ + m_desc.cellSize * static_cast<float32>(row);
+                for (int32 column = beginX; column <= endX; ++column) {
+                    float32 x = m_desc.originX + m_desc.cellSize * static_cast<float32>(column);
+                    float32 weightA = ((b.x - x) * (c.z - z) - (c.x - x) * (b.z - z)) * inverseArea;
+                    float32 weightB = ((c.x - x) * (a.z - z) - (a.x - x) * (c.z - z)) * inverseArea;
+                    float32 weightC = 1.0f - weightA - weightB;
+                    if (weightA < 0.0f || weightB < 0.0f || weightC < 0.0f) {
+                        continue;
+                    }
+                    float32& height = m_heights[row * m_desc.columns + column];
+                    height = std::max(height, weightA * a.y + weightB * b.y + weightC * c.y);
+                }
+            }
+        }
+    }
+
+    for (float32& height : m_heights) {
+        if (height == LOWEST_HEIGHT) {
+            height = m_desc.baseHeight;
+        }
+    }
+
+    BuildMaxHeights();
+    return true;
+}
+
+float32 Heightfield::GetHeight(float32 x, float32 z) const {
+    if (m_heights.empty()) {
+        return 0.0f;
+    }
+
+    float32 gridX = std::clamp((x - m_desc.originX) / m_desc.cellSize, 0.0f, static_cast<float32>(m_desc.columns - 1));
+    float32 gridZ = std::clamp((z - m_desc.originZ) / m_desc.cellSize, 0.0f, static_cast<float32>(m_desc.rows - 1));
+    uint32 column = std::min(static_cast<uint32>(gridX), m_desc.columns - 2);
+    uint32 row = std::min(static_cast<uint32>(gridZ), m_desc.rows - 2);
+    float32 tx = gridX - static_cast<float32>(column);
+    float32 tz = gridZ - static_cast<float32>(row);
+
+    const float32* sample = m_heights.data() + row * m_desc.columns + column;
+    float32 front = sample[0] + (sample[1] - sample[0]) * tx;
+    float32 back = sample[m_desc.columns] + (sample[m_desc.columns + 1] - sample[m_desc.columns]) * tx;
+    return front + (back - front) * tz;
+}
+
+float32 Heightfield::GetMaxHeight(float32 x, float32 z) const {
+    if (m_maxHeights.empty()) {
+        return 0.0f;
+    }
+    return m_maxHeights[GetCellIndex(x, z)];
+}
+
+bool Heightfield::Initialize(const HeightfieldDesc& desc) {
+    m_heights.clear();
+    m_maxHeights.clear();
+
+    if (desc.columns < 2 || desc.rows < 2) {
+        LOG_ERROR("Heightfield: Needs at least 2x2 samples, got {}x{}", desc.columns, desc.rows);
+        return false;
+    }
+    if (!(desc.cellSize > 0.0f) || !(desc.maxHeightRadius >= 0.0f)) {
+        LOG_ERROR("Heightfield: Cell size must be positive and the max height radius not negative");
+        return false;
+    }
+
+    m_desc = desc;
+    m_cellColumns = desc.columns - 1;
+    m_cellRows = desc.rows - 1;
+    m_heights.resize(static_cast<size_t>(desc.columns) * desc.rows, desc.baseHeight);
+    m_maxHeights.resize(static_cast<size_t>(m_cellColumns) * m_cellRows, LOWEST_HEIGHT);
+    return true;
+}
+
+void Heightfield::BuildMaxHeights() {
+    // A bilinear cell never rises above its highest corner
+    for (uint32 row = 0; row < m_cellRows; ++row) {
+        for (uint32 column = 0; column < m_cellColumns; ++column) {
+            const float32* sample = m_heights.data() + row * m_desc.columns + column;
+            float32 corners = std::max({ sample[0], sample[1], sample[m_desc.columns], sample[m_desc.columns + 1] });
+            float32& cellMax = m_maxHeights[row * m_cellColumns + column];
+            cellMax = std::max(cellMax, corners);
+        }
+    }
+
+    // Every point within the radius of a cell lies in a cell at most this many steps away
+    uint32 radius = static_cast<uint32>(std::ceil(m_desc.maxHeightRadius / m_desc.cellSize));
+    if (radius == 0) {
+        return;
+    }
+    Vector<float32> scratch;
+    MaxFilter(m_maxHeights, scratch, m_cellColumns, 1, m_cellRows, m_cellColumns, radius);
+    MaxFilter(m_maxHeights, scratch, m_cellRows, m_cellColumns, m_cellColumns, 1, radius);
+}
+
+uint32 Heightfield::GetCellIndex(float32 x, float32 z) const {
+    float32 gridX = (x - m_desc.originX) / m_desc.cellSize;
+    float32 gridZ = (z - m_desc.originZ) / m_desc.cellSize;
+    uint32 column = static_cast<uint32>(std::clamp(gridX, 0.0f, static_cast<float32>(m_cellColumns - 1)));
+    uint32 row = static_cast<uint32>(std::clamp(gridZ, 0.0f, static_cast<float32>(m_cellRows - 1)));
+    return row * m_cellColumns + column;
+}
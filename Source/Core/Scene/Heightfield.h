@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include "../Utilities/MeshData.h"
+
+struct HeightfieldDesc {
+    uint32 columns = 0;             // Samples along x, at least 2
+    uint32 rows = 0;                // Samples along z, at least 2
+    float32 cellSize = 1.0f;        // World units between samples
+    float32 originX = 0.0f;         // World position of sample (0, 0)
+    float32 originZ = 0.0f;
+    float32 maxHeightRadius = 0.0f; // World units GetMaxHeight looks around a point
+    float32 baseHeight = 0.0f;      // Height where a mesh leaves no triangle above a sample
+};
+
+// Terrain height on a regular grid in the xz plane, for queries that must not cost a
+// raycast against meshes (camera clamping, placement). Heights are sampled once at
+// build time; lookups read a fixed number of samples.
+//
+// Alongside the samples it keeps, per cell, the highest terrain within maxHeightRadius
+// of that cell, so "how high do I have to stay around here" is also a single read.
+class Heightfield {
+public:
+    Heightfield() = default;
+    ~Heightfield() = default;
+
+    // Sample heightAt(x, z) at every grid point
+    bool Build(const HeightfieldDesc& desc, const Function<float32(float32, float32)>& heightAt);
+
+    // Highest triangle of a world-space mesh above every grid point. The max heights
+    // also cover every cell a triangle's bounds overlap, so features thinner than a
+    // cell still raise them.
+    bool BuildFromMesh(const HeightfieldDesc& desc, const MeshData& mesh);
+
+    // Bilinear height; points outside the grid take the nearest edge
+    float32 GetHeight(float32 x, float32 z) const;
+
+    // At least the highest terrain within maxHeightRadius of (x, z), rounded out to cells
+    float32 GetMaxHeight(float32 x, float32 z) const;
+
+    bool IsValid() const { return !m_heights.empty(); }
+    uint32 GetColumns() const { return m_desc.columns; }
+    uint32 GetRows() const { return m_desc.rows; }
+    float32 GetCellSize() const { return m_desc.cellSize; }
+    float32 GetMinX() const { return m_desc.originX; }
+    float32 GetMinZ() const { return m_desc.originZ; }
+    float32 GetMaxX() const { return m_desc.originX + m_desc.cellSize * static_cast<float32>(m_desc.columns - 1); }
+    float32 GetMaxZ() const { return m_desc.originZ + m_desc.cellSize * static_cast<float32>(m_desc.rows - 1); }
+    float32 GetMaxHeightRadius() const { return m_desc.maxHeightRadius; }
+
+private:
+    bool Initialize(const HeightfieldDesc& desc);
+
+    // Cell maxima from the samples (and whatever BuildFromMesh splatted), then widened
+    // by maxHeightRadius
+    void BuildMaxHeights();
+
+    // Cell containing a point, clamped to the grid
+    uint32 GetCellIndex(float32 x, float32 z) const;
+
+private:
+    HeightfieldDesc m_desc;
+    uint32 m_cellColumns = 0;
+    uint32 m_cellRows = 0;
+    Vector<float32> m_heights;      // columns x rows samples, row-major
+    Vector<float32> m_maxHeights;   // (columns - 1) x (rows - 1) cells
+
+    DECLARE_NON_COPYABLE(Heightfield);
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include <DirectXMath.h>
+
+// Render resources are shared with the render thread through reference counts, so a
+// packet keeps them alive even if their entity is destroyed while it is drawn.
+// Materials are not: the simulation edits them, so a draw copies what it binds.
+class Mesh;
+class Texture;
+
+enum class RenderDrawPipeline : uint8 {
+    Basic,      // Color only
+    Textured,   // Material textures bound
+    Emissive
+};
+
+struct RenderView {
+    DirectX::XMFLOAT4X4 view;
+    DirectX::XMFLOAT4X4 projection;
+    DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+    float32 fovY = 0.0f;
+    float32 nearPlane = 0.0f;
+    float32 viewportHeight = 0.0f;
+    float32 cullDistance = 0.0f;        // Draws farther from the eye were left out; 0 = no limit
+    float32 lodDistanceScale = 1.0f;    // Multiplies distances used to pick detail
+};
+
+struct RenderLight {
+    DirectX::XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+    DirectX::XMFLOAT3 color = { 1.0f, 1.0f, 1.0f };
+    float32 intensity = 0.0f;
+};
+
+// One visible mesh, with everything the render thread needs to draw it
+struct RenderDraw {
+    SharedPtr<Mesh> mesh;
+    SharedPtr<Texture> diffuseTexture;      // Textured pipeline; also reported to the texture streamer
+    DirectX::XMFLOAT4X4 world;              // Interpolated between simulation steps
+    DirectX::XMFLOAT3 boundsCenter = { 0.0f, 0.0f, 0.0f };     // World-space bounding sphere
+    float32 boundsRadius = 0.0f;
+    DirectX::XMFLOAT3 color = { 1.0f, 1.0f, 1.0f };
+    uint32 diffuseTextureSlot = 0;          // Root parameter the material binds the texture to
+    RenderDrawPipeline pipeline = RenderDrawPipeline::Basic;
+    EntityID entity = 0;
+};
+
+// Snapshot of a simulated frame for the render thread. The simulation fills it, then
+// hands it over and never touches it again; the renderer reads it, then empties it
+// once drawn. Nothing in it points at simulation state.
+struct RenderPacket {
+    uint64 frameIndex = 0;
+    int64 buildCounter = 0;                 // Platform counter when the simulation started the frame
+    float32 interpolationAlpha = 1.0f;
+
+    bool hasView = false;
+    RenderView view;
+    bool hasLight = false;
+    RenderLight light;
+    Vector<RenderDraw> draws;
+
+    // Empty the packet for reuse, keeping its allocations
+    void Reset() {
+        hasView = false;
+        hasLight = false;
+        draws.clear();
+    }
+};
@@ -1,11 +1,17 @@
 #include "Scene.h"
 #include "../Entity/Entity.h"
 #include "../Entity/TransformComponent.h"
-#include "../Entity/MeshComponent.h"
-#include "../../Platform/Windows/WindowsPlatform.h"
+#include "../../Platform/Platform.h"
 #include "../../Rendering/Renderer.h"
-#include "../../Rendering/Dx12/DX12Renderer.h"
-#include "../../Rendering/RHI/IRHIContext.h"
+#include "../../Rendering/RHI/IRHIContextPool.h"
+#include "../Threading/JobSystem.h"
+#include "../Logging/Logger.h"
+#include "../Profiling/Profiler.h"
+#include "RenderPacket.h"
+
+#ifdef _WIN32
+    #include "../../Rendering/Dx12/DX12Renderer.h"
+#endif
 
 Scene::Scene() {
     Platform::OutputDebugMessage("Scene created\n");
@@ -27,7 +33,7 @@ bool Scene::DestroyEntity(Entity* entity) {
 
     // Find the entity in our vector
     auto it = std::find_if(m_entities.begin(), m_entities.end(),
-        [entity](const UniquePtr<Entity>& ptr) { return ptr.get() == entity; });
+        [entity](const PoolPtr<Entity>& ptr) { return ptr.get() == entity; });
 
     if (it != m_entities.end()) {
         // Notify derived class
@@ -107,6 +113,7 @@ void Scene::EndPlay() {
 
 void Scene::Update(float deltaTime) {
     if (!m_isActive) return;
+    PROFILE_SCOPE("Scene::Update");
 
     for (auto& entity : m_entities) {
         if (entity && entity->IsActive()) {
@@ -115,9 +122,23 @@ void Scene::Update(float deltaTime) {
     }
 }
 
+void Scene::Simulate(float stepSeconds) {
+    if (!m_isActive) return;
+    PROFILE_SCOPE("Scene::Simulate");
+
+    for (auto& entity : m_entities) {
+        if (TransformComponent* transform = entity ? entity->GetComponent<TransformComponent>() : nullptr) {
+            transform->SavePreviousState();
+        }
+    }
+
+    Update(stepSeconds);
+}
+
 void Scene::Render(Renderer* renderer) {
     if (!m_isActive || !renderer) return;
 
+#ifdef _WIN32
     // Try to cast to DX12Renderer for now
     DX12Renderer* dx12Renderer = dynamic_cast<DX12Renderer*>(renderer);
     if (dx12Renderer) {
@@ -125,10 +146,14 @@ void Scene::Render(Renderer* renderer) {
     } else {
         Platform::OutputDebugMessage("Scene: Renderer is not DX12Renderer\n");
     }
+#else
+    Platform::OutputDebugMessage("Scene: No renderer backend on this platform, use Render(IRHIContext&)\n");
+#endif
 }
 
 void Scene::Render(DX12Renderer* renderer) {
     if (!m_isActive || !renderer) return;
+    PROFILE_SCOPE("Scene::Render");
 
     // Render all active entities
     for (auto& entity : m_entities) {
@@ -140,20 +165,50 @@ void Scene::Render(DX12Renderer* renderer) {
 
 void Scene::Render(IRHIContext& context) {
     if (!m_isActive) return;
+    PROFILE_SCOPE("Scene::Render");
 
     // Render all active entities using new RHI system
     for (auto& entity : m_entities) {
         if (entity && entity->IsActive()) {
-            // TODO: Add entity->Render(context) when Entity class is updated
-            // For now, we'll need to get MeshComponent directly
-            auto* meshComponent = entity->GetComponent<MeshComponent>();
-            if (meshComponent) {
-                meshComponent->Render(context);
-            }
+            entity->Render(context);
         }
     }
 }
 
+void Scene::BuildRenderPacket(RenderPacket& packet) {
+    if (!m_isActive) return;
+    PROFILE_SCOPE("Scene::BuildRenderPacket");
+
+    packet.interpolationAlpha = m_interpolationAlpha;
+    for (auto& entity : m_entities) {
+        if (entity && entity->IsActive()) {
+            entity->BuildRenderPacket(packet);
+        }
+    }
+}
+
+void Scene::Render(IRHIContextPool& contextPool, JobSystem& jobSystem, const Function<bool(const Entity&)>& isVisible) {
+    if (!m_isActive) return;
+    PROFILE_SCOPE("Scene::Render");
+
+    // Cull first and snapshot what is left, so every worker indexes the same stable array
+    // and culled entities do not unbalance the ranges
+    m_renderList.clear();
+    for (auto& entity : m_entities) {
+        if (entity && entity->IsActive() && (!isVisible || isVisible(*entity))) {
+            m_renderList.push_back(entity.get());
+        }
+    }
+
+    contextPool.RecordParallel(jobSystem, static_cast<uint32>(m_renderList.size()), m_minEntitiesPerRenderContext,
+        [this](IRHIContext& context, JobRange range) {
+            PROFILE_SCOPE("Scene::RecordContext");
+            for (uint32 i = range.begin; i < range.end; ++i) {
+                m_renderList[i]->Render(context);
+            }
+        });
+}
+
 EntityID Scene::GenerateEntityID() {
     return m_nextEntityID++;
 }
@@ -161,8 +216,7 @@ EntityID Scene::GenerateEntityID() {
 void Scene::RegisterEntity(Entity* entity) {
     if (entity) {
         m_entityLookup[entity->GetID()] = entity;
-        Platform::OutputDebugMessage("Scene: Registered entity ID " + std::to_string(entity->GetID()) +
-                                    " (" + entity->GetName() + ")\n");
+        LOG_DEBUG("Scene: Registered entity ID {} ({})", entity->GetID(), entity->GetName());
     }
 }
 
@@ -171,7 +225,7 @@ void Scene::UnregisterEntity(Entity* entity) {
         auto it = m_entityLookup.find(entity->GetID());
         if (it != m_entityLookup.end()) {
             m_entityLookup.erase(it);
-            Platform::OutputDebugMessage("Scene: Unregistered entity ID " + std::to_string(entity->GetID()) + "\n");
+            LOG_DEBUG("Scene: Unregistered entity ID {}", entity->GetID());
         }
     }
 }
\ No newline at end of file
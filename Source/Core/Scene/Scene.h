@@ -9,6 +9,9 @@
 
 class Renderer;
 class DX12Renderer;
+class IRHIContextPool;
+class JobSystem;
+struct RenderPacket;
 
 class Scene {
 public:
@@ -25,7 +28,7 @@ public:
     Entity* FindEntity(EntityID id) const;
     Entity* FindEntityByName(const String& name) const;
 
-    const Vector<UniquePtr<Entity>>& GetEntities() const { return m_entities; }
+    const Vector<PoolPtr<Entity>>& GetEntities() const { return m_entities; }
     size_t GetEntityCount() const { return m_entities.size(); }
 
     // Scene lifecycle
@@ -34,11 +37,32 @@ public:
     virtual void EndPlay();
     virtual void Update(float deltaTime);
 
+    // One fixed simulation step: keeps every transform's state for interpolation, then
+    // runs Update with the step length. Call once per FixedTimestep step.
+    void Simulate(float stepSeconds);
+
+    // How far rendering is between the previous and the current step (see FixedTimestep::GetAlpha)
+    float GetInterpolationAlpha() const { return m_interpolationAlpha; }
+    void SetInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+
     // ���������� ��� �������������
     virtual void Render(Renderer* renderer);
     virtual void Render(DX12Renderer* renderer); // �������� �������������
     virtual void Render(class IRHIContext& context); // ����� RHI �������������
 
+    // Records the active entities into the pool's contexts on the job system's workers.
+    // isVisible (e.g. a frustum test) filters them first, so the contexts split only what
+    // is drawn; without it every active entity is recorded. The list is split into
+    // contiguous ranges and the pool submits the contexts in order, so draw order matches
+    // Render(IRHIContext&). Entity::Render(IRHIContext&) must only touch shared resources
+    // read-only.
+    virtual void Render(IRHIContextPool& contextPool, JobSystem& jobSystem,
+                        const Function<bool(const Entity&)>& isVisible = nullptr);
+
+    // Snapshot the active entities' draws, blended by the interpolation alpha, into a
+    // packet the render thread can draw while the next step is simulated
+    virtual void BuildRenderPacket(RenderPacket& packet);
+
     // Scene properties
     const String& GetName() const { return m_name; }
     void SetName(const String& name) { m_name = name; }
@@ -46,6 +70,10 @@ public:
     bool IsActive() const { return m_isActive; }
     void SetActive(bool active) { m_isActive = active; }
 
+    // Smallest number of entities worth a context of their own when rendering in parallel
+    uint32 GetMinEntitiesPerRenderContext() const { return m_minEntitiesPerRenderContext; }
+    void SetMinEntitiesPerRenderContext(uint32 count) { m_minEntitiesPerRenderContext = count; }
+
 
 protected:
     virtual void OnEntitySpawned(Entity* entity) {}
@@ -54,12 +82,17 @@ protected:
 private:
     String m_name = "Untitled Scene";
     bool m_isActive = true;
+    float m_interpolationAlpha = 1.0f;  // Scenes that are not simulated render their current state
 
-    Vector<UniquePtr<Entity>> m_entities;
+    Vector<PoolPtr<Entity>> m_entities;     // Each entity type has its own pool
     std::unordered_map<EntityID, Entity*> m_entityLookup;
 
     EntityID m_nextEntityID = 1;
 
+    // Parallel rendering
+    Vector<Entity*> m_renderList;   // Visible entities of the current Render(IRHIContextPool&, ...)
+    uint32 m_minEntitiesPerRenderContext = 32;
+
     // Internal helpers
     EntityID GenerateEntityID();
     void RegisterEntity(Entity* entity);
@@ -74,7 +107,7 @@ T* Scene::SpawnEntity(Args&&... args) {
     static_assert(std::is_base_of_v<Entity, T>, "T must derive from Entity");
 
     EntityID id = GenerateEntityID();
-    auto entity = std::make_unique<T>(id, std::forward<Args>(args)...);
+    PoolPtr<T> entity = MakePooled<T>(MemoryTag::Entities, id, std::forward<Args>(args)...);
     T* entityPtr = entity.get();
 
     // Set scene reference
@@ -0,0 +1,138 @@
+#include "JobSystem.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+
+JobSystem::JobSystem(uint32 workerCount) {
+    if (workerCount == 0) {
+        uint32 hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+    }
+
+    m_workers.reserve(workerCount);
+    for (uint32 i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::WorkerMain, this);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_condition.notify_all();
+
+    for (std::thread& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+JobSystem& JobSystem::GetGlobal() {
+    static JobSystem s_globalJobSystem;
+    return s_globalJobSystem;
+}
+
+void JobSystem::ParallelFor(uint32 count, const Function<void(uint32)>& func) {
+    if (count == 0) {
+        return;
+    }
+
+    // Shared state outlives this call so helper jobs that start late can exit safely
+    struct ParallelForState {
+        std::atomic<uint32> nextIndex{ 0 };
+        std::atomic<uint32> completed{ 0 };
+        uint32 count = 0;
+        Function<void(uint32)> func;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+
+    auto state = std::make_shared<ParallelForState>();
+    state->count = count;
+    state->func = func;
+
+    auto runItems = [](ParallelForState& s) {
+        for (;;) {
+            uint32 index = s.nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (index >= s.count) {
+                return;
+            }
+
+            s.func(index);
+
+            if (s.completed.fetch_add(1, std::memory_order_acq_rel) + 1 == s.count) {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                s.done.notify_all();
+            }
+        }
+    };
+
+    // The calling thread takes part, so only count - 1 helpers are ever useful
+    uint32 helperCount = std::min(GetWorkerCount(), count - 1);
+    for (uint32 i = 0; i < helperCount; ++i) {
+        Enqueue([state, runItems]() { runItems(*state); });
+    }
+
+    runItems(*state);
+
+    // Wait on completed items rather than helper jobs: a helper may still be queued
+    // behind work that is itself blocked in a nested ParallelFor
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state]() {
+        return state->completed.load(std::memory_order_acquire) == state->count;
+    });
+}
+
+JobRange JobSystem::GetPartitionRange(uint32 count, uint32 partitionCount, uint32 partitionIndex) {
+    JobRange range;
+    if (partitionCount == 0 || partitionIndex >= partitionCount) {
+        return range;
+    }
+
+    // The first (count % partitionCount) slices take one extra item
+    uint32 baseSize = count / partitionCount;
+    uint32 remainder = count % partitionCount;
+    range.begin = partitionIndex * baseSize + std::min(partitionIndex, remainder);
+    range.end = range.begin + baseSize + (partitionIndex < remainder ? 1 : 0);
+    return range;
+}
+
+uint32 JobSystem::GetPartitionCount(uint32 count, uint32 maxPartitions, uint32 minItemsPerPartition) {
+    if (count == 0) {
+        return 0;
+    }
+
+    uint32 minItems = std::max(minItemsPerPartition, 1u);
+    uint32 partitions = count / minItems;
+    return std::clamp(partitions, 1u, std::max(maxPartitions, 1u));
+}
+
+void JobSystem::Enqueue(Function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+    }
+    m_condition.notify_one();
+}
+
+void JobSystem::WorkerMain() {
+    Profiler::GetGlobal().SetThreadName("Job Worker");
+
+    for (;;) {
+        Function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(lock, [this]() { return m_shutdown || !m_jobs.empty(); });
+
+            if (m_shutdown && m_jobs.empty()) {
+                return;
+            }
+
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+
+        job();
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// Contiguous [begin, end) slice of an index range
+struct JobRange {
+    uint32 begin = 0;
+    uint32 end = 0;
+
+    uint32 GetCount() const { return end - begin; }
+};
+
+// Fixed-size pool of worker threads executing fire-and-forget jobs
+class JobSystem {
+public:
+    // workerCount == 0 picks hardware_concurrency - 1 (at least one worker)
+    explicit JobSystem(uint32 workerCount = 0);
+    ~JobSystem();
+
+    // Process-wide pool shared by loaders and other engine systems
+    static JobSystem& GetGlobal();
+
+    // Queue a job; the returned future carries its result (or exception)
+    template<typename Func>
+    auto Submit(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>>>;
+
+    // Run func(index) for index in [0, count) across the workers and the calling thread.
+    // Blocks until every index has been processed. Safe to call from inside a job.
+    void ParallelFor(uint32 count, const Function<void(uint32)>& func);
+
+    // Split [0, count) into partitionCount slices whose sizes differ by at most one.
+    // Slice i always precedes slice i + 1, so per-slice results can be merged in index order.
+    static JobRange GetPartitionRange(uint32 count, uint32 partitionCount, uint32 partitionIndex);
+
+    // Slices to use so that each holds at least minItemsPerPartition items (0 only when count is 0)
+    static uint32 GetPartitionCount(uint32 count, uint32 maxPartitions, uint32 minItemsPerPartition);
+
+    // Accessors
+    uint32 GetWorkerCount() const { return static_cast<uint32>(m_workers.size()); }
+
+private:
+    void Enqueue(Function<void()> job);
+    void WorkerMain();
+
+private:
+    Vector<std::thread> m_workers;
+    std::deque<Function<void()>> m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_shutdown = false;
+
+    DECLARE_NON_COPYABLE(JobSystem);
+};
+
+template<typename Func>
+auto JobSystem::Submit(Func&& func) -> std::future<std::invoke_result_t<std::decay_t<Func>>> {
+    using Result = std::invoke_result_t<std::decay_t<Func>>;
+
+    // std::function requires copyable callables, so the packaged task lives behind a shared_ptr
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+    std::future<Result> future = task->get_future();
+    Enqueue([task]() { (*task)(); });
+    return future;
+}
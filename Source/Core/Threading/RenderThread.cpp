@@ -0,0 +1,127 @@
+#include "RenderThread.h"
+#include "../Memory/FrameMemory.h"
+#include "../Profiling/Profiler.h"
+#include "../../Platform/Platform.h"
+
+namespace {
+    float64 SecondsSince(int64 counter) {
+        return static_cast<float64>(Platform::GetPerformanceCounter() - counter) /
+               static_cast<float64>(Platform::GetPerformanceFrequency());
+    }
+}
+
+RenderThread::~RenderThread() {
+    Stop();
+}
+
+bool RenderThread::Start(const String& threadName) {
+    if (IsRunning() || !m_render) {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopRequested = false;
+    }
+    m_thread = std::thread(&RenderThread::ThreadMain, this, threadName);
+    return true;
+}
+
+void RenderThread::Stop() {
+    if (IsRunning()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopRequested = true;
+        }
+        m_submittedCondition.notify_one();
+        m_thread.join();
+    }
+
+    // Drop the packets' references so resources do not outlive the renderer
+    for (RenderPacket& packet : m_packets) {
+        packet.Reset();
+    }
+}
+
+RenderPacket& RenderThread::BeginPacket() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_submitted - m_rendered >= PACKET_COUNT) {
+        PROFILE_SCOPE("RenderThread::WaitForPacket");
+        int64 waitBegin = Platform::GetPerformanceCounter();
+        m_renderedCondition.wait(lock, [this]() { return m_submitted - m_rendered < PACKET_COUNT; });
+        m_stats.producerWaitSeconds += SecondsSince(waitBegin);
+    }
+
+    RenderPacket& packet = m_packets[m_submitted % PACKET_COUNT];
+    packet.Reset();
+    packet.frameIndex = m_submitted;
+    packet.buildCounter = Platform::GetPerformanceCounter();
+    return packet;
+}
+
+void RenderThread::SubmitPacket() {
+    if (!IsRunning()) {
+        RenderPacket& packet = m_packets[m_submitted % PACKET_COUNT];
+        if (m_render) {
+            m_render(packet);
+        }
+        packet.Reset();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_submitted;
+        ++m_rendered;
+        ++m_stats.packetsRendered;
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_submitted;
+    }
+    m_submittedCondition.notify_one();
+}
+
+void RenderThread::WaitForIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_renderedCondition.wait(lock, [this]() { return m_rendered == m_submitted; });
+}
+
+RenderThreadStats RenderThread::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void RenderThread::ThreadMain(String threadName) {
+    Profiler::GetGlobal().SetThreadName(threadName);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        if (m_rendered == m_submitted) {
+            if (m_stopRequested) {
+                return;
+            }
+            int64 waitBegin = Platform::GetPerformanceCounter();
+            m_submittedCondition.wait(lock, [this]() { return m_rendered < m_submitted || m_stopRequested; });
+            m_stats.renderIdleSeconds += SecondsSince(waitBegin);
+            continue;
+        }
+
+        // The simulation does not write a submitted packet until it has been rendered
+        RenderPacket& packet = m_packets[m_rendered % PACKET_COUNT];
+        lock.unlock();
+        {
+            PROFILE_SCOPE("RenderThread::Frame");
+            FrameMemory::BeginFrame();
+            m_render(packet);
+
+            // Drop the references here, so a resource whose entity was destroyed meanwhile
+            // is released on the thread that renders with it
+            packet.Reset();
+        }
+        lock.lock();
+
+        ++m_rendered;
+        ++m_stats.packetsRendered;
+        m_renderedCondition.notify_all();
+    }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "../Utilities/Types.h"
+#include "../Scene/RenderPacket.h"
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+struct RenderThreadStats {
+    uint64 packetsRendered = 0;
+    float64 producerWaitSeconds = 0.0;  // Simulation blocked waiting for a free packet
+    float64 renderIdleSeconds = 0.0;    // Render thread waiting for the next packet
+};
+
+// Runs rendering one frame behind the simulation. The simulation thread fills a packet
+// (BeginPacket/SubmitPacket) while the render thread draws the previous one; the two
+// packets are swapped through a mutex once per frame, so frame time becomes
+// max(simulation, render) instead of their sum. The simulation can be at most one
+// submitted packet ahead of the packet being drawn. A drawn packet is emptied by the
+// thread that drew it, so the last reference to a mesh, material or texture whose
+// entity was destroyed in the meantime is released on the render thread.
+//
+// Before Start (or after Stop) SubmitPacket renders inline on the calling thread, so
+// callers use the same path with or without the extra thread.
+class RenderThread {
+public:
+    static constexpr uint32 PACKET_COUNT = 2;
+
+    using RenderFunction = Function<void(const RenderPacket&)>;
+
+    RenderThread() = default;
+    ~RenderThread();
+
+    void SetRenderFunction(RenderFunction render) { m_render = std::move(render); }
+
+    bool Start(const String& threadName = "Render");
+    void Stop();    // Renders what was submitted, joins and empties the packets
+    bool IsRunning() const { return m_thread.joinable(); }
+
+    // Packet for the next frame, emptied; blocks while both packets are in use
+    RenderPacket& BeginPacket();
+
+    // Hand the packet from BeginPacket to the render thread
+    void SubmitPacket();
+
+    // Block until every submitted packet has been rendered. Afterwards the caller may
+    // use the renderer directly until it submits again.
+    void WaitForIdle();
+
+    RenderThreadStats GetStats() const;
+
+private:
+    void ThreadMain(String threadName);
+
+private:
+    RenderFunction m_render;
+    RenderPacket m_packets[PACKET_COUNT];
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_submittedCondition;
+    std::condition_variable m_renderedCondition;
+    uint64 m_submitted = 0;     // Packets handed over; the next one is m_packets[m_submitted % PACKET_COUNT]
+    uint64 m_rendered = 0;
+    bool m_stopRequested = false;
+    RenderThreadStats m_stats;
+
+    std::thread m_thread;
+
+    DECLARE_NON_COPYABLE(RenderThread);
+};
@@ -0,0 +1,108 @@
+#include "FileSystem.h"
+#include "../Assets/PackReader.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+
+namespace {
+    // Readers are only added/removed under the exclusive lock; lookups take the shared one
+    std::shared_mutex s_packMutex;
+    Vector<UniquePtr<PackReader>> s_mountedPacks;
+
+    bool ReadFromPacks(const String& filePath, Vector<uint8>& outData) {
+        std::shared_lock<std::shared_mutex> lock(s_packMutex);
+        for (auto it = s_mountedPacks.rbegin(); it != s_mountedPacks.rend(); ++it) {
+            if (const PackTocEntry* entry = (*it)->FindEntry(filePath)) {
+                return (*it)->ReadEntry(*entry, outData);
+            }
+        }
+        return false;
+    }
+
+    bool ExistsInPacks(const String& filePath) {
+        std::shared_lock<std::shared_mutex> lock(s_packMutex);
+        for (const UniquePtr<PackReader>& pack : s_mountedPacks) {
+            if (pack->Contains(filePath)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+bool FileSystem::MountPack(const String& packPath) {
+    auto pack = std::make_unique<PackReader>();
+    if (!pack->Open(packPath)) {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(s_packMutex);
+    s_mountedPacks.push_back(std::move(pack));
+    return true;
+}
+
+void FileSystem::UnmountAll() {
+    std::unique_lock<std::shared_mutex> lock(s_packMutex);
+    s_mountedPacks.clear();
+}
+
+uint32 FileSystem::GetMountedPackCount() {
+    std::shared_lock<std::shared_mutex> lock(s_packMutex);
+    return static_cast<uint32>(s_mountedPacks.size());
+}
+
+bool FileSystem::ReadFile(const String& filePath, Vector<uint8>& outData) {
+    if (ReadFromPacks(filePath, outData)) {
+        return true;
+    }
+
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::streamsize size = file.tellg();
+    if (size < 0) {
+        return false;
+    }
+
+    outData.resize(static_cast<size_t>(size));
+    file.seekg(0, std::ios::beg);
+    if (size > 0 && !file.read(reinterpret_cast<char*>(outData.data()), size)) {
+        outData.clear();
+        return false;
+    }
+
+    return true;
+}
+
+bool FileSystem::FileExists(const String& filePath) {
+    if (ExistsInPacks(filePath)) {
+        return true;
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    return file.is_open();
+}
+
+String FileSystem::GetExtension(const String& filePath) {
+    size_t dot = filePath.find_last_of('.');
+    size_t slash = filePath.find_last_of("/\\");
+    if (dot == String::npos || (slash != String::npos && dot < slash)) {
+        return String();
+    }
+
+    String extension = filePath.substr(dot);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension;
+}
+
+String FileSystem::NormalizePath(const String& filePath) {
+    String normalized = filePath;
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    return normalized;
+}
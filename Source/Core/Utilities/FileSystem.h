@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Types.h"
+
+class PackReader;
+
+// File access used by the asset loaders.
+// Mounted packs are searched (most recent first) before loose files on disk.
+class FileSystem {
+public:
+    // Pack mounting
+    static bool MountPack(const String& packPath);
+    static void UnmountAll();
+    static uint32 GetMountedPackCount();
+
+    // Read a whole file into memory
+    static bool ReadFile(const String& filePath, Vector<uint8>& outData);
+
+    static bool FileExists(const String& filePath);
+
+    // Lower-case extension including the dot (".bmp"), or empty
+    static String GetExtension(const String& filePath);
+
+    // Forward slashes only, so "a\\b.dds" and "a/b.dds" map to the same asset
+    static String NormalizePath(const String& filePath);
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Types.h"
+
+// 64-bit FNV-1a hashing. Stable across runs and platforms, so the results
+// can be stored on disk (asset content hashes, cache keys).
+constexpr uint64 FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+constexpr uint64 FNV1A_PRIME = 1099511628211ull;
+
+inline uint64 HashBytes(const void* data, size_t size, uint64 seed = FNV1A_OFFSET_BASIS) {
+    const uint8* bytes = static_cast<const uint8*>(data);
+    uint64 hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= FNV1A_PRIME;
+    }
+    return hash;
+}
+
+inline uint64 HashString(const String& text, uint64 seed = FNV1A_OFFSET_BASIS) {
+    return HashBytes(text.data(), text.size(), seed);
+}
+
+// Mix a value into an existing hash (order dependent)
+inline uint64 HashCombine(uint64 hash, uint64 value) {
+    return HashBytes(&value, sizeof(value), hash);
+}
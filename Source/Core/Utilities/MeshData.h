@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Types.h"
+#include <DirectXMath.h>
+
+// Vertex structure
+struct Vertex {
+    DirectX::XMFLOAT3 position;
+    DirectX::XMFLOAT3 normal;
+    DirectX::XMFLOAT2 texCoord;
+
+    Vertex() = default;
+    Vertex(const DirectX::XMFLOAT3& pos, const DirectX::XMFLOAT3& norm, const DirectX::XMFLOAT2& uv)
+        : position(pos), normal(norm), texCoord(uv) {}
+};
+
+// One drawable range inside the merged vertex/index buffers.
+// Indices are relative to baseVertex, so each range can be drawn on its own.
+struct SubMesh {
+    String name;
+    uint32 indexStart = 0;
+    uint32 indexCount = 0;
+    uint32 baseVertex = 0;
+    uint32 vertexCount = 0;
+    uint32 materialIndex = 0;
+
+    // Node-to-model transform of the source node (already baked into the vertices)
+    DirectX::XMFLOAT4X4 transform = {
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    };
+};
+
+// CPU-side geometry shared by importers and primitive generators
+struct MeshData {
+    Vector<Vertex> vertices;
+    Vector<uint32> indices;
+    Vector<SubMesh> subMeshes;
+
+    bool IsValid() const { return !vertices.empty() && !indices.empty() && !subMeshes.empty(); }
+};
@@ -0,0 +1,164 @@
+#include "MeshGeometry.h"
+#include <algorithm>
+#include <cmath>
+
+namespace MeshGeometry {
+
+namespace {
+    void AddWholeMeshSubMesh(MeshData& data, const String& name) {
+        data.subMeshes.clear();
+
+        SubMesh subMesh;
+        subMesh.name = name;
+        subMesh.indexCount = static_cast<uint32>(data.indices.size());
+        subMesh.vertexCount = static_cast<uint32>(data.vertices.size());
+        data.subMeshes.push_back(subMesh);
+    }
+}
+
+MeshData CreateCube() {
+    MeshData data;
+
+    // Cube vertices with normals and UVs
+    data.vertices = {
+        // Front face
+        { { -1.0f, -1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f } },
+        { {  1.0f, -1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f } },
+        { {  1.0f,  1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f } },
+        { { -1.0f,  1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f } },
+
+        // Back face
+        { {  1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f } },
+        { { -1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 1.0f } },
+        { { -1.0f,  1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 0.0f } },
+        { {  1.0f,  1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f } },
+
+        // Top face
+        { { -1.0f,  1.0f,  1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f } },
+        { {  1.0f,  1.0f,  1.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f } },
+        { {  1.0f,  1.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 0.0f } },
+        { { -1.0f,  1.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f } },
+
+        // Bottom face
+        { { -1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 1.0f } },
+        { {  1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f } },
+        { {  1.0f, -1.0f,  1.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 0.0f } },
+        { { -1.0f, -1.0f,  1.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f } },
+
+        // Right face
+        { {  1.0f, -1.0f,  1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f } },
+        { {  1.0f, -1.0f, -1.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f } },
+        { {  1.0f,  1.0f, -1.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f } },
+        { {  1.0f,  1.0f,  1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f } },
+
+        // Left face
+        { { -1.0f, -1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f } },
+        { { -1.0f, -1.0f,  1.0f }, { -1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f } },
+        { { -1.0f,  1.0f,  1.0f }, { -1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f } },
+        { { -1.0f,  1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f } }
+    };
+
+    // Cube indices
+    data.indices = {
+        // Front face
+        0, 1, 2,  2, 3, 0,
+        // Back face
+        4, 5, 6,  6, 7, 4,
+        // Top face
+        8, 9, 10,  10, 11, 8,
+        // Bottom face
+        12, 13, 14,  14, 15, 12,
+        // Right face
+        16, 17, 18,  18, 19, 16,
+        // Left face
+        20, 21, 22,  22, 23, 20
+    };
+
+    AddWholeMeshSubMesh(data, "Cube");
+    return data;
+}
+
+MeshData CreateSphere(uint32 stacks, uint32 slices) {
+    MeshData data;
+
+    const float PI = 3.14159265f;
+    const float radius = 1.0f;
+
+    // Generate vertices
+    for (uint32 stack = 0; stack <= stacks; ++stack) {
+        float phi = PI * stack / stacks; // From 0 to PI
+        float sinPhi = std::sin(phi);
+        float cosPhi = std::cos(phi);
+
+        for (uint32 slice = 0; slice <= slices; ++slice) {
+            float theta = 2.0f * PI * slice / slices; // From 0 to 2*PI
+            float sinTheta = std::sin(theta);
+            float cosTheta = std::cos(theta);
+
+            // Spherical coordinates to Cartesian
+            DirectX::XMFLOAT3 position;
+            position.x = radius * sinPhi * cosTheta;
+            position.y = radius * cosPhi;
+            position.z = radius * sinPhi * sinTheta;
+
+            // Normal is the same as position for unit sphere
+            DirectX::XMFLOAT3 normal = position;
+
+            // Texture coordinates
+            DirectX::XMFLOAT2 texCoord;
+            texCoord.x = static_cast<float>(slice) / slices;
+            texCoord.y = static_cast<float>(stack) / stacks;
+
+            data.vertices.emplace_back(position, normal, texCoord);
+        }
+    }
+
+    // Generate indices
+    for (uint32 stack = 0; stack < stacks; ++stack) {
+        for (uint32 slice = 0; slice < slices; ++slice) {
+            uint32 first = stack * (slices + 1) + slice;
+            uint32 second = first + slices + 1;
+
+            // First triangle
+            data.indices.push_back(first);
+            data.indices.push_back(second);
+            data.indices.push_back(first + 1);
+
+            // Second triangle
+            data.indices.push_back(second);
+            data.indices.push_back(second + 1);
+            data.indices.push_back(first + 1);
+        }
+    }
+
+    AddWholeMeshSubMesh(data, "Sphere");
+    return data;
+}
+
+void CalculateBounds(const Vector<Vertex>& vertices, DirectX::XMFLOAT3& outCenter, float& outRadius) {
+    if (vertices.empty()) {
+        outCenter = { 0.0f, 0.0f, 0.0f };
+        outRadius = 0.0f;
+        return;
+    }
+
+    DirectX::XMFLOAT3 minPos = vertices[0].position;
+    DirectX::XMFLOAT3 maxPos = vertices[0].position;
+    for (const Vertex& vertex : vertices) {
+        minPos = { std::min(minPos.x, vertex.position.x), std::min(minPos.y, vertex.position.y), std::min(minPos.z, vertex.position.z) };
+        maxPos = { std::max(maxPos.x, vertex.position.x), std::max(maxPos.y, vertex.position.y), std::max(maxPos.z, vertex.position.z) };
+    }
+
+    outCenter = { (minPos.x + maxPos.x) * 0.5f, (minPos.y + maxPos.y) * 0.5f, (minPos.z + maxPos.z) * 0.5f };
+
+    float radiusSq = 0.0f;
+    for (const Vertex& vertex : vertices) {
+        float dx = vertex.position.x - outCenter.x;
+        float dy = vertex.position.y - outCenter.y;
+        float dz = vertex.position.z - outCenter.z;
+        radiusSq = std::max(radiusSq, dx * dx + dy * dy + dz * dz);
+    }
+    outRadius = std::sqrt(radiusSq);
+}
+
+} // namespace MeshGeometry
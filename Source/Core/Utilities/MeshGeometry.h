@@ -0,0 +1,16 @@
+#pragma once
+
+#include "MeshData.h"
+
+// CPU-side primitive generators and geometry helpers. No GPU dependencies, so
+// headless builds can create and measure the same meshes the renderer draws.
+namespace MeshGeometry {
+    // Unit cube (-1..1) with per-face normals and UVs, one submesh
+    MeshData CreateCube();
+
+    // Unit-radius UV sphere, one submesh
+    MeshData CreateSphere(uint32 stacks = 20, uint32 slices = 20);
+
+    // Bounding sphere centered on the vertex AABB
+    void CalculateBounds(const Vector<Vertex>& vertices, DirectX::XMFLOAT3& outCenter, float& outRadius);
+}
@@ -0,0 +1,302 @@
+#include "MeshImporter.h"
+#include "FileSystem.h"
+#include "../Threading/JobSystem.h"
+#include "../../Platform/Platform.h"
+
+#include <assimp/Importer.hpp>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+#include <assimp/scene.h>
+#include <assimp/postprocess.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    // Read-only Assimp stream over a file loaded through FileSystem (mounted packs or disk)
+    class FileSystemIOStream : public Assimp::IOStream {
+    public:
+        explicit FileSystemIOStream(Vector<uint8>&& data) : m_data(std::move(data)) {}
+
+        size_t Read(void* buffer, size_t size, size_t count) override {
+            if (size == 0) {
+                return 0;
+            }
+            size_t available = (m_data.size() - m_position) / size;
+            size_t elements = count < available ? count : available;
+            std::memcpy(buffer, m_data.data() + m_position, elements * size);
+            m_position += elements * size;
+            return elements;
+        }
+
+        size_t Write(const void*, size_t, size_t) override { return 0; }
+
+        aiReturn Seek(size_t offset, aiOrigin origin) override {
+            size_t base = origin == aiOrigin_SET ? 0 : (origin == aiOrigin_CUR ? m_position : m_data.size());
+            if (base + offset > m_data.size()) {
+                return aiReturn_FAILURE;
+            }
+            m_position = base + offset;
+            return aiReturn_SUCCESS;
+        }
+
+        size_t Tell() const override { return m_position; }
+        size_t FileSize() const override { return m_data.size(); }
+        void Flush() override {}
+
+    private:
+        Vector<uint8> m_data;
+        size_t m_position = 0;
+    };
+
+    // Routes Assimp's file access (including companion files such as .mtl) through FileSystem
+    class FileSystemIOSystem : public Assimp::IOSystem {
+    public:
+        bool Exists(const char* filePath) const override {
+            return FileSystem::FileExists(filePath);
+        }
+
+        char getOsSeparator() const override { return '/'; }
+
+        Assimp::IOStream* Open(const char* filePath, const char* mode) override {
+            if (std::strchr(mode, 'w') || std::strchr(mode, 'a')) {
+                return nullptr;
+            }
+
+            Vector<uint8> data;
+            if (!FileSystem::ReadFile(filePath, data)) {
+                return nullptr;
+            }
+            return new FileSystemIOStream(std::move(data));
+        }
+
+        void Close(Assimp::IOStream* stream) override {
+            delete stream;
+        }
+    };
+
+    // A mesh referenced by a node, with the node's accumulated transform
+    struct MeshInstance {
+        uint32 meshIndex = 0;
+        aiMatrix4x4 transform;
+        String name;
+    };
+
+    void CollectMeshInstances(const aiNode* node, const aiMatrix4x4& parentTransform, Vector<MeshInstance>& instances) {
+        aiMatrix4x4 globalTransform = parentTransform * node->mTransformation;
+
+        for (uint32 i = 0; i < node->mNumMeshes; ++i) {
+            MeshInstance instance;
+            instance.meshIndex = node->mMeshes[i];
+            instance.transform = globalTransform;
+            instance.name = node->mName.C_Str();
+            instances.push_back(std::move(instance));
+        }
+
+        for (uint32 i = 0; i < node->mNumChildren; ++i) {
+            CollectMeshInstances(node->mChildren[i], globalTransform, instances);
+        }
+    }
+
+    // Counts the triangle indices a mesh produces and the primitives it cannot render.
+    // aiProcess_Triangulate has already split every polygon, so faces have 1 to 3 indices.
+    uint32 CountTriangleIndices(const aiMesh* mesh, MeshImportStats& stats) {
+        uint32 indexCount = 0;
+        for (uint32 i = 0; i < mesh->mNumFaces; ++i) {
+            uint32 faceIndices = mesh->mFaces[i].mNumIndices;
+            if (faceIndices == 3) {
+                indexCount += 3;
+                ++stats.triangles;
+            } else if (faceIndices == 2) {
+                ++stats.linesSkipped;
+            } else {
+                ++stats.pointsSkipped;
+            }
+        }
+        return indexCount;
+    }
+
+    // Assimp matrices act on column vectors; DirectXMath uses row vectors, hence the transpose
+    DirectX::XMFLOAT4X4 ToXMFloat4x4(const aiMatrix4x4& m) {
+        return DirectX::XMFLOAT4X4(
+            m.a1, m.b1, m.c1, m.d1,
+            m.a2, m.b2, m.c2, m.d2,
+            m.a3, m.b3, m.c3, m.d3,
+            m.a4, m.b4, m.c4, m.d4);
+    }
+
+    void ConvertMeshInstance(const aiMesh* mesh, const MeshInstance& instance, const SubMesh& subMesh, MeshData& data) {
+        // Normals need the inverse-transpose so non-uniform node scales stay correct
+        aiMatrix3x3 linearPart(instance.transform);
+        aiMatrix3x3 normalMatrix = linearPart;
+        normalMatrix.Inverse().Transpose();
+
+        // Mirroring transforms flip the triangle winding
+        bool flipWinding = linearPart.Determinant() < 0.0f;
+
+        Vertex* vertices = data.vertices.data() + subMesh.baseVertex;
+        for (uint32 i = 0; i < mesh->mNumVertices; ++i) {
+            Vertex& vertex = vertices[i];
+
+            aiVector3D position = instance.transform * mesh->mVertices[i];
+            vertex.position = { position.x, position.y, position.z };
+
+            if (mesh->HasNormals()) {
+                aiVector3D normal = normalMatrix * mesh->mNormals[i];
+                normal.NormalizeSafe();
+                vertex.normal = { normal.x, normal.y, normal.z };
+            } else {
+                vertex.normal = { 0.0f, 1.0f, 0.0f };
+            }
+
+            if (mesh->mTextureCoords[0]) {
+                vertex.texCoord = { mesh->mTextureCoords[0][i].x, mesh->mTextureCoords[0][i].y };
+            } else {
+                vertex.texCoord = { 0.0f, 0.0f };
+            }
+        }
+
+        uint32* indices = data.indices.data() + subMesh.indexStart;
+        uint32 written = 0;
+        for (uint32 i = 0; i < mesh->mNumFaces; ++i) {
+            const aiFace& face = mesh->mFaces[i];
+            if (face.mNumIndices != 3) {
+                continue;
+            }
+            indices[written++] = face.mIndices[0];
+            indices[written++] = face.mIndices[flipWinding ? 2 : 1];
+            indices[written++] = face.mIndices[flipWinding ? 1 : 2];
+        }
+    }
+}
+
+float32 MeshImportProgress::GetProgress() const {
+    if (IsFinished()) {
+        return 1.0f;
+    }
+
+    uint32 total = std::max(m_stepsTotal.load(std::memory_order_acquire), 1u);
+    uint32 done = std::min(m_stepsDone.load(std::memory_order_acquire), total);
+    return static_cast<float32>(done) / static_cast<float32>(total);
+}
+
+MeshData MeshImporter::LoadFromFile(const String& filePath, MeshImportStats* outStats, MeshImportProgress* progress) {
+    // Every return below counts as finished, including the failures
+    struct FinishOnExit {
+        MeshImportProgress* progress;
+        ~FinishOnExit() {
+            if (progress) {
+                progress->m_finished.store(true, std::memory_order_release);
+            }
+        }
+    } finishOnExit{ progress };
+
+    Platform::OutputDebugMessage("MeshImporter: Loading mesh from file: " + filePath + "\n");
+
+    MeshData result;
+    Assimp::Importer importer;
+    importer.SetIOHandler(new FileSystemIOSystem()); // The importer takes ownership
+
+    // Assimp triangulates polygons (concave ones included). Points and lines are kept in
+    // their own meshes (SortByPType) and reported below instead of being removed silently.
+    const aiScene* scene = importer.ReadFile(filePath,
+        aiProcess_Triangulate |
+        aiProcess_GenNormals |
+        aiProcess_FlipUVs |
+        aiProcess_CalcTangentSpace |
+        aiProcess_JoinIdenticalVertices |
+        aiProcess_SortByPType |
+        aiProcess_ImproveCacheLocality |
+        aiProcess_OptimizeMeshes |
+        aiProcess_ValidateDataStructure
+    );
+
+    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
+        Platform::OutputDebugMessage("MeshImporter: Error loading mesh: " + String(importer.GetErrorString()) + "\n");
+        return result;
+    }
+
+    if (scene->mNumMeshes == 0) {
+        Platform::OutputDebugMessage("MeshImporter: No meshes found in file: " + filePath + "\n");
+        return result;
+    }
+
+    // Walk the node hierarchy; a mesh referenced by several nodes becomes several submeshes
+    Vector<MeshInstance> instances;
+    CollectMeshInstances(scene->mRootNode, aiMatrix4x4(), instances);
+
+    // Lay out the merged buffers up front so workers can write their ranges without locking
+    MeshImportStats stats;
+    Vector<uint32> instanceIndexCounts(instances.size(), 0);
+    uint32 vertexTotal = 0;
+    uint32 indexTotal = 0;
+
+    Vector<uint32> convertList;
+    convertList.reserve(instances.size());
+
+    for (size_t i = 0; i < instances.size(); ++i) {
+        const aiMesh* mesh = scene->mMeshes[instances[i].meshIndex];
+        uint32 indexCount = CountTriangleIndices(mesh, stats);
+        if (indexCount == 0) {
+            continue; // Point or line mesh, counted in stats
+        }
+
+        SubMesh subMesh;
+        subMesh.name = instances[i].name.empty() ? String(mesh->mName.C_Str()) : instances[i].name;
+        subMesh.indexStart = indexTotal;
+        subMesh.indexCount = indexCount;
+        subMesh.baseVertex = vertexTotal;
+        subMesh.vertexCount = mesh->mNumVertices;
+        subMesh.materialIndex = mesh->mMaterialIndex;
+        subMesh.transform = ToXMFloat4x4(instances[i].transform);
+
+        vertexTotal += mesh->mNumVertices;
+        indexTotal += indexCount;
+
+        convertList.push_back(static_cast<uint32>(i));
+        result.subMeshes.push_back(std::move(subMesh));
+    }
+
+    stats.meshInstances = static_cast<uint32>(result.subMeshes.size());
+
+    if (result.subMeshes.empty()) {
+        Platform::OutputDebugMessage("MeshImporter: File contains no triangle geometry: " + filePath + "\n");
+        return result;
+    }
+
+    result.vertices.resize(vertexTotal);
+    result.indices.resize(indexTotal);
+
+    // Reading and parsing was the first step; one more per converted instance
+    if (progress) {
+        progress->m_stepsTotal.store(static_cast<uint32>(convertList.size()) + 1, std::memory_order_release);
+        progress->m_stepsDone.store(1, std::memory_order_release);
+    }
+
+    // Convert every mesh instance in parallel; each writes only its own submesh range
+    JobSystem::GetGlobal().ParallelFor(static_cast<uint32>(convertList.size()), [&](uint32 i) {
+        const MeshInstance& instance = instances[convertList[i]];
+        ConvertMeshInstance(scene->mMeshes[instance.meshIndex], instance, result.subMeshes[i], result);
+
+        if (progress) {
+            progress->m_stepsDone.fetch_add(1, std::memory_order_acq_rel);
+        }
+    });
+
+    Platform::OutputDebugMessage("MeshImporter: Loaded " + filePath +
+                                 " - Submeshes: " + std::to_string(stats.meshInstances) +
+                                 ", Vertices: " + std::to_string(vertexTotal) +
+                                 ", Triangles: " + std::to_string(stats.triangles) + "\n");
+
+    if (stats.pointsSkipped > 0 || stats.linesSkipped > 0) {
+        Platform::OutputDebugMessage("MeshImporter: Warning: skipped " + std::to_string(stats.pointsSkipped) +
+                                     " point and " + std::to_string(stats.linesSkipped) +
+                                     " line primitives (not renderable as triangles)\n");
+    }
+
+    if (outStats) {
+        *outStats = stats;
+    }
+
+    return result;
+}
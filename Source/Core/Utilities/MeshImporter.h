@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Types.h"
+#include "MeshData.h"
+#include <atomic>
+
+// Progress of an import running on another thread. Reading and parsing the file is one
+// step, then every converted mesh instance is one more; safe to poll from any thread.
+class MeshImportProgress {
+public:
+    MeshImportProgress() = default;
+
+    // In [0, 1]; 1 once every step is done, also when the import failed
+    float32 GetProgress() const;
+    bool IsFinished() const { return m_finished.load(std::memory_order_acquire); }
+
+private:
+    friend class MeshImporter;
+
+    std::atomic<uint32> m_stepsDone{ 0 };
+    std::atomic<uint32> m_stepsTotal{ 1 };
+    std::atomic<bool> m_finished{ false };
+
+    DECLARE_NON_COPYABLE(MeshImportProgress);
+};
+
+// Mesh import statistics gathered while converting a scene
+struct MeshImportStats {
+    uint32 meshInstances = 0;       // (node, mesh) pairs turned into submeshes
+    uint32 triangles = 0;
+    uint32 pointsSkipped = 0;
+    uint32 linesSkipped = 0;
+};
+
+// Mesh loader utility class (Assimp-backed)
+class MeshImporter {
+public:
+    // Import every mesh referenced by the node hierarchy into one merged MeshData.
+    // Node transforms are baked into the vertices; one submesh is emitted per mesh instance.
+    // Background loads go through AssetManager::LoadMesh, which reports progress on its handle.
+    static MeshData LoadFromFile(const String& filePath, MeshImportStats* outStats = nullptr,
+                                 MeshImportProgress* progress = nullptr);
+};
@@ -1,13 +1,15 @@
 #include "TextureLoader.h"
-#include "../../Platform/Windows/WindowsPlatform.h"
-#include <fstream>
+#include "FileSystem.h"
+#include "../../Platform/Platform.h"
 #include <algorithm>
+#include <cstring>
 
 TextureImageData TextureLoader::LoadFromFile(const String& filePath) {
     // Determine file type by extension
-    if (filePath.ends_with(".bmp") || filePath.ends_with(".BMP")) {
+    String extension = FileSystem::GetExtension(filePath);
+    if (extension == ".bmp") {
         return LoadBMP(filePath);
-    } else if (filePath.ends_with(".dds") || filePath.ends_with(".DDS")) {
+    } else if (extension == ".dds") {
         return LoadDDS(filePath);
     }
     
@@ -18,22 +20,44 @@ TextureImageData TextureLoader::LoadFromFile(const String& filePath) {
     return CreateTestPattern(64, 64, "checkerboard");
 }
 
+TextureImageData TextureLoader::LoadFromMemory(const uint8* data, size_t size, const String& filePath) {
+    // The path is only used to pick the decoder and for diagnostics
+    String extension = FileSystem::GetExtension(filePath);
+    if (extension == ".bmp") {
+        return LoadBMPFromMemory(data, size, filePath);
+    } else if (extension == ".dds") {
+        return LoadDDS(filePath);
+    }
+
+    Platform::OutputDebugMessage("TextureLoader: Unsupported file format: " + filePath + "\n");
+    return CreateTestPattern(64, 64, "checkerboard");
+}
+
 TextureImageData TextureLoader::LoadBMP(const String& filePath) {
+    Vector<uint8> fileData;
+    if (!FileSystem::ReadFile(filePath, fileData)) {
+        Platform::OutputDebugMessage("TextureLoader: Failed to open file: " + filePath + "\n");
+        return TextureImageData();
+    }
+
+    return LoadBMPFromMemory(fileData.data(), fileData.size(), filePath);
+}
+
+TextureImageData TextureLoader::LoadBMPFromMemory(const uint8* data, size_t size, const String& filePath) {
     TextureImageData result;
     
-    std::ifstream file(filePath, std::ios::binary);
-    if (!file.is_open()) {
-        Platform::OutputDebugMessage("TextureLoader: Failed to open file: " + filePath + "\n");
+    if (!data || size < sizeof(BMPFileHeader) + sizeof(BMPInfoHeader)) {
+        Platform::OutputDebugMessage("TextureLoader: BMP data too small: " + filePath + "\n");
         return result;
     }
     
     // Read file header
     BMPFileHeader fileHeader;
-    file.read(reinterpret_cast<char*>(&fileHeader), sizeof(BMPFileHeader));
+    memcpy(&fileHeader, data, sizeof(BMPFileHeader));
     
     // Read info header
     BMPInfoHeader infoHeader;
-    file.read(reinterpret_cast<char*>(&infoHeader), sizeof(BMPInfoHeader));
+    memcpy(&infoHeader, data + sizeof(BMPFileHeader), sizeof(BMPInfoHeader));
     
     if (!ValidateBMPHeaders(fileHeader, infoHeader)) {
         Platform::OutputDebugMessage("TextureLoader: Invalid BMP file: " + filePath + "\n");
@@ -46,20 +70,19 @@ TextureImageData TextureLoader::LoadBMP(const String& filePath) {
     result.channels = 4; // Always convert to RGBA
     
     // Calculate source data size
-    uint32 bytesPerPixel = infoHeader.biBitCount / 8;
     uint32 rowSize = ((infoHeader.biBitCount * result.width + 31) / 32) * 4; // BMP rows are padded to 4 bytes
-    uint32 sourceDataSize = rowSize * result.height;
+    uint64 sourceDataSize = static_cast<uint64>(rowSize) * result.height;
     
-    // Read source data
-    auto sourceData = std::make_unique<uint8[]>(sourceDataSize);
-    file.seekg(fileHeader.bfOffBits, std::ios::beg);
-    file.read(reinterpret_cast<char*>(sourceData.get()), sourceDataSize);
+    if (fileHeader.bfOffBits > size || size - fileHeader.bfOffBits < sourceDataSize) {
+        Platform::OutputDebugMessage("TextureLoader: Truncated BMP pixel data: " + filePath + "\n");
+        return TextureImageData();
+    }
     
     // Allocate destination data
     result.pixels = std::make_unique<uint8[]>(result.GetDataSize());
     
     // Convert to RGBA
-    ConvertToRGBA(sourceData.get(), result.pixels.get(), result.width, result.height, infoHeader.biBitCount);
+    ConvertToRGBA(data + fileHeader.bfOffBits, result.pixels.get(), result.width, result.height, infoHeader.biBitCount);
     
     // BMP images are stored bottom-to-top, so flip vertically
     if (infoHeader.biHeight > 0) {
@@ -254,4 +277,76 @@ TextureImageData TextureLoader::CreateUVTest(uint32 width, uint32 height) {
     }
     
     return result;
-}
\ No newline at end of file
+}
+
+uint32 TextureLoader::CalculateMipCount(uint32 width, uint32 height) {
+    uint32 mipCount = 1;
+    uint32 size = std::max(width, height);
+    while (size > 1) {
+        size >>= 1;
+        ++mipCount;
+    }
+    return mipCount;
+}
+
+TextureImageData TextureLoader::GenerateMip(const TextureImageData& source) {
+    TextureImageData result;
+    result.width = std::max(1u, source.width / 2);
+    result.height = std::max(1u, source.height / 2);
+    result.channels = 4;
+    result.pixels = std::make_unique<uint8[]>(result.GetDataSize());
+
+    // 2x2 box filter; odd edges and 1-pixel axes clamp to the last source texel
+    for (uint32 y = 0; y < result.height; ++y) {
+        uint32 y0 = std::min(y * 2, source.height - 1);
+        uint32 y1 = std::min(y * 2 + 1, source.height - 1);
+
+        for (uint32 x = 0; x < result.width; ++x) {
+            uint32 x0 = std::min(x * 2, source.width - 1);
+            uint32 x1 = std::min(x * 2 + 1, source.width - 1);
+
+            const uint8* p00 = source.pixels.get() + (y0 * source.width + x0) * 4;
+            const uint8* p01 = source.pixels.get() + (y0 * source.width + x1) * 4;
+            const uint8* p10 = source.pixels.get() + (y1 * source.width + x0) * 4;
+            const uint8* p11 = source.pixels.get() + (y1 * source.width + x1) * 4;
+            uint8* dst = result.pixels.get() + (y * result.width + x) * 4;
+
+            for (uint32 c = 0; c < 4; ++c) {
+                dst[c] = static_cast<uint8>((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+            }
+        }
+    }
+
+    return result;
+}
+
+Vector<TextureImageData> TextureLoader::GenerateMipChain(const TextureImageData& image, uint32 firstMip) {
+    Vector<TextureImageData> mips;
+    if (!image.IsValid()) {
+        return mips;
+    }
+
+    uint32 mipCount = CalculateMipCount(image.width, image.height);
+    if (firstMip >= mipCount) {
+        return mips;
+    }
+    mips.reserve(mipCount - firstMip);
+
+    // Mip 0 is copied so the caller's image stays untouched
+    TextureImageData current;
+    current.width = image.width;
+    current.height = image.height;
+    current.channels = 4;
+    current.pixels = std::make_unique<uint8[]>(image.GetDataSize());
+    std::memcpy(current.pixels.get(), image.pixels.get(), image.GetDataSize());
+
+    for (uint32 mip = 0; mip < mipCount; ++mip) {
+        TextureImageData next = mip + 1 < mipCount ? GenerateMip(current) : TextureImageData();
+        if (mip >= firstMip) {
+            mips.push_back(std::move(current));
+        }
+        current = std::move(next);
+    }
+
+    return mips;
+}
@@ -44,6 +44,9 @@ class TextureLoader {
 public:
     // Load texture from file (supports .bmp and .dds)
     static TextureImageData LoadFromFile(const String& filePath);
+
+    // Decode an already loaded file; filePath selects the format by extension
+    static TextureImageData LoadFromMemory(const uint8* data, size_t size, const String& filePath);
     
     // Create test textures programmatically
     static TextureImageData CreateTestPattern(uint32 width, uint32 height, const String& pattern = "checkerboard");
@@ -51,9 +54,17 @@ public:
     static TextureImageData CreateGradient(uint32 width, uint32 height);
     static TextureImageData CreateUVTest(uint32 width, uint32 height);
 
+    // Mip chains (box filtered, RGBA8)
+    static uint32 CalculateMipCount(uint32 width, uint32 height);
+    static TextureImageData GenerateMip(const TextureImageData& source);
+
+    // Mips [firstMip, CalculateMipCount) of the image; smaller index = more detail
+    static Vector<TextureImageData> GenerateMipChain(const TextureImageData& image, uint32 firstMip = 0);
+
 private:
     // Format specific loading
     static TextureImageData LoadBMP(const String& filePath);
+    static TextureImageData LoadBMPFromMemory(const uint8* data, size_t size, const String& filePath);
     static TextureImageData LoadDDS(const String& filePath);
     
     // Helper functions
@@ -70,6 +70,17 @@ struct Handle {
     ClassName(ClassName&&) = delete; \
     ClassName& operator=(ClassName&&) = delete;
 
+// Implemented by the platform layer (see Platform/Platform.h)
+namespace Platform {
+    void ReportAssertionFailure(const std::string& message);
+}
+
+#if defined(_MSC_VER)
+    #define DEBUG_BREAK() __debugbreak()
+#else
+    #define DEBUG_BREAK() __builtin_trap()
+#endif
+
 // Debug macros
 #ifdef _DEBUG
     #define DEBUG_BUILD 1
@@ -79,8 +90,8 @@ struct Handle {
                 std::string msg = "Assertion failed: " + std::string(message) + \
                                   "\nFile: " + __FILE__ + \
                                   "\nLine: " + std::to_string(__LINE__); \
-                MessageBoxA(nullptr, msg.c_str(), "Assertion Failed", MB_OK | MB_ICONERROR); \
-                __debugbreak(); \
+                Platform::ReportAssertionFailure(msg); \
+                DEBUG_BREAK(); \
             } \
         } while(0)
 #else
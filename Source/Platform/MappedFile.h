@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+
+// Read-only memory mapping of a whole file.
+// Implemented per platform (Windows/WindowsMappedFile.cpp, Posix/PosixMappedFile.cpp).
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    bool Open(const String& filePath);
+    void Close();
+
+    // Accessors
+    bool IsOpen() const { return m_data != nullptr; }
+    const uint8* GetData() const { return m_data; }
+    uint64 GetSize() const { return m_size; }
+
+private:
+    const uint8* m_data = nullptr;
+    uint64 m_size = 0;
+
+    // Native handles (file and mapping object on Windows, unused on POSIX)
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+
+    DECLARE_NON_COPYABLE(MappedFile);
+};
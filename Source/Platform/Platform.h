@@ -0,0 +1,21 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+
+// Platform services that need no OS types in their signatures, so platform-neutral
+// code (Core runtime, headless builds) can use them without pulling in windows.h.
+// Implemented per platform (Windows/WindowsPlatform.cpp, Posix/PosixPlatform.cpp).
+namespace Platform {
+    String WStringToString(const WString& wstr);
+    WString StringToWString(const String& str);
+
+    void ShowMessageBox(const String& title, const String& message);
+    void OutputDebugMessage(const String& message);
+
+    // Called by ASSERT before it breaks into the debugger
+    void ReportAssertionFailure(const String& message);
+
+    // Monotonic high resolution clock
+    int64 GetPerformanceCounter();
+    int64 GetPerformanceFrequency();
+}
@@ -0,0 +1,97 @@
+#include "../Platform.h"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+namespace Platform {
+
+namespace {
+    // UTF-8 <-> UTF-32 (wchar_t is 32 bits on POSIX targets)
+    void AppendUtf8(String& out, uint32 codePoint) {
+        if (codePoint < 0x80) {
+            out.push_back(static_cast<char>(codePoint));
+        } else if (codePoint < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        } else if (codePoint < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    // Debug output is emitted every frame; like OutputDebugString without a debugger
+    // attached it goes nowhere unless RTS_DEBUG_OUTPUT is set
+    bool IsDebugOutputEnabled() {
+        static const bool enabled = std::getenv("RTS_DEBUG_OUTPUT") != nullptr;
+        return enabled;
+    }
+}
+
+String WStringToString(const WString& wstr) {
+    String result;
+    result.reserve(wstr.size());
+    for (wchar_t c : wstr) {
+        AppendUtf8(result, static_cast<uint32>(c));
+    }
+    return result;
+}
+
+WString StringToWString(const String& str) {
+    WString result;
+    result.reserve(str.size());
+
+    size_t i = 0;
+    while (i < str.size()) {
+        uint8 lead = static_cast<uint8>(str[i]);
+        uint32 codePoint = lead;
+        size_t length = 1;
+
+        if (lead >= 0xF0)      { codePoint = lead & 0x07; length = 4; }
+        else if (lead >= 0xE0) { codePoint = lead & 0x0F; length = 3; }
+        else if (lead >= 0xC0) { codePoint = lead & 0x1F; length = 2; }
+
+        if (i + length > str.size()) {
+            break;
+        }
+        for (size_t j = 1; j < length; ++j) {
+            codePoint = (codePoint << 6) | (static_cast<uint8>(str[i + j]) & 0x3F);
+        }
+
+        result.push_back(static_cast<wchar_t>(codePoint));
+        i += length;
+    }
+    return result;
+}
+
+void ShowMessageBox(const String& title, const String& message) {
+    std::fprintf(stderr, "[%s] %s\n", title.c_str(), message.c_str());
+}
+
+void OutputDebugMessage(const String& message) {
+    if (IsDebugOutputEnabled()) {
+        std::fputs(message.c_str(), stderr);
+    }
+}
+
+void ReportAssertionFailure(const String& message) {
+    std::fprintf(stderr, "%s\n", message.c_str());
+    std::fflush(stderr);
+}
+
+int64 GetPerformanceCounter() {
+    timespec now = {};
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<int64>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+}
+
+int64 GetPerformanceFrequency() {
+    return 1000000000LL;
+}
+
+} // namespace Platform
@@ -37,4 +37,21 @@ void OutputDebugMessage(const String& message) {
     OutputDebugStringW(wMessage.c_str());
 }
 
+void ReportAssertionFailure(const String& message) {
+    OutputDebugMessage(message + "\n");
+    MessageBoxA(nullptr, message.c_str(), "Assertion Failed", MB_OK | MB_ICONERROR);
+}
+
+int64 GetPerformanceCounter() {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+
+int64 GetPerformanceFrequency() {
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return frequency.QuadPart;
+}
+
 } // namespace Platform
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Core/Utilities/Types.h"
+#include "../Platform.h"
 
 // Windows includes
 #define WIN32_LEAN_AND_MEAN
@@ -77,12 +78,3 @@ private:
             THROW_IF_FAILED(HRESULT_FROM_WIN32(GetLastError()), function); \
         } \
     } while(0)
-
-// Utility functions
-namespace Platform {
-    String WStringToString(const WString& wstr);
-    WString StringToWString(const String& str);
-
-    void ShowMessageBox(const String& title, const String& message);
-    void OutputDebugMessage(const String& message);
-}
\ No newline at end of file
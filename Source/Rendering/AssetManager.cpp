@@ -0,0 +1,483 @@
+#include "AssetManager.h"
+#include "Dx12/DX12Renderer.h"
+#include "Bindable/Texture.h"
+#include "TextureStreamer.h"
+#include "Mesh.h"
+#include "../Core/Utilities/FileSystem.h"
+#include "../Core/Utilities/Hash.h"
+#include "../Core/Utilities/MeshImporter.h"
+#include "../Core/Profiling/Profiler.h"
+#include "../Platform/Windows/WindowsPlatform.h"
+#include <algorithm>
+
+namespace {
+    String MakeAssetKey(AssetType type, const String& filePath) {
+        return (type == AssetType::Texture ? "texture:" : "mesh:") + FileSystem::NormalizePath(filePath);
+    }
+}
+
+AssetManager::AssetManager(DX12Renderer& renderer, uint64 budgetBytes)
+    : m_renderer(renderer) {
+    m_stats.budgetBytes = budgetBytes;
+
+    // Slot 0 stays unused so a zero Handle is always invalid
+    m_entries.emplace_back();
+
+    m_ioThread = std::thread(&AssetManager::IoThreadMain, this);
+    Platform::OutputDebugMessage("AssetManager: Created with budget " + std::to_string(budgetBytes / (1024 * 1024)) + " MB\n");
+}
+
+AssetManager::~AssetManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_ioMutex);
+        m_shutdown = true;
+        m_requests.clear();
+    }
+    m_ioCondition.notify_all();
+
+    if (m_ioThread.joinable()) {
+        m_ioThread.join();
+    }
+
+    // The renderer waits for the GPU before destroying the asset manager
+    m_retired.clear();
+    m_entries.clear();
+}
+
+// Each request holds the lock until its handle has a reference, so the render thread
+// cannot evict a cached entry in between
+TextureHandle AssetManager::LoadTexture(const String& filePath, LoadCallback onComplete) {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    return TextureHandle(this, RequestLoad(AssetType::Texture, filePath, std::move(onComplete)));
+}
+
+MeshHandle AssetManager::LoadMesh(const String& filePath, LoadCallback onComplete) {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    return MeshHandle(this, RequestLoad(AssetType::Mesh, filePath, std::move(onComplete)));
+}
+
+MeshHandle AssetManager::CreateCube() {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    return MeshHandle(this, FindOrCreateBuiltin("builtin:cube", [this](Mesh& mesh) {
+        return mesh.CreateCube(&m_renderer);
+    }));
+}
+
+MeshHandle AssetManager::CreateSphere(uint32 stacks, uint32 slices) {
+    String key = "builtin:sphere_" + std::to_string(stacks) + "x" + std::to_string(slices);
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    return MeshHandle(this, FindOrCreateBuiltin(key, [this, stacks, slices](Mesh& mesh) {
+        return mesh.CreateSphere(&m_renderer, stacks, slices);
+    }));
+}
+
+void AssetManager::SetBudget(uint64 budgetBytes) {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    m_stats.budgetBytes = budgetBytes;
+}
+
+AssetManagerStats AssetManager::GetStats() const {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    return m_stats;
+}
+
+void AssetManager::Update() {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    ++m_frameNumber;
+
+    ProcessCompletedLoads();
+    EvictOverBudget();
+    ReleaseRetiredAssets();
+}
+
+void AssetManager::AddRef(const Handle& handle) {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    AssetEntry* entry = FindEntry(handle);
+    if (!entry) {
+        return;
+    }
+
+    if (entry->refCount++ == 0 && entry->inLru) {
+        m_lru.erase(entry->lruPosition);
+        entry->inLru = false;
+    }
+}
+
+void AssetManager::Release(const Handle& handle) {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    AssetEntry* entry = FindEntry(handle);
+    if (!entry || entry->refCount == 0) {
+        return;
+    }
+
+    if (--entry->refCount == 0) {
+        // Unreferenced assets stay cached until the budget forces them out
+        entry->lruPosition = m_lru.insert(m_lru.end(), handle.index);
+        entry->inLru = true;
+    }
+}
+
+AssetState AssetManager::GetState(const Handle& handle) const {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    const AssetEntry* entry = FindEntry(handle);
+    return entry ? entry->state : AssetState::Failed;
+}
+
+float32 AssetManager::GetProgress(const Handle& handle) const {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    const AssetEntry* entry = FindEntry(handle);
+    if (!entry || entry->state != AssetState::Loading) {
+        return 1.0f;
+    }
+    return entry->progress ? entry->progress->GetProgress() : 0.0f;
+}
+
+template<>
+SharedPtr<Texture> AssetManager::GetAsset<Texture>(const Handle& handle) const {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    const AssetEntry* entry = FindEntry(handle);
+    return (entry && entry->state == AssetState::Ready) ? entry->texture : nullptr;
+}
+
+template<>
+SharedPtr<Mesh> AssetManager::GetAsset<Mesh>(const Handle& handle) const {
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    const AssetEntry* entry = FindEntry(handle);
+    return (entry && entry->state == AssetState::Ready) ? entry->mesh : nullptr;
+}
+
+AssetManager::AssetEntry* AssetManager::FindEntry(const Handle& handle) {
+    if (handle.index == 0 || handle.index >= m_entries.size()) {
+        return nullptr;
+    }
+
+    AssetEntry& entry = m_entries[handle.index];
+    return (entry.inUse && entry.generation == handle.generation) ? &entry : nullptr;
+}
+
+const AssetManager::AssetEntry* AssetManager::FindEntry(const Handle& handle) const {
+    return const_cast<AssetManager*>(this)->FindEntry(handle);
+}
+
+Handle AssetManager::AllocateEntry(AssetType type, const String& key) {
+    uint32 index;
+    if (!m_freeEntries.empty()) {
+        index = m_freeEntries.back();
+        m_freeEntries.pop_back();
+    } else {
+        index = static_cast<uint32>(m_entries.size());
+        m_entries.emplace_back();
+    }
+
+    AssetEntry& entry = m_entries[index];
+    entry.type = type;
+    entry.state = AssetState::Loading;
+    entry.key = key;
+    entry.inUse = true;
+
+    m_keyLookup[key] = index;
+    ++m_stats.liveAssets;
+
+    Handle handle;
+    handle.index = index;
+    handle.generation = entry.generation;
+    return handle;
+}
+
+void AssetManager::FreeEntry(uint32 index) {
+    AssetEntry& entry = m_entries[index];
+
+    m_keyLookup.erase(entry.key);
+    auto contentIt = m_contentLookup.find(HashCombine(entry.contentHash, static_cast<uint64>(entry.type)));
+    if (contentIt != m_contentLookup.end() && contentIt->second == index) {
+        m_contentLookup.erase(contentIt);
+    }
+
+    if (entry.inLru) {
+        m_lru.erase(entry.lruPosition);
+    }
+
+    m_stats.residentBytes -= entry.gpuBytes;
+    --m_stats.liveAssets;
+
+    // Bumping the generation invalidates any stale handle to this slot
+    uint32 nextGeneration = entry.generation + 1;
+    entry = AssetEntry();
+    entry.generation = nextGeneration;
+    m_freeEntries.push_back(index);
+}
+
+Handle AssetManager::RequestLoad(AssetType type, const String& filePath, LoadCallback onComplete) {
+    String key = MakeAssetKey(type, filePath);
+
+    auto it = m_keyLookup.find(key);
+    if (it != m_keyLookup.end()) {
+        AssetEntry& entry = m_entries[it->second];
+        ++m_stats.pathHits;
+
+        if (onComplete) {
+            if (entry.state == AssetState::Loading) {
+                entry.callbacks.push_back(std::move(onComplete));
+            } else {
+                onComplete(entry.state == AssetState::Ready);
+            }
+        }
+
+        Handle handle;
+        handle.index = it->second;
+        handle.generation = entry.generation;
+        return handle;
+    }
+
+    Handle handle = AllocateEntry(type, key);
+    AssetEntry& entry = m_entries[handle.index];
+    if (onComplete) {
+        entry.callbacks.push_back(std::move(onComplete));
+    }
+    if (type == AssetType::Mesh) {
+        entry.progress = std::make_shared<MeshImportProgress>();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_ioMutex);
+        LoadRequest request;
+        request.handle = handle;
+        request.type = type;
+        request.filePath = filePath;
+        request.progress = entry.progress;
+        m_requests.push_back(std::move(request));
+        ++m_stats.pendingLoads;
+    }
+    m_ioCondition.notify_one();
+
+    return handle;
+}
+
+Handle AssetManager::FindOrCreateBuiltin(const String& key, const Function<bool(Mesh&)>& build) {
+    auto it = m_keyLookup.find(key);
+    if (it != m_keyLookup.end()) {
+        ++m_stats.pathHits;
+
+        Handle handle;
+        handle.index = it->second;
+        handle.generation = m_entries[it->second].generation;
+        return handle;
+    }
+
+    Handle handle = AllocateEntry(AssetType::Mesh, key);
+    AssetEntry& entry = m_entries[handle.index];
+
+    auto mesh = std::make_shared<Mesh>();
+    if (build(*mesh)) {
+        entry.mesh = mesh;
+        FinishEntry(entry, true);
+    } else {
+        Platform::OutputDebugMessage("AssetManager: Failed to build " + key + "\n");
+        FinishEntry(entry, false);
+    }
+
+    return handle;
+}
+
+void AssetManager::ProcessCompletedLoads() {
+    PROFILE_SCOPE("AssetManager::ProcessCompletedLoads");
+    std::lock_guard<std::recursive_mutex> lock(m_entryMutex);
+    std::deque<LoadResult> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_ioMutex);
+        completed.swap(m_completed);
+    }
+
+    for (LoadResult& result : completed) {
+        --m_stats.pendingLoads;
+        CompleteLoad(result);
+    }
+}
+
+void AssetManager::CompleteLoad(LoadResult& result) {
+    AssetEntry* entry = FindEntry(result.handle);
+    if (!entry) {
+        return;
+    }
+
+    if (!result.success) {
+        Platform::OutputDebugMessage("AssetManager: Failed to load " + result.filePath + "\n");
+        FinishEntry(*entry, false);
+        return;
+    }
+
+    entry->contentHash = result.contentHash;
+    uint64 contentKey = HashCombine(result.contentHash, static_cast<uint64>(result.type));
+
+    // Identical bytes under another path: share the existing GPU resource
+    auto contentIt = m_contentLookup.find(contentKey);
+    if (contentIt != m_contentLookup.end()) {
+        const AssetEntry& original = m_entries[contentIt->second];
+        if (original.state == AssetState::Ready) {
+            entry->texture = original.texture;
+            entry->mesh = original.mesh;
+            ++m_stats.contentHits;
+            Platform::OutputDebugMessage("AssetManager: " + result.filePath + " has the same content as " + original.key + "\n");
+
+            // Shared resources are accounted for once, on the original entry
+            FinishEntry(*entry, true, true);
+            return;
+        }
+    }
+
+    try {
+        PROFILE_SCOPE("AssetManager::CreateGpuResource");
+        TextureStreamer* streamer = m_renderer.GetTextureStreamer();
+        bool streamTexture = streamer &&
+            std::max(result.image.width, result.image.height) > streamer->GetResidentMipSize();
+
+        if (result.type == AssetType::Texture && streamTexture) {
+            // Large textures keep only their low mips resident; the rest stream on demand
+            SharedPtr<Texture> texture = Texture::CreateStreaming(m_renderer, result.image, result.filePath,
+                                                                  streamer->GetResidentMipSize());
+            if (texture && texture->IsValid()) {
+                entry->texture = texture;
+            }
+        } else if (result.type == AssetType::Texture) {
+            RHITextureDesc desc;
+            desc.width = result.image.width;
+            desc.height = result.image.height;
+            desc.format = RHIResourceFormat::R8G8B8A8_Unorm;
+            desc.mipLevels = 1;
+            desc.debugName = result.filePath;
+
+            auto texture = std::make_shared<Texture>(m_renderer, desc, result.image.pixels.get(), result.filePath);
+            if (texture->IsValid()) {
+                entry->texture = texture;
+            }
+        } else {
+            auto mesh = std::make_shared<Mesh>();
+            if (mesh->CreateFromData(std::move(result.mesh), &m_renderer)) {
+                entry->mesh = mesh;
+            }
+        }
+    }
+    catch (const WindowsException& e) {
+        Platform::OutputDebugMessage("AssetManager: Error creating GPU resource for " + result.filePath + ": " + e.GetMessage());
+    }
+
+    bool success = entry->texture != nullptr || entry->mesh != nullptr;
+    if (success) {
+        m_contentLookup[contentKey] = result.handle.index;
+    }
+    FinishEntry(*entry, success);
+}
+
+void AssetManager::FinishEntry(AssetEntry& entry, bool success, bool sharesResource) {
+    entry.state = success ? AssetState::Ready : AssetState::Failed;
+    entry.progress.reset();
+
+    if (success && !sharesResource) {
+        entry.gpuBytes = CalculateGpuBytes(entry);
+        m_stats.residentBytes += entry.gpuBytes;
+    }
+
+    // Callbacks may request more assets, which can grow m_entries
+    Vector<LoadCallback> callbacks = std::move(entry.callbacks);
+    entry.callbacks.clear();
+    for (LoadCallback& callback : callbacks) {
+        callback(success);
+    }
+}
+
+void AssetManager::EvictOverBudget() {
+    auto it = m_lru.begin();
+    while (m_stats.residentBytes > m_stats.budgetBytes && it != m_lru.end()) {
+        uint32 index = *it++;
+        AssetEntry& entry = m_entries[index];
+
+        // Still loading, or the resource was handed out (e.g. to a Material) and is alive elsewhere
+        if (entry.state == AssetState::Loading ||
+            (entry.texture && entry.texture.use_count() > 1) ||
+            (entry.mesh && entry.mesh.use_count() > 1)) {
+            continue;
+        }
+
+        Platform::OutputDebugMessage("AssetManager: Evicting " + entry.key + "\n");
+
+        RetiredAsset retired;
+        retired.retireFrame = m_frameNumber;
+        retired.texture = std::move(entry.texture);
+        retired.mesh = std::move(entry.mesh);
+        m_retired.push_back(std::move(retired));
+
+        FreeEntry(index);
+        ++m_stats.evictions;
+    }
+}
+
+void AssetManager::ReleaseRetiredAssets() {
+    // Frames already submitted may still reference an evicted resource
+    uint64 framesInFlight = m_renderer.GetConfig().maxFramesInFlight;
+    while (!m_retired.empty() && m_retired.front().retireFrame + framesInFlight < m_frameNumber) {
+        m_retired.pop_front();
+    }
+}
+
+void AssetManager::IoThreadMain() {
+    Profiler::GetGlobal().SetThreadName("Asset IO");
+
+    for (;;) {
+        LoadRequest request;
+        {
+            std::unique_lock<std::mutex> lock(m_ioMutex);
+            m_ioCondition.wait(lock, [this]() { return m_shutdown || !m_requests.empty(); });
+            if (m_shutdown) {
+                return;
+            }
+
+            request = std::move(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        PROFILE_SCOPE("AssetManager::Load");
+        LoadResult result;
+        result.handle = request.handle;
+        result.type = request.type;
+        result.filePath = request.filePath;
+
+        Vector<uint8> fileData;
+        if (FileSystem::ReadFile(request.filePath, fileData)) {
+            result.contentHash = HashBytes(fileData.data(), fileData.size());
+
+            if (request.type == AssetType::Texture) {
+                result.image = TextureLoader::LoadFromMemory(fileData.data(), fileData.size(), request.filePath);
+                result.success = result.image.IsValid();
+            } else {
+                // Assimp resolves sibling files (.mtl, .bin) itself, so it gets the path
+                result.mesh = MeshImporter::LoadFromFile(request.filePath, nullptr, request.progress.get());
+                result.success = result.mesh.IsValid();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_ioMutex);
+            m_completed.push_back(std::move(result));
+        }
+        m_completedCondition.notify_all();
+    }
+}
+
+uint64 AssetManager::CalculateGpuBytes(const AssetEntry& entry) {
+    if (entry.texture) {
+        // Streamed mips are budgeted by the TextureStreamer; only the resident tail counts here
+        if (entry.texture->IsStreaming()) {
+            return entry.texture->GetResidentBytes();
+        }
+        return static_cast<uint64>(entry.texture->GetWidth()) * entry.texture->GetHeight() * 4;
+    }
+
+    if (entry.mesh) {
+        // Mesh keeps both the bindable and the legacy copies of its buffers
+        uint64 bufferBytes = static_cast<uint64>(entry.mesh->GetVertexCount()) * sizeof(Vertex) +
+                             static_cast<uint64>(entry.mesh->GetIndexCount()) * sizeof(uint32);
+        return bufferBytes * 2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include "../Core/Utilities/TextureLoader.h"
+#include "../Core/Utilities/MeshData.h"
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <thread>
+
+class DX12Renderer;
+class Texture;
+class Mesh;
+class AssetManager;
+class MeshImportProgress;
+
+enum class AssetType : uint8 {
+    Texture,
+    Mesh
+};
+
+enum class AssetState : uint8 {
+    Loading,
+    Ready,
+    Failed
+};
+
+// Typed, reference-counted handle to an asset owned by the AssetManager.
+// Handles belong to the simulation thread; the asset stays cached while any handle exists.
+template<typename T>
+class AssetHandle {
+public:
+    AssetHandle() = default;
+    AssetHandle(const AssetHandle& other);
+    AssetHandle(AssetHandle&& other) noexcept;
+    AssetHandle& operator=(AssetHandle other) noexcept;
+    ~AssetHandle() { Reset(); }
+
+    bool IsValid() const { return m_manager != nullptr && m_handle.IsValid(); }
+    bool IsReady() const;
+    bool IsFailed() const;
+
+    // Load progress in [0, 1] for loading screens; 1 once ready or failed. Meshes advance
+    // per imported mesh instance, textures stay at 0 until they are ready.
+    float32 GetProgress() const;
+
+    // nullptr until the asset is ready
+    SharedPtr<T> Get() const;
+
+    const Handle& GetHandle() const { return m_handle; }
+    void Reset();
+
+    bool operator==(const AssetHandle& other) const { return m_manager == other.m_manager && m_handle == other.m_handle; }
+
+private:
+    friend class AssetManager;
+    AssetHandle(AssetManager* manager, Handle handle);
+
+    AssetManager* m_manager = nullptr;
+    Handle m_handle;
+};
+
+using TextureHandle = AssetHandle<Texture>;
+using MeshHandle = AssetHandle<Mesh>;
+
+struct AssetManagerStats {
+    uint32 liveAssets = 0;          // Cached entries (referenced or not)
+    uint32 pendingLoads = 0;
+    uint32 pathHits = 0;            // Requests served by an existing entry for the same path
+    uint32 contentHits = 0;         // Different paths resolved to identical file contents
+    uint32 evictions = 0;
+    uint64 residentBytes = 0;       // Estimated GPU memory of cached assets
+    uint64 budgetBytes = 0;
+};
+
+// Loads textures and meshes on a background I/O thread, deduplicates them by path
+// and content hash, and evicts unreferenced assets (LRU) when over the memory budget.
+// GPU resources are created in Update on the render thread (DX12Renderer::BeginFrame),
+// while the simulation requests and polls assets; the entry table is locked for both.
+class AssetManager {
+public:
+    using LoadCallback = Function<void(bool success)>;
+
+    AssetManager(DX12Renderer& renderer, uint64 budgetBytes);
+    ~AssetManager();
+
+    // Asynchronous loads; onComplete runs inside Update(), on the render thread when pipelined
+    TextureHandle LoadTexture(const String& filePath, LoadCallback onComplete = nullptr);
+    MeshHandle LoadMesh(const String& filePath, LoadCallback onComplete = nullptr);
+
+    // Built-in primitives are generated synchronously and shared by every caller
+    MeshHandle CreateCube();
+    MeshHandle CreateSphere(uint32 stacks, uint32 slices);
+
+    // Block until a load has finished, completing loads on the calling thread while waiting.
+    // The render thread must be idle (Application::WaitForRenderThread).
+    template<typename T>
+    bool Wait(const AssetHandle<T>& handle);
+
+    // Render thread, outside command list recording: create GPU resources for finished
+    // loads, fire callbacks, evict over-budget assets and release retired ones
+    void Update();
+
+    // Budget
+    void SetBudget(uint64 budgetBytes);
+    AssetManagerStats GetStats() const;
+
+private:
+    template<typename T> friend class AssetHandle;
+
+    struct AssetEntry {
+        AssetType type = AssetType::Texture;
+        AssetState state = AssetState::Loading;
+        String key;
+        uint64 contentHash = 0;
+        uint32 generation = 1;
+        uint32 refCount = 0;
+        uint64 gpuBytes = 0;
+        bool inUse = false;
+        std::list<uint32>::iterator lruPosition;
+        bool inLru = false;
+
+        SharedPtr<Texture> texture;
+        SharedPtr<Mesh> mesh;
+        Vector<LoadCallback> callbacks;
+
+        // Written by the IO thread while a mesh imports, dropped once the entry finishes
+        SharedPtr<MeshImportProgress> progress;
+    };
+
+    struct LoadRequest {
+        Handle handle;
+        AssetType type = AssetType::Texture;
+        String filePath;
+        SharedPtr<MeshImportProgress> progress;
+    };
+
+    struct LoadResult {
+        Handle handle;
+        AssetType type = AssetType::Texture;
+        String filePath;
+        bool success = false;
+        uint64 contentHash = 0;
+        TextureImageData image;
+        MeshData mesh;
+    };
+
+    struct RetiredAsset {
+        uint64 retireFrame = 0;
+        SharedPtr<Texture> texture;
+        SharedPtr<Mesh> mesh;
+    };
+
+    // Handle plumbing
+    void AddRef(const Handle& handle);
+    void Release(const Handle& handle);
+    AssetState GetState(const Handle& handle) const;
+    float32 GetProgress(const Handle& handle) const;
+    template<typename T> SharedPtr<T> GetAsset(const Handle& handle) const;
+
+    // Entry management
+    AssetEntry* FindEntry(const Handle& handle);
+    const AssetEntry* FindEntry(const Handle& handle) const;
+    Handle AllocateEntry(AssetType type, const String& key);
+    void FreeEntry(uint32 index);
+    Handle RequestLoad(AssetType type, const String& filePath, LoadCallback onComplete);
+    Handle FindOrCreateBuiltin(const String& key, const Function<bool(Mesh&)>& build);
+
+    // Completion, under m_entryMutex
+    void ProcessCompletedLoads();
+    void CompleteLoad(LoadResult& result);
+    void FinishEntry(AssetEntry& entry, bool success, bool sharesResource = false);
+    void EvictOverBudget();
+    void ReleaseRetiredAssets();
+
+    // I/O thread
+    void IoThreadMain();
+    static uint64 CalculateGpuBytes(const AssetEntry& entry);
+
+private:
+    DX12Renderer& m_renderer;
+
+    // Guards everything below but the I/O thread state. Recursive because completion
+    // callbacks may request more assets.
+    mutable std::recursive_mutex m_entryMutex;
+
+    // Entries (index 0 is reserved so Handle::IsValid works)
+    Vector<AssetEntry> m_entries;
+    Vector<uint32> m_freeEntries;
+    HashMap<String, uint32> m_keyLookup;
+    HashMap<uint64, uint32> m_contentLookup;
+
+    // Unreferenced entries, least recently released first
+    std::list<uint32> m_lru;
+
+    // Assets evicted while the GPU may still reference them
+    std::deque<RetiredAsset> m_retired;
+    uint64 m_frameNumber = 0;
+
+    // I/O thread state
+    std::thread m_ioThread;
+    std::mutex m_ioMutex;
+    std::condition_variable m_ioCondition;
+    std::condition_variable m_completedCondition;
+    std::deque<LoadRequest> m_requests;
+    std::deque<LoadResult> m_completed;
+    bool m_shutdown = false;
+
+    AssetManagerStats m_stats;
+
+    DECLARE_NON_COPYABLE(AssetManager);
+};
+
+// Asset accessors are specialized per asset type in AssetManager.cpp
+template<> SharedPtr<Texture> AssetManager::GetAsset<Texture>(const Handle& handle) const;
+template<> SharedPtr<Mesh> AssetManager::GetAsset<Mesh>(const Handle& handle) const;
+
+template<typename T>
+bool AssetManager::Wait(const AssetHandle<T>& handle) {
+    for (;;) {
+        AssetState state = GetState(handle.GetHandle());
+        if (state != AssetState::Loading) {
+            return state == AssetState::Ready;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_ioMutex);
+            m_completedCondition.wait(lock, [this]() { return !m_completed.empty(); });
+        }
+        ProcessCompletedLoads();
+    }
+}
+
+// AssetHandle implementation
+template<typename T>
+AssetHandle<T>::AssetHandle(AssetManager* manager, Handle handle)
+    : m_manager(manager), m_handle(handle) {
+    if (IsValid()) {
+        m_manager->AddRef(m_handle);
+    }
+}
+
+template<typename T>
+AssetHandle<T>::AssetHandle(const AssetHandle& other)
+    : m_manager(other.m_manager), m_handle(other.m_handle) {
+    if (IsValid()) {
+        m_manager->AddRef(m_handle);
+    }
+}
+
+template<typename T>
+AssetHandle<T>::AssetHandle(AssetHandle&& other) noexcept
+    : m_manager(other.m_manager), m_handle(other.m_handle) {
+    other.m_manager = nullptr;
+    other.m_handle = Handle();
+}
+
+template<typename T>
+AssetHandle<T>& AssetHandle<T>::operator=(AssetHandle other) noexcept {
+    std::swap(m_manager, other.m_manager);
+    std::swap(m_handle, other.m_handle);
+    return *this;
+}
+
+template<typename T>
+bool AssetHandle<T>::IsReady() const {
+    return IsValid() && m_manager->GetState(m_handle) == AssetState::Ready;
+}
+
+template<typename T>
+bool AssetHandle<T>::IsFailed() const {
+    return IsValid() && m_manager->GetState(m_handle) == AssetState::Failed;
+}
+
+template<typename T>
+float32 AssetHandle<T>::GetProgress() const {
+    return IsValid() ? m_manager->GetProgress(m_handle) : 0.0f;
+}
+
+template<typename T>
+SharedPtr<T> AssetHandle<T>::Get() const {
+    return IsValid() ? m_manager->template GetAsset<T>(m_handle) : nullptr;
+}
+
+template<typename T>
+void AssetHandle<T>::Reset() {
+    if (IsValid()) {
+        m_manager->Release(m_handle);
+    }
+    m_manager = nullptr;
+    m_handle = Handle();
+}
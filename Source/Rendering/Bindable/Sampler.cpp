@@ -1,4 +1,5 @@
 #include "Sampler.h"
+#include "SamplerCache.h"
 #include "../Dx12/DX12Renderer.h"
 #include "../RHI/DX12RHIContext.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
@@ -28,16 +29,16 @@ void Sampler::Bind(IRHIContext& context) {
 bool Sampler::CreateSampler(const RHISamplerDesc& desc) {
     m_sampler.desc = desc;
     
-    // Create descriptor heap for sampler
-    if (!m_renderer.CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 1, 
-                                       D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, m_samplerHeap)) {
-        Platform::OutputDebugMessage("Sampler: Failed to create descriptor heap\n");
+    // Take a slot in the renderer's shared sampler heap
+    m_samplerIndex = m_renderer.AllocateSamplerDescriptor();
+    if (m_samplerIndex == INVALID_DESCRIPTOR_INDEX) {
+        Platform::OutputDebugMessage("Sampler: Failed to allocate sampler descriptor\n");
         return false;
     }
     
     // Get descriptor handles
-    m_samplerHandle = m_samplerHeap->GetCPUDescriptorHandleForHeapStart();
-    m_samplerGpuHandle = m_samplerHeap->GetGPUDescriptorHandleForHeapStart();
+    m_samplerHandle = m_renderer.GetSamplerCPUHandle(m_samplerIndex);
+    m_samplerGpuHandle = m_renderer.GetSamplerGPUHandle(m_samplerIndex);
     
     // Create D3D12 sampler description
     D3D12_SAMPLER_DESC samplerDesc = {};
@@ -59,18 +60,16 @@ bool Sampler::CreateSampler(const RHISamplerDesc& desc) {
     m_renderer.GetDevice()->CreateSampler(&samplerDesc, m_samplerHandle);
     
     // Update RHI sampler
-    m_sampler.samplerResource = m_samplerHeap.Get();
-    
-    if (DEBUG_BUILD && !m_debugName.empty()) {
-        std::wstring wideName(m_debugName.begin(), m_debugName.end());
-        m_samplerHeap->SetName(wideName.c_str());
-    }
+    m_sampler.samplerResource = m_renderer.GetSamplerHeap();
     
     return true;
 }
 
 void Sampler::Cleanup() {
-    m_samplerHeap.Reset();
+    if (m_samplerIndex != INVALID_DESCRIPTOR_INDEX) {
+        m_renderer.FreeSamplerDescriptor(m_samplerIndex);
+        m_samplerIndex = INVALID_DESCRIPTOR_INDEX;
+    }
     m_sampler.samplerResource = nullptr;
 }
 
@@ -120,7 +119,7 @@ D3D12_TEXTURE_ADDRESS_MODE Sampler::ConvertAddressMode(RHITextureAddressMode mod
 }
 
 // Static factory methods
-UniquePtr<Sampler> Sampler::CreateLinearWrap(DX12Renderer& renderer, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreateLinearWrap(DX12Renderer& renderer, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Linear;
     desc.magFilter = RHITextureFilter::Linear;
@@ -130,10 +129,10 @@ UniquePtr<Sampler> Sampler::CreateLinearWrap(DX12Renderer& renderer, const Strin
     desc.addressW = RHITextureAddressMode::Wrap;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
 
-UniquePtr<Sampler> Sampler::CreateLinearClamp(DX12Renderer& renderer, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreateLinearClamp(DX12Renderer& renderer, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Linear;
     desc.magFilter = RHITextureFilter::Linear;
@@ -143,10 +142,10 @@ UniquePtr<Sampler> Sampler::CreateLinearClamp(DX12Renderer& renderer, const Stri
     desc.addressW = RHITextureAddressMode::Clamp;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
 
-UniquePtr<Sampler> Sampler::CreatePointWrap(DX12Renderer& renderer, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreatePointWrap(DX12Renderer& renderer, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Point;
     desc.magFilter = RHITextureFilter::Point;
@@ -156,10 +155,10 @@ UniquePtr<Sampler> Sampler::CreatePointWrap(DX12Renderer& renderer, const String
     desc.addressW = RHITextureAddressMode::Wrap;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
 
-UniquePtr<Sampler> Sampler::CreatePointClamp(DX12Renderer& renderer, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreatePointClamp(DX12Renderer& renderer, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Point;
     desc.magFilter = RHITextureFilter::Point;
@@ -169,10 +168,10 @@ UniquePtr<Sampler> Sampler::CreatePointClamp(DX12Renderer& renderer, const Strin
     desc.addressW = RHITextureAddressMode::Clamp;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
 
-UniquePtr<Sampler> Sampler::CreateAnisotropic(DX12Renderer& renderer, uint32 maxAnisotropy, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreateAnisotropic(DX12Renderer& renderer, uint32 maxAnisotropy, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Anisotropic;
     desc.magFilter = RHITextureFilter::Anisotropic;
@@ -183,10 +182,10 @@ UniquePtr<Sampler> Sampler::CreateAnisotropic(DX12Renderer& renderer, uint32 max
     desc.maxAnisotropy = maxAnisotropy;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
 
-UniquePtr<Sampler> Sampler::CreateShadowComparison(DX12Renderer& renderer, const String& debugName) {
+SharedPtr<Sampler> Sampler::CreateShadowComparison(DX12Renderer& renderer, const String& debugName) {
     RHISamplerDesc desc;
     desc.minFilter = RHITextureFilter::Linear;
     desc.magFilter = RHITextureFilter::Linear;
@@ -196,5 +195,5 @@ UniquePtr<Sampler> Sampler::CreateShadowComparison(DX12Renderer& renderer, const
     desc.addressW = RHITextureAddressMode::Border;
     desc.debugName = debugName;
     
-    return std::make_unique<Sampler>(renderer, desc, debugName);
+    return renderer.GetSamplerCache().GetOrCreate(desc);
 }
\ No newline at end of file
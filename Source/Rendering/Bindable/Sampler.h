@@ -2,6 +2,7 @@
 
 #include "IBindable.h"
 #include "../RHI/RHITypes.h"
+#include "../Descriptors/DescriptorAllocator.h"
 #include "../../Core/Utilities/Types.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
 
@@ -13,7 +14,7 @@ public:
     virtual ~Sampler();
 
     void Bind(IRHIContext& context) override;
-    bool IsValid() const override { return m_sampler.samplerResource != nullptr; }
+    bool IsValid() const override { return m_samplerIndex != INVALID_DESCRIPTOR_INDEX; }
     const String& GetDebugName() const override { return m_debugName; }
 
     // Sampler-specific methods
@@ -26,13 +27,19 @@ public:
     // Access to RHI sampler for advanced operations
     const RHISampler& GetRHISampler() const { return m_sampler; }
 
-    // Static factory methods for common sampler types
-    static UniquePtr<Sampler> CreateLinearWrap(DX12Renderer& renderer, const String& debugName = "LinearWrap");
-    static UniquePtr<Sampler> CreateLinearClamp(DX12Renderer& renderer, const String& debugName = "LinearClamp");
-    static UniquePtr<Sampler> CreatePointWrap(DX12Renderer& renderer, const String& debugName = "PointWrap");
-    static UniquePtr<Sampler> CreatePointClamp(DX12Renderer& renderer, const String& debugName = "PointClamp");
-    static UniquePtr<Sampler> CreateAnisotropic(DX12Renderer& renderer, uint32 maxAnisotropy = 16, const String& debugName = "Anisotropic");
-    static UniquePtr<Sampler> CreateShadowComparison(DX12Renderer& renderer, const String& debugName = "ShadowComparison");
+    // Slot in the renderer's sampler heap
+    uint32 GetDescriptorIndex() const { return m_samplerIndex; }
+    D3D12_GPU_DESCRIPTOR_HANDLE GetGPUHandle() const { return m_samplerGpuHandle; }
+
+    // Static factory methods for common sampler types. They go through the renderer's
+    // SamplerCache, so equal descriptions share one sampler (and one descriptor); the
+    // debug name only applies when the call creates it.
+    static SharedPtr<Sampler> CreateLinearWrap(DX12Renderer& renderer, const String& debugName = "LinearWrap");
+    static SharedPtr<Sampler> CreateLinearClamp(DX12Renderer& renderer, const String& debugName = "LinearClamp");
+    static SharedPtr<Sampler> CreatePointWrap(DX12Renderer& renderer, const String& debugName = "PointWrap");
+    static SharedPtr<Sampler> CreatePointClamp(DX12Renderer& renderer, const String& debugName = "PointClamp");
+    static SharedPtr<Sampler> CreateAnisotropic(DX12Renderer& renderer, uint32 maxAnisotropy = 16, const String& debugName = "Anisotropic");
+    static SharedPtr<Sampler> CreateShadowComparison(DX12Renderer& renderer, const String& debugName = "ShadowComparison");
 
 private:
     bool CreateSampler(const RHISamplerDesc& desc);
@@ -45,7 +52,7 @@ private:
 private:
     DX12Renderer& m_renderer;
     RHISampler m_sampler;
-    ComPtr<ID3D12DescriptorHeap> m_samplerHeap;
+    uint32 m_samplerIndex = INVALID_DESCRIPTOR_INDEX;
     D3D12_CPU_DESCRIPTOR_HANDLE m_samplerHandle = {};
     D3D12_GPU_DESCRIPTOR_HANDLE m_samplerGpuHandle = {};
     
@@ -0,0 +1,78 @@
+#include "SamplerCache.h"
+#include "Sampler.h"
+#include "../../Core/Utilities/Hash.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+#include <cstring>
+
+SamplerCache::SamplerCache(DX12Renderer& renderer)
+    : m_renderer(renderer) {
+}
+
+SharedPtr<Sampler> SamplerCache::GetOrCreate(const RHISamplerDesc& desc) {
+    uint64 hash = ComputeHash(desc);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_samplers.find(hash);
+    if (it != m_samplers.end()) {
+        if (IsSameState(it->second->GetDesc(), desc)) {
+            ++m_stats.hits;
+            return it->second;
+        }
+
+        // Keep the first owner; the newcomer works but is not shared
+        ++m_stats.hashCollisions;
+        Platform::OutputDebugMessage("SamplerCache: Hash collision for sampler '" + desc.debugName + "'\n");
+        return std::make_shared<Sampler>(m_renderer, desc, desc.debugName);
+    }
+
+    ++m_stats.misses;
+    SharedPtr<Sampler> sampler = std::make_shared<Sampler>(m_renderer, desc, desc.debugName);
+    if (!sampler->IsValid()) {
+        return nullptr;
+    }
+    m_samplers.emplace(hash, sampler);
+    return sampler;
+}
+
+void SamplerCache::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_samplers.clear();
+}
+
+uint32 SamplerCache::GetCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return static_cast<uint32>(m_samplers.size());
+}
+
+SamplerCacheStats SamplerCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+uint64 SamplerCache::ComputeHash(const RHISamplerDesc& desc) {
+    auto floatBits = [](float32 value) {
+        uint32 bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    };
+
+    uint64 hash = FNV1A_OFFSET_BASIS;
+    hash = HashCombine(hash, static_cast<uint64>(desc.minFilter));
+    hash = HashCombine(hash, static_cast<uint64>(desc.magFilter));
+    hash = HashCombine(hash, static_cast<uint64>(desc.mipFilter));
+    hash = HashCombine(hash, static_cast<uint64>(desc.addressU));
+    hash = HashCombine(hash, static_cast<uint64>(desc.addressV));
+    hash = HashCombine(hash, static_cast<uint64>(desc.addressW));
+    hash = HashCombine(hash, floatBits(desc.mipLODBias));
+    hash = HashCombine(hash, desc.maxAnisotropy);
+    hash = HashCombine(hash, floatBits(desc.minLOD));
+    hash = HashCombine(hash, floatBits(desc.maxLOD));
+    return hash;
+}
+
+bool SamplerCache::IsSameState(const RHISamplerDesc& a, const RHISamplerDesc& b) {
+    return a.minFilter == b.minFilter && a.magFilter == b.magFilter && a.mipFilter == b.mipFilter &&
+           a.addressU == b.addressU && a.addressV == b.addressV && a.addressW == b.addressW &&
+           a.mipLODBias == b.mipLODBias && a.maxAnisotropy == b.maxAnisotropy &&
+           a.minLOD == b.minLOD && a.maxLOD == b.maxLOD;
+}
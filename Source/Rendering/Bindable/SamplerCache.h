@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../RHI/RHITypes.h"
+#include "../../Core/Utilities/Types.h"
+#include <mutex>
+
+class DX12Renderer;
+class Sampler;
+
+struct SamplerCacheStats {
+    uint32 hits = 0;
+    uint32 misses = 0;              // Each one is a sampler descriptor
+    uint32 hashCollisions = 0;      // Same hash, different description; created but not cached
+};
+
+// Shared samplers keyed by a hash of RHISamplerDesc (the debug name is not part of the
+// key). Materials ask for the same few filter/address combinations over and over, so
+// each unique description takes one descriptor in the renderer's sampler heap no matter
+// how many materials use it. Entries live until Clear.
+class SamplerCache {
+public:
+    explicit SamplerCache(DX12Renderer& renderer);
+    ~SamplerCache() = default;
+
+    SharedPtr<Sampler> GetOrCreate(const RHISamplerDesc& desc);
+
+    // Drop the cache's references; samplers still held elsewhere stay alive
+    void Clear();
+
+    uint32 GetCount() const;
+    SamplerCacheStats GetStats() const;
+
+    static uint64 ComputeHash(const RHISamplerDesc& desc);
+    static bool IsSameState(const RHISamplerDesc& a, const RHISamplerDesc& b);
+
+private:
+    DX12Renderer& m_renderer;
+    mutable std::mutex m_mutex;
+    HashMap<uint64, SharedPtr<Sampler>> m_samplers;
+    SamplerCacheStats m_stats;
+
+    DECLARE_NON_COPYABLE(SamplerCache);
+};
@@ -1,8 +1,12 @@
 #include "Texture.h"
 #include "../Dx12/DX12Renderer.h"
+#include "../TextureStreamer.h"
 #include "../RHI/DX12RHIContext.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
 #include "../../Core/Utilities/TextureLoader.h"
+#include "../../Core/Logging/Logger.h"
+#include "../../Core/Profiling/Profiler.h"
+#include <algorithm>
 
 Texture::Texture(DX12Renderer& renderer, const RHITextureDesc& desc, const void* initialData, const String& debugName)
     : m_renderer(renderer)
@@ -32,12 +36,24 @@ Texture::Texture(DX12Renderer& renderer, const String& filePath, bool generateMi
     }
 }
 
+Texture::Texture(DX12Renderer& renderer, const String& debugName)
+    : m_renderer(renderer)
+    , m_debugName(debugName) {
+}
+
 Texture::~Texture() {
+    if (m_isStreaming && m_renderer.GetTextureStreamer()) {
+        m_renderer.GetTextureStreamer()->Unregister(this);
+    }
     Cleanup();
 }
 
 void Texture::Bind(IRHIContext& context) {
-    Platform::OutputDebugMessage("Texture::Bind: Starting bind for texture: " + m_debugName + "\n");
+    Bind(context, m_slot);
+}
+
+void Texture::Bind(IRHIContext& context, uint32 slot) {
+    LOG_TRACE("Texture::Bind: Starting bind for texture: {}", m_debugName);
     
     if (!IsValid()) {
         Platform::OutputDebugMessage("Texture::Bind: Texture is not valid, skipping bind\n");
@@ -45,20 +61,21 @@ void Texture::Bind(IRHIContext& context) {
     }
     
     try {
-        // Set our descriptor heap (only SRV for now, sampler binding is disabled)
-        if (m_srvHeap) {
-            auto& dx12Context = static_cast<DX12RHIContext&>(context);
-            ID3D12GraphicsCommandList* commandList = dx12Context.GetCommandList();
-            
-            if (!commandList) {
-                Platform::OutputDebugMessage("Texture::Bind: Command list is null!\n");
-                return;
+        // Set the renderer's shared SRV heap (only SRV for now, sampler binding is disabled)
+        if (ID3D12DescriptorHeap* srvHeap = m_renderer.GetSRVHeap(); srvHeap && m_srvIndex != INVALID_DESCRIPTOR_INDEX) {
+            // Heaps are a DX12 concept; other contexts (recording, null) only see the descriptor table below
+            if (auto* dx12Context = dynamic_cast<DX12RHIContext*>(&context)) {
+                ID3D12GraphicsCommandList* commandList = dx12Context->GetCommandList();
+
+                if (!commandList) {
+                    Platform::OutputDebugMessage("Texture::Bind: Command list is null!\n");
+                    return;
+                }
+
+                ID3D12DescriptorHeap* heaps[] = { srvHeap };
+                commandList->SetDescriptorHeaps(1, heaps);
+                LOG_TRACE("Texture::Bind: Descriptor heap set (SRV only)");
             }
-            
-            Platform::OutputDebugMessage("Texture::Bind: Setting texture descriptor heap (SRV only)\n");
-            ID3D12DescriptorHeap* heaps[] = { m_srvHeap.Get() };
-            commandList->SetDescriptorHeaps(1, heaps);
-            Platform::OutputDebugMessage("Texture::Bind: Descriptor heap set successfully\n");
         } else {
             Platform::OutputDebugMessage("Texture::Bind: No SRV heap available!\n");
             return;
@@ -66,10 +83,8 @@ void Texture::Bind(IRHIContext& context) {
         
         // Bind texture descriptor table
         if (m_srvGpuHandle.ptr != 0) {
-            Platform::OutputDebugMessage("Texture::Bind: Binding texture to slot " + std::to_string(m_slot) + 
-                                        " with handle ptr: " + std::to_string(m_srvGpuHandle.ptr) + "\n");
-            context.SetTexture(m_slot, &m_srvGpuHandle);
-            Platform::OutputDebugMessage("Texture::Bind: Texture bound successfully\n");
+            LOG_TRACE("Texture::Bind: Binding texture to slot {} with handle ptr: {}", slot, m_srvGpuHandle.ptr);
+            context.SetTexture(slot, &m_srvGpuHandle);
         } else {
             Platform::OutputDebugMessage("Texture::Bind: GPU handle is null (ptr=0), skipping texture bind\n");
         }
@@ -130,46 +145,11 @@ void Texture::UpdateData(const void* data, uint32 dataSize, uint32 mipLevel) {
 bool Texture::CreateTexture(const RHITextureDesc& desc, const void* initialData) {
     m_texture.desc = desc;
     
-    // Create D3D12 texture description
-    D3D12_RESOURCE_DESC textureDesc = {};
-    textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
-    textureDesc.Width = desc.width;
-    textureDesc.Height = desc.height;
-    textureDesc.DepthOrArraySize = static_cast<UINT16>(desc.arraySize);
-    textureDesc.MipLevels = static_cast<UINT16>(desc.mipLevels);
-    textureDesc.Format = ConvertToD3D12Format(desc.format);
-    textureDesc.SampleDesc.Count = 1;
-    textureDesc.SampleDesc.Quality = 0;
-    textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
-    textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-    
-    // Create heap properties
-    D3D12_HEAP_PROPERTIES heapProps = {};
-    heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
-    heapProps.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-    heapProps.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-    
     // Create the texture resource in common state for potential data upload
-    HRESULT hr = m_renderer.GetDevice()->CreateCommittedResource(
-        &heapProps,
-        D3D12_HEAP_FLAG_NONE,
-        &textureDesc,
-        D3D12_RESOURCE_STATE_COMMON,
-        nullptr,
-        IID_PPV_ARGS(&m_d3d12Texture)
-    );
-    
-    if (FAILED(hr)) {
-        Platform::OutputDebugMessage("Texture: Failed to create D3D12 texture resource\n");
+    if (!CreateResource(desc, D3D12_RESOURCE_STATE_COMMON, m_d3d12Texture)) {
         return false;
     }
     
-    // Set debug name
-    if (DEBUG_BUILD && !m_debugName.empty()) {
-        std::wstring wideName(m_debugName.begin(), m_debugName.end());
-        m_d3d12Texture->SetName(wideName.c_str());
-    }
-    
     // Update RHI texture
     m_texture.textureResource = m_d3d12Texture.Get();
     
@@ -193,7 +173,7 @@ bool Texture::CreateTexture(const RHITextureDesc& desc, const void* initialData)
         
         // Map and copy data
         void* mappedData = nullptr;
-        hr = m_uploadBuffer->Map(0, nullptr, &mappedData);
+        HRESULT hr = m_uploadBuffer->Map(0, nullptr, &mappedData);
         if (SUCCEEDED(hr)) {
             memcpy(mappedData, initialData, uploadBufferSize);
             m_uploadBuffer->Unmap(0, nullptr);
@@ -218,21 +198,67 @@ bool Texture::CreateTexture(const RHITextureDesc& desc, const void* initialData)
     return true;
 }
 
+bool Texture::CreateResource(const RHITextureDesc& desc, D3D12_RESOURCE_STATES initialState, ComPtr<ID3D12Resource>& outResource) {
+    // Create D3D12 texture description
+    D3D12_RESOURCE_DESC textureDesc = {};
+    textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    textureDesc.Width = desc.width;
+    textureDesc.Height = desc.height;
+    textureDesc.DepthOrArraySize = static_cast<UINT16>(desc.arraySize);
+    textureDesc.MipLevels = static_cast<UINT16>(desc.mipLevels);
+    textureDesc.Format = ConvertToD3D12Format(desc.format);
+    textureDesc.SampleDesc.Count = 1;
+    textureDesc.SampleDesc.Quality = 0;
+    textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+    textureDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
+    
+    // Create heap properties
+    D3D12_HEAP_PROPERTIES heapProps = {};
+    heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+    heapProps.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapProps.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    
+    HRESULT hr = m_renderer.GetDevice()->CreateCommittedResource(
+        &heapProps,
+        D3D12_HEAP_FLAG_NONE,
+        &textureDesc,
+        initialState,
+        nullptr,
+        IID_PPV_ARGS(&outResource)
+    );
+    
+    if (FAILED(hr)) {
+        Platform::OutputDebugMessage("Texture: Failed to create D3D12 texture resource\n");
+        return false;
+    }
+    
+    // Set debug name
+    if (DEBUG_BUILD && !m_debugName.empty()) {
+        std::wstring wideName(m_debugName.begin(), m_debugName.end());
+        outResource->SetName(wideName.c_str());
+    }
+    
+    return true;
+}
+
 bool Texture::CreateShaderResourceView() {
     Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Starting for texture: " + m_debugName + "\n");
     
     try {
-        // Create descriptor heap for SRV
-        if (!m_renderer.CreateDescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 1, 
-                                           D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE, m_srvHeap)) {
-            Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Failed to create descriptor heap\n");
-            return false;
+        // Allocate a slot in the shared SRV heap once (UpdateResidentMips gives streaming textures a new one)
+        if (m_srvIndex == INVALID_DESCRIPTOR_INDEX) {
+            m_srvIndex = m_renderer.AllocateSRVDescriptor();
+            if (m_srvIndex == INVALID_DESCRIPTOR_INDEX) {
+                Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Failed to allocate SRV descriptor\n");
+                return false;
+            }
+            Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Allocated SRV descriptor " +
+                                        std::to_string(m_srvIndex) + "\n");
         }
-        Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Descriptor heap created\n");
         
         // Get descriptor handles
-        m_srvHandle = m_srvHeap->GetCPUDescriptorHandleForHeapStart();
-        m_srvGpuHandle = m_srvHeap->GetGPUDescriptorHandleForHeapStart();
+        m_srvHandle = m_renderer.GetSRVCPUHandle(m_srvIndex);
+        m_srvGpuHandle = m_renderer.GetSRVGPUHandle(m_srvIndex);
         Platform::OutputDebugMessage("Texture::CreateShaderResourceView: Got descriptor handles, GPU ptr: " + 
                                     std::to_string(m_srvGpuHandle.ptr) + "\n");
         
@@ -247,7 +273,7 @@ bool Texture::CreateShaderResourceView() {
         srvDesc.Format = ConvertToD3D12Format(m_texture.desc.format);
         srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
-        srvDesc.Texture2D.MipLevels = m_texture.desc.mipLevels;
+        srvDesc.Texture2D.MipLevels = m_texture.desc.mipLevels - m_residentMip;
         srvDesc.Texture2D.MostDetailedMip = 0;
         srvDesc.Texture2D.PlaneSlice = 0;
         srvDesc.Texture2D.ResourceMinLODClamp = 0.0f;
@@ -268,7 +294,13 @@ bool Texture::CreateShaderResourceView() {
 }
 
 void Texture::Cleanup() {
-    m_srvHeap.Reset();
+    // The slot is only reused once frames that may still sample it have completed
+    if (m_srvIndex != INVALID_DESCRIPTOR_INDEX) {
+        m_renderer.FreeSRVDescriptor(m_srvIndex);
+        m_srvIndex = INVALID_DESCRIPTOR_INDEX;
+    }
+    m_srvHandle = {};
+    m_srvGpuHandle = {};
     m_uploadBuffer.Reset();
     m_d3d12Texture.Reset();
     m_texture.textureResource = nullptr;
@@ -359,7 +391,197 @@ UniquePtr<Texture> Texture::CreateCheckerboard(DX12Renderer& renderer, uint32 wi
     return std::make_unique<Texture>(renderer, desc, imageData.pixels.get(), debugName);
 }
 
+UniquePtr<Texture> Texture::CreateStreaming(DX12Renderer& renderer, const TextureImageData& image,
+                                             const String& sourcePath, uint32 residentMipSize) {
+    UniquePtr<Texture> texture(new Texture(renderer, sourcePath));
+
+    uint32 mipCount = TextureLoader::CalculateMipCount(image.width, image.height);
+
+    // Most detailed mip that still fits the always-resident size
+    uint32 tailMip = 0;
+    while (tailMip + 1 < mipCount && std::max(image.width >> tailMip, image.height >> tailMip) > residentMipSize) {
+        ++tailMip;
+    }
+
+    texture->m_texture.desc.width = image.width;
+    texture->m_texture.desc.height = image.height;
+    texture->m_texture.desc.format = RHIResourceFormat::R8G8B8A8_Unorm;
+    texture->m_texture.desc.mipLevels = mipCount;
+    texture->m_texture.desc.debugName = sourcePath;
+    texture->m_isStreaming = true;
+    texture->m_residentMip = mipCount; // Nothing resident yet
+    texture->m_sourcePath = sourcePath;
+
+    if (!texture->UpdateResidentMips(tailMip, TextureLoader::GenerateMipChain(image, tailMip))) {
+        Platform::OutputDebugMessage("Texture: Failed to create streaming texture: " + sourcePath + "\n");
+        return nullptr;
+    }
+
+    if (TextureStreamer* streamer = renderer.GetTextureStreamer()) {
+        streamer->Register(texture.get(), tailMip);
+    }
+    return texture;
+}
+
+uint64 Texture::GetMipBytes(uint32 firstMip, uint32 endMip) const {
+    uint64 bytes = 0;
+    for (uint32 mip = firstMip; mip < endMip; ++mip) {
+        uint64 width = std::max(1u, m_texture.desc.width >> mip);
+        uint64 height = std::max(1u, m_texture.desc.height >> mip);
+        bytes += width * height * 4; // RGBA8
+    }
+    return bytes;
+}
+
+bool Texture::UpdateResidentMips(uint32 firstMip, const Vector<TextureImageData>& newMips) {
+    PROFILE_SCOPE("Texture::UpdateResidentMips");
+    const uint32 mipCount = m_texture.desc.mipLevels;
+    if (!m_isStreaming || firstMip >= mipCount || firstMip == m_residentMip) {
+        return firstMip == m_residentMip;
+    }
+
+    // Mips that have to come from newMips rather than from the current resource
+    const uint32 uploadCount = firstMip < m_residentMip ? std::min(m_residentMip, mipCount) - firstMip : 0;
+    if (newMips.size() < uploadCount) {
+        Platform::OutputDebugMessage("Texture: Missing mip data for " + m_debugName + "\n");
+        return false;
+    }
+
+    RHITextureDesc resourceDesc = m_texture.desc;
+    resourceDesc.width = std::max(1u, m_texture.desc.width >> firstMip);
+    resourceDesc.height = std::max(1u, m_texture.desc.height >> firstMip);
+    resourceDesc.mipLevels = mipCount - firstMip;
+
+    try {
+        ComPtr<ID3D12Resource> newTexture;
+        if (!CreateResource(resourceDesc, D3D12_RESOURCE_STATE_COPY_DEST, newTexture)) {
+            return false;
+        }
+
+        // Stage the new mips with the row pitch the copy engine expects
+        ComPtr<ID3D12Resource> uploadBuffer;
+        Vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> layouts(uploadCount);
+        if (uploadCount > 0) {
+            Vector<UINT> rowCounts(uploadCount);
+            Vector<UINT64> rowSizes(uploadCount);
+            UINT64 uploadSize = 0;
+            D3D12_RESOURCE_DESC d3dDesc = newTexture->GetDesc();
+            m_renderer.GetDevice()->GetCopyableFootprints(&d3dDesc, 0, uploadCount, 0, layouts.data(),
+                                                          rowCounts.data(), rowSizes.data(), &uploadSize);
+
+            if (!m_renderer.CreateBuffer(uploadSize, D3D12_HEAP_TYPE_UPLOAD, D3D12_RESOURCE_STATE_GENERIC_READ, uploadBuffer)) {
+                Platform::OutputDebugMessage("Texture: Failed to create mip upload buffer\n");
+                return false;
+            }
+
+            uint8* mapped = nullptr;
+            THROW_IF_FAILED(uploadBuffer->Map(0, nullptr, reinterpret_cast<void**>(&mapped)), "Map mip upload buffer");
+            for (uint32 i = 0; i < uploadCount; ++i) {
+                const TextureImageData& mip = newMips[i];
+                const size_t sourcePitch = static_cast<size_t>(mip.width) * 4;
+                for (UINT row = 0; row < rowCounts[i]; ++row) {
+                    memcpy(mapped + layouts[i].Offset + row * layouts[i].Footprint.RowPitch,
+                           mip.pixels.get() + row * sourcePitch, sourcePitch);
+                }
+            }
+            uploadBuffer->Unmap(0, nullptr);
+        }
+
+        // Frames still in flight read the current descriptor, so the new view gets its own slot
+        uint32 srvIndex = m_renderer.AllocateSRVDescriptor();
+        if (srvIndex == INVALID_DESCRIPTOR_INDEX) {
+            Platform::OutputDebugMessage("Texture: Failed to allocate SRV descriptor for " + m_debugName + "\n");
+            return false;
+        }
+
+        // Inside a frame the copies go on its command list, ahead of the draws that sample
+        // the new mips; outside one they are submitted and waited for below
+        ID3D12GraphicsCommandList* commandList = m_renderer.GetFrameCommandList();
+        const bool isFrameUpload = commandList != nullptr;
+        if (!isFrameUpload) {
+            commandList = m_renderer.BeginUploadCommands();
+        }
+        if (!commandList) {
+            m_renderer.FreeSRVDescriptor(srvIndex);
+            return false;
+        }
+
+        for (uint32 i = 0; i < uploadCount; ++i) {
+            D3D12_TEXTURE_COPY_LOCATION dest = {};
+            dest.pResource = newTexture.Get();
+            dest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+            dest.SubresourceIndex = i;
+
+            D3D12_TEXTURE_COPY_LOCATION src = {};
+            src.pResource = uploadBuffer.Get();
+            src.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+            src.PlacedFootprint = layouts[i];
+
+            commandList->CopyTextureRegion(&dest, 0, 0, 0, &src, nullptr);
+        }
+
+        // Mips present in both resources are copied GPU-side instead of re-uploaded
+        if (m_d3d12Texture) {
+            D3D12_RESOURCE_BARRIER toCopySource = {};
+            toCopySource.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+            toCopySource.Transition.pResource = m_d3d12Texture.Get();
+            toCopySource.Transition.StateBefore = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+            toCopySource.Transition.StateAfter = D3D12_RESOURCE_STATE_COPY_SOURCE;
+            toCopySource.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+            commandList->ResourceBarrier(1, &toCopySource);
+
+            for (uint32 mip = std::max(firstMip, m_residentMip); mip < mipCount; ++mip) {
+                D3D12_TEXTURE_COPY_LOCATION dest = {};
+                dest.pResource = newTexture.Get();
+                dest.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+                dest.SubresourceIndex = mip - firstMip;
+
+                D3D12_TEXTURE_COPY_LOCATION src = {};
+                src.pResource = m_d3d12Texture.Get();
+                src.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+                src.SubresourceIndex = mip - m_residentMip;
+
+                commandList->CopyTextureRegion(&dest, 0, 0, 0, &src, nullptr);
+            }
+        }
+
+        D3D12_RESOURCE_BARRIER toShaderResource = {};
+        toShaderResource.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        toShaderResource.Transition.pResource = newTexture.Get();
+        toShaderResource.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
+        toShaderResource.Transition.StateAfter = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE;
+        toShaderResource.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        commandList->ResourceBarrier(1, &toShaderResource);
+
+        if (!isFrameUpload) {
+            m_renderer.ExecuteUploadCommands();
+        }
+
+        // The previous resource and the staging buffer live until the copies have run and
+        // no frame in flight samples the old mips; the old descriptor slot likewise
+        m_renderer.RetireResource(std::move(m_d3d12Texture));
+        m_renderer.RetireResource(std::move(uploadBuffer));
+        m_renderer.RetireResource(std::move(m_uploadBuffer));
+        if (m_srvIndex != INVALID_DESCRIPTOR_INDEX) {
+            m_renderer.FreeSRVDescriptor(m_srvIndex);
+        }
+        m_srvIndex = srvIndex;
+
+        m_d3d12Texture = newTexture;
+        m_texture.textureResource = m_d3d12Texture.Get();
+        m_residentMip = firstMip;
+        m_needsUpload = false;
+
+        return CreateShaderResourceView();
+    }
+    catch (const WindowsException& e) {
+        Platform::OutputDebugMessage("Texture: Error updating resident mips of " + m_debugName + ": " + e.GetMessage());
+        return false;
+    }
+}
+
 void Texture::UploadTextureData(uint64 uploadBufferSize) {
+    PROFILE_SCOPE("Texture::UploadTextureData");
     if (!m_uploadBuffer || !m_d3d12Texture) {
         Platform::OutputDebugMessage("Texture::UploadTextureData: Invalid buffers\n");
         return;
@@ -2,7 +2,9 @@
 
 #include "IBindable.h"
 #include "../RHI/RHITypes.h"
+#include "../Descriptors/DescriptorAllocator.h"
 #include "../../Core/Utilities/Types.h"
+#include "../../Core/Utilities/TextureLoader.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
 #include <DirectXMath.h>
 
@@ -15,6 +17,10 @@ public:
     virtual ~Texture();
 
     void Bind(IRHIContext& context) override;
+
+    // Bind to the given root parameter rather than GetSlot(); changes nothing on the
+    // texture, so recording workers may share it
+    void Bind(IRHIContext& context, uint32 slot);
     bool IsValid() const override { return m_texture.textureResource != nullptr; }
     const String& GetDebugName() const override { return m_debugName; }
 
@@ -40,13 +46,36 @@ public:
     bool NeedsUpload() const { return m_needsUpload; }
     void ForceUpload();
 
+    // Streaming mode (see TextureStreamer). The desc describes the full mip chain;
+    // only mips [GetResidentMip(), mipLevels) exist on the GPU.
+    bool IsStreaming() const { return m_isStreaming; }
+    uint32 GetMipCount() const { return m_texture.desc.mipLevels; }
+    uint32 GetResidentMip() const { return m_residentMip; }
+    const String& GetSourcePath() const { return m_sourcePath; }
+    uint64 GetResidentBytes() const { return GetMipBytes(m_residentMip, m_texture.desc.mipLevels); }
+    uint64 GetMipBytes(uint32 firstMip, uint32 endMip) const;
+
+    // Rebuild the GPU resource to hold mips [firstMip, mipLevels). When streaming in,
+    // newMips holds the missing mips [firstMip, GetResidentMip()); mips that are already
+    // resident are copied on the GPU. Render thread. Inside a frame the copies are recorded
+    // on the frame's command list and the replaced resource is retired with the frame
+    // fence; outside one they are submitted and waited for.
+    bool UpdateResidentMips(uint32 firstMip, const Vector<TextureImageData>& newMips);
+
     // Static factory methods
     static UniquePtr<Texture> CreateFromFile(DX12Renderer& renderer, const String& filePath, bool generateMips = true, const String& debugName = "");
     static UniquePtr<Texture> CreateSolidColor(DX12Renderer& renderer, uint32 width, uint32 height, const DirectX::XMFLOAT4& color, const String& debugName = "SolidColorTexture");
     static UniquePtr<Texture> CreateCheckerboard(DX12Renderer& renderer, uint32 width, uint32 height, const String& debugName = "CheckerboardTexture");
 
+    // Keeps only the mips no larger than residentMipSize; sourcePath is re-read when higher mips are needed
+    static UniquePtr<Texture> CreateStreaming(DX12Renderer& renderer, const TextureImageData& image,
+                                              const String& sourcePath, uint32 residentMipSize);
+
 private:
+    Texture(DX12Renderer& renderer, const String& debugName);
+
     bool CreateTexture(const RHITextureDesc& desc, const void* initialData);
+    bool CreateResource(const RHITextureDesc& desc, D3D12_RESOURCE_STATES initialState, ComPtr<ID3D12Resource>& outResource);
     bool CreateShaderResourceView();
     void Cleanup();
 
@@ -66,7 +95,7 @@ private:
     RHITexture m_texture;
     ComPtr<ID3D12Resource> m_uploadBuffer;
     ComPtr<ID3D12Resource> m_d3d12Texture;
-    ComPtr<ID3D12DescriptorHeap> m_srvHeap;
+    uint32 m_srvIndex = INVALID_DESCRIPTOR_INDEX;  // Slot in the renderer's SRV heap
     D3D12_CPU_DESCRIPTOR_HANDLE m_srvHandle = {};
     D3D12_GPU_DESCRIPTOR_HANDLE m_srvGpuHandle = {};
     
@@ -74,5 +103,10 @@ private:
     String m_debugName;
     bool m_needsUpload = false;
 
+    // Streaming state
+    bool m_isStreaming = false;
+    uint32 m_residentMip = 0;
+    String m_sourcePath;
+
     DECLARE_NON_COPYABLE(Texture);
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "Camera.h"
 #include "../Core/Window/Window.h"
-#include "../Platform/Windows/WindowsPlatform.h"
+#include "../Platform/Platform.h"
 
 using namespace DirectX;
 
@@ -11,6 +11,8 @@ Camera::Camera(const CameraDesc& desc)
     , m_aspectRatio(desc.aspectRatio)
     , m_nearPlane(desc.nearPlane)
     , m_farPlane(desc.farPlane)
+    , m_reverseZ(desc.reverseZ)
+    , m_infiniteFarPlane(desc.infiniteFarPlane)
     , m_moveSpeed(desc.moveSpeed)
     , m_rotationSpeed(desc.rotationSpeed)
     , m_mouseSensitivity(desc.mouseSensitivity)
@@ -160,21 +162,28 @@ void Camera::OnMouseWheelEvent(const MouseWheelEvent& event) {
 }
 
 XMMATRIX Camera::GetViewMatrix() const {
-    if (m_viewMatrixDirty) {
-        UpdateMatrices();
-    }
+    UpdateMatrices();
     return m_viewMatrix;
 }
 
 XMMATRIX Camera::GetProjectionMatrix() const {
-    if (m_projectionMatrixDirty) {
-        UpdateMatrices();
-    }
+    UpdateMatrices();
     return m_projectionMatrix;
 }
 
 XMMATRIX Camera::GetViewProjectionMatrix() const {
-    return GetViewMatrix() * GetProjectionMatrix();
+    UpdateMatrices();
+    return m_viewProjectionMatrix;
+}
+
+XMMATRIX Camera::GetInverseViewProjectionMatrix() const {
+    UpdateMatrices();
+    return m_inverseViewProjectionMatrix;
+}
+
+const Frustum& Camera::GetFrustum() const {
+    UpdateMatrices();
+    return m_frustum;
 }
 
 void Camera::SetPosition(const XMFLOAT3& position) {
@@ -207,6 +216,12 @@ void Camera::SetFOV(float fovY) {
     m_projectionMatrixDirty = true;
 }
 
+void Camera::SetDepthMode(bool reverseZ, bool infiniteFarPlane) {
+    m_reverseZ = reverseZ;
+    m_infiniteFarPlane = infiniteFarPlane;
+    m_projectionMatrixDirty = true;
+}
+
 void Camera::MoveForward(float distance) {
     XMVECTOR forward = XMLoadFloat3(&m_forward);
     XMVECTOR pos = XMLoadFloat3(&m_position);
@@ -249,8 +264,7 @@ XMFLOAT3 Camera::ScreenToWorld(const XMFLOAT2& screenPos, float depth) const {
     // Convert screen coordinates to NDC
     XMVECTOR screenVec = XMVectorSet(screenPos.x, screenPos.y, depth, 1.0f);
 
-    // Get inverse view-projection matrix
-    XMMATRIX invViewProj = XMMatrixInverse(nullptr, GetViewProjectionMatrix());
+    XMMATRIX invViewProj = GetInverseViewProjectionMatrix();
 
     // Transform to world space
     XMVECTOR worldVec = XMVector4Transform(screenVec, invViewProj);
@@ -285,6 +299,10 @@ void Camera::UpdateVectors() {
 }
 
 void Camera::UpdateMatrices() const {
+    if (!m_viewMatrixDirty && !m_projectionMatrixDirty) {
+        return;
+    }
+
     if (m_viewMatrixDirty) {
         XMVECTOR posVec = XMLoadFloat3(&m_position);
         XMVECTOR forwardVec = XMLoadFloat3(&m_forward);
@@ -298,10 +316,30 @@ void Camera::UpdateMatrices() const {
     }
 
     if (m_projectionMatrixDirty) {
-        // Use RH for DirectX 12 default
-        m_projectionMatrix = XMMatrixPerspectiveFovRH(m_fovY, m_aspectRatio, m_nearPlane, m_farPlane);
+        m_projectionMatrix = BuildProjectionMatrix();
         m_projectionMatrixDirty = false;
     }
+
+    m_viewProjectionMatrix = m_viewMatrix * m_projectionMatrix;
+    m_inverseViewProjectionMatrix = XMMatrixInverse(nullptr, m_viewProjectionMatrix);
+    m_frustum = Frustum(m_viewProjectionMatrix);
+}
+
+XMMATRIX Camera::BuildProjectionMatrix() const {
+    // Use RH for DirectX 12 default
+    if (!m_infiniteFarPlane) {
+        // Swapping the planes maps near to 1 and far to 0
+        return m_reverseZ ? XMMatrixPerspectiveFovRH(m_fovY, m_aspectRatio, m_farPlane, m_nearPlane)
+                          : XMMatrixPerspectiveFovRH(m_fovY, m_aspectRatio, m_nearPlane, m_farPlane);
+    }
+
+    // The finite matrix with the far plane taken to infinity: depth is n / -z with
+    // reverse Z, 1 + n / z without. Only the z column differs.
+    XMFLOAT4X4 projection;
+    XMStoreFloat4x4(&projection, XMMatrixPerspectiveFovRH(m_fovY, m_aspectRatio, m_nearPlane, m_nearPlane + 1.0f));
+    projection.m[2][2] = m_reverseZ ? 0.0f : -1.0f;
+    projection.m[3][2] = m_reverseZ ? m_nearPlane : -m_nearPlane;
+    return XMLoadFloat4x4(&projection);
 }
 
 void Camera::ClampPitch() {
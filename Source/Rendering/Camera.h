@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/Utilities/Types.h"
+#include "Frustum.h"
 #include <DirectXMath.h>
 
 // Forward declarations
@@ -20,6 +21,12 @@ struct CameraDesc {
     float nearPlane = 0.1f;
     float farPlane = 1000.0f;
 
+    // Depth 1 at the near plane falling to 0 at the far plane. Float precision then
+    // follows the perspective divide instead of fighting it, so distant geometry stays
+    // resolved. The renderer must clear to 0 and test with Greater (RendererConfig::reverseZ).
+    bool reverseZ = false;
+    bool infiniteFarPlane = false;    // farPlane is ignored; nothing is clipped by distance
+
     // Movement settings
     float moveSpeed = 10.0f;          // units per second
     float rotationSpeed = 2.0f;       // radians per second
@@ -42,22 +49,31 @@ public:
     void OnMouseMoveEvent(const MouseMoveEvent& event);
     void OnMouseWheelEvent(const MouseWheelEvent& event);
 
-    // Matrix getters
+    // Matrix getters. The matrices and the frustum are rebuilt together, once per
+    // change of the camera, not on every call.
     DirectX::XMMATRIX GetViewMatrix() const;
     DirectX::XMMATRIX GetProjectionMatrix() const;
     DirectX::XMMATRIX GetViewProjectionMatrix() const;
+    DirectX::XMMATRIX GetInverseViewProjectionMatrix() const;
+    const Frustum& GetFrustum() const;
 
     // Camera properties
     DirectX::XMFLOAT3 GetPosition() const { return m_position; }
     DirectX::XMFLOAT3 GetForward() const { return m_forward; }
     DirectX::XMFLOAT3 GetRight() const { return m_right; }
     DirectX::XMFLOAT3 GetUp() const { return m_up; }
+    float GetFOV() const { return m_fovY; }
+    float GetNearPlane() const { return m_nearPlane; }
+    float GetFarPlane() const { return m_farPlane; }
+    bool IsReverseZ() const { return m_reverseZ; }
+    bool HasInfiniteFarPlane() const { return m_infiniteFarPlane; }
 
     // Setters
     void SetPosition(const DirectX::XMFLOAT3& position);
     void SetTarget(const DirectX::XMFLOAT3& target);
     void SetAspectRatio(float aspectRatio);
     void SetFOV(float fovY);
+    void SetDepthMode(bool reverseZ, bool infiniteFarPlane);
     void SetMoveSpeed(float speed) { m_moveSpeed = speed; }
     void SetMouseSensitivity(float sensitivity) { m_mouseSensitivity = sensitivity; }
 
@@ -75,6 +91,7 @@ private:
     // Update internal vectors
     void UpdateVectors();
     void UpdateMatrices() const;
+    DirectX::XMMATRIX BuildProjectionMatrix() const;
 
     // Clamp pitch to avoid gimbal lock
     void ClampPitch();
@@ -96,6 +113,8 @@ private:
     float m_aspectRatio;
     float m_nearPlane;
     float m_farPlane;
+    bool m_reverseZ;
+    bool m_infiniteFarPlane;
 
     // Movement settings
     float m_moveSpeed;
@@ -113,6 +132,9 @@ private:
     // Cached matrices
     mutable DirectX::XMMATRIX m_viewMatrix;
     mutable DirectX::XMMATRIX m_projectionMatrix;
+    mutable DirectX::XMMATRIX m_viewProjectionMatrix;
+    mutable DirectX::XMMATRIX m_inverseViewProjectionMatrix;
+    mutable Frustum m_frustum;
     mutable bool m_viewMatrixDirty = true;
     mutable bool m_projectionMatrixDirty = true;
 
@@ -0,0 +1,71 @@
+#include "DX12DescriptorHeap.h"
+
+DX12DescriptorHeap::DX12DescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 persistentCount, uint32 transientCount)
+    : m_type(type)
+    , m_allocator(persistentCount, transientCount) {
+}
+
+bool DX12DescriptorHeap::Create(ID3D12Device* device, const String& debugName) {
+    D3D12_DESCRIPTOR_HEAP_DESC heapDesc = {};
+    heapDesc.Type = m_type;
+    heapDesc.NumDescriptors = m_allocator.GetCapacity();
+    heapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
+    heapDesc.NodeMask = 0;
+
+    if (FAILED(device->CreateDescriptorHeap(&heapDesc, IID_PPV_ARGS(&m_heap)))) {
+        Platform::OutputDebugMessage("DX12DescriptorHeap: Failed to create " + debugName + "\n");
+        return false;
+    }
+
+    if (DEBUG_BUILD && !debugName.empty()) {
+        std::wstring wideName(debugName.begin(), debugName.end());
+        m_heap->SetName(wideName.c_str());
+    }
+
+    m_cpuStart = m_heap->GetCPUDescriptorHandleForHeapStart();
+    m_gpuStart = m_heap->GetGPUDescriptorHandleForHeapStart();
+    m_descriptorSize = device->GetDescriptorHandleIncrementSize(m_type);
+    return true;
+}
+
+uint32 DX12DescriptorHeap::AllocatePersistent(uint32 count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocator.AllocatePersistent(count);
+}
+
+void DX12DescriptorHeap::FreePersistent(uint32 index, uint32 count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_allocator.FreePersistent(index, count);
+}
+
+uint32 DX12DescriptorHeap::AllocateTransient(uint32 count) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocator.AllocateTransient(count);
+}
+
+void DX12DescriptorHeap::CloseFrame(uint64 fenceValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_allocator.CloseFrame(fenceValue);
+}
+
+void DX12DescriptorHeap::Recycle(uint64 completedFenceValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_allocator.Recycle(completedFenceValue);
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE DX12DescriptorHeap::GetCPUHandle(uint32 index) const {
+    D3D12_CPU_DESCRIPTOR_HANDLE handle = m_cpuStart;
+    handle.ptr += static_cast<SIZE_T>(index) * m_descriptorSize;
+    return handle;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE DX12DescriptorHeap::GetGPUHandle(uint32 index) const {
+    D3D12_GPU_DESCRIPTOR_HANDLE handle = m_gpuStart;
+    handle.ptr += static_cast<UINT64>(index) * m_descriptorSize;
+    return handle;
+}
+
+DescriptorAllocatorStats DX12DescriptorHeap::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocator.GetStats();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "DescriptorAllocator.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+#include <mutex>
+
+// Shader-visible descriptor heap handed out through a DescriptorAllocator. Calls are
+// serialized, so loader code and recording threads can allocate concurrently.
+class DX12DescriptorHeap {
+public:
+    DX12DescriptorHeap(D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 persistentCount, uint32 transientCount);
+    ~DX12DescriptorHeap() = default;
+
+    bool Create(ID3D12Device* device, const String& debugName);
+
+    uint32 AllocatePersistent(uint32 count = 1);
+    void FreePersistent(uint32 index, uint32 count = 1);
+    uint32 AllocateTransient(uint32 count);
+
+    // See DescriptorAllocator::CloseFrame / Recycle
+    void CloseFrame(uint64 fenceValue);
+    void Recycle(uint64 completedFenceValue);
+
+    D3D12_CPU_DESCRIPTOR_HANDLE GetCPUHandle(uint32 index) const;
+    D3D12_GPU_DESCRIPTOR_HANDLE GetGPUHandle(uint32 index) const;
+
+    ID3D12DescriptorHeap* GetHeap() const { return m_heap.Get(); }
+    uint32 GetDescriptorSize() const { return m_descriptorSize; }
+    DescriptorAllocatorStats GetStats() const;
+
+private:
+    D3D12_DESCRIPTOR_HEAP_TYPE m_type;
+    ComPtr<ID3D12DescriptorHeap> m_heap;
+    D3D12_CPU_DESCRIPTOR_HANDLE m_cpuStart = {};
+    D3D12_GPU_DESCRIPTOR_HANDLE m_gpuStart = {};
+    uint32 m_descriptorSize = 0;
+
+    mutable std::mutex m_mutex;
+    DescriptorAllocator m_allocator;
+
+    DECLARE_NON_COPYABLE(DX12DescriptorHeap);
+};
@@ -0,0 +1,166 @@
+#include "DescriptorAllocator.h"
+#include <algorithm>
+
+DescriptorAllocator::DescriptorAllocator(uint32 persistentCapacity, uint32 transientCapacity)
+    : m_persistentCapacity(persistentCapacity)
+    , m_transientCapacity(transientCapacity) {
+    if (persistentCapacity > 0) {
+        m_freeRanges.push_back({ 0, persistentCapacity });
+    }
+}
+
+uint32 DescriptorAllocator::AllocatePersistent(uint32 count) {
+    ASSERT(count > 0, "Empty descriptor allocation");
+
+    // Best fit; an exact match ends the search
+    size_t best = m_freeRanges.size();
+    for (size_t i = 0; i < m_freeRanges.size(); ++i) {
+        const Range& range = m_freeRanges[i];
+        if (range.count >= count && (best == m_freeRanges.size() || range.count < m_freeRanges[best].count)) {
+            best = i;
+            if (range.count == count) {
+                break;
+            }
+        }
+    }
+
+    if (count == 0 || best == m_freeRanges.size()) {
+        ++m_failedAllocations;
+        return INVALID_DESCRIPTOR_INDEX;
+    }
+
+    Range& range = m_freeRanges[best];
+    uint32 index = range.start;
+    range.start += count;
+    range.count -= count;
+    if (range.count == 0) {
+        m_freeRanges.erase(m_freeRanges.begin() + best);
+    }
+
+    m_persistentUsed += count;
+    m_persistentPeak = std::max(m_persistentPeak, m_persistentUsed);
+    return index;
+}
+
+void DescriptorAllocator::FreePersistent(uint32 index, uint32 count) {
+    if (index == INVALID_DESCRIPTOR_INDEX || count == 0) {
+        return;
+    }
+    ASSERT(index + count <= m_persistentCapacity, "Descriptor range outside the persistent region");
+    ASSERT(!IsFree(index, count), "Descriptor range freed twice");
+
+    m_openFrees.push_back({ index, count });
+}
+
+uint32 DescriptorAllocator::AllocateTransient(uint32 count) {
+    if (count == 0 || count > m_transientCapacity) {
+        ++m_failedAllocations;
+        return INVALID_DESCRIPTOR_INDEX;
+    }
+
+    // Ranges never wrap; the end of the ring is skipped instead
+    uint32 position = static_cast<uint32>(m_transientHead % m_transientCapacity);
+    uint32 padding = position + count > m_transientCapacity ? m_transientCapacity - position : 0;
+    if (padding > 0 && m_transientHead == m_transientTail) {
+        // Nothing in flight, so the skipped end does not have to wait for a fence
+        m_transientHead += padding;
+        m_transientTail = m_transientHead;
+        padding = 0;
+    }
+    if (m_transientHead - m_transientTail + padding + count > m_transientCapacity) {
+        ++m_failedAllocations;
+        return INVALID_DESCRIPTOR_INDEX;
+    }
+
+    m_transientHead += padding;
+    uint32 index = m_persistentCapacity + static_cast<uint32>(m_transientHead % m_transientCapacity);
+    m_transientHead += count;
+    m_transientPeak = std::max(m_transientPeak, static_cast<uint32>(m_transientHead - m_transientTail));
+    return index;
+}
+
+void DescriptorAllocator::CloseFrame(uint64 fenceValue) {
+    for (const Range& range : m_openFrees) {
+        m_pendingFrees.push_back({ range, fenceValue });
+    }
+    m_openFrees.clear();
+
+    uint64 lastHead = m_transientFrames.empty() ? m_transientTail : m_transientFrames.back().head;
+    if (m_transientHead != lastHead) {
+        m_transientFrames.push_back({ fenceValue, m_transientHead });
+    }
+}
+
+void DescriptorAllocator::Recycle(uint64 completedFenceValue) {
+    size_t released = 0;
+    while (released < m_pendingFrees.size() && m_pendingFrees[released].fenceValue <= completedFenceValue) {
+        ReleaseRange(m_pendingFrees[released].range);
+        m_persistentUsed -= m_pendingFrees[released].range.count;
+        ++released;
+    }
+    m_pendingFrees.erase(m_pendingFrees.begin(), m_pendingFrees.begin() + released);
+
+    size_t finished = 0;
+    while (finished < m_transientFrames.size() && m_transientFrames[finished].fenceValue <= completedFenceValue) {
+        m_transientTail = m_transientFrames[finished].head;
+        ++finished;
+    }
+    m_transientFrames.erase(m_transientFrames.begin(), m_transientFrames.begin() + finished);
+}
+
+void DescriptorAllocator::ReleaseRange(const Range& range) {
+    auto next = std::lower_bound(m_freeRanges.begin(), m_freeRanges.end(), range.start,
+                                 [](const Range& r, uint32 start) { return r.start < start; });
+
+    // Coalesce with the neighbours so a freed texture set becomes one range again
+    bool mergesPrevious = next != m_freeRanges.begin() && (next - 1)->start + (next - 1)->count == range.start;
+    bool mergesNext = next != m_freeRanges.end() && range.start + range.count == next->start;
+    if (mergesPrevious && mergesNext) {
+        (next - 1)->count += range.count + next->count;
+        m_freeRanges.erase(next);
+    } else if (mergesPrevious) {
+        (next - 1)->count += range.count;
+    } else if (mergesNext) {
+        next->start = range.start;
+        next->count += range.count;
+    } else {
+        m_freeRanges.insert(next, range);
+    }
+}
+
+bool DescriptorAllocator::IsFree(uint32 index, uint32 count) const {
+    auto next = std::upper_bound(m_freeRanges.begin(), m_freeRanges.end(), index,
+                                 [](uint32 start, const Range& r) { return start < r.start; });
+    if (next != m_freeRanges.begin() && (next - 1)->start + (next - 1)->count > index) {
+        return true;
+    }
+    return next != m_freeRanges.end() && next->start < index + count;
+}
+
+float32 DescriptorAllocator::GetFragmentation() const {
+    uint32 totalFree = 0;
+    uint32 largest = 0;
+    for (const Range& range : m_freeRanges) {
+        totalFree += range.count;
+        largest = std::max(largest, range.count);
+    }
+    return totalFree > 0 ? 1.0f - static_cast<float32>(largest) / static_cast<float32>(totalFree) : 0.0f;
+}
+
+DescriptorAllocatorStats DescriptorAllocator::GetStats() const {
+    DescriptorAllocatorStats stats;
+    stats.persistentCapacity = m_persistentCapacity;
+    stats.persistentUsed = m_persistentUsed;
+    stats.persistentPeak = m_persistentPeak;
+    stats.pendingFrees = static_cast<uint32>(m_openFrees.size() + m_pendingFrees.size());
+    stats.freeRanges = static_cast<uint32>(m_freeRanges.size());
+    for (const Range& range : m_freeRanges) {
+        stats.largestFreeRange = std::max(stats.largestFreeRange, range.count);
+    }
+
+    stats.transientCapacity = m_transientCapacity;
+    stats.transientUsed = static_cast<uint32>(m_transientHead - m_transientTail);
+    stats.transientPeak = m_transientPeak;
+    stats.failedAllocations = m_failedAllocations;
+    return stats;
+}
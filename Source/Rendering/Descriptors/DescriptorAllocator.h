@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../../Core/Utilities/Types.h"
+
+// Returned when a region has no room left
+constexpr uint32 INVALID_DESCRIPTOR_INDEX = ~0u;
+
+struct DescriptorAllocatorStats {
+    uint32 persistentCapacity = 0;
+    uint32 persistentUsed = 0;          // Includes ranges waiting for their fence
+    uint32 persistentPeak = 0;
+    uint32 pendingFrees = 0;            // Freed ranges the GPU may still read
+    uint32 freeRanges = 0;
+    uint32 largestFreeRange = 0;
+
+    uint32 transientCapacity = 0;
+    uint32 transientUsed = 0;           // Including frames still in flight
+    uint32 transientPeak = 0;
+
+    uint32 failedAllocations = 0;
+};
+
+// Index allocator for one descriptor heap, without API types. The heap is split in
+//  - a persistent region [0, persistentCapacity): ranges stay at the same index until
+//    freed, so shaders can index them bindlessly. Free ranges are kept sorted and
+//    coalesced; allocation is best fit to keep large ranges intact.
+//  - a transient region [persistentCapacity, persistentCapacity + transientCapacity):
+//    a ring of per-frame linear allocations for descriptors that live one frame.
+// Nothing is reused while the GPU may still read it: frees and transient allocations
+// are stamped with the frame's fence by CloseFrame and come back in Recycle once that
+// fence has completed. Not thread safe; DX12DescriptorHeap serializes access.
+class DescriptorAllocator {
+public:
+    DescriptorAllocator(uint32 persistentCapacity, uint32 transientCapacity);
+    ~DescriptorAllocator() = default;
+
+    // Contiguous persistent range, or INVALID_DESCRIPTOR_INDEX when no free range fits
+    uint32 AllocatePersistent(uint32 count = 1);
+
+    // count must match the allocation; the range is reusable after the next CloseFrame's fence
+    void FreePersistent(uint32 index, uint32 count = 1);
+
+    // Contiguous range valid until the end of the current frame
+    uint32 AllocateTransient(uint32 count);
+
+    // Stamp everything freed or allocated transiently since the last call with the
+    // fence value signaled after this frame's commands
+    void CloseFrame(uint64 fenceValue);
+
+    // Return ranges whose fence has completed
+    void Recycle(uint64 completedFenceValue);
+
+    // 0 when all free space is one range, approaching 1 as it splinters
+    float32 GetFragmentation() const;
+    DescriptorAllocatorStats GetStats() const;
+
+    uint32 GetPersistentCapacity() const { return m_persistentCapacity; }
+    uint32 GetTransientCapacity() const { return m_transientCapacity; }
+    uint32 GetCapacity() const { return m_persistentCapacity + m_transientCapacity; }
+
+private:
+    struct Range {
+        uint32 start = 0;
+        uint32 count = 0;
+    };
+
+    struct PendingFree {
+        Range range;
+        uint64 fenceValue = 0;
+    };
+
+    struct TransientFrame {
+        uint64 fenceValue = 0;
+        uint64 head = 0;                // Ring head when the frame closed
+    };
+
+    void ReleaseRange(const Range& range);
+    bool IsFree(uint32 index, uint32 count) const;
+
+private:
+    uint32 m_persistentCapacity;
+    uint32 m_transientCapacity;
+
+    // Persistent region
+    Vector<Range> m_freeRanges;         // Sorted by start, never adjacent
+    Vector<Range> m_openFrees;          // Freed this frame, fence not known yet
+    Vector<PendingFree> m_pendingFrees; // In fence order
+    uint32 m_persistentUsed = 0;
+    uint32 m_persistentPeak = 0;
+
+    // Transient ring; head and tail only grow, positions are taken modulo the capacity
+    uint64 m_transientHead = 0;
+    uint64 m_transientTail = 0;
+    Vector<TransientFrame> m_transientFrames;
+    uint32 m_transientPeak = 0;
+
+    uint32 m_failedAllocations = 0;
+
+    DECLARE_NON_COPYABLE(DescriptorAllocator);
+};
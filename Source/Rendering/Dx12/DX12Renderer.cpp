@@ -2,10 +2,28 @@
 #include "../../Core/Window/Window.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
 #include "../RHI/DX12RHIContext.h"
+#include "../RHI/DX12RHIContextPool.h"
+#include "../FrameGraph/DX12FrameGraphBackend.h"
+#include "../Pipeline/DX12PipelineLibrary.h"
+#include "../Descriptors/DX12DescriptorHeap.h"
+#include "../Bindable/SamplerCache.h"
+#include "../MaterialConstantPool.h"
+#include "../Material.h"
+#include "../Pipeline/PipelineStateCache.h"
+#include "../AssetManager.h"
+#include "../TextureStreamer.h"
+#include "../ShaderCache.h"
+#include "DX12ShaderCompiler.h"
+#include "../../Core/Threading/JobSystem.h"
+#include "../../Core/Utilities/Hash.h"
+#include "../../Core/Profiling/Profiler.h"
+#include "../../Core/Memory/FrameMemory.h"
 
 #include "../Mesh.h"
 #include <fstream>
 #include <sstream>
+#include <algorithm>
+#include <cstdio>
 
 // Link required libraries
 #pragma comment(lib, "d3d12.lib")
@@ -51,9 +69,20 @@ bool DX12Renderer::Initialize(Window* window, const RendererConfig& config) {
         if (!CreateCommandAllocators()) return false;
         if (!CreateCommandList()) return false;
         if (!CreateSynchronization()) return false;
+        if (!CreateRHIContextPool()) return false;
+        m_frameGraphBackend = std::make_unique<DX12FrameGraphBackend>(this);
         if (!CreateAllConstantBuffers()) return false;
         if (!CreateShaderDescriptorHeaps()) return false;
 
+        m_shaderCache = std::make_unique<ShaderCache>(m_config.shaderCacheDirectory);
+        m_materialConstantPool = std::make_unique<MaterialConstantPool>(*this);
+
+        if (m_config.enableTextureStreaming) {
+            m_textureStreamer = std::make_unique<TextureStreamer>(*this, m_config.textureStreamingBudgetMB * 1024 * 1024,
+                                                                  m_config.streamingResidentMipSize);
+        }
+        m_assetManager = std::make_unique<AssetManager>(*this, m_config.gpuMemoryBudgetMB * 1024 * 1024);
+
         if (m_config.enableDebugLayer) {
             SetupDebugDevice();
         }
@@ -76,6 +105,51 @@ void DX12Renderer::Shutdown() {
     // Wait for GPU to finish
     WaitForGpu();
 
+    m_rhiContextPool.reset();
+    m_openRetiredResources.clear();
+    m_retiredResources.clear();
+
+    // Keep this run's new pipelines for the next start
+    if (m_pipelineLibrary) {
+        const PipelineLibraryStats& stats = m_pipelineLibrary->GetStats();
+        Platform::OutputDebugMessage("DX12Renderer: " + std::to_string(stats.loaded) + " pipelines loaded, " +
+                                     std::to_string(stats.created) + " compiled\n");
+        m_pipelineLibrary->Save();
+    }
+    m_pipelineCache.reset();
+    m_pipelineStates.clear();
+    m_pipelineLibrary.reset();
+    m_rootSignatures.clear();
+    m_shaderBytecode.clear();
+
+    m_frameGraph.Reset();
+    if (m_frameGraphBackend) {
+        m_frameGraphBackend->Release();
+        m_frameGraphBackend.reset();
+    }
+
+    // Cached assets own GPU resources, release them while the device is alive
+    // (streaming textures unregister themselves, so the streamer goes last)
+    m_assetManager.reset();
+    m_textureStreamer.reset();
+
+    // Shared samplers hold sampler heap slots
+    if (m_samplerCache) {
+        SamplerCacheStats samplerStats = m_samplerCache->GetStats();
+        Platform::OutputDebugMessage("DX12Renderer: " + std::to_string(m_samplerCache->GetCount()) + " unique samplers served " +
+                                     std::to_string(samplerStats.hits + samplerStats.misses) + " requests\n");
+        m_samplerCache.reset();
+    }
+
+    // Templates are only kept alive by instances once the cache lets go
+    m_materialTemplates.clear();
+    if (m_materialConstantPool) {
+        MaterialConstantPoolStats poolStats = m_materialConstantPool->GetStats();
+        Platform::OutputDebugMessage("DX12Renderer: material constants peaked at " + std::to_string(poolStats.slotsPeak) +
+                                     " slots in " + std::to_string(poolStats.pages) + " pages\n");
+        m_materialConstantPool.reset();
+    }
+
     // Clean up synchronization
     if (m_fenceEvent) {
         CloseHandle(m_fenceEvent);
@@ -118,8 +192,8 @@ void DX12Renderer::Shutdown() {
     m_renderTargets.clear();
     m_dsvHeap.Reset();
     m_rtvHeap.Reset();
-    m_srvHeap.Reset();
-    m_samplerHeap.Reset();
+    m_srvDescriptors.reset();
+    m_samplerDescriptors.reset();
     m_vertexShader.Reset();
     m_pixelShader.Reset();
     m_texturedPixelShader.Reset();
@@ -136,56 +210,63 @@ void DX12Renderer::Shutdown() {
 
 void DX12Renderer::BeginFrame() {
     ASSERT(m_isInitialized, "Renderer not initialized");
+    PROFILE_SCOPE("DX12Renderer::BeginFrame");
+
+    // Finish background asset loads before the frame's command list starts recording
+    // (new textures upload through the same list and wait for the GPU)
+    m_assetManager->Update();
+
+    // Descriptors and resources freed by frames the GPU has finished can be handed out again
+    uint64 completedFenceValue = m_fence->GetCompletedValue();
+    m_srvDescriptors->Recycle(completedFenceValue);
+    m_samplerDescriptors->Recycle(completedFenceValue);
+    m_materialConstantPool->Recycle(completedFenceValue);
+    auto firstInFlight = std::find_if(m_retiredResources.begin(), m_retiredResources.end(),
+        [completedFenceValue](const RetiredResource& retired) { return retired.fenceValue > completedFenceValue; });
+    m_retiredResources.erase(m_retiredResources.begin(), firstInFlight);
 
     // Reset command allocator and list for current frame
     THROW_IF_FAILED(m_commandAllocators[m_currentFrameIndex]->Reset(), "Reset command allocator");
     THROW_IF_FAILED(m_commandList->Reset(m_commandAllocators[m_currentFrameIndex].Get(), nullptr), "Reset command list");
+    m_isRecordingFrame = true;
+
+    // Mip residency changes record their copies here, ahead of the frame's draws
+    if (m_textureStreamer) {
+        m_textureStreamer->Update();
+    }
 
     // Get current back buffer index
     m_currentBackBufferIndex = m_swapChain->GetCurrentBackBufferIndex();
 
-    // Transition back buffer to render target state
-    D3D12_RESOURCE_BARRIER barrier = {};
-    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-    barrier.Transition.pResource = m_renderTargets[m_currentBackBufferIndex].Get();
-    barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_PRESENT;
-    barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_RENDER_TARGET;
-    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-    m_commandList->ResourceBarrier(1, &barrier);
-
-    // Set render targets
-    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_rtvHeap->GetCPUDescriptorHandleForHeapStart();
-    rtvHandle.ptr += m_currentBackBufferIndex * m_rtvDescriptorSize;
-
-    D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = m_dsvHeap->GetCPUDescriptorHandleForHeapStart();
-
-    m_commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
+    // Compile this frame's graph and run it through the scene pass, which binds the
+    // back buffer; the caller records the scene's draws until EndFrame
+    BuildFrameGraph();
+    bool isCompiled = m_frameGraph.Compile([this](const RHITextureDesc& desc, RHIResourceState usage) {
+        return m_frameGraphBackend->GetAllocation(desc, usage);
+    });
+    if (!isCompiled || !m_frameGraph.BeginExecute(*m_frameGraphBackend)) {
+        throw WindowsException(E_FAIL, "Compile frame graph", __FILE__, __LINE__);
+    }
 
-    // Set viewport
-    ViewportDesc viewport;
-    viewport.width = static_cast<float>(m_windowWidth);
-    viewport.height = static_cast<float>(m_windowHeight);
-    SetViewport(viewport);
+    uint32 sceneCompiledIndex = m_frameGraph.GetCompiledPassIndex(m_scenePassIndex);
+    for (uint32 i = 0; i <= sceneCompiledIndex; ++i) {
+        m_frameGraph.ExecutePass(*m_frameGraphBackend, i);
+    }
 }
 
 void DX12Renderer::EndFrame() {
     ASSERT(m_isInitialized, "Renderer not initialized");
+    PROFILE_SCOPE("DX12Renderer::EndFrame");
 
-    // Transition back buffer to present state
-    D3D12_RESOURCE_BARRIER barrier = {};
-    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
-    barrier.Transition.pResource = m_renderTargets[m_currentBackBufferIndex].Get();
-    barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_RENDER_TARGET;
-    barrier.Transition.StateAfter = D3D12_RESOURCE_STATE_PRESENT;
-    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
-
-    m_commandList->ResourceBarrier(1, &barrier);
+    // Passes after the scene, then the back buffer back to present state
+    for (uint32 i = m_frameGraph.GetCompiledPassIndex(m_scenePassIndex) + 1; i < m_frameGraph.GetCompiledPassCount(); ++i) {
+        m_frameGraph.ExecutePass(*m_frameGraphBackend, i);
+    }
+    m_frameGraph.ExecuteFinalBarriers(*m_frameGraphBackend);
 
     // Close and execute command list
     THROW_IF_FAILED(m_commandList->Close(), "Close command list");
+    m_isRecordingFrame = false;
 
     ID3D12CommandList* commandLists[] = { m_commandList.Get() };
     m_commandQueue->ExecuteCommandLists(1, commandLists);
@@ -194,10 +275,20 @@ void DX12Renderer::EndFrame() {
     m_currentFenceValue++;
     THROW_IF_FAILED(m_commandQueue->Signal(m_fence.Get(), m_currentFenceValue), "Signal fence");
     m_fenceValues[m_currentFrameIndex] = m_currentFenceValue;
+
+    // Descriptors freed or used transiently this frame are safe once this fence completes
+    m_srvDescriptors->CloseFrame(m_currentFenceValue);
+    m_samplerDescriptors->CloseFrame(m_currentFenceValue);
+    m_materialConstantPool->CloseFrame(m_currentFenceValue);
+    for (ComPtr<ID3D12Resource>& resource : m_openRetiredResources) {
+        m_retiredResources.push_back({ std::move(resource), m_currentFenceValue });
+    }
+    m_openRetiredResources.clear();
 }
 
 void DX12Renderer::Present() {
     ASSERT(m_isInitialized, "Renderer not initialized");
+    PROFILE_SCOPE("DX12Renderer::Present");
 
     // Present
     UINT presentFlags = 0;
@@ -240,7 +331,55 @@ void DX12Renderer::Clear(const ClearValues& clearValues) {
         clearValues.depth, clearValues.stencil, 0, nullptr);
 }
 
+void DX12Renderer::BuildFrameGraph() {
+    m_frameGraph.Reset();
+
+    RHITextureDesc backBufferDesc;
+    backBufferDesc.width = m_windowWidth;
+    backBufferDesc.height = m_windowHeight;
+    backBufferDesc.format = RHIResourceFormat::R8G8B8A8_Unorm;
+    FrameGraphResource backBuffer = m_frameGraph.ImportTexture("BackBuffer", backBufferDesc,
+                                                               m_renderTargets[m_currentBackBufferIndex].Get(),
+                                                               RHIResourceState::Present, RHIResourceState::Present);
+
+    RHITextureDesc depthDesc = backBufferDesc;
+    depthDesc.format = RHIResourceFormat::D32_Float;
+    FrameGraphResource depth = m_frameGraph.ImportTexture("DepthStencil", depthDesc, m_depthStencilBuffer.Get(),
+                                                          RHIResourceState::DepthWrite, RHIResourceState::DepthWrite);
+
+    // Everything recorded between BeginFrame and EndFrame. Shadow and fog of war passes
+    // go before it, post effects after it.
+    m_scenePassIndex = m_frameGraph.AddPass("Scene",
+        [&](FrameGraphPassBuilder& builder) {
+            builder.Write(backBuffer, RHIResourceState::RenderTarget);
+            builder.Write(depth, RHIResourceState::DepthWrite);
+        },
+        [this](FrameGraphPassContext& context) {
+            SetFrameRenderTargets(m_commandList.Get());
+
+            ViewportDesc viewport;
+            viewport.width = static_cast<float>(m_windowWidth);
+            viewport.height = static_cast<float>(m_windowHeight);
+            SetViewport(viewport);
+        });
+}
+
 void DX12Renderer::SetViewport(const ViewportDesc& viewport) {
+    // Remembered so worker command lists can start from the same viewport
+    m_currentViewport = viewport;
+    ApplyViewport(m_commandList.Get(), viewport);
+}
+
+void DX12Renderer::SetFrameRenderTargets(ID3D12GraphicsCommandList* commandList) {
+    D3D12_CPU_DESCRIPTOR_HANDLE rtvHandle = m_rtvHeap->GetCPUDescriptorHandleForHeapStart();
+    rtvHandle.ptr += m_currentBackBufferIndex * m_rtvDescriptorSize;
+
+    D3D12_CPU_DESCRIPTOR_HANDLE dsvHandle = m_dsvHeap->GetCPUDescriptorHandleForHeapStart();
+
+    commandList->OMSetRenderTargets(1, &rtvHandle, FALSE, &dsvHandle);
+}
+
+void DX12Renderer::ApplyViewport(ID3D12GraphicsCommandList* commandList, const ViewportDesc& viewport) {
     D3D12_VIEWPORT d3dViewport = {};
     d3dViewport.TopLeftX = viewport.x;
     d3dViewport.TopLeftY = viewport.y;
@@ -249,7 +388,7 @@ void DX12Renderer::SetViewport(const ViewportDesc& viewport) {
     d3dViewport.MinDepth = viewport.minDepth;
     d3dViewport.MaxDepth = viewport.maxDepth;
 
-    m_commandList->RSSetViewports(1, &d3dViewport);
+    commandList->RSSetViewports(1, &d3dViewport);
 
     // Set scissor rect to match viewport
     D3D12_RECT scissorRect = {};
@@ -258,7 +397,36 @@ void DX12Renderer::SetViewport(const ViewportDesc& viewport) {
     scissorRect.right = static_cast<LONG>(viewport.x + viewport.width);
     scissorRect.bottom = static_cast<LONG>(viewport.y + viewport.height);
 
-    m_commandList->RSSetScissorRects(1, &scissorRect);
+    commandList->RSSetScissorRects(1, &scissorRect);
+}
+
+void DX12Renderer::ApplyFrameState(ID3D12GraphicsCommandList* commandList) {
+    SetFrameRenderTargets(commandList);
+    ApplyViewport(commandList, m_currentViewport);
+
+    // Default pipeline, so draws that only bind geometry through the RHI are valid
+    if (GetBasicMeshPSO() && GetBasicMeshRootSignature()) {
+        BindForMeshRendering(commandList);
+    }
+}
+
+void DX12Renderer::ExecuteWorkerCommandLists(ID3D12CommandList* const* commandLists, uint32 count) {
+    ASSERT(m_isInitialized, "Renderer not initialized");
+
+    // Main list first: it holds the back buffer transition and clears the workers draw on top of
+    THROW_IF_FAILED(m_commandList->Close(), "Close command list before worker submission");
+
+    ScratchScope scratch;
+    ID3D12CommandList** batch = scratch.Allocate<ID3D12CommandList*>(count + 1);
+    batch[0] = m_commandList.Get();
+    std::copy(commandLists, commandLists + count, batch + 1);
+    m_commandQueue->ExecuteCommandLists(count + 1, batch);
+
+    // A list can be reset as soon as it is submitted; the allocator keeps the submitted
+    // commands alive until the frame fence lets BeginFrame reset it
+    THROW_IF_FAILED(m_commandList->Reset(m_commandAllocators[m_currentFrameIndex].Get(), nullptr),
+                    "Reset command list after worker submission");
+    ApplyFrameState(m_commandList.Get());
 }
 
 void DX12Renderer::WaitForGpu() {
@@ -514,7 +682,7 @@ bool DX12Renderer::CreateDepthStencil() {
 
     D3D12_CLEAR_VALUE optimizedClearValue = {};
     optimizedClearValue.Format = m_depthStencilFormat;
-    optimizedClearValue.DepthStencil.Depth = 1.0f;
+    optimizedClearValue.DepthStencil.Depth = m_config.GetDepthClearValue();
     optimizedClearValue.DepthStencil.Stencil = 0;
 
     D3D12_HEAP_PROPERTIES heapProps = {};
@@ -582,6 +750,16 @@ bool DX12Renderer::CreateCommandList() {
     return true;
 }
 
+bool DX12Renderer::CreateRHIContextPool() {
+    Platform::OutputDebugMessage("Creating worker command contexts...\n");
+
+    // More lists than threads that can record them would only sit idle
+    uint32 contextCount = std::min(m_config.maxRecordingContexts, JobSystem::GetGlobal().GetWorkerCount() + 1);
+
+    m_rhiContextPool = std::make_unique<DX12RHIContextPool>(this);
+    return m_rhiContextPool->Initialize(std::max(contextCount, 1u), m_backBufferCount);
+}
+
 bool DX12Renderer::CreateSynchronization() {
     Platform::OutputDebugMessage("Creating synchronization objects...\n");
 
@@ -852,11 +1030,41 @@ bool DX12Renderer::CopyUploadToTexture(ComPtr<ID3D12Resource>& textureResource,
     }
 }
 
+ID3D12GraphicsCommandList* DX12Renderer::BeginUploadCommands() {
+    HRESULT hr = m_commandAllocators[m_currentFrameIndex]->Reset();
+    if (FAILED(hr)) {
+        Platform::OutputDebugMessage("BeginUploadCommands: Failed to reset command allocator\n");
+        return nullptr;
+    }
+
+    hr = m_commandList->Reset(m_commandAllocators[m_currentFrameIndex].Get(), nullptr);
+    if (FAILED(hr)) {
+        Platform::OutputDebugMessage("BeginUploadCommands: Failed to reset command list\n");
+        return nullptr;
+    }
+
+    return m_commandList.Get();
+}
+
 void DX12Renderer::ExecuteUploadCommands() {
+    PROFILE_SCOPE("DX12Renderer::ExecuteUploadCommands");
     Platform::OutputDebugMessage("DX12Renderer: Executing upload commands\n");
     ExecuteCommandListAndWait();
 }
 
+void DX12Renderer::RetireResource(ComPtr<ID3D12Resource> resource) {
+    if (!resource) {
+        return;
+    }
+
+    // Inside a frame the current list may still use it; outside one, only submitted work can
+    if (m_isRecordingFrame) {
+        m_openRetiredResources.push_back(std::move(resource));
+    } else {
+        m_retiredResources.push_back({ std::move(resource), m_currentFenceValue });
+    }
+}
+
 bool DX12Renderer::CreateVertexBuffer(const void* data, uint64 size, ComPtr<ID3D12Resource>& vertexBuffer,
                                      ComPtr<ID3D12Resource>& uploadBuffer, D3D12_VERTEX_BUFFER_VIEW& bufferView) {
     if (!CreateBuffer(size, D3D12_HEAP_TYPE_DEFAULT, D3D12_RESOURCE_STATE_VERTEX_AND_CONSTANT_BUFFER,
@@ -905,37 +1113,14 @@ bool DX12Renderer::CreateConstantBuffer(uint64 size, ComPtr<ID3D12Resource>& con
 bool DX12Renderer::CompileShader(const String& source, const String& entryPoint, const String& target,
                                 ComPtr<ID3DBlob>& shaderBlob) {
     try {
-        ComPtr<ID3DBlob> errorBlob;
+        ShaderCompileDesc desc;
+        desc.source = source;
+        desc.entryPoint = entryPoint;
+        desc.target = target;
+        desc.compileFlags = DX12ShaderCompiler::GetDefaultCompileFlags(DEBUG_BUILD);
 
-        UINT compileFlags = 0;
-        #ifdef _DEBUG
-            compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
-        #endif
-
-        HRESULT hr = D3DCompile(
-            source.c_str(),
-            source.length(),
-            nullptr,
-            nullptr,
-            nullptr,
-            entryPoint.c_str(),
-            target.c_str(),
-            compileFlags,
-            0,
-            &shaderBlob,
-            &errorBlob
-        );
-
-        if (FAILED(hr)) {
-            if (errorBlob) {
-                String errorMsg = "Shader compilation failed: ";
-                errorMsg += static_cast<const char*>(errorBlob->GetBufferPointer());
-                Platform::OutputDebugMessage(errorMsg);
-            }
-            return false;
-        }
-
-        return true;
+        Vector<uint8> bytecode;
+        return DX12ShaderCompiler::Compile(desc, bytecode) && DX12ShaderCompiler::CreateBlob(bytecode, shaderBlob);
     }
     catch (const std::exception& e) {
         Platform::OutputDebugMessage("Error compiling shader: " + String(e.what()));
@@ -1010,342 +1195,107 @@ bool DX12Renderer::CreateRootSignatures() {
 }
 
 bool DX12Renderer::CreateAllPipelineStates() {
-    Platform::OutputDebugMessage("DX12Renderer: Creating all Pipeline State Objects...\n");
-    
-    // Create basic mesh PSO
-    if (!CreateBasicMeshPSO(m_basicMeshRootSignature.Get(), 
-                           m_vertexShader.Get(), 
-                           m_pixelShader.Get())) {
-        Platform::OutputDebugMessage("DX12Renderer: Failed to create basic mesh PSO\n");
-        return false;
-    }
-    
-    // Create wireframe mesh PSO
-    if (!CreateWireframeMeshPSO(m_basicMeshRootSignature.Get(), 
-                               m_vertexShader.Get(), 
-                               m_pixelShader.Get())) {
-        Platform::OutputDebugMessage("DX12Renderer: Failed to create wireframe mesh PSO\n");
-        return false;
-    }
-    
-    // Create textured mesh PSO
-    if (!CreateTexturedMeshPSO(m_texturedMeshRootSignature.Get(), 
-                              m_vertexShader.Get(), 
-                              m_texturedPixelShader.Get())) {
-        Platform::OutputDebugMessage("DX12Renderer: Failed to create textured mesh PSO\n");
-        return false;
-    }
-    
-    // Create textured wireframe mesh PSO
-    if (!CreateTexturedWireframeMeshPSO(m_texturedMeshRootSignature.Get(), 
-                                       m_vertexShader.Get(), 
-                                       m_texturedPixelShader.Get())) {
-        Platform::OutputDebugMessage("DX12Renderer: Failed to create textured wireframe mesh PSO\n");
-        return false;
-    }
-    
-    // Create emissive mesh PSO (if emissive shader is available)
+    Platform::OutputDebugMessage("DX12Renderer: Describing mesh pipelines...\n");
+
+    // A missing or rejected library only means this run compiles its pipelines
+    m_pipelineLibrary = std::make_unique<DX12PipelineLibrary>(m_device.Get(), m_config.pipelineLibraryPath);
+    m_pipelineLibrary->Load();
+    m_pipelineCache = std::make_unique<PipelineStateCache>([this](const PipelineStateDesc& desc, uint64 hash) -> void* {
+        return CreatePipelineState(desc, hash);
+    });
+
+    // Defaults match m_backBufferFormat and m_depthStencilFormat
+    PipelineStateDesc basic;
+    basic.depthFunc = m_config.reverseZ ? RHIComparisonFunc::Greater : RHIComparisonFunc::Less;
+    basic.rootSignature = m_basicMeshRootSignatureKey;
+    basic.vertexShader = GetShaderKey(m_vertexShader.Get());
+    basic.pixelShader = GetShaderKey(m_pixelShader.Get());
+
+    PipelineStateDesc textured = basic;
+    textured.rootSignature = m_texturedMeshRootSignatureKey;
+    textured.pixelShader = GetShaderKey(m_texturedPixelShader.Get());
+
+    // Without the emissive shader the emissive variants resolve to the basic pipelines
+    PipelineStateDesc emissive = basic;
     if (m_emissivePixelShader) {
-        if (!CreateEmissiveMeshPSO(m_basicMeshRootSignature.Get(), 
-                                  m_vertexShader.Get(), 
-                                  m_emissivePixelShader.Get())) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create emissive mesh PSO\n");
-            return false;
-        }
-        
-        // Create emissive wireframe mesh PSO
-        if (!CreateEmissiveWireframeMeshPSO(m_basicMeshRootSignature.Get(), 
-                                           m_vertexShader.Get(), 
-                                           m_emissivePixelShader.Get())) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create emissive wireframe mesh PSO\n");
-            return false;
-        }
+        emissive.pixelShader = GetShaderKey(m_emissivePixelShader.Get());
     } else {
-        Platform::OutputDebugMessage("DX12Renderer: Emissive pixel shader not available, skipping emissive PSOs\n");
+        Platform::OutputDebugMessage("DX12Renderer: Emissive pixel shader not available, emissive meshes use the basic pipeline\n");
     }
-    
-    Platform::OutputDebugMessage("DX12Renderer: All Pipeline State Objects created successfully\n");
-    return true;
-}
 
-bool DX12Renderer::CreateBasicMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating basic mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
+    const PipelineStateDesc solids[] = { basic, textured, emissive };
+    for (uint32 i = 0; i < static_cast<uint32>(MeshPipeline::Count); ++i) {
+        PipelineStateDesc wireframe = solids[i];
+        wireframe.fillMode = RHIFillMode::Wireframe;
+        wireframe.cullMode = RHICullMode::None;
 
-        // PSO description
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
-
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_basicMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create basic mesh PSO\n");
-            return false;
-        }
-
-        SetDebugName(m_basicMeshPSO.Get(), "Basic Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Basic mesh PSO created successfully\n");
-        return true;
+        m_meshPipelineDescs[i][0] = solids[i];
+        m_meshPipelineDescs[i][1] = wireframe;
     }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateBasicMeshPSO\n");
-        return false;
-    }
-}
-
-bool DX12Renderer::CreateWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating wireframe mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
 
-        // PSO description (same as basic but wireframe)
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_WIREFRAME; // Wireframe mode
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;      // Disable culling for wireframe
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
-
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_wireframeMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create wireframe mesh PSO\n");
-            return false;
-        }
-
-        SetDebugName(m_wireframeMeshPSO.Get(), "Wireframe Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Wireframe mesh PSO created successfully\n");
-        return true;
+    // The emissive wireframe has always kept back-face culling
+    if (m_emissivePixelShader) {
+        m_meshPipelineDescs[static_cast<uint32>(MeshPipeline::Emissive)][1].cullMode = RHICullMode::Back;
     }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateWireframeMeshPSO\n");
-        return false;
+
+    for (uint32 i = 0; i < static_cast<uint32>(MeshPipeline::Count); ++i) {
+        m_meshPipelineHashes[i][0] = PipelineStateDesc::ComputeHash(m_meshPipelineDescs[i][0]);
+        m_meshPipelineHashes[i][1] = PipelineStateDesc::ComputeHash(m_meshPipelineDescs[i][1]);
     }
-}
 
-bool DX12Renderer::CreateTexturedMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating textured mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
+    Platform::OutputDebugMessage("DX12Renderer: Mesh pipelines described\n");
+    return true;
+}
 
-        // PSO description
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
+uint64 DX12Renderer::GetShaderKey(ID3DBlob* shaderBlob) {
+    return shaderBlob ? HashBytes(shaderBlob->GetBufferPointer(), shaderBlob->GetBufferSize()) : 0;
+}
 
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_texturedMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create textured mesh PSO\n");
-            return false;
-        }
+const PipelineStateDesc& DX12Renderer::GetMeshPipelineDesc(MeshPipeline pipeline, bool wireframe) const {
+    return m_meshPipelineDescs[static_cast<uint32>(pipeline)][wireframe ? 1 : 0];
+}
 
-        SetDebugName(m_texturedMeshPSO.Get(), "Textured Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Textured mesh PSO created successfully\n");
-        return true;
-    }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateTexturedMeshPSO\n");
-        return false;
+ID3D12PipelineState* DX12Renderer::GetMeshPipelineState(MeshPipeline pipeline, bool wireframe) {
+    if (!m_pipelineCache) {
+        return nullptr;
     }
+
+    // Hashes are precomputed, so a warm bind is one map lookup
+    uint32 index = static_cast<uint32>(pipeline);
+    uint32 variant = wireframe ? 1 : 0;
+    return static_cast<ID3D12PipelineState*>(m_pipelineCache->GetOrCreate(m_meshPipelineDescs[index][variant],
+                                                                          m_meshPipelineHashes[index][variant]));
 }
 
-bool DX12Renderer::CreateTexturedWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating textured wireframe mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
+ID3D12PipelineState* DX12Renderer::GetPipelineState(const PipelineStateDesc& desc) {
+    return m_pipelineCache ? static_cast<ID3D12PipelineState*>(m_pipelineCache->GetOrCreate(desc)) : nullptr;
+}
 
-        // PSO description (textured but wireframe)
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_WIREFRAME; // Wireframe mode
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;      // Disable culling for wireframe
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
+ID3D12PipelineState* DX12Renderer::CreatePipelineState(const PipelineStateDesc& desc, uint64 hash) {
+    auto rootSignature = m_rootSignatures.find(desc.rootSignature);
+    auto vertexShader = m_shaderBytecode.find(desc.vertexShader);
+    auto pixelShader = m_shaderBytecode.find(desc.pixelShader);
+    if (rootSignature == m_rootSignatures.end() || vertexShader == m_shaderBytecode.end() ||
+        (desc.pixelShader != 0 && pixelShader == m_shaderBytecode.end())) {
+        Platform::OutputDebugMessage("DX12Renderer: Pipeline refers to an unregistered shader or root signature\n");
+        return nullptr;
+    }
 
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_texturedWireframeMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create textured wireframe mesh PSO\n");
-            return false;
-        }
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = DX12PipelineLibrary::BuildGraphicsDesc(
+        desc, rootSignature->second, vertexShader->second.Get(),
+        desc.pixelShader != 0 ? pixelShader->second.Get() : nullptr);
 
-        SetDebugName(m_texturedWireframeMeshPSO.Get(), "Textured Wireframe Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Textured wireframe mesh PSO created successfully\n");
-        return true;
-    }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateTexturedWireframeMeshPSO\n");
-        return false;
+    ComPtr<ID3D12PipelineState> pipeline;
+    if (!m_pipelineLibrary->LoadOrCreate(hash, psoDesc, pipeline)) {
+        Platform::OutputDebugMessage("DX12Renderer: Failed to create pipeline state\n");
+        return nullptr;
     }
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "PSO %016llx", static_cast<unsigned long long>(hash));
+    SetDebugName(pipeline.Get(), name);
+    m_pipelineStates.push_back(pipeline);
+    return pipeline.Get();
 }
 
 bool DX12Renderer::CreateBasicMeshRootSignature() {
@@ -1410,6 +1360,10 @@ bool DX12Renderer::CreateBasicMeshRootSignature() {
             return false;
         }
 
+        // Pipeline descriptions refer to the root signature by its serialized contents
+        m_basicMeshRootSignatureKey = HashBytes(signature->GetBufferPointer(), signature->GetBufferSize());
+        m_rootSignatures[m_basicMeshRootSignatureKey] = m_basicMeshRootSignature.Get();
+
         SetDebugName(m_basicMeshRootSignature.Get(), "Basic Mesh Root Signature");
         Platform::OutputDebugMessage("DX12Renderer: Basic mesh root signature created successfully\n");
         return true;
@@ -1505,6 +1459,9 @@ bool DX12Renderer::CreateTexturedMeshRootSignature() {
             return false;
         }
 
+        m_texturedMeshRootSignatureKey = HashBytes(signature->GetBufferPointer(), signature->GetBufferSize());
+        m_rootSignatures[m_texturedMeshRootSignatureKey] = m_texturedMeshRootSignature.Get();
+
         SetDebugName(m_texturedMeshRootSignature.Get(), "Textured Mesh Root Signature");
         Platform::OutputDebugMessage("DX12Renderer: Textured mesh root signature created successfully\n");
         return true;
@@ -1672,82 +1629,98 @@ bool DX12Renderer::InitializeRenderingPipeline() {
 bool DX12Renderer::CreateShaderDescriptorHeaps() {
     Platform::OutputDebugMessage("Creating shader descriptor heaps in DX12Renderer...\n");
 
-    try {
-        // Create SRV descriptor heap (for textures)
-        D3D12_DESCRIPTOR_HEAP_DESC srvHeapDesc = {};
-        srvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV;
-        srvHeapDesc.NumDescriptors = 1024; // Support up to 1024 textures
-        srvHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        srvHeapDesc.NodeMask = 0;
-
-        THROW_IF_FAILED(m_device->CreateDescriptorHeap(&srvHeapDesc,
-                                                       IID_PPV_ARGS(&m_srvHeap)),
-                        "Create SRV descriptor heap");
-        
-        SetDebugName(m_srvHeap.Get(), "SRV Descriptor Heap");
-        m_srvDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
-
-        // Create Sampler descriptor heap
-        D3D12_DESCRIPTOR_HEAP_DESC samplerHeapDesc = {};
-        samplerHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER;
-        samplerHeapDesc.NumDescriptors = 256; // Support up to 256 samplers
-        samplerHeapDesc.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE;
-        samplerHeapDesc.NodeMask = 0;
-
-        THROW_IF_FAILED(m_device->CreateDescriptorHeap(&samplerHeapDesc,
-                                                       IID_PPV_ARGS(&m_samplerHeap)),
-                        "Create Sampler descriptor heap");
-        
-        SetDebugName(m_samplerHeap.Get(), "Sampler Descriptor Heap");
-        m_samplerDescriptorSize = m_device->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER);
-
-        Platform::OutputDebugMessage("Shader descriptor heaps created successfully in DX12Renderer\n");
-        return true;
+    // Textures come and go with streaming, so SRV slots are recycled rather than bumped
+    m_srvDescriptors = std::make_unique<DX12DescriptorHeap>(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+                                                            MAX_SRV_DESCRIPTORS, MAX_TRANSIENT_SRV_DESCRIPTORS);
+    if (!m_srvDescriptors->Create(m_device.Get(), "SRV Descriptor Heap")) {
+        return false;
     }
-    catch (const WindowsException& e) {
-        Platform::OutputDebugMessage("Error creating shader descriptor heaps: " + e.GetMessage());
+
+    m_samplerDescriptors = std::make_unique<DX12DescriptorHeap>(D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, MAX_SAMPLER_DESCRIPTORS, 0);
+    if (!m_samplerDescriptors->Create(m_device.Get(), "Sampler Descriptor Heap")) {
         return false;
     }
+    m_samplerCache = std::make_unique<SamplerCache>(*this);
+
+    Platform::OutputDebugMessage("Shader descriptor heaps created successfully in DX12Renderer\n");
+    return true;
+}
+
+ID3D12DescriptorHeap* DX12Renderer::GetSRVHeap() const {
+    return m_srvDescriptors ? m_srvDescriptors->GetHeap() : nullptr;
+}
+
+ID3D12DescriptorHeap* DX12Renderer::GetSamplerHeap() const {
+    return m_samplerDescriptors ? m_samplerDescriptors->GetHeap() : nullptr;
 }
 
 uint32 DX12Renderer::AllocateSRVDescriptor() {
-    if (m_currentSrvIndex >= 1024) {
+    uint32 index = m_srvDescriptors->AllocatePersistent();
+    if (index == INVALID_DESCRIPTOR_INDEX) {
         Platform::OutputDebugMessage("DX12Renderer: SRV descriptor heap is full!\n");
-        return 0;
     }
-    return m_currentSrvIndex++;
+    return index;
 }
 
 uint32 DX12Renderer::AllocateSamplerDescriptor() {
-    if (m_currentSamplerIndex >= 256) {
+    uint32 index = m_samplerDescriptors->AllocatePersistent();
+    if (index == INVALID_DESCRIPTOR_INDEX) {
         Platform::OutputDebugMessage("DX12Renderer: Sampler descriptor heap is full!\n");
-        return 0;
     }
-    return m_currentSamplerIndex++;
+    return index;
+}
+
+void DX12Renderer::FreeSRVDescriptor(uint32 index) {
+    if (m_srvDescriptors) {
+        m_srvDescriptors->FreePersistent(index);
+    }
+}
+
+void DX12Renderer::FreeSamplerDescriptor(uint32 index) {
+    if (m_samplerDescriptors) {
+        m_samplerDescriptors->FreePersistent(index);
+    }
+}
+
+uint32 DX12Renderer::AllocateTransientSRVDescriptors(uint32 count) {
+    uint32 index = m_srvDescriptors->AllocateTransient(count);
+    if (index == INVALID_DESCRIPTOR_INDEX) {
+        Platform::OutputDebugMessage("DX12Renderer: Transient SRV descriptors exhausted this frame\n");
+    }
+    return index;
+}
+
+DescriptorAllocatorStats DX12Renderer::GetSRVDescriptorStats() const {
+    return m_srvDescriptors->GetStats();
+}
+
+SharedPtr<Material> DX12Renderer::GetMaterialTemplate(const String& key, const Function<SharedPtr<Material>()>& create) {
+    auto it = m_materialTemplates.find(key);
+    if (it != m_materialTemplates.end()) {
+        return it->second;
+    }
+
+    SharedPtr<Material> material = create();
+    if (material) {
+        m_materialTemplates.emplace(key, material);
+    }
+    return material;
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE DX12Renderer::GetSRVCPUHandle(uint32 index) const {
-    D3D12_CPU_DESCRIPTOR_HANDLE handle = m_srvHeap->GetCPUDescriptorHandleForHeapStart();
-    handle.ptr += index * m_srvDescriptorSize;
-    return handle;
+    return m_srvDescriptors->GetCPUHandle(index);
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE DX12Renderer::GetSRVGPUHandle(uint32 index) const {
-    D3D12_GPU_DESCRIPTOR_HANDLE handle = m_srvHeap->GetGPUDescriptorHandleForHeapStart();
-    handle.ptr += index * m_srvDescriptorSize;
-    return handle;
+    return m_srvDescriptors->GetGPUHandle(index);
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE DX12Renderer::GetSamplerCPUHandle(uint32 index) const {
-    D3D12_CPU_DESCRIPTOR_HANDLE handle = m_samplerHeap->GetCPUDescriptorHandleForHeapStart();
-    handle.ptr += index * m_samplerDescriptorSize;
-    return handle;
+    return m_samplerDescriptors->GetCPUHandle(index);
 }
 
 D3D12_GPU_DESCRIPTOR_HANDLE DX12Renderer::GetSamplerGPUHandle(uint32 index) const {
-    D3D12_GPU_DESCRIPTOR_HANDLE handle = m_samplerHeap->GetGPUDescriptorHandleForHeapStart();
-    handle.ptr += index * m_samplerDescriptorSize;
-    return handle;
+    return m_samplerDescriptors->GetGPUHandle(index);
 }
 
 bool DX12Renderer::LoadShaderSource(const String& filePath, String& shaderSource) {
@@ -1772,59 +1745,65 @@ bool DX12Renderer::LoadShaderSource(const String& filePath, String& shaderSource
     return true;
 }
 
-bool DX12Renderer::CreateBasicMeshShaders() {
-    Platform::OutputDebugMessage("Creating basic mesh shaders from files...\n");
-
-    // Load shaders from files
-    String vertexShaderCode;
-    String pixelShaderCode;
-    String texturedPixelShaderCode;
-    String emissivePixelShaderCode;
+bool DX12Renderer::LoadShader(const String& filePath, const String& entryPoint, const String& target,
+                              ComPtr<ID3DBlob>& shaderBlob, const Vector<ShaderDefine>& defines) {
+    ShaderCompileDesc desc;
+    desc.sourcePath = filePath;
+    desc.entryPoint = entryPoint;
+    desc.target = target;
+    desc.defines = defines;
+    desc.compileFlags = DX12ShaderCompiler::GetDefaultCompileFlags(DEBUG_BUILD);
 
-    if (!LoadShaderSource("../../Shaders/BasicMesh.vs.hlsl", vertexShaderCode)) {
-        Platform::OutputDebugMessage("Failed to load vertex shader from file\n");
+    // The source is still read so edits invalidate the cache; hashing it is far cheaper than D3DCompile
+    if (!LoadShaderSource(filePath, desc.source)) {
         return false;
     }
 
-    if (!LoadShaderSource("../../Shaders/BasicMesh.ps.hlsl", pixelShaderCode)) {
-        Platform::OutputDebugMessage("Failed to load pixel shader from file\n");
+    Vector<uint8> bytecode;
+    auto compile = [](const ShaderCompileDesc& compileDesc, Vector<uint8>& outBytecode) {
+        return DX12ShaderCompiler::Compile(compileDesc, outBytecode);
+    };
+    if (!m_shaderCache->GetOrCompile(desc, compile, bytecode)) {
+        Platform::OutputDebugMessage("Failed to compile shader: " + filePath + "\n");
         return false;
     }
 
-    if (!LoadShaderSource("../../Shaders/TexturedMesh.ps.hlsl", texturedPixelShaderCode)) {
-        Platform::OutputDebugMessage("Failed to load textured pixel shader from file\n");
+    if (!DX12ShaderCompiler::CreateBlob(bytecode, shaderBlob)) {
         return false;
     }
 
-    if (!LoadShaderSource("../../Shaders/EmissiveMesh.ps.hlsl", emissivePixelShaderCode)) {
-        Platform::OutputDebugMessage("Failed to load emissive pixel shader from file\n");
-        return false;
-    }
-    Platform::OutputDebugMessage("Emissive pixel shader loaded successfully\n");
+    // Pipeline descriptions name shaders by bytecode hash
+    m_shaderBytecode[GetShaderKey(shaderBlob.Get())] = shaderBlob;
+    return true;
+}
 
-    // Compile shaders
-    if (!CompileShader(vertexShaderCode, "VSMain", "vs_5_0", m_vertexShader)) {
-        Platform::OutputDebugMessage("Failed to compile vertex shader\n");
+bool DX12Renderer::CreateBasicMeshShaders() {
+    Platform::OutputDebugMessage("Creating basic mesh shaders from files...\n");
+
+    // Bytecode comes from the shader cache when it is up to date
+    if (!LoadShader("../../Shaders/BasicMesh.vs.hlsl", "VSMain", "vs_5_0", m_vertexShader)) {
+        Platform::OutputDebugMessage("Failed to load vertex shader\n");
         return false;
     }
 
-    if (!CompileShader(pixelShaderCode, "PSMain", "ps_5_0", m_pixelShader)) {
-        Platform::OutputDebugMessage("Failed to compile pixel shader\n");
+    if (!LoadShader("../../Shaders/BasicMesh.ps.hlsl", "PSMain", "ps_5_0", m_pixelShader)) {
+        Platform::OutputDebugMessage("Failed to load pixel shader\n");
         return false;
     }
 
-    if (!CompileShader(texturedPixelShaderCode, "PSMain", "ps_5_0", m_texturedPixelShader)) {
-        Platform::OutputDebugMessage("Failed to compile textured pixel shader\n");
+    if (!LoadShader("../../Shaders/TexturedMesh.ps.hlsl", "PSMain", "ps_5_0", m_texturedPixelShader)) {
+        Platform::OutputDebugMessage("Failed to load textured pixel shader\n");
         return false;
     }
 
-    if (!CompileShader(emissivePixelShaderCode, "PSMain", "ps_5_0", m_emissivePixelShader)) {
-        Platform::OutputDebugMessage("Failed to compile emissive pixel shader\n");
+    if (!LoadShader("../../Shaders/EmissiveMesh.ps.hlsl", "PSMain", "ps_5_0", m_emissivePixelShader)) {
+        Platform::OutputDebugMessage("Failed to load emissive pixel shader\n");
         return false;
     }
-    Platform::OutputDebugMessage("Emissive pixel shader compiled successfully\n");
 
-    Platform::OutputDebugMessage("Basic mesh shaders compiled successfully from files\n");
+    const ShaderCacheStats& stats = m_shaderCache->GetStats();
+    Platform::OutputDebugMessage("Basic mesh shaders ready (" + std::to_string(stats.hits) + " cached, " +
+                                 std::to_string(stats.misses) + " compiled)\n");
     return true;
 }
 
@@ -1861,8 +1840,9 @@ void DX12Renderer::BindForTexturedMeshRendering(ID3D12GraphicsCommandList* comma
         return;
     }
     
-    // Check if textured PSOs exist
-    if (!GetTexturedMeshPSO() || !GetTexturedWireframeMeshPSO()) {
+    // Check if the textured PSO for the current mode exists
+    ID3D12PipelineState* texturedPSO = GetMeshPipelineState(MeshPipeline::Textured, m_wireframeMode);
+    if (!texturedPSO) {
         Platform::OutputDebugMessage("BindForTexturedMeshRendering: Missing textured PSOs, falling back to basic rendering\n");
         BindForMeshRendering(commandList, objectIndex);
         return;
@@ -1882,11 +1862,7 @@ void DX12Renderer::BindForTexturedMeshRendering(ID3D12GraphicsCommandList* comma
     commandList->SetGraphicsRootSignature(GetTexturedMeshRootSignature());
     
     Platform::OutputDebugMessage("BindForTexturedMeshRendering: Setting PSO\n");
-    if (m_wireframeMode) {
-        commandList->SetPipelineState(GetTexturedWireframeMeshPSO());
-    } else {
-        commandList->SetPipelineState(GetTexturedMeshPSO());
-    }
+    commandList->SetPipelineState(texturedPSO);
     
     Platform::OutputDebugMessage("BindForTexturedMeshRendering: Binding constant buffers\n");
     // Bind constant buffers
@@ -1940,146 +1916,6 @@ void DX12Renderer::BindForEmissiveMeshRendering(ID3D12GraphicsCommandList* comma
     }
 }
 
-bool DX12Renderer::CreateEmissiveMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating emissive mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
-
-        // PSO description
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_SOLID;
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
-
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_emissiveMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create emissive mesh PSO\n");
-            return false;
-        }
-
-        SetDebugName(m_emissiveMeshPSO.Get(), "Emissive Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Emissive mesh PSO created successfully\n");
-        return true;
-    }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateEmissiveMeshPSO\n");
-        return false;
-    }
-}
-
-bool DX12Renderer::CreateEmissiveWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
-    Platform::OutputDebugMessage("DX12Renderer: Creating emissive wireframe mesh PSO...\n");
-    
-    try {
-        // Input layout
-        D3D12_INPUT_ELEMENT_DESC inputElementDescs[] = {
-            { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
-            { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
-        };
-
-        // PSO description
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
-        psoDesc.InputLayout = { inputElementDescs, _countof(inputElementDescs) };
-        psoDesc.pRootSignature = rootSignature;
-        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
-        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
-
-        psoDesc.RasterizerState.FillMode = D3D12_FILL_MODE_WIREFRAME; // Wireframe mode
-        psoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_BACK;
-        psoDesc.RasterizerState.FrontCounterClockwise = TRUE;
-        psoDesc.RasterizerState.DepthBias = 0;
-        psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
-        psoDesc.RasterizerState.SlopeScaledDepthBias = 0.0f;
-        psoDesc.RasterizerState.DepthClipEnable = TRUE;
-        psoDesc.RasterizerState.MultisampleEnable = FALSE;
-        psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
-        psoDesc.RasterizerState.ForcedSampleCount = 0;
-        psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
-
-        // Blend state
-        psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
-        psoDesc.BlendState.IndependentBlendEnable = FALSE;
-        for (int i = 0; i < 8; ++i) {
-            psoDesc.BlendState.RenderTarget[i].BlendEnable = FALSE;
-            psoDesc.BlendState.RenderTarget[i].RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
-        }
-
-        // Depth stencil state
-        psoDesc.DepthStencilState.DepthEnable = TRUE;
-        psoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ALL;
-        psoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS;
-        psoDesc.DepthStencilState.StencilEnable = FALSE;
-
-        // Other settings
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = m_backBufferFormat;
-        psoDesc.DSVFormat = m_depthStencilFormat;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-
-        // Create PSO
-        HRESULT hr = m_device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&m_emissiveWireframeMeshPSO));
-        if (FAILED(hr)) {
-            Platform::OutputDebugMessage("DX12Renderer: Failed to create emissive wireframe mesh PSO\n");
-            return false;
-        }
-
-        SetDebugName(m_emissiveWireframeMeshPSO.Get(), "Emissive Wireframe Mesh PSO");
-        Platform::OutputDebugMessage("DX12Renderer: Emissive wireframe mesh PSO created successfully\n");
-        return true;
-    }
-    catch (...) {
-        Platform::OutputDebugMessage("DX12Renderer: Exception in CreateEmissiveWireframeMeshPSO\n");
-        return false;
-    }
-}
-
 // Factory method implementation
 UniquePtr<Renderer> Renderer::Create() {
     return std::make_unique<DX12Renderer>();
@@ -1,41 +1,37 @@
 #pragma once
 
 #include "../Renderer.h"
+#include "../ShaderConstants.h"
+#include "../FrameGraph/FrameGraph.h"
+#include "../Pipeline/PipelineStateDesc.h"
 #include "../../Platform/Windows/WindowsPlatform.h"
 #include <DirectXMath.h>
 
-// Constant buffer structures
-struct ModelConstants {
-    DirectX::XMMATRIX modelMatrix;
-    DirectX::XMMATRIX normalMatrix;
-};
-
-struct ViewConstants {
-    DirectX::XMMATRIX viewMatrix;
-    DirectX::XMMATRIX projectionMatrix;
-    DirectX::XMMATRIX viewProjectionMatrix;
-    DirectX::XMFLOAT3 cameraPosition;
-    float padding;
-};
-
-struct LightConstants {
-    DirectX::XMFLOAT3 lightPosition;
-    float lightIntensity;
-    DirectX::XMFLOAT3 lightColor;
-    float padding;
-};
-
-struct MaterialConstants {
-    DirectX::XMFLOAT3 baseColor;
-    float metallic;
-    float roughness;
-    float padding[3];
-};
-
 class Window;
+class AssetManager;
+class TextureStreamer;
+class ShaderCache;
+struct ShaderDefine;
+class DX12RHIContextPool;
+class DX12FrameGraphBackend;
+class DX12PipelineLibrary;
+class PipelineStateCache;
+class DX12DescriptorHeap;
+class SamplerCache;
+class MaterialConstantPool;
+class Material;
+struct DescriptorAllocatorStats;
 
 class DX12Renderer : public Renderer {
 public:
+    // Pipelines the mesh Bind* methods choose from (each has a solid and a wireframe variant)
+    enum class MeshPipeline {
+        Basic,
+        Textured,
+        Emissive,
+        Count
+    };
+
     DX12Renderer();
     virtual ~DX12Renderer();
 
@@ -56,6 +52,13 @@ public:
     void SetDebugName(void* resource, const String& name) override;
     uint64 GetGpuMemoryUsage() const override;
     uint32 GetCurrentFrameIndex() const override { return m_currentFrameIndex; }
+    const RendererConfig& GetConfig() const { return m_config; }
+
+    // Shared texture/mesh cache (budget from RendererConfig::gpuMemoryBudgetMB)
+    AssetManager& GetAssetManager() { return *m_assetManager; }
+
+    // Mip streaming for large textures; nullptr when RendererConfig::enableTextureStreaming is off
+    TextureStreamer* GetTextureStreamer() { return m_textureStreamer.get(); }
 
     // Resource creation helpers for meshes and shaders
     bool CreateBuffer(uint64 size, D3D12_HEAP_TYPE heapType, D3D12_RESOURCE_STATES initialState,
@@ -70,9 +73,19 @@ public:
                             ComPtr<ID3D12Resource>& uploadBuffer,
                             uint32 width, uint32 height, DXGI_FORMAT format);
 
+    // Reset the command list for a batch of copy commands; finish with ExecuteUploadCommands
+    ID3D12GraphicsCommandList* BeginUploadCommands();
+
     // Public interface for executing upload commands
     void ExecuteUploadCommands();
 
+    // The frame's command list between BeginFrame's reset and EndFrame, nullptr outside
+    // a frame. Copies recorded here run before the frame's draws without a GPU wait.
+    ID3D12GraphicsCommandList* GetFrameCommandList() const { return m_isRecordingFrame ? m_commandList.Get() : nullptr; }
+
+    // Keep a resource alive until the frames that may still use it have finished on the GPU
+    void RetireResource(ComPtr<ID3D12Resource> resource);
+
     bool CreateVertexBuffer(const void* data, uint64 size, ComPtr<ID3D12Resource>& vertexBuffer,
                            ComPtr<ID3D12Resource>& uploadBuffer, D3D12_VERTEX_BUFFER_VIEW& bufferView);
 
@@ -87,12 +100,19 @@ public:
     
     // Shader loading from files  
     bool LoadShaderSource(const String& filePath, String& shaderSource);
+
+    // Load a shader file through the on-disk bytecode cache (filled offline by Tools/ShaderCompiler);
+    // compiles and stores the result on a miss
+    bool LoadShader(const String& filePath, const String& entryPoint, const String& target,
+                    ComPtr<ID3DBlob>& shaderBlob, const Vector<ShaderDefine>& defines = {});
+    ShaderCache& GetShaderCache() { return *m_shaderCache; }
     bool CreateBasicMeshShaders();
 
     // Root Signature creation
     bool CreateRootSignatures();
     
-    // PSO creation - updated to use internal shaders
+    // Describes the mesh pipelines and opens the on-disk pipeline library; the PSOs
+    // themselves are created (or loaded from the library) on first use
     bool CreateAllPipelineStates();
     
     // Initialize rendering pipeline with shader loading
@@ -102,13 +122,23 @@ public:
     ID3D12RootSignature* GetBasicMeshRootSignature() const { return m_basicMeshRootSignature.Get(); }
     ID3D12RootSignature* GetTexturedMeshRootSignature() const { return m_texturedMeshRootSignature.Get(); }
     
-    // PSO accessors
-    ID3D12PipelineState* GetBasicMeshPSO() const { return m_basicMeshPSO.Get(); }
-    ID3D12PipelineState* GetWireframeMeshPSO() const { return m_wireframeMeshPSO.Get(); }
-    ID3D12PipelineState* GetTexturedMeshPSO() const { return m_texturedMeshPSO.Get(); }
-    ID3D12PipelineState* GetTexturedWireframeMeshPSO() const { return m_texturedWireframeMeshPSO.Get(); }
-    ID3D12PipelineState* GetEmissiveMeshPSO() const { return m_emissiveMeshPSO.Get(); }
-    ID3D12PipelineState* GetEmissiveWireframeMeshPSO() const { return m_emissiveWireframeMeshPSO.Get(); }
+    // PSO accessors (created on first call)
+    ID3D12PipelineState* GetBasicMeshPSO() { return GetMeshPipelineState(MeshPipeline::Basic, false); }
+    ID3D12PipelineState* GetWireframeMeshPSO() { return GetMeshPipelineState(MeshPipeline::Basic, true); }
+    ID3D12PipelineState* GetTexturedMeshPSO() { return GetMeshPipelineState(MeshPipeline::Textured, false); }
+    ID3D12PipelineState* GetTexturedWireframeMeshPSO() { return GetMeshPipelineState(MeshPipeline::Textured, true); }
+    ID3D12PipelineState* GetEmissiveMeshPSO() { return GetMeshPipelineState(MeshPipeline::Emissive, false); }
+    ID3D12PipelineState* GetEmissiveWireframeMeshPSO() { return GetMeshPipelineState(MeshPipeline::Emissive, true); }
+    ID3D12PipelineState* GetMeshPipelineState(MeshPipeline pipeline, bool wireframe);
+    const PipelineStateDesc& GetMeshPipelineDesc(MeshPipeline pipeline, bool wireframe) const;
+
+    // Any pipeline variant, created on first use. Shaders loaded through LoadShader and
+    // the mesh root signatures are known by key; register them before recording starts.
+    ID3D12PipelineState* GetPipelineState(const PipelineStateDesc& desc);
+    PipelineStateCache& GetPipelineCache() { return *m_pipelineCache; }
+    static uint64 GetShaderKey(ID3DBlob* shaderBlob);
+    uint64 GetBasicMeshRootSignatureKey() const { return m_basicMeshRootSignatureKey; }
+    uint64 GetTexturedMeshRootSignatureKey() const { return m_texturedMeshRootSignatureKey; }
     
     // Shader accessors
     ID3DBlob* GetVertexShader() const { return m_vertexShader.Get(); }
@@ -141,8 +171,8 @@ public:
     
     // Shader resource descriptor heaps
     bool CreateShaderDescriptorHeaps();
-    ID3D12DescriptorHeap* GetSRVHeap() const { return m_srvHeap.Get(); }
-    ID3D12DescriptorHeap* GetSamplerHeap() const { return m_samplerHeap.Get(); }
+    ID3D12DescriptorHeap* GetSRVHeap() const;
+    ID3D12DescriptorHeap* GetSamplerHeap() const;
     
     // Mesh rendering methods (moved from ShaderManager)
     void BindForMeshRendering(ID3D12GraphicsCommandList* commandList, uint32 objectIndex = 0);
@@ -153,9 +183,26 @@ public:
     void SetWireframeMode(bool wireframe) { m_wireframeMode = wireframe; }
     bool IsWireframeMode() const { return m_wireframeMode; }
     
-    // Descriptor allocation and handle management
+    // Descriptor allocation and handle management. Persistent indices stay valid until
+    // freed (INVALID_DESCRIPTOR_INDEX when the heap is full); freed slots are reused once
+    // the frames that could still read them have finished on the GPU.
     uint32 AllocateSRVDescriptor();
     uint32 AllocateSamplerDescriptor();
+    void FreeSRVDescriptor(uint32 index);
+    void FreeSamplerDescriptor(uint32 index);
+
+    // Contiguous SRV range valid for the current frame only
+    uint32 AllocateTransientSRVDescriptors(uint32 count);
+    DescriptorAllocatorStats GetSRVDescriptorStats() const;
+
+    // Samplers shared by description (see Sampler::Create*)
+    SamplerCache& GetSamplerCache() { return *m_samplerCache; }
+
+    // Constant slots for material instances, recycled with the frame fence
+    MaterialConstantPool* GetMaterialConstantPool() { return m_materialConstantPool.get(); }
+
+    // Shared material template for a key, built by create on first use (main thread only)
+    SharedPtr<Material> GetMaterialTemplate(const String& key, const Function<SharedPtr<Material>()>& create);
     D3D12_CPU_DESCRIPTOR_HANDLE GetSRVCPUHandle(uint32 index) const;
     D3D12_GPU_DESCRIPTOR_HANDLE GetSRVGPUHandle(uint32 index) const;
     D3D12_CPU_DESCRIPTOR_HANDLE GetSamplerCPUHandle(uint32 index) const;
@@ -170,6 +217,19 @@ public:
     class DX12RHIContext* CreateRHIContext();
     void DestroyRHIContext(class DX12RHIContext* context);
 
+    // Per-worker command lists the frame's draws are recorded into (see MeshComponent::DrawAll)
+    DX12RHIContextPool& GetRHIContextPool() { return *m_rhiContextPool; }
+
+    // Bind the frame's render targets, viewport and default pipeline on a freshly reset list
+    void ApplyFrameState(ID3D12GraphicsCommandList* commandList);
+
+    // Submit the main command list's work so far, then the closed worker lists in order.
+    // The main list is reopened afterwards for the rest of the frame.
+    void ExecuteWorkerCommandLists(ID3D12CommandList* const* commandLists, uint32 count);
+
+    // This frame's compiled graph (passes, barrier batches, transient memory stats)
+    const FrameGraph& GetFrameGraph() const { return m_frameGraph; }
+
 private:
     // Core D3D12 objects
     bool CreateDevice();
@@ -181,11 +241,19 @@ private:
     bool CreateCommandAllocators();
     bool CreateCommandList();
     bool CreateSynchronization();
+    bool CreateRHIContextPool();
 
     // Resource management
     void CreateRtvDescriptorHeap();
     void CreateDsvDescriptorHeap();
 
+    // Declares the frame's passes around the open "Scene" pass
+    void BuildFrameGraph();
+
+    // Frame state shared by the main and worker command lists
+    void SetFrameRenderTargets(ID3D12GraphicsCommandList* commandList);
+    void ApplyViewport(ID3D12GraphicsCommandList* commandList, const ViewportDesc& viewport);
+
     // Frame synchronization
     void MoveToNextFrame();
     void WaitForFrame(uint32 frameIndex);
@@ -202,13 +270,9 @@ private:
     bool CreateBasicMeshRootSignature();
     bool CreateTexturedMeshRootSignature();
     
-    // PSO creation helpers
-    bool CreateBasicMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
-    bool CreateWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
-    bool CreateTexturedMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
-    bool CreateTexturedWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
-    bool CreateEmissiveMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
-    bool CreateEmissiveWireframeMeshPSO(ID3D12RootSignature* rootSignature, ID3DBlob* vertexShader, ID3DBlob* pixelShader);
+    // Pipeline cache create function; runs under the cache's exclusive lock
+    ID3D12PipelineState* CreatePipelineState(const PipelineStateDesc& desc, uint64 hash);
+
     // Window reference
     Window* m_window = nullptr;
     HWND m_hwnd = nullptr;
@@ -246,22 +310,35 @@ private:
     uint64 m_currentFenceValue = 0;
     HANDLE m_fenceEvent = nullptr;
 
+    // Resources released once a fence passes, in the DescriptorAllocator's scheme
+    struct RetiredResource {
+        ComPtr<ID3D12Resource> resource;
+        uint64 fenceValue = 0;
+    };
+    Vector<ComPtr<ID3D12Resource>> m_openRetiredResources;   // Retired this frame, fence not known yet
+    Vector<RetiredResource> m_retiredResources;              // In fence order
+
     // Frame tracking
     uint32 m_currentFrameIndex = 0;
     uint32 m_currentBackBufferIndex = 0;
+    ViewportDesc m_currentViewport;
     bool m_isInitialized = false;
+    bool m_isRecordingFrame = false;
 
     // Root Signatures
     ComPtr<ID3D12RootSignature> m_basicMeshRootSignature;
     ComPtr<ID3D12RootSignature> m_texturedMeshRootSignature;
+    uint64 m_basicMeshRootSignatureKey = 0;
+    uint64 m_texturedMeshRootSignatureKey = 0;
     
-    // Pipeline State Objects
-    ComPtr<ID3D12PipelineState> m_basicMeshPSO;
-    ComPtr<ID3D12PipelineState> m_wireframeMeshPSO;
-    ComPtr<ID3D12PipelineState> m_texturedMeshPSO;
-    ComPtr<ID3D12PipelineState> m_texturedWireframeMeshPSO;
-    ComPtr<ID3D12PipelineState> m_emissiveMeshPSO;
-    ComPtr<ID3D12PipelineState> m_emissiveWireframeMeshPSO;
+    // Pipeline State Objects, by PipelineStateDesc; the cache hands out m_pipelineStates entries
+    UniquePtr<PipelineStateCache> m_pipelineCache;
+    UniquePtr<DX12PipelineLibrary> m_pipelineLibrary;
+    Vector<ComPtr<ID3D12PipelineState>> m_pipelineStates;
+    HashMap<uint64, ComPtr<ID3DBlob>> m_shaderBytecode;             // By GetShaderKey
+    HashMap<uint64, ID3D12RootSignature*> m_rootSignatures;         // By serialized blob hash
+    PipelineStateDesc m_meshPipelineDescs[static_cast<uint32>(MeshPipeline::Count)][2];
+    uint64 m_meshPipelineHashes[static_cast<uint32>(MeshPipeline::Count)][2] = {};
 
     // Constant Buffers
     static const uint32 MAX_OBJECTS = 256;
@@ -278,12 +355,16 @@ private:
     Vector<MaterialConstants*> m_mappedMaterialConstants;
 
     // Shader Resource Descriptor Heaps
-    ComPtr<ID3D12DescriptorHeap> m_srvHeap;
-    ComPtr<ID3D12DescriptorHeap> m_samplerHeap;
-    uint32 m_srvDescriptorSize = 0;
-    uint32 m_samplerDescriptorSize = 0;
-    uint32 m_currentSrvIndex = 0;
-    uint32 m_currentSamplerIndex = 0;
+    static const uint32 MAX_SRV_DESCRIPTORS = 4096;
+    static const uint32 MAX_TRANSIENT_SRV_DESCRIPTORS = 1024;
+    static const uint32 MAX_SAMPLER_DESCRIPTORS = 256;
+    UniquePtr<DX12DescriptorHeap> m_srvDescriptors;
+    UniquePtr<DX12DescriptorHeap> m_samplerDescriptors;
+    UniquePtr<SamplerCache> m_samplerCache;
+
+    // Material instances (see Material::CreateInstance)
+    UniquePtr<MaterialConstantPool> m_materialConstantPool;
+    HashMap<String, SharedPtr<Material>> m_materialTemplates;
     
     // Shaders (moved from ShaderManager)
     ComPtr<ID3DBlob> m_vertexShader;
@@ -292,6 +373,19 @@ private:
     ComPtr<ID3DBlob> m_emissivePixelShader;
     bool m_wireframeMode = false;
 
+    // Assets
+    UniquePtr<AssetManager> m_assetManager;
+    UniquePtr<TextureStreamer> m_textureStreamer;
+    UniquePtr<ShaderCache> m_shaderCache;
+
+    // Parallel command recording
+    UniquePtr<DX12RHIContextPool> m_rhiContextPool;
+
+    // Frame graph; passes up to the scene pass run in BeginFrame, the rest in EndFrame
+    FrameGraph m_frameGraph;
+    UniquePtr<DX12FrameGraphBackend> m_frameGraphBackend;
+    uint32 m_scenePassIndex = 0;
+
     // Debug
     ComPtr<ID3D12Debug> m_debugController;
     ComPtr<ID3D12DebugDevice> m_debugDevice;
@@ -0,0 +1,56 @@
+#include "DX12ShaderCompiler.h"
+#include <cstring>
+
+uint32 DX12ShaderCompiler::GetDefaultCompileFlags(bool debug) {
+    return debug ? (D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION) : 0;
+}
+
+bool DX12ShaderCompiler::Compile(const ShaderCompileDesc& desc, Vector<uint8>& outBytecode, String* outErrors) {
+    // D3D_SHADER_MACRO arrays are null terminated
+    Vector<D3D_SHADER_MACRO> macros;
+    macros.reserve(desc.defines.size() + 1);
+    for (const ShaderDefine& define : desc.defines) {
+        macros.push_back({ define.name.c_str(), define.value.c_str() });
+    }
+    macros.push_back({ nullptr, nullptr });
+
+    ComPtr<ID3DBlob> shaderBlob;
+    ComPtr<ID3DBlob> errorBlob;
+    HRESULT hr = D3DCompile(
+        desc.source.c_str(),
+        desc.source.length(),
+        desc.sourcePath.empty() ? nullptr : desc.sourcePath.c_str(),
+        macros.data(),
+        nullptr,
+        desc.entryPoint.c_str(),
+        desc.target.c_str(),
+        desc.compileFlags,
+        0,
+        &shaderBlob,
+        &errorBlob
+    );
+
+    if (FAILED(hr)) {
+        String errorMsg = "Shader compilation failed: ";
+        if (errorBlob) {
+            errorMsg += static_cast<const char*>(errorBlob->GetBufferPointer());
+        }
+        Platform::OutputDebugMessage(errorMsg);
+        if (outErrors) {
+            *outErrors = errorMsg;
+        }
+        return false;
+    }
+
+    const uint8* bytecode = static_cast<const uint8*>(shaderBlob->GetBufferPointer());
+    outBytecode.assign(bytecode, bytecode + shaderBlob->GetBufferSize());
+    return true;
+}
+
+bool DX12ShaderCompiler::CreateBlob(const Vector<uint8>& bytecode, ComPtr<ID3DBlob>& outBlob) {
+    if (bytecode.empty() || FAILED(D3DCreateBlob(bytecode.size(), &outBlob))) {
+        return false;
+    }
+    std::memcpy(outBlob->GetBufferPointer(), bytecode.data(), bytecode.size());
+    return true;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "../ShaderCache.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+
+// D3DCompile front end shared by the renderer and Tools/ShaderCompiler, so both
+// produce identical cache keys and bytecode
+class DX12ShaderCompiler {
+public:
+    // Flags used by the renderer for the current build configuration
+    static uint32 GetDefaultCompileFlags(bool debug);
+
+    static bool Compile(const ShaderCompileDesc& desc, Vector<uint8>& outBytecode, String* outErrors = nullptr);
+    static bool CreateBlob(const Vector<uint8>& bytecode, ComPtr<ID3DBlob>& outBlob);
+};
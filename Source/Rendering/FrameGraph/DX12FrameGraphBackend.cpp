@@ -0,0 +1,219 @@
+#include "DX12FrameGraphBackend.h"
+#include "../Dx12/DX12Renderer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    DXGI_FORMAT ConvertFormat(RHIResourceFormat format) {
+        switch (format) {
+            case RHIResourceFormat::R32G32B32_Float:     return DXGI_FORMAT_R32G32B32_FLOAT;
+            case RHIResourceFormat::R32G32B32A32_Float:  return DXGI_FORMAT_R32G32B32A32_FLOAT;
+            case RHIResourceFormat::R32G32_Float:        return DXGI_FORMAT_R32G32_FLOAT;
+            case RHIResourceFormat::R32_Float:           return DXGI_FORMAT_R32_FLOAT;
+            case RHIResourceFormat::R8G8B8A8_Unorm:      return DXGI_FORMAT_R8G8B8A8_UNORM;
+            case RHIResourceFormat::R8G8B8A8_Unorm_sRGB: return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+            case RHIResourceFormat::R16_Uint:            return DXGI_FORMAT_R16_UINT;
+            case RHIResourceFormat::R32_Uint:            return DXGI_FORMAT_R32_UINT;
+            case RHIResourceFormat::D32_Float:           return DXGI_FORMAT_D32_FLOAT;
+            default:                                     return DXGI_FORMAT_UNKNOWN;
+        }
+    }
+
+    bool IsSameDesc(const D3D12_RESOURCE_DESC& a, const D3D12_RESOURCE_DESC& b) {
+        return std::memcmp(&a, &b, sizeof(D3D12_RESOURCE_DESC)) == 0;
+    }
+}
+
+DX12FrameGraphBackend::DX12FrameGraphBackend(DX12Renderer* renderer)
+    : m_renderer(renderer) {
+    ASSERT(renderer != nullptr, "DX12Renderer cannot be null");
+}
+
+D3D12_RESOURCE_STATES DX12FrameGraphBackend::ConvertState(RHIResourceState state) {
+    uint32 bits = static_cast<uint32>(state);
+    if (bits == 0 || state == RHIResourceState::Undefined) {
+        return D3D12_RESOURCE_STATE_COMMON;
+    }
+
+    D3D12_RESOURCE_STATES result = D3D12_RESOURCE_STATE_COMMON;
+    if (bits & static_cast<uint32>(RHIResourceState::RenderTarget))    result |= D3D12_RESOURCE_STATE_RENDER_TARGET;
+    if (bits & static_cast<uint32>(RHIResourceState::DepthWrite))      result |= D3D12_RESOURCE_STATE_DEPTH_WRITE;
+    if (bits & static_cast<uint32>(RHIResourceState::DepthRead))       result |= D3D12_RESOURCE_STATE_DEPTH_READ;
+    if (bits & static_cast<uint32>(RHIResourceState::ShaderResource))  result |= D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE |
+                                                                                  D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    if (bits & static_cast<uint32>(RHIResourceState::UnorderedAccess)) result |= D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    if (bits & static_cast<uint32>(RHIResourceState::CopySource))      result |= D3D12_RESOURCE_STATE_COPY_SOURCE;
+    if (bits & static_cast<uint32>(RHIResourceState::CopyDest))        result |= D3D12_RESOURCE_STATE_COPY_DEST;
+    if (bits & static_cast<uint32>(RHIResourceState::Present))         result |= D3D12_RESOURCE_STATE_PRESENT;
+    return result;
+}
+
+D3D12_RESOURCE_DESC DX12FrameGraphBackend::BuildResourceDesc(const RHITextureDesc& desc, RHIResourceState usage) const {
+    D3D12_RESOURCE_DESC resourceDesc = {};
+    resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    resourceDesc.Width = desc.width;
+    resourceDesc.Height = desc.height;
+    resourceDesc.DepthOrArraySize = static_cast<UINT16>(std::max(desc.arraySize, 1u));
+    resourceDesc.MipLevels = static_cast<UINT16>(std::max(desc.mipLevels, 1u));
+    resourceDesc.Format = ConvertFormat(desc.format);
+    resourceDesc.SampleDesc.Count = 1;
+    resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+
+    // The heap only takes RT/DS textures (resource heap tier 1), so every transient is one
+    if (desc.format == RHIResourceFormat::D32_Float) {
+        resourceDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
+    } else {
+        resourceDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
+        if ((usage & RHIResourceState::UnorderedAccess) == RHIResourceState::UnorderedAccess) {
+            resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+        }
+    }
+    return resourceDesc;
+}
+
+FrameGraphAllocation DX12FrameGraphBackend::GetAllocation(const RHITextureDesc& desc, RHIResourceState usage) const {
+    D3D12_RESOURCE_DESC resourceDesc = BuildResourceDesc(desc, usage);
+    D3D12_RESOURCE_ALLOCATION_INFO info = m_renderer->GetDevice()->GetResourceAllocationInfo(0, 1, &resourceDesc);
+
+    FrameGraphAllocation allocation;
+    allocation.size = info.SizeInBytes;
+    allocation.alignment = info.Alignment;
+    return allocation;
+}
+
+bool DX12FrameGraphBackend::PrepareTransients(const FrameGraph& frameGraph) {
+    ID3D12Device* device = m_renderer->GetDevice();
+    uint64 heapSize = frameGraph.GetTransientHeapSize();
+    bool isGpuIdle = false;
+
+    // Grow only; earlier frames may still be reading the old heap
+    if (heapSize > m_heapSize) {
+        m_renderer->WaitForGpu();
+        isGpuIdle = true;
+        m_transients.clear();
+        m_heap.Reset();
+
+        D3D12_HEAP_DESC heapDesc = {};
+        heapDesc.SizeInBytes = heapSize;
+        heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+        heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+        heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+        if (FAILED(device->CreateHeap(&heapDesc, IID_PPV_ARGS(&m_heap)))) {
+            Platform::OutputDebugMessage("DX12FrameGraphBackend: Failed to create a " + std::to_string(heapSize) + " byte heap\n");
+            m_heapSize = 0;
+            return false;
+        }
+        m_heap->SetName(L"FrameGraph Transient Heap");
+        m_heapSize = heapSize;
+    }
+
+    m_transients.resize(frameGraph.GetResourceCount());
+    for (uint32 r = 0; r < frameGraph.GetResourceCount(); ++r) {
+        if (frameGraph.IsImported(r) || !frameGraph.IsResourceUsed(r)) {
+            continue;
+        }
+
+        TransientTexture& texture = m_transients[r];
+        D3D12_RESOURCE_DESC desc = BuildResourceDesc(frameGraph.GetResourceDesc(r), frameGraph.GetResourceUsage(r));
+        uint64 heapOffset = frameGraph.GetHeapOffset(r);
+        if (texture.resource && IsSameDesc(texture.desc, desc) && texture.heapOffset == heapOffset) {
+            continue;
+        }
+
+        if (texture.resource && !isGpuIdle) {
+            m_renderer->WaitForGpu();
+            isGpuIdle = true;
+        }
+
+        D3D12_CLEAR_VALUE clearValue = {};
+        clearValue.Format = desc.Format;
+        bool isDepth = (desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL) != 0;
+        if (isDepth) {
+            clearValue.DepthStencil.Depth = m_renderer->GetConfig().GetDepthClearValue();
+        }
+
+        texture.resource.Reset();
+        if (FAILED(device->CreatePlacedResource(m_heap.Get(), heapOffset, &desc, D3D12_RESOURCE_STATE_COMMON,
+                                                isDepth ? &clearValue : nullptr, IID_PPV_ARGS(&texture.resource)))) {
+            Platform::OutputDebugMessage("DX12FrameGraphBackend: Failed to place '" + frameGraph.GetResourceName(r) + "'\n");
+            return false;
+        }
+
+        m_renderer->SetDebugName(texture.resource.Get(), "FrameGraph " + frameGraph.GetResourceName(r));
+        texture.desc = desc;
+        texture.heapOffset = heapOffset;
+        texture.state = D3D12_RESOURCE_STATE_COMMON;
+    }
+    return true;
+}
+
+void* DX12FrameGraphBackend::GetTransientTexture(uint32 resourceIndex) {
+    return resourceIndex < m_transients.size() ? m_transients[resourceIndex].resource.Get() : nullptr;
+}
+
+ID3D12Resource* DX12FrameGraphBackend::GetResource(const FrameGraph& frameGraph, uint32 resourceIndex) {
+    if (frameGraph.IsImported(resourceIndex)) {
+        return static_cast<ID3D12Resource*>(frameGraph.GetImportedTexture(resourceIndex));
+    }
+    return static_cast<ID3D12Resource*>(GetTransientTexture(resourceIndex));
+}
+
+void DX12FrameGraphBackend::SubmitBarriers(const FrameGraph& frameGraph, const FrameGraphBarrier* barriers, uint32 count) {
+    m_barrierScratch.clear();
+
+    for (uint32 i = 0; i < count; ++i) {
+        const FrameGraphBarrier& barrier = barriers[i];
+        ID3D12Resource* resource = GetResource(frameGraph, barrier.resource);
+        if (!resource) {
+            continue;
+        }
+
+        D3D12_RESOURCE_BARRIER d3dBarrier = {};
+        d3dBarrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+
+        switch (barrier.type) {
+            case FrameGraphBarrier::Type::Transition: {
+                bool isTransient = !frameGraph.IsImported(barrier.resource);
+                D3D12_RESOURCE_STATES after = ConvertState(barrier.stateAfter);
+                D3D12_RESOURCE_STATES before = barrier.stateBefore == RHIResourceState::Undefined && isTransient
+                    ? m_transients[barrier.resource].state
+                    : ConvertState(barrier.stateBefore);
+                if (isTransient) {
+                    m_transients[barrier.resource].state = after;
+                }
+                if (before == after) {
+                    continue;
+                }
+
+                d3dBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+                d3dBarrier.Transition.pResource = resource;
+                d3dBarrier.Transition.StateBefore = before;
+                d3dBarrier.Transition.StateAfter = after;
+                d3dBarrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+                break;
+            }
+            case FrameGraphBarrier::Type::Aliasing:
+                d3dBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+                d3dBarrier.Aliasing.pResourceBefore = barrier.aliasBefore != INVALID_FRAME_GRAPH_INDEX
+                    ? static_cast<ID3D12Resource*>(GetTransientTexture(barrier.aliasBefore))
+                    : nullptr;
+                d3dBarrier.Aliasing.pResourceAfter = resource;
+                break;
+            case FrameGraphBarrier::Type::UnorderedAccess:
+                d3dBarrier.Type = D3D12_RESOURCE_BARRIER_TYPE_UAV;
+                d3dBarrier.UAV.pResource = resource;
+                break;
+        }
+        m_barrierScratch.push_back(d3dBarrier);
+    }
+
+    if (!m_barrierScratch.empty()) {
+        m_renderer->GetCommandList()->ResourceBarrier(static_cast<UINT>(m_barrierScratch.size()), m_barrierScratch.data());
+    }
+}
+
+void DX12FrameGraphBackend::Release() {
+    m_transients.clear();
+    m_heap.Reset();
+    m_heapSize = 0;
+}
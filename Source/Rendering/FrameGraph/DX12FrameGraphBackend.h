@@ -0,0 +1,49 @@
+#pragma once
+
+#include "FrameGraph.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+
+class DX12Renderer;
+
+// Realizes frame graph transients as placed resources in one ID3D12Heap and records
+// each barrier batch as a single ResourceBarrier call on the renderer's command list.
+// Placed resources are kept across frames while their description and heap offset
+// stay the same, so a stable graph creates nothing after the first frame. Growing the
+// heap or moving a texture waits for the GPU first (resize or graph change only).
+class DX12FrameGraphBackend : public IFrameGraphBackend {
+public:
+    explicit DX12FrameGraphBackend(DX12Renderer* renderer);
+    virtual ~DX12FrameGraphBackend() = default;
+
+    bool PrepareTransients(const FrameGraph& frameGraph) override;
+    void* GetTransientTexture(uint32 resourceIndex) override;
+    void SubmitBarriers(const FrameGraph& frameGraph, const FrameGraphBarrier* barriers, uint32 count) override;
+
+    // Device sizes and alignments, for FrameGraph::Compile
+    FrameGraphAllocation GetAllocation(const RHITextureDesc& desc, RHIResourceState usage) const;
+
+    // Drop the heap and every placed texture (GPU must be idle)
+    void Release();
+
+    static D3D12_RESOURCE_STATES ConvertState(RHIResourceState state);
+
+private:
+    struct TransientTexture {
+        ComPtr<ID3D12Resource> resource;
+        D3D12_RESOURCE_DESC desc = {};
+        uint64 heapOffset = 0;
+        D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+    };
+
+    D3D12_RESOURCE_DESC BuildResourceDesc(const RHITextureDesc& desc, RHIResourceState usage) const;
+    ID3D12Resource* GetResource(const FrameGraph& frameGraph, uint32 resourceIndex);
+
+private:
+    DX12Renderer* m_renderer;
+    ComPtr<ID3D12Heap> m_heap;
+    uint64 m_heapSize = 0;
+    Vector<TransientTexture> m_transients;           // Indexed like the graph's resources
+    Vector<D3D12_RESOURCE_BARRIER> m_barrierScratch;
+
+    DECLARE_NON_COPYABLE(DX12FrameGraphBackend);
+};
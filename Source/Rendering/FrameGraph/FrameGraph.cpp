@@ -0,0 +1,598 @@
+#include "FrameGraph.h"
+#include "../../Core/Memory/FrameMemory.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+
+namespace {
+    constexpr uint64 DEFAULT_PLACEMENT_ALIGNMENT = 64 * 1024;
+
+    uint64 AlignUp(uint64 value, uint64 alignment) {
+        return alignment > 1 ? (value + alignment - 1) / alignment * alignment : value;
+    }
+
+    bool LifetimesOverlap(uint32 firstA, uint32 lastA, uint32 firstB, uint32 lastB) {
+        return firstA <= lastB && firstB <= lastA;
+    }
+
+    bool RangesOverlap(uint64 offsetA, uint64 sizeA, uint64 offsetB, uint64 sizeB) {
+        return offsetA < offsetB + sizeB && offsetB < offsetA + sizeA;
+    }
+
+    bool Contains(RHIResourceState states, RHIResourceState state) {
+        return (states & state) == state;
+    }
+}
+
+void FrameGraph::Reset() {
+    m_resources.clear();
+    m_nodes.clear();
+    m_passes.clear();
+    m_compiledPasses.clear();
+    m_finalBarriers.clear();
+    // m_passStates and m_passBarriers are resized by Compile, keeping their inner capacity
+    m_stats = {};
+    m_isCompiled = false;
+}
+
+FrameGraphResource FrameGraph::CreateTexture(const String& name, const RHITextureDesc& desc) {
+    ResourceEntry resource;
+    resource.name = name;
+    resource.desc = desc;
+    m_resources.push_back(std::move(resource));
+    m_isCompiled = false;
+    return AddNode(static_cast<uint32>(m_resources.size() - 1), INVALID_FRAME_GRAPH_INDEX);
+}
+
+FrameGraphResource FrameGraph::ImportTexture(const String& name, const RHITextureDesc& desc, void* texture,
+                                             RHIResourceState initialState, RHIResourceState finalState) {
+    ResourceEntry resource;
+    resource.name = name;
+    resource.desc = desc;
+    resource.isImported = true;
+    resource.importedTexture = texture;
+    resource.initialState = initialState;
+    resource.finalState = finalState;
+    m_resources.push_back(std::move(resource));
+    m_isCompiled = false;
+    return AddNode(static_cast<uint32>(m_resources.size() - 1), INVALID_FRAME_GRAPH_INDEX);
+}
+
+uint32 FrameGraph::AddPass(const String& name, const FrameGraphSetupFunction& setup, const FrameGraphExecuteFunction& execute) {
+    PassEntry pass;
+    pass.name = name;
+    pass.execute = execute;
+    m_passes.push_back(std::move(pass));
+    m_isCompiled = false;
+
+    uint32 passIndex = static_cast<uint32>(m_passes.size() - 1);
+    if (setup) {
+        FrameGraphPassBuilder builder(*this, passIndex);
+        setup(builder);
+    }
+    return passIndex;
+}
+
+FrameGraphResource FrameGraph::AddNode(uint32 resourceIndex, uint32 producer) {
+    ResourceNode node;
+    node.resourceIndex = resourceIndex;
+    node.producer = producer;
+    m_nodes.push_back(node);
+    return static_cast<FrameGraphResource>(m_nodes.size() - 1);
+}
+
+bool FrameGraph::Compile(const FrameGraphAllocationQuery& query) {
+    m_isCompiled = false;
+    m_stats = {};
+    m_stats.declaredPasses = static_cast<uint32>(m_passes.size());
+
+    CullPasses();
+    if (!GatherPassStates()) {
+        return false;
+    }
+    ComputeLifetimes();
+    PlaceTransients(query);
+    BuildBarriers();
+
+    m_isCompiled = true;
+    return true;
+}
+
+void FrameGraph::CullPasses() {
+    // Readers per version; the newest version of an imported texture is observed outside the graph
+    ScratchScope scratch;
+    ScratchVector<uint32> nodeReferences(m_nodes.size(), scratch.GetResource());
+    ScratchVector<FrameGraphResource> latestNode(m_resources.size(), INVALID_FRAME_GRAPH_RESOURCE, scratch.GetResource());
+    for (uint32 i = 0; i < m_nodes.size(); ++i) {
+        nodeReferences[i] = m_nodes[i].readerCount;
+        latestNode[m_nodes[i].resourceIndex] = i;
+    }
+    for (uint32 r = 0; r < m_resources.size(); ++r) {
+        if (m_resources[r].isImported && latestNode[r] != INVALID_FRAME_GRAPH_RESOURCE) {
+            ++nodeReferences[latestNode[r]];
+        }
+    }
+
+    ScratchVector<FrameGraphResource> unreferenced(scratch.GetResource());
+    auto cullPass = [&](PassEntry& pass) {
+        pass.isCulled = true;
+        for (const ResourceAccess& read : pass.reads) {
+            if (--nodeReferences[read.node] == 0) {
+                unreferenced.push_back(read.node);
+            }
+        }
+    };
+
+    for (PassEntry& pass : m_passes) {
+        pass.isCulled = false;
+        pass.compiledIndex = INVALID_FRAME_GRAPH_INDEX;
+        pass.referenceCount = static_cast<uint32>(pass.writes.size());
+    }
+    for (uint32 i = 0; i < m_nodes.size(); ++i) {
+        if (nodeReferences[i] == 0) {
+            unreferenced.push_back(i);
+        }
+    }
+    for (PassEntry& pass : m_passes) {
+        if (pass.referenceCount == 0 && !pass.hasSideEffects) {
+            cullPass(pass);
+        }
+    }
+
+    // A pass dies when none of its outputs is read
+    while (!unreferenced.empty()) {
+        FrameGraphResource node = unreferenced.back();
+        unreferenced.pop_back();
+
+        uint32 producer = m_nodes[node].producer;
+        if (producer == INVALID_FRAME_GRAPH_INDEX) {
+            continue;
+        }
+
+        PassEntry& pass = m_passes[producer];
+        if (pass.isCulled || pass.hasSideEffects) {
+            continue;
+        }
+        if (--pass.referenceCount == 0) {
+            cullPass(pass);
+        }
+    }
+
+    m_compiledPasses.clear();
+    for (uint32 i = 0; i < m_passes.size(); ++i) {
+        if (m_passes[i].isCulled) {
+            ++m_stats.culledPasses;
+        } else {
+            m_passes[i].compiledIndex = static_cast<uint32>(m_compiledPasses.size());
+            m_compiledPasses.push_back(i);
+        }
+    }
+}
+
+bool FrameGraph::GatherPassStates() {
+    // Inner vectors keep their capacity from the last frame
+    m_passStates.resize(m_compiledPasses.size());
+    for (Vector<PassResourceState>& states : m_passStates) {
+        states.clear();
+    }
+
+    for (uint32 c = 0; c < m_compiledPasses.size(); ++c) {
+        const PassEntry& pass = m_passes[m_compiledPasses[c]];
+        Vector<PassResourceState>& states = m_passStates[c];
+
+        auto findState = [&states](uint32 resourceIndex) -> PassResourceState* {
+            for (PassResourceState& state : states) {
+                if (state.resourceIndex == resourceIndex) {
+                    return &state;
+                }
+            }
+            return nullptr;
+        };
+
+        // Writes decide the state; a pass cannot write one texture in two states
+        for (const ResourceAccess& write : pass.writes) {
+            uint32 resourceIndex = m_nodes[write.node].resourceIndex;
+            PassResourceState* existing = findState(resourceIndex);
+            if (existing && existing->state != write.state) {
+                Platform::OutputDebugMessage("FrameGraph: Pass '" + pass.name + "' writes '" +
+                                             m_resources[resourceIndex].name + "' in two states\n");
+                return false;
+            }
+            if (!existing) {
+                states.push_back({ resourceIndex, write.state });
+            }
+        }
+
+        // Reads must match the write state, or combine into one read-only state
+        size_t writeCount = states.size();
+        for (const ResourceAccess& read : pass.reads) {
+            uint32 resourceIndex = m_nodes[read.node].resourceIndex;
+            PassResourceState* existing = findState(resourceIndex);
+            if (!existing) {
+                states.push_back({ resourceIndex, read.state });
+                continue;
+            }
+
+            bool isWritten = static_cast<size_t>(existing - states.data()) < writeCount;
+            if (isWritten) {
+                if (existing->state != read.state) {
+                    Platform::OutputDebugMessage("FrameGraph: Pass '" + pass.name + "' reads and writes '" +
+                                                 m_resources[resourceIndex].name + "' in different states\n");
+                    return false;
+                }
+            } else if (existing->state != read.state) {
+                RHIResourceState combined = existing->state | read.state;
+                if (!IsReadOnlyState(combined)) {
+                    Platform::OutputDebugMessage("FrameGraph: Pass '" + pass.name + "' reads '" +
+                                                 m_resources[resourceIndex].name + "' in conflicting states\n");
+                    return false;
+                }
+                existing->state = combined;
+            }
+        }
+    }
+    return true;
+}
+
+void FrameGraph::ComputeLifetimes() {
+    for (ResourceEntry& resource : m_resources) {
+        resource.usage = RHIResourceState::Common;
+        resource.firstUse = INVALID_FRAME_GRAPH_INDEX;
+        resource.lastUse = INVALID_FRAME_GRAPH_INDEX;
+    }
+
+    for (uint32 c = 0; c < m_passStates.size(); ++c) {
+        for (const PassResourceState& state : m_passStates[c]) {
+            ResourceEntry& resource = m_resources[state.resourceIndex];
+            resource.usage = resource.usage | state.state;
+            if (resource.firstUse == INVALID_FRAME_GRAPH_INDEX) {
+                resource.firstUse = c;
+            }
+            resource.lastUse = c;
+        }
+    }
+}
+
+void FrameGraph::PlaceTransients(const FrameGraphAllocationQuery& query) {
+    ScratchScope scratch;
+    ScratchVector<uint32> transients(scratch.GetResource());
+    for (uint32 r = 0; r < m_resources.size(); ++r) {
+        ResourceEntry& resource = m_resources[r];
+        resource.heapOffset = 0;
+        resource.aliasBefore = INVALID_FRAME_GRAPH_INDEX;
+        resource.isAliased = false;
+        if (resource.isImported || resource.firstUse == INVALID_FRAME_GRAPH_INDEX) {
+            continue;
+        }
+
+        resource.allocation = query ? query(resource.desc, resource.usage) : EstimateAllocation(resource.desc, resource.usage);
+        resource.allocation.alignment = std::max<uint64>(resource.allocation.alignment, 1);
+        transients.push_back(r);
+        m_stats.unaliasedTransientMemory += resource.allocation.size;
+    }
+    m_stats.transientResources = static_cast<uint32>(transients.size());
+
+    // Largest first, then first fit below anything alive at the same time
+    std::sort(transients.begin(), transients.end(), [this](uint32 a, uint32 b) {
+        const ResourceEntry& left = m_resources[a];
+        const ResourceEntry& right = m_resources[b];
+        if (left.allocation.size != right.allocation.size) {
+            return left.allocation.size > right.allocation.size;
+        }
+        return left.firstUse < right.firstUse;
+    });
+
+    struct Range {
+        uint64 begin;
+        uint64 end;
+    };
+
+    ScratchVector<uint32> placed(scratch.GetResource());
+    ScratchVector<Range> occupied(scratch.GetResource());
+    uint64 heapSize = 0;
+    for (uint32 r : transients) {
+        ResourceEntry& resource = m_resources[r];
+
+        occupied.clear();
+        for (uint32 other : placed) {
+            const ResourceEntry& entry = m_resources[other];
+            if (LifetimesOverlap(resource.firstUse, resource.lastUse, entry.firstUse, entry.lastUse)) {
+                occupied.push_back({ entry.heapOffset, entry.heapOffset + entry.allocation.size });
+            }
+        }
+        std::sort(occupied.begin(), occupied.end(), [](const Range& a, const Range& b) { return a.begin < b.begin; });
+
+        uint64 offset = 0;
+        for (const Range& range : occupied) {
+            if (offset + resource.allocation.size <= range.begin) {
+                break;
+            }
+            offset = std::max(offset, AlignUp(range.end, resource.allocation.alignment));
+        }
+
+        resource.heapOffset = offset;
+        heapSize = std::max(heapSize, offset + resource.allocation.size);
+        placed.push_back(r);
+    }
+    m_stats.transientMemory = heapSize;
+
+    // Memory shared with another transient needs an aliasing barrier at first use. The
+    // previous owner is the latest user earlier this frame, else the last one of the
+    // previous frame; with several candidates the barrier names no specific resource.
+    for (uint32 r : transients) {
+        ResourceEntry& resource = m_resources[r];
+        uint32 earlierCount = 0;
+        uint32 earlier = INVALID_FRAME_GRAPH_INDEX;
+        uint32 previousFrameCount = 0;
+        uint32 previousFrame = INVALID_FRAME_GRAPH_INDEX;
+
+        for (uint32 other : transients) {
+            const ResourceEntry& entry = m_resources[other];
+            if (other == r || !RangesOverlap(resource.heapOffset, resource.allocation.size, entry.heapOffset, entry.allocation.size)) {
+                continue;
+            }
+            if (entry.lastUse < resource.firstUse) {
+                ++earlierCount;
+                if (earlier == INVALID_FRAME_GRAPH_INDEX || entry.lastUse > m_resources[earlier].lastUse) {
+                    earlier = other;
+                }
+            } else {
+                ++previousFrameCount;
+                if (previousFrame == INVALID_FRAME_GRAPH_INDEX || entry.lastUse > m_resources[previousFrame].lastUse) {
+                    previousFrame = other;
+                }
+            }
+        }
+
+        if (earlierCount > 0) {
+            resource.isAliased = true;
+            resource.aliasBefore = earlierCount == 1 ? earlier : INVALID_FRAME_GRAPH_INDEX;
+        } else if (previousFrameCount > 0) {
+            resource.isAliased = true;
+            resource.aliasBefore = previousFrameCount == 1 ? previousFrame : INVALID_FRAME_GRAPH_INDEX;
+        }
+    }
+}
+
+void FrameGraph::BuildBarriers() {
+    ScratchScope scratch;
+    ScratchVector<RHIResourceState> currentStates(m_resources.size(), scratch.GetResource());
+    ScratchVector<RHIResourceState> unmergedStates(m_resources.size(), scratch.GetResource());
+    for (uint32 r = 0; r < m_resources.size(); ++r) {
+        currentStates[r] = m_resources[r].isImported ? m_resources[r].initialState : RHIResourceState::Undefined;
+        unmergedStates[r] = currentStates[r];
+    }
+
+    // State of resourceIndex in compiled pass c, Common when unused
+    auto findPassState = [this](uint32 c, uint32 resourceIndex, RHIResourceState& outState) {
+        for (const PassResourceState& state : m_passStates[c]) {
+            if (state.resourceIndex == resourceIndex) {
+                outState = state.state;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    m_passBarriers.resize(m_compiledPasses.size());
+    for (Vector<FrameGraphBarrier>& batch : m_passBarriers) {
+        batch.clear();
+    }
+    for (uint32 c = 0; c < m_compiledPasses.size(); ++c) {
+        Vector<FrameGraphBarrier>& batch = m_passBarriers[c];
+
+        for (const PassResourceState& passState : m_passStates[c]) {
+            uint32 r = passState.resourceIndex;
+            const ResourceEntry& resource = m_resources[r];
+            RHIResourceState needed = passState.state;
+
+            if (unmergedStates[r] != needed) {
+                ++m_stats.unmergedTransitions;
+                unmergedStates[r] = needed;
+            }
+
+            if (!resource.isImported && resource.isAliased && resource.firstUse == c) {
+                FrameGraphBarrier barrier;
+                barrier.type = FrameGraphBarrier::Type::Aliasing;
+                barrier.resource = r;
+                barrier.aliasBefore = resource.aliasBefore;
+                batch.push_back(barrier);
+                ++m_stats.aliasingBarriers;
+            }
+
+            RHIResourceState current = currentStates[r];
+            RHIResourceState target = needed;
+            if (IsReadOnlyState(needed)) {
+                if (IsReadOnlyState(current) && Contains(current, needed)) {
+                    continue;
+                }
+
+                // Cover the following readers too, up to the next write
+                for (uint32 next = c + 1; next < m_compiledPasses.size(); ++next) {
+                    RHIResourceState nextState;
+                    if (!findPassState(next, r, nextState)) {
+                        continue;
+                    }
+                    if (!IsReadOnlyState(nextState)) {
+                        break;
+                    }
+                    target = target | nextState;
+                }
+            } else if (current == needed) {
+                if (needed == RHIResourceState::UnorderedAccess) {
+                    FrameGraphBarrier barrier;
+                    barrier.type = FrameGraphBarrier::Type::UnorderedAccess;
+                    barrier.resource = r;
+                    batch.push_back(barrier);
+                }
+                continue;
+            }
+
+            FrameGraphBarrier barrier;
+            barrier.type = FrameGraphBarrier::Type::Transition;
+            barrier.resource = r;
+            barrier.stateBefore = current;
+            barrier.stateAfter = target;
+            batch.push_back(barrier);
+            currentStates[r] = target;
+            ++m_stats.transitions;
+        }
+
+        if (!batch.empty()) {
+            ++m_stats.barrierBatches;
+        }
+    }
+
+    // Hand imported textures back in the state their owner expects
+    m_finalBarriers.clear();
+    for (uint32 r = 0; r < m_resources.size(); ++r) {
+        const ResourceEntry& resource = m_resources[r];
+        if (!resource.isImported) {
+            continue;
+        }
+        if (unmergedStates[r] != resource.finalState) {
+            ++m_stats.unmergedTransitions;
+        }
+        if (currentStates[r] == resource.finalState) {
+            continue;
+        }
+
+        FrameGraphBarrier barrier;
+        barrier.type = FrameGraphBarrier::Type::Transition;
+        barrier.resource = r;
+        barrier.stateBefore = currentStates[r];
+        barrier.stateAfter = resource.finalState;
+        m_finalBarriers.push_back(barrier);
+        ++m_stats.transitions;
+    }
+    if (!m_finalBarriers.empty()) {
+        ++m_stats.barrierBatches;
+    }
+}
+
+bool FrameGraph::Execute(IFrameGraphBackend& backend) {
+    if (!BeginExecute(backend)) {
+        return false;
+    }
+    for (uint32 c = 0; c < m_compiledPasses.size(); ++c) {
+        ExecutePass(backend, c);
+    }
+    ExecuteFinalBarriers(backend);
+    return true;
+}
+
+bool FrameGraph::BeginExecute(IFrameGraphBackend& backend) {
+    if (!m_isCompiled) {
+        Platform::OutputDebugMessage("FrameGraph: Execute called before a successful Compile\n");
+        return false;
+    }
+    if (!backend.PrepareTransients(*this)) {
+        Platform::OutputDebugMessage("FrameGraph: Backend failed to create transient textures\n");
+        return false;
+    }
+    return true;
+}
+
+void FrameGraph::ExecutePass(IFrameGraphBackend& backend, uint32 compiledIndex) {
+    ASSERT(m_isCompiled && compiledIndex < m_compiledPasses.size(), "FrameGraph pass out of range");
+
+    const Vector<FrameGraphBarrier>& barriers = m_passBarriers[compiledIndex];
+    if (!barriers.empty()) {
+        backend.SubmitBarriers(*this, barriers.data(), static_cast<uint32>(barriers.size()));
+    }
+
+    uint32 passIndex = m_compiledPasses[compiledIndex];
+    const PassEntry& pass = m_passes[passIndex];
+    if (pass.execute) {
+        FrameGraphPassContext context(*this, backend, passIndex);
+        pass.execute(context);
+    }
+}
+
+void FrameGraph::ExecuteFinalBarriers(IFrameGraphBackend& backend) {
+    if (!m_finalBarriers.empty()) {
+        backend.SubmitBarriers(*this, m_finalBarriers.data(), static_cast<uint32>(m_finalBarriers.size()));
+    }
+}
+
+FrameGraphAllocation FrameGraph::EstimateAllocation(const RHITextureDesc& desc, RHIResourceState usage) {
+    // Bytes per 4x4 block for compressed formats, per texel otherwise
+    bool isBlockCompressed = false;
+    uint64 bytesPerElement = 4;
+    switch (desc.format) {
+        case RHIResourceFormat::R32G32B32A32_Float: bytesPerElement = 16; break;
+        case RHIResourceFormat::R32G32B32_Float:    bytesPerElement = 12; break;
+        case RHIResourceFormat::R32G32_Float:       bytesPerElement = 8; break;
+        case RHIResourceFormat::R16_Uint:           bytesPerElement = 2; break;
+        case RHIResourceFormat::BC1_Unorm:          bytesPerElement = 8; isBlockCompressed = true; break;
+        case RHIResourceFormat::BC2_Unorm:
+        case RHIResourceFormat::BC3_Unorm:
+        case RHIResourceFormat::BC7_Unorm:          bytesPerElement = 16; isBlockCompressed = true; break;
+        default:                                    bytesPerElement = 4; break;
+    }
+
+    uint64 size = 0;
+    uint32 width = std::max(desc.width, 1u);
+    uint32 height = std::max(desc.height, 1u);
+    uint32 depth = std::max(desc.depth, 1u);
+    for (uint32 mip = 0; mip < std::max(desc.mipLevels, 1u); ++mip) {
+        uint64 columns = isBlockCompressed ? (width + 3) / 4 : width;
+        uint64 rows = isBlockCompressed ? (height + 3) / 4 : height;
+        size += columns * rows * depth * bytesPerElement;
+        width = std::max(width / 2, 1u);
+        height = std::max(height / 2, 1u);
+        depth = std::max(depth / 2, 1u);
+    }
+    size *= std::max(desc.arraySize, 1u);
+
+    FrameGraphAllocation allocation;
+    allocation.alignment = DEFAULT_PLACEMENT_ALIGNMENT;
+    allocation.size = AlignUp(size, allocation.alignment);
+    return allocation;
+}
+
+// FrameGraphPassBuilder
+
+FrameGraphPassBuilder::FrameGraphPassBuilder(FrameGraph& frameGraph, uint32 passIndex)
+    : m_frameGraph(frameGraph)
+    , m_passIndex(passIndex) {
+}
+
+FrameGraphResource FrameGraphPassBuilder::CreateTexture(const String& name, const RHITextureDesc& desc) {
+    return m_frameGraph.CreateTexture(name, desc);
+}
+
+FrameGraphResource FrameGraphPassBuilder::Read(FrameGraphResource resource, RHIResourceState state) {
+    if (resource >= m_frameGraph.m_nodes.size()) {
+        Platform::OutputDebugMessage("FrameGraph: Pass '" + m_frameGraph.m_passes[m_passIndex].name + "' reads an invalid handle\n");
+        return INVALID_FRAME_GRAPH_RESOURCE;
+    }
+
+    m_frameGraph.m_passes[m_passIndex].reads.push_back({ resource, state });
+    ++m_frameGraph.m_nodes[resource].readerCount;
+    return resource;
+}
+
+FrameGraphResource FrameGraphPassBuilder::Write(FrameGraphResource resource, RHIResourceState state) {
+    if (resource >= m_frameGraph.m_nodes.size()) {
+        Platform::OutputDebugMessage("FrameGraph: Pass '" + m_frameGraph.m_passes[m_passIndex].name + "' writes an invalid handle\n");
+        return INVALID_FRAME_GRAPH_RESOURCE;
+    }
+
+    FrameGraphResource version = m_frameGraph.AddNode(m_frameGraph.m_nodes[resource].resourceIndex, m_passIndex);
+    m_frameGraph.m_passes[m_passIndex].writes.push_back({ version, state });
+    return version;
+}
+
+// FrameGraphPassContext
+
+void* FrameGraphPassContext::GetTexture(FrameGraphResource resource) const {
+    uint32 resourceIndex = m_frameGraph.GetResourceIndex(resource);
+    if (m_frameGraph.IsImported(resourceIndex)) {
+        return m_frameGraph.GetImportedTexture(resourceIndex);
+    }
+    return m_backend.GetTransientTexture(resourceIndex);
+}
+
+const RHITextureDesc& FrameGraphPassContext::GetDesc(FrameGraphResource resource) const {
+    return m_frameGraph.GetResourceDesc(m_frameGraph.GetResourceIndex(resource));
+}
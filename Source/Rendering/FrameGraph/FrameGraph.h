@@ -0,0 +1,256 @@
+#pragma once
+
+#include "../RHI/RHITypes.h"
+
+class FrameGraph;
+class FrameGraphPassBuilder;
+class FrameGraphPassContext;
+
+// Versioned handle to a texture in the graph. Every Write returns a new handle, so
+// a pass can only depend on work that was declared before it.
+using FrameGraphResource = uint32;
+constexpr FrameGraphResource INVALID_FRAME_GRAPH_RESOURCE = ~0u;
+
+// Unset pass or resource index
+constexpr uint32 INVALID_FRAME_GRAPH_INDEX = ~0u;
+
+// Memory a transient texture needs inside the shared heap
+struct FrameGraphAllocation {
+    uint64 size = 0;
+    uint64 alignment = 0;
+};
+
+// usage is every state the texture is used in this frame (render target, UAV, ...)
+using FrameGraphAllocationQuery = Function<FrameGraphAllocation(const RHITextureDesc& desc, RHIResourceState usage)>;
+
+struct FrameGraphBarrier {
+    enum class Type {
+        Transition,
+        Aliasing,       // Memory switches to resource from aliasBefore (INVALID: any previous user)
+        UnorderedAccess // UAV writes of one pass must finish before the next pass's UAV access
+    };
+
+    Type type = Type::Transition;
+    uint32 resource = 0;                                // Resource index, not a versioned handle
+    uint32 aliasBefore = INVALID_FRAME_GRAPH_INDEX;
+    RHIResourceState stateBefore = RHIResourceState::Undefined;
+    RHIResourceState stateAfter = RHIResourceState::Common;
+};
+
+struct FrameGraphStats {
+    uint32 declaredPasses = 0;
+    uint32 culledPasses = 0;
+    uint32 transientResources = 0;
+
+    uint32 transitions = 0;             // After merging consecutive reads
+    uint32 unmergedTransitions = 0;     // One per state change per pass, as hand-placed barriers would be
+    uint32 aliasingBarriers = 0;
+    uint32 barrierBatches = 0;          // ResourceBarrier calls
+
+    uint64 transientMemory = 0;         // Heap size with aliasing
+    uint64 unaliasedTransientMemory = 0;
+};
+
+// Implemented per graphics API; creates the transient textures and records barriers
+class IFrameGraphBackend {
+public:
+    virtual ~IFrameGraphBackend() = default;
+
+    // Called before the first pass executes; transients are placed at their compiled offsets
+    virtual bool PrepareTransients(const FrameGraph& frameGraph) = 0;
+    virtual void* GetTransientTexture(uint32 resourceIndex) = 0;
+
+    // One call per batch. Transitions from Undefined start at whatever state the
+    // backend last left the physical texture in.
+    virtual void SubmitBarriers(const FrameGraph& frameGraph, const FrameGraphBarrier* barriers, uint32 count) = 0;
+};
+
+using FrameGraphSetupFunction = Function<void(FrameGraphPassBuilder& builder)>;
+using FrameGraphExecuteFunction = Function<void(FrameGraphPassContext& context)>;
+
+// Render graph for one frame. Passes declare what they read and write; Compile then
+//  - culls passes whose outputs nobody reads (imported textures and side-effect
+//    passes are the roots),
+//  - places transient textures in one heap, reusing memory between textures whose
+//    lifetimes do not overlap,
+//  - computes one barrier batch per pass, widening read states so a run of readers
+//    needs a single transition.
+// Passes run in declaration order. Compile and the statistics need no GPU, so the
+// compiler can be exercised headlessly (see Tools/FrameGraphReport).
+//
+// Aliased transients start with undefined contents: their first pass must clear,
+// discard or fully overwrite them.
+class FrameGraph {
+public:
+    FrameGraph() = default;
+    ~FrameGraph() = default;
+
+    // Drops all passes and resources; call once per frame before declaring the graph
+    void Reset();
+
+    // Resources
+    FrameGraphResource CreateTexture(const String& name, const RHITextureDesc& desc);
+    FrameGraphResource ImportTexture(const String& name, const RHITextureDesc& desc, void* texture,
+                                     RHIResourceState initialState, RHIResourceState finalState);
+
+    // Passes
+    uint32 AddPass(const String& name, const FrameGraphSetupFunction& setup, const FrameGraphExecuteFunction& execute);
+
+    // Compile with backend-specific sizes, or EstimateAllocation when query is empty
+    bool Compile(const FrameGraphAllocationQuery& query = {});
+
+    // Run every compiled pass, then the final transitions of imported textures.
+    // ExecutePass/ExecuteFinalBarriers allow recording between passes.
+    bool Execute(IFrameGraphBackend& backend);
+    bool BeginExecute(IFrameGraphBackend& backend);
+    void ExecutePass(IFrameGraphBackend& backend, uint32 compiledIndex);
+    void ExecuteFinalBarriers(IFrameGraphBackend& backend);
+
+    // Rough D3D12 sizes (64KB placement alignment) for headless compiles
+    static FrameGraphAllocation EstimateAllocation(const RHITextureDesc& desc, RHIResourceState usage);
+
+    // Compiled results
+    bool IsCompiled() const { return m_isCompiled; }
+    uint64 GetTransientHeapSize() const { return m_stats.transientMemory; }
+    const FrameGraphStats& GetStats() const { return m_stats; }
+    uint32 GetCompiledPassCount() const { return static_cast<uint32>(m_compiledPasses.size()); }
+    uint32 GetCompiledPassIndex(uint32 passIndex) const { return m_passes[passIndex].compiledIndex; }  // INVALID when culled
+    uint32 GetPassIndex(uint32 compiledIndex) const { return m_compiledPasses[compiledIndex]; }
+    const Vector<FrameGraphBarrier>& GetPassBarriers(uint32 compiledIndex) const { return m_passBarriers[compiledIndex]; }
+    const Vector<FrameGraphBarrier>& GetFinalBarriers() const { return m_finalBarriers; }
+
+    // Passes
+    uint32 GetPassCount() const { return static_cast<uint32>(m_passes.size()); }
+    const String& GetPassName(uint32 passIndex) const { return m_passes[passIndex].name; }
+    bool IsPassCulled(uint32 passIndex) const { return m_passes[passIndex].isCulled; }
+
+    // Resources (by resource index)
+    uint32 GetResourceCount() const { return static_cast<uint32>(m_resources.size()); }
+    uint32 GetResourceIndex(FrameGraphResource handle) const { return m_nodes[handle].resourceIndex; }
+    const String& GetResourceName(uint32 resourceIndex) const { return m_resources[resourceIndex].name; }
+    const RHITextureDesc& GetResourceDesc(uint32 resourceIndex) const { return m_resources[resourceIndex].desc; }
+    bool IsResourceAliased(uint32 resourceIndex) const { return m_resources[resourceIndex].isAliased; }
+    bool IsImported(uint32 resourceIndex) const { return m_resources[resourceIndex].isImported; }
+    bool IsResourceUsed(uint32 resourceIndex) const { return m_resources[resourceIndex].firstUse != INVALID_FRAME_GRAPH_INDEX; }
+    RHIResourceState GetResourceUsage(uint32 resourceIndex) const { return m_resources[resourceIndex].usage; }
+    uint64 GetHeapOffset(uint32 resourceIndex) const { return m_resources[resourceIndex].heapOffset; }
+    uint64 GetAllocationSize(uint32 resourceIndex) const { return m_resources[resourceIndex].allocation.size; }
+    uint32 GetFirstUse(uint32 resourceIndex) const { return m_resources[resourceIndex].firstUse; }
+    uint32 GetLastUse(uint32 resourceIndex) const { return m_resources[resourceIndex].lastUse; }
+    void* GetImportedTexture(uint32 resourceIndex) const { return m_resources[resourceIndex].importedTexture; }
+
+private:
+    friend class FrameGraphPassBuilder;
+    friend class FrameGraphPassContext;
+
+    struct ResourceEntry {
+        String name;
+        RHITextureDesc desc;
+        bool isImported = false;
+        void* importedTexture = nullptr;
+        RHIResourceState initialState = RHIResourceState::Undefined;
+        RHIResourceState finalState = RHIResourceState::Common;
+
+        // Compiled
+        RHIResourceState usage = RHIResourceState::Common;
+        uint32 firstUse = INVALID_FRAME_GRAPH_INDEX;        // Compiled pass indices
+        uint32 lastUse = INVALID_FRAME_GRAPH_INDEX;
+        FrameGraphAllocation allocation;
+        uint64 heapOffset = 0;
+        uint32 aliasBefore = INVALID_FRAME_GRAPH_INDEX;
+        bool isAliased = false;
+    };
+
+    // One version of a resource
+    struct ResourceNode {
+        uint32 resourceIndex = 0;
+        uint32 producer = INVALID_FRAME_GRAPH_INDEX;         // Writing pass
+        uint32 readerCount = 0;
+    };
+
+    struct ResourceAccess {
+        FrameGraphResource node = INVALID_FRAME_GRAPH_RESOURCE;
+        RHIResourceState state = RHIResourceState::Common;
+    };
+
+    struct PassEntry {
+        String name;
+        FrameGraphExecuteFunction execute;
+        Vector<ResourceAccess> reads;
+        Vector<ResourceAccess> writes;
+        bool hasSideEffects = false;
+        bool isCulled = false;
+        uint32 referenceCount = 0;
+        uint32 compiledIndex = INVALID_FRAME_GRAPH_INDEX;
+    };
+
+    // State a compiled pass needs for one resource
+    struct PassResourceState {
+        uint32 resourceIndex = 0;
+        RHIResourceState state = RHIResourceState::Common;
+    };
+
+    FrameGraphResource AddNode(uint32 resourceIndex, uint32 producer);
+
+    // Compile steps
+    void CullPasses();
+    bool GatherPassStates();
+    void ComputeLifetimes();
+    void PlaceTransients(const FrameGraphAllocationQuery& query);
+    void BuildBarriers();
+
+private:
+    Vector<ResourceEntry> m_resources;
+    Vector<ResourceNode> m_nodes;
+    Vector<PassEntry> m_passes;
+
+    // Compiled
+    Vector<uint32> m_compiledPasses;
+    Vector<Vector<PassResourceState>> m_passStates;
+    Vector<Vector<FrameGraphBarrier>> m_passBarriers;
+    Vector<FrameGraphBarrier> m_finalBarriers;
+    FrameGraphStats m_stats;
+    bool m_isCompiled = false;
+
+    DECLARE_NON_COPYABLE(FrameGraph);
+};
+
+// Handed to a pass's setup function to declare its resource accesses
+class FrameGraphPassBuilder {
+public:
+    FrameGraphPassBuilder(FrameGraph& frameGraph, uint32 passIndex);
+
+    // Transient texture owned by the graph
+    FrameGraphResource CreateTexture(const String& name, const RHITextureDesc& desc);
+
+    // Reads keep the handle; writes return the new version. Write does not preserve
+    // contents on its own: Read the same handle first to draw on top of it.
+    FrameGraphResource Read(FrameGraphResource resource, RHIResourceState state = RHIResourceState::ShaderResource);
+    FrameGraphResource Write(FrameGraphResource resource, RHIResourceState state = RHIResourceState::RenderTarget);
+
+    // Never cull this pass (readback, present, GPU timestamps, ...)
+    void SetSideEffect() { m_frameGraph.m_passes[m_passIndex].hasSideEffects = true; }
+
+private:
+    FrameGraph& m_frameGraph;
+    uint32 m_passIndex;
+};
+
+// Handed to a pass's execute function
+class FrameGraphPassContext {
+public:
+    FrameGraphPassContext(const FrameGraph& frameGraph, IFrameGraphBackend& backend, uint32 passIndex)
+        : m_frameGraph(frameGraph), m_backend(backend), m_passIndex(passIndex) {}
+
+    // API texture (e.g. ID3D12Resource*) behind a handle
+    void* GetTexture(FrameGraphResource resource) const;
+    const RHITextureDesc& GetDesc(FrameGraphResource resource) const;
+
+    uint32 GetPassIndex() const { return m_passIndex; }
+    IFrameGraphBackend& GetBackend() const { return m_backend; }
+
+private:
+    const FrameGraph& m_frameGraph;
+    IFrameGraphBackend& m_backend;
+    uint32 m_passIndex;
+};
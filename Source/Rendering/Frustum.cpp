@@ -0,0 +1,80 @@
+#include "Frustum.h"
+#include <cmath>
+
+using namespace DirectX;
+
+namespace {
+    // 0x + 0y + 0z + 1 >= -radius for every sphere
+    const XMFLOAT4 PASS_PLANE = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+    // Shorter normals than this come from a plane at infinity
+    constexpr float32 MIN_PLANE_NORMAL_LENGTH = 1.0e-6f;
+}
+
+Frustum::Frustum() {
+    for (XMFLOAT4& plane : m_planes) {
+        plane = PASS_PLANE;
+    }
+    for (uint32 batch = 0; batch < 2; ++batch) {
+        m_planeX[batch] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        m_planeY[batch] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        m_planeZ[batch] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        m_planeW[batch] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    }
+}
+
+Frustum::Frustum(const XMMATRIX& viewProjection) {
+    // Row vectors: clip = (x, y, z, 1) * M, so each clip coordinate is a column of M
+    XMFLOAT4X4 m;
+    XMStoreFloat4x4(&m, viewProjection);
+    auto column = [&m](int c) { return XMFLOAT4(m.m[0][c], m.m[1][c], m.m[2][c], m.m[3][c]); };
+    XMFLOAT4 x = column(0);
+    XMFLOAT4 y = column(1);
+    XMFLOAT4 z = column(2);
+    XMFLOAT4 w = column(3);
+
+    m_planes[0] = { w.x + x.x, w.y + x.y, w.z + x.z, w.w + x.w };   // -w <= x
+    m_planes[1] = { w.x - x.x, w.y - x.y, w.z - x.z, w.w - x.w };   //  x <= w
+    m_planes[2] = { w.x + y.x, w.y + y.y, w.z + y.z, w.w + y.w };   // -w <= y
+    m_planes[3] = { w.x - y.x, w.y - y.y, w.z - y.z, w.w - y.w };   //  y <= w
+    m_planes[4] = z;                                                // 0 <= z
+    m_planes[5] = { w.x - z.x, w.y - z.y, w.z - z.z, w.w - z.w };   //  z <= w
+
+    for (XMFLOAT4& plane : m_planes) {
+        float32 length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if (length < MIN_PLANE_NORMAL_LENGTH) {
+            plane = PASS_PLANE;
+            continue;
+        }
+        plane = { plane.x / length, plane.y / length, plane.z / length, plane.w / length };
+    }
+
+    XMFLOAT4 padded[8];
+    for (uint32 i = 0; i < 8; ++i) {
+        padded[i] = i < PLANE_COUNT ? m_planes[i] : PASS_PLANE;
+    }
+    for (uint32 batch = 0; batch < 2; ++batch) {
+        const XMFLOAT4* p = padded + batch * 4;
+        m_planeX[batch] = { p[0].x, p[1].x, p[2].x, p[3].x };
+        m_planeY[batch] = { p[0].y, p[1].y, p[2].y, p[3].y };
+        m_planeZ[batch] = { p[0].z, p[1].z, p[2].z, p[3].z };
+        m_planeW[batch] = { p[0].w, p[1].w, p[2].w, p[3].w };
+    }
+}
+
+bool Frustum::IntersectsSphere(const XMFLOAT3& center, float32 radius) const {
+    XMVECTOR centerX = XMVectorReplicate(center.x);
+    XMVECTOR centerY = XMVectorReplicate(center.y);
+    XMVECTOR centerZ = XMVectorReplicate(center.z);
+    XMVECTOR negativeRadius = XMVectorReplicate(-radius);
+
+    for (uint32 batch = 0; batch < 2; ++batch) {
+        XMVECTOR distance = XMVectorMultiplyAdd(XMLoadFloat4A(&m_planeX[batch]), centerX, XMLoadFloat4A(&m_planeW[batch]));
+        distance = XMVectorMultiplyAdd(XMLoadFloat4A(&m_planeY[batch]), centerY, distance);
+        distance = XMVectorMultiplyAdd(XMLoadFloat4A(&m_planeZ[batch]), centerZ, distance);
+        if (!XMVector4GreaterOrEqual(distance, negativeRadius)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include <DirectXMath.h>
+
+// View volume as six inward-facing planes, taken from a view-projection matrix with
+// a [0, 1] depth range. Works for standard and reverse Z; with an infinite far plane
+// the far plane is degenerate and is replaced by one that always passes.
+//
+// The planes are also kept as a structure of arrays in two batches of four (the two
+// spare slots always pass), so a sphere is tested against four planes per step.
+class Frustum {
+public:
+    static constexpr uint32 PLANE_COUNT = 6;
+
+    // Contains everything
+    Frustum();
+    explicit Frustum(const DirectX::XMMATRIX& viewProjection);
+
+    // True if the sphere is at least partly inside
+    bool IntersectsSphere(const DirectX::XMFLOAT3& center, float32 radius) const;
+
+    // Normalized (a, b, c, d): left, right, bottom, top, then the z = 0 and z = w planes
+    // (near and far, or far and near with reverse Z)
+    const DirectX::XMFLOAT4& GetPlane(uint32 index) const { return m_planes[index]; }
+
+private:
+    DirectX::XMFLOAT4 m_planes[PLANE_COUNT];
+    DirectX::XMFLOAT4A m_planeX[2];
+    DirectX::XMFLOAT4A m_planeY[2];
+    DirectX::XMFLOAT4A m_planeZ[2];
+    DirectX::XMFLOAT4A m_planeW[2];
+};
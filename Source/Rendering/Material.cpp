@@ -2,40 +2,48 @@
 #include "Dx12/DX12Renderer.h"
 #include "Bindable/Texture.h"
 #include "Bindable/Sampler.h"
+#include "../Core/Utilities/FileSystem.h"
+#include "../Core/Logging/Logger.h"
 #include "../Platform/Windows/WindowsPlatform.h"
 
+namespace {
+    void WriteInitialValue(MaterialParameterBlock& constants, MaterialParameterId id, const MaterialParameter& param) {
+        switch (param.type) {
+            case MaterialParameterType::Float:  constants.Set(id, param.value.floatValue); break;
+            case MaterialParameterType::Float2: constants.Set(id, param.value.float2Value); break;
+            case MaterialParameterType::Float3: constants.Set(id, param.value.float3Value); break;
+            case MaterialParameterType::Float4: constants.Set(id, param.value.float4Value); break;
+            case MaterialParameterType::Int:    constants.Set(id, param.value.intValue); break;
+            case MaterialParameterType::Bool:   constants.Set(id, param.value.boolValue); break;
+            default:                            break;
+        }
+    }
+}
+
 Material::Material(DX12Renderer& renderer, const MaterialDesc& desc)
     : m_renderer(renderer)
     , m_name(desc.name)
-    , m_desc(desc)
     , m_vertexShaderPath(desc.vertexShaderPath)
     , m_pixelShaderPath(desc.pixelShaderPath)
     , m_isTransparent(desc.isTransparent)
     , m_castsShadows(desc.castsShadows)
     , m_receivesShadows(desc.receivesShadows) {
     
-    // Copy parameters
-    m_parameters = desc.parameters;
-    
-    // Build parameter name to index map
-    for (uint32 i = 0; i < m_parameters.size(); ++i) {
-        m_parameterNameToIndex[m_parameters[i].name] = i;
+    // Compile the parameter layout once; from here on parameters are addressed by ID
+    for (const MaterialParameter& param : desc.parameters) {
+        if (m_layout.AddParameter(param.name, param.type, param.textureSlot, param.samplerSlot) == INVALID_MATERIAL_PARAMETER) {
+            Platform::OutputDebugMessage("Material: Parameter '" + param.name + "' declared twice with different types\n");
+        }
     }
-    
-    // Calculate parameter buffer layout
-    uint32 currentOffset = 0;
-    for (auto& param : m_parameters) {
-        // Align to 16-byte boundaries for constant buffers
-        currentOffset = (currentOffset + 15) & ~15;
-        param.offset = currentOffset;
-        currentOffset += param.size;
+    m_constants.Reset(m_layout);
+    for (const MaterialParameter& param : desc.parameters) {
+        WriteInitialValue(m_constants, m_layout.Find(param.name), param);
     }
-    m_parameterBufferSize = (currentOffset + 15) & ~15; // Align total size
+    m_textures.resize(m_layout.GetParameterCount());
+    m_samplers.resize(m_layout.GetParameterCount());
     
     // Create parameter buffer if we have parameters
-    if (m_parameterBufferSize > 0) {
-        CreateParameterBuffer();
-    }
+    CreateParameterBuffer();
     
     // Load shaders
     LoadShaders();
@@ -49,44 +57,73 @@ Material::Material(DX12Renderer& renderer, const MaterialDesc& desc)
     }
 }
 
+Material::Material(SharedPtr<Material> parent, const String& name)
+    : m_renderer(parent->m_renderer)
+    , m_name(name)
+    , m_parent(parent->m_parent ? parent->m_parent : parent)
+    , m_isTransparent(parent->m_isTransparent)
+    , m_castsShadows(parent->m_castsShadows)
+    , m_receivesShadows(parent->m_receivesShadows) {
+    
+    // Start as a copy of the template's constants; only overrides will diverge
+    m_constants.Reset(m_parent->m_layout);
+    m_overridden.assign(m_parent->m_layout.GetParameterCount(), false);
+    m_parentConstantsVersion = m_parent->m_constantsVersion - 1;
+    SyncWithParent();
+    
+    // An instance of an instance hangs off the template too, starting with the source's overrides
+    if (parent != m_parent) {
+        for (MaterialParameterId id = 0; id < m_overridden.size(); ++id) {
+            if (parent->m_overridden[id]) {
+                m_constants.CopyFrom(parent->m_constants, id);
+                m_overridden[id] = true;
+            }
+        }
+        m_textures = parent->m_textures;
+        m_samplers = parent->m_samplers;
+    }
+    
+    CreateParameterBuffer();
+    m_isInitialized = m_parent->m_isInitialized;
+}
+
 Material::~Material() {
-    if (m_mappedParameterData) {
-        m_parameterBuffer->Unmap(0, nullptr);
-        m_mappedParameterData = nullptr;
+    if (MaterialConstantPool* pool = m_renderer.GetMaterialConstantPool()) {
+        pool->Free(m_constantSlot);
     }
 }
 
 void Material::Bind(IRHIContext& context) {
     if (!IsValid()) return;
     
-    Platform::OutputDebugMessage("Material: Binding material '" + m_name + "'\n");
+    LOG_TRACE("Material: Binding material '{}'", m_name);
     
-    // Update parameter buffer if needed
-    if (m_parametersNeedUpdate) {
+    // Upload changed parameter bytes
+    {
+        std::lock_guard<std::mutex> lock(m_updateMutex);
         UpdateParameterBuffer();
-        m_parametersNeedUpdate = false;
     }
     
     // Bind textures and samplers
-    for (const auto& param : m_parameters) {
+    const Vector<MaterialLayoutEntry>& entries = GetLayout().GetEntries();
+    for (MaterialParameterId id = 0; id < entries.size(); ++id) {
+        const MaterialLayoutEntry& param = entries[id];
         if (param.type == MaterialParameterType::Texture2D) {
-            auto textureIt = m_textures.find(param.name);
-            auto samplerIt = m_samplers.find(param.name);
+            const SharedPtr<Texture>& texture = FindTexture(id);
             
-            if (textureIt != m_textures.end() && textureIt->second && textureIt->second->IsValid()) {
-                Platform::OutputDebugMessage("Material: Binding texture '" + param.name + "' to slot " + std::to_string(param.textureSlot) + "\n");
-                textureIt->second->SetSlot(param.textureSlot);
-                textureIt->second->Bind(context);
+            if (texture && texture->IsValid()) {
+                LOG_TRACE("Material: Binding texture '{}' to slot {}", param.name, param.textureSlot);
+                if (texture->GetSlot() != param.textureSlot) {
+                    texture->SetSlot(param.textureSlot);
+                }
+                texture->Bind(context);
             } else {
-                Platform::OutputDebugMessage("Material: No valid texture found for '" + param.name + "'\n");
+                LOG_TRACE("Material: No valid texture found for '{}'", param.name);
             }
             
             // Static samplers are used in root signature - no need to bind sampler descriptor tables
-            Platform::OutputDebugMessage("Material: Using static sampler - no descriptor table binding needed\n");
         }
     }
-    
-    Platform::OutputDebugMessage("Material: Finished binding material\n");
 }
 
 bool Material::IsValid() const {
@@ -95,235 +132,231 @@ bool Material::IsValid() const {
     return m_isInitialized || true; // Always valid for texture testing
 }
 
-void Material::SetParameter(const String& name, float value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float) {
-        param->value.floatValue = value;
-        m_parametersNeedUpdate = true;
+template<typename T>
+void Material::SetConstant(MaterialParameterId id, const T& value) {
+    if (!m_constants.Set(id, value)) {
+        return;
+    }
+    if (m_parent) {
+        m_overridden[id] = true;
+    } else {
+        ++m_constantsVersion;
     }
 }
 
+void Material::SetParameter(MaterialParameterId id, float value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(MaterialParameterId id, const DirectX::XMFLOAT2& value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(MaterialParameterId id, const DirectX::XMFLOAT3& value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(MaterialParameterId id, const DirectX::XMFLOAT4& value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(MaterialParameterId id, int32 value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(MaterialParameterId id, bool value) {
+    SetConstant(id, value);
+}
+
+void Material::SetParameter(const String& name, float value) {
+    SetParameter(GetLayout().Find(name), value);
+}
+
 void Material::SetParameter(const String& name, const DirectX::XMFLOAT2& value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float2) {
-        param->value.float2Value = value;
-        m_parametersNeedUpdate = true;
-    }
+    SetParameter(GetLayout().Find(name), value);
 }
 
 void Material::SetParameter(const String& name, const DirectX::XMFLOAT3& value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float3) {
-        param->value.float3Value = value;
-        m_parametersNeedUpdate = true;
-    }
+    SetParameter(GetLayout().Find(name), value);
 }
 
 void Material::SetParameter(const String& name, const DirectX::XMFLOAT4& value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float4) {
-        param->value.float4Value = value;
-        m_parametersNeedUpdate = true;
-    }
+    SetParameter(GetLayout().Find(name), value);
 }
 
 void Material::SetParameter(const String& name, int32 value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Int) {
-        param->value.intValue = value;
-        m_parametersNeedUpdate = true;
-    }
+    SetParameter(GetLayout().Find(name), value);
 }
 
 void Material::SetParameter(const String& name, bool value) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Bool) {
-        param->value.boolValue = value;
-        m_parametersNeedUpdate = true;
-    }
+    SetParameter(GetLayout().Find(name), value);
 }
 
 void Material::SetTexture(const String& name, SharedPtr<Texture> texture, SharedPtr<Sampler> sampler) {
-    MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Texture2D) {
+    const MaterialLayout& layout = GetLayout();
+    MaterialParameterId id = layout.Find(name);
+    if (id != INVALID_MATERIAL_PARAMETER && layout.GetEntry(id).type == MaterialParameterType::Texture2D) {
+        if (m_textures.size() < layout.GetParameterCount()) {
+            m_textures.resize(layout.GetParameterCount());
+            m_samplers.resize(layout.GetParameterCount());
+        }
+        
         if (texture) {
-            m_textures[name] = texture;
-            param->value.texturePtr = texture.get();
+            m_textures[id] = texture;
         }
         
         if (sampler) {
-            m_samplers[name] = sampler;
+            m_samplers[id] = sampler;
         } else if (texture) {
-            // Create default linear wrap sampler if none provided
-            auto sampler = Sampler::CreateLinearWrap(m_renderer, name + "_Sampler");
-            m_samplers[name] = SharedPtr<Sampler>(sampler.release());
+            // Default linear wrap sampler, shared with every other material using it
+            m_samplers[id] = Sampler::CreateLinearWrap(m_renderer);
         }
     }
 }
 
 bool Material::GetParameter(const String& name, float& outValue) const {
-    const MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float) {
-        outValue = param->value.floatValue;
-        return true;
-    }
-    return false;
+    return GetParameter(GetLayout().Find(name), outValue);
 }
 
 bool Material::GetParameter(const String& name, DirectX::XMFLOAT3& outValue) const {
-    const MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float3) {
-        outValue = param->value.float3Value;
-        return true;
-    }
-    return false;
+    return GetParameter(GetLayout().Find(name), outValue);
 }
 
 bool Material::GetParameter(const String& name, DirectX::XMFLOAT4& outValue) const {
-    const MaterialParameter* param = FindParameter(name);
-    if (param && param->type == MaterialParameterType::Float4) {
-        outValue = param->value.float4Value;
-        return true;
-    }
-    return false;
+    return GetParameter(GetLayout().Find(name), outValue);
+}
+
+SharedPtr<Texture> Material::GetTexture(MaterialParameterId id) const {
+    return FindTexture(id);
 }
 
 SharedPtr<Texture> Material::GetTexture(const String& name) const {
-    auto it = m_textures.find(name);
-    return (it != m_textures.end()) ? it->second : nullptr;
+    return FindTexture(GetLayout().Find(name));
 }
 
-void Material::UpdateParameters() {
-    if (m_parametersNeedUpdate) {
-        UpdateParameterBuffer();
-        m_parametersNeedUpdate = false;
+const SharedPtr<Texture>& Material::FindTexture(MaterialParameterId id) const {
+    static const SharedPtr<Texture> s_noTexture;
+    if (id < m_textures.size() && m_textures[id]) {
+        return m_textures[id];
     }
+    return m_parent ? m_parent->FindTexture(id) : s_noTexture;
+}
+
+void Material::UpdateParameters() {
+    std::lock_guard<std::mutex> lock(m_updateMutex);
+    UpdateParameterBuffer();
 }
 
 void Material::CreateParameterBuffer() {
-    if (m_parameterBufferSize == 0) return;
+    if (m_constants.GetSize() == 0) return;
     
-    if (!m_renderer.CreateConstantBuffer(m_parameterBufferSize, m_parameterBuffer, &m_mappedParameterData)) {
-        Platform::OutputDebugMessage("Material: Failed to create parameter constant buffer\n");
-        return;
-    }
-    
-    // Set debug name
-    if (DEBUG_BUILD) {
-        std::wstring wideName = std::wstring(m_name.begin(), m_name.end()) + L"_Parameters";
-        m_parameterBuffer->SetName(wideName.c_str());
+    MaterialConstantPool* pool = m_renderer.GetMaterialConstantPool();
+    m_constantSlot = pool ? pool->Allocate(m_constants.GetSize()) : MaterialConstantSlot();
+    if (!m_constantSlot.IsValid()) {
+        Platform::OutputDebugMessage("Material: Failed to allocate parameter constants for '" + m_name + "'\n");
     }
 }
 
 void Material::UpdateParameterBuffer() {
-    if (!m_mappedParameterData || m_parameterBufferSize == 0) return;
+    SyncWithParent();
+    if (!m_constantSlot.IsValid()) return;
     
-    // Copy parameter values to buffer
-    for (const auto& param : m_parameters) {
-        if (param.type == MaterialParameterType::Texture2D) continue; // Skip textures
-        
-        uint8* destPtr = static_cast<uint8*>(m_mappedParameterData) + param.offset;
-        
-        switch (param.type) {
-            case MaterialParameterType::Float:
-                memcpy(destPtr, &param.value.floatValue, sizeof(float));
-                break;
-            case MaterialParameterType::Float2:
-                memcpy(destPtr, &param.value.float2Value, sizeof(DirectX::XMFLOAT2));
-                break;
-            case MaterialParameterType::Float3:
-                memcpy(destPtr, &param.value.float3Value, sizeof(DirectX::XMFLOAT3));
-                break;
-            case MaterialParameterType::Float4:
-                memcpy(destPtr, &param.value.float4Value, sizeof(DirectX::XMFLOAT4));
-                break;
-            case MaterialParameterType::Int:
-                memcpy(destPtr, &param.value.intValue, sizeof(int32));
-                break;
-            case MaterialParameterType::Bool:
-                {
-                    int32 boolAsInt = param.value.boolValue ? 1 : 0;
-                    memcpy(destPtr, &boolAsInt, sizeof(int32));
-                }
-                break;
-            default:
-                break;
-        }
-    }
+    // Only the bytes written since the last upload, already in cbuffer layout
+    m_constants.Flush(m_constantSlot.cpuAddress);
 }
 
-MaterialParameter* Material::FindParameter(const String& name) {
-    auto it = m_parameterNameToIndex.find(name);
-    if (it != m_parameterNameToIndex.end()) {
-        return &m_parameters[it->second];
+void Material::SyncWithParent() {
+    if (!m_parent || m_parentConstantsVersion == m_parent->m_constantsVersion) return;
+    
+    for (MaterialParameterId id = 0; id < m_overridden.size(); ++id) {
+        if (!m_overridden[id]) {
+            m_constants.CopyFrom(m_parent->m_constants, id);
+        }
     }
-    return nullptr;
+    m_parentConstantsVersion = m_parent->m_constantsVersion;
 }
 
-const MaterialParameter* Material::FindParameter(const String& name) const {
-    auto it = m_parameterNameToIndex.find(name);
-    if (it != m_parameterNameToIndex.end()) {
-        return &m_parameters[it->second];
+void Material::LoadShaders() {
+    // Shader files go through the renderer's bytecode cache, so materials sharing
+    // a shader (or a previous launch) never compile it twice
+    bool vertexLoaded = FileSystem::FileExists(m_vertexShaderPath) &&
+                        m_renderer.LoadShader(m_vertexShaderPath, "VSMain", "vs_5_0", m_vertexShader);
+    bool pixelLoaded = FileSystem::FileExists(m_pixelShaderPath) &&
+                       m_renderer.LoadShader(m_pixelShaderPath, "PSMain", "ps_5_0", m_pixelShader);
+
+    if (!vertexLoaded || !pixelLoaded) {
+        Platform::OutputDebugMessage("Material: Shader files for '" + m_name + "' not found - using placeholders\n");
     }
-    return nullptr;
-}
 
-uint32 Material::CalculateParameterBufferSize() const {
-    uint32 size = 0;
-    for (const auto& param : m_parameters) {
-        size += param.size;
+    // Create empty blobs as placeholders
+    if (!vertexLoaded) {
+        D3DCreateBlob(1, &m_vertexShader);
+    }
+    if (!pixelLoaded) {
+        D3DCreateBlob(1, &m_pixelShader);
     }
-    return (size + 15) & ~15; // Align to 16-byte boundary
 }
 
-void Material::LoadShaders() {
-    // For now, create placeholder shaders
-    // In a full implementation, this would load from files or compile HLSL
-    Platform::OutputDebugMessage("Material: Shader loading not fully implemented - using placeholders\n");
-    
-    // Create empty blobs as placeholders
-    D3DCreateBlob(1, &m_vertexShader);
-    D3DCreateBlob(1, &m_pixelShader);
+SharedPtr<Material> Material::CreateInstance(SharedPtr<Material> parent, const String& name) {
+    if (!parent) {
+        return nullptr;
+    }
+    return std::make_shared<Material>(std::move(parent), name);
 }
 
 // Static factory methods
 SharedPtr<Material> Material::CreateUnlit(DX12Renderer& renderer, const DirectX::XMFLOAT4& color, const String& name) {
-    MaterialDesc desc;
-    desc.name = name;
-    desc.vertexShaderPath = "Shaders/UnlitVS.hlsl";
-    desc.pixelShaderPath = "Shaders/UnlitPS.hlsl";
-    desc.parameters.push_back(MaterialParameter("Color", color));
+    SharedPtr<Material> unlit = renderer.GetMaterialTemplate("Unlit", [&renderer]() {
+        MaterialDesc desc;
+        desc.name = "UnlitTemplate";
+        desc.vertexShaderPath = "Shaders/UnlitVS.hlsl";
+        desc.pixelShaderPath = "Shaders/UnlitPS.hlsl";
+        desc.parameters.push_back(MaterialParameter("Color", DirectX::XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f)));
+        return std::make_shared<Material>(renderer, desc);
+    });
     
-    return std::make_shared<Material>(renderer, desc);
+    SharedPtr<Material> material = CreateInstance(unlit, name);
+    material->SetParameter("Color", color);
+    return material;
 }
 
 SharedPtr<Material> Material::CreateLit(DX12Renderer& renderer, const DirectX::XMFLOAT4& albedo, float metallic, float roughness, const String& name) {
-    MaterialDesc desc;
-    desc.name = name;
-    desc.vertexShaderPath = "Shaders/LitVS.hlsl";
-    desc.pixelShaderPath = "Shaders/LitPS.hlsl";
-    desc.parameters.push_back(MaterialParameter("Albedo", albedo));
-    desc.parameters.push_back(MaterialParameter("Metallic", metallic));
-    desc.parameters.push_back(MaterialParameter("Roughness", roughness));
+    SharedPtr<Material> lit = renderer.GetMaterialTemplate("Lit", [&renderer]() {
+        MaterialDesc desc;
+        desc.name = "LitTemplate";
+        desc.vertexShaderPath = "Shaders/LitVS.hlsl";
+        desc.pixelShaderPath = "Shaders/LitPS.hlsl";
+        desc.parameters.push_back(MaterialParameter("Albedo", DirectX::XMFLOAT4(1.0f, 1.0f, 1.0f, 1.0f)));
+        desc.parameters.push_back(MaterialParameter("Metallic", 0.0f));
+        desc.parameters.push_back(MaterialParameter("Roughness", 0.5f));
+        return std::make_shared<Material>(renderer, desc);
+    });
     
-    return std::make_shared<Material>(renderer, desc);
+    SharedPtr<Material> material = CreateInstance(lit, name);
+    material->SetParameter("Albedo", albedo);
+    material->SetParameter("Metallic", metallic);
+    material->SetParameter("Roughness", roughness);
+    return material;
 }
 
 SharedPtr<Material> Material::CreateTextured(DX12Renderer& renderer, SharedPtr<Texture> diffuseTexture, const String& name) {
-    MaterialDesc desc;
-    desc.name = name;
-    desc.vertexShaderPath = "Shaders/TexturedVS.hlsl";
-    desc.pixelShaderPath = "Shaders/TexturedPS.hlsl";
-    
-    // Add texture parameter
-    MaterialParameter texParam;
-    texParam.name = "DiffuseTexture";
-    texParam.type = MaterialParameterType::Texture2D;
-    texParam.textureSlot = 3; // Texture descriptor table slot in root signature
-    texParam.samplerSlot = 0; // Static sampler, no slot needed
-    desc.parameters.push_back(texParam);
+    SharedPtr<Material> textured = renderer.GetMaterialTemplate("Textured", [&renderer]() {
+        MaterialDesc desc;
+        desc.name = "TexturedTemplate";
+        desc.vertexShaderPath = "Shaders/TexturedVS.hlsl";
+        desc.pixelShaderPath = "Shaders/TexturedPS.hlsl";
+        
+        // Add texture parameter
+        MaterialParameter texParam;
+        texParam.name = "DiffuseTexture";
+        texParam.type = MaterialParameterType::Texture2D;
+        texParam.textureSlot = 3; // Texture descriptor table slot in root signature
+        texParam.samplerSlot = 0; // Static sampler, no slot needed
+        desc.parameters.push_back(texParam);
+        return std::make_shared<Material>(renderer, desc);
+    });
     
-    auto material = std::make_shared<Material>(renderer, desc);
+    SharedPtr<Material> material = CreateInstance(textured, name);
     
     if (diffuseTexture) {
         material->SetTexture("DiffuseTexture", diffuseTexture);
@@ -335,4 +368,4 @@ SharedPtr<Material> Material::CreateTextured(DX12Renderer& renderer, SharedPtr<T
 SharedPtr<Material> Material::CreateDefault(DX12Renderer& renderer, const String& name) {
     // Create a default magenta material for debugging
     return CreateUnlit(renderer, {1.0f, 0.0f, 1.0f, 1.0f}, name);
-}
\ No newline at end of file
+}
@@ -3,27 +3,16 @@
 #include "../Core/Utilities/Types.h"
 #include "Bindable/IBindable.h"
 #include "RHI/RHITypes.h"
+#include "MaterialLayout.h"
+#include "MaterialConstantPool.h"
 #include "../Platform/Windows/WindowsPlatform.h"
 #include <DirectXMath.h>
-#include <unordered_map>
+#include <mutex>
 
 class DX12Renderer;
 class Texture;
 class Sampler;
 
-// Material parameter types
-enum class MaterialParameterType {
-    Float,
-    Float2,
-    Float3,
-    Float4,
-    Int,
-    Bool,
-    Texture2D,
-    TextureCube,
-    Unknown
-};
-
 // Material parameter value
 union MaterialParameterValue {
     float floatValue;
@@ -37,13 +26,11 @@ union MaterialParameterValue {
     MaterialParameterValue() : floatValue(0.0f) {}
 };
 
-// Material parameter definition
+// Material parameter definition (initial value; offsets come from the compiled MaterialLayout)
 struct MaterialParameter {
     String name;
     MaterialParameterType type = MaterialParameterType::Unknown;
     MaterialParameterValue value;
-    uint32 offset = 0;        // Offset in constant buffer
-    uint32 size = 0;          // Size in bytes
     uint32 textureSlot = 0;   // For texture parameters
     uint32 samplerSlot = 0;   // For texture parameters
     
@@ -51,19 +38,16 @@ struct MaterialParameter {
     MaterialParameter(const String& paramName, float val) 
         : name(paramName), type(MaterialParameterType::Float) {
         value.floatValue = val;
-        size = sizeof(float);
     }
     
     MaterialParameter(const String& paramName, const DirectX::XMFLOAT3& val) 
         : name(paramName), type(MaterialParameterType::Float3) {
         value.float3Value = val;
-        size = sizeof(DirectX::XMFLOAT3);
     }
     
     MaterialParameter(const String& paramName, const DirectX::XMFLOAT4& val) 
         : name(paramName), type(MaterialParameterType::Float4) {
         value.float4Value = val;
-        size = sizeof(DirectX::XMFLOAT4);
     }
 };
 
@@ -78,10 +62,16 @@ struct MaterialDesc {
     bool receivesShadows = true;
 };
 
-// Material class - manages shaders, textures, and parameters
+// Material class - manages shaders, textures, and parameters.
+// A material is either a template, which loads the shaders and compiles the parameter
+// layout, or an instance of one. Instances share the parent's layout, shaders (and so
+// its pipeline states) and textures, and keep only the parameters and textures they
+// override; parameters they leave alone follow the parent. Every material's constants
+// live in a slot of the renderer's MaterialConstantPool.
 class Material : public IBindable {
 public:
     Material(DX12Renderer& renderer, const MaterialDesc& desc);
+    Material(SharedPtr<Material> parent, const String& name);
     virtual ~Material();
 
     // IBindable interface
@@ -89,7 +79,18 @@ public:
     bool IsValid() const override;
     const String& GetDebugName() const override { return m_name; }
 
-    // Parameter management
+    // Parameter management. The name overloads look the name up on every call; code that
+    // sets or reads a parameter per frame should resolve it once with FindParameterId.
+    MaterialParameterId FindParameterId(const String& name) const { return GetLayout().Find(name); }
+    const MaterialLayout& GetLayout() const { return m_parent ? m_parent->m_layout : m_layout; }
+
+    void SetParameter(MaterialParameterId id, float value);
+    void SetParameter(MaterialParameterId id, const DirectX::XMFLOAT2& value);
+    void SetParameter(MaterialParameterId id, const DirectX::XMFLOAT3& value);
+    void SetParameter(MaterialParameterId id, const DirectX::XMFLOAT4& value);
+    void SetParameter(MaterialParameterId id, int32 value);
+    void SetParameter(MaterialParameterId id, bool value);
+
     void SetParameter(const String& name, float value);
     void SetParameter(const String& name, const DirectX::XMFLOAT2& value);
     void SetParameter(const String& name, const DirectX::XMFLOAT3& value);
@@ -99,38 +100,55 @@ public:
     void SetTexture(const String& name, SharedPtr<Texture> texture, SharedPtr<Sampler> sampler = nullptr);
     
     // Parameter getters
+    bool GetParameter(MaterialParameterId id, float& outValue) const { return m_constants.Get(id, outValue); }
+    bool GetParameter(MaterialParameterId id, DirectX::XMFLOAT3& outValue) const { return m_constants.Get(id, outValue); }
+    bool GetParameter(MaterialParameterId id, DirectX::XMFLOAT4& outValue) const { return m_constants.Get(id, outValue); }
+    SharedPtr<Texture> GetTexture(MaterialParameterId id) const;
+
     bool GetParameter(const String& name, float& outValue) const;
     bool GetParameter(const String& name, DirectX::XMFLOAT3& outValue) const;
     bool GetParameter(const String& name, DirectX::XMFLOAT4& outValue) const;
     SharedPtr<Texture> GetTexture(const String& name) const;
     
+    // Template / instance relationship
+    bool IsInstance() const { return m_parent != nullptr; }
+    const SharedPtr<Material>& GetParent() const { return m_parent; }
+    bool IsOverridden(MaterialParameterId id) const { return id < m_overridden.size() && m_overridden[id]; }
+
+    // Constant block for binding as a root CBV (0 when the material has no constants)
+    D3D12_GPU_VIRTUAL_ADDRESS GetConstantBufferAddress() const { return m_constantSlot.gpuAddress; }
+
     // Material properties
     const String& GetName() const { return m_name; }
     bool IsTransparent() const { return m_isTransparent; }
     bool CastsShadows() const { return m_castsShadows; }
     bool ReceivesShadows() const { return m_receivesShadows; }
     
-    // Update constant buffer with current parameter values
+    // Upload the parameter bytes changed since the last update
     void UpdateParameters();
     
-    // Static factory methods
+    // Instance of parent with no overrides yet
+    static SharedPtr<Material> CreateInstance(SharedPtr<Material> parent, const String& name);
+
+    // Static factory methods. These return instances of per-renderer templates, so one
+    // material per unit color costs a constant slot rather than a buffer and shader set.
     static SharedPtr<Material> CreateUnlit(DX12Renderer& renderer, const DirectX::XMFLOAT4& color = {1,1,1,1}, const String& name = "UnlitMaterial");
     static SharedPtr<Material> CreateLit(DX12Renderer& renderer, const DirectX::XMFLOAT4& albedo = {1,1,1,1}, float metallic = 0.0f, float roughness = 0.5f, const String& name = "LitMaterial");
     static SharedPtr<Material> CreateTextured(DX12Renderer& renderer, SharedPtr<Texture> diffuseTexture, const String& name = "TexturedMaterial");
     static SharedPtr<Material> CreateDefault(DX12Renderer& renderer, const String& name = "DefaultMaterial");
 
 private:
+    template<typename T> void SetConstant(MaterialParameterId id, const T& value);
+    const SharedPtr<Texture>& FindTexture(MaterialParameterId id) const;
     void CreateParameterBuffer();
     void UpdateParameterBuffer();
-    MaterialParameter* FindParameter(const String& name);
-    const MaterialParameter* FindParameter(const String& name) const;
-    uint32 CalculateParameterBufferSize() const;
+    void SyncWithParent();
     void LoadShaders();
 
 private:
     DX12Renderer& m_renderer;
     String m_name;
-    MaterialDesc m_desc;
+    SharedPtr<Material> m_parent;
     
     // Shader resources
     String m_vertexShaderPath;
@@ -138,18 +156,21 @@ private:
     ComPtr<ID3DBlob> m_vertexShader;
     ComPtr<ID3DBlob> m_pixelShader;
     
-    // Parameters
-    Vector<MaterialParameter> m_parameters;
-    std::unordered_map<String, uint32> m_parameterNameToIndex;
+    // Parameters: compiled layout (templates only) and the CPU copy of the constants.
+    // Templates bump the version on every change; instances re-copy the parameters
+    // they do not override when it moves.
+    MaterialLayout m_layout;
+    MaterialParameterBlock m_constants;
+    Vector<bool> m_overridden;
+    uint32 m_constantsVersion = 0;
+    uint32 m_parentConstantsVersion = 0;
     
-    // Constant buffer for parameters
-    ComPtr<ID3D12Resource> m_parameterBuffer;
-    void* m_mappedParameterData = nullptr;
-    uint32 m_parameterBufferSize = 0;
+    // Slot in the renderer's shared constant pages
+    MaterialConstantSlot m_constantSlot;
     
-    // Textures and samplers
-    std::unordered_map<String, SharedPtr<Texture>> m_textures;
-    std::unordered_map<String, SharedPtr<Sampler>> m_samplers;
+    // Textures and samplers, by parameter ID (instances: overrides only, sized on first use)
+    Vector<SharedPtr<Texture>> m_textures;
+    Vector<SharedPtr<Sampler>> m_samplers;
     
     // Material properties
     bool m_isTransparent = false;
@@ -157,8 +178,10 @@ private:
     bool m_receivesShadows = true;
     
     // State
-    bool m_parametersNeedUpdate = true;
     bool m_isInitialized = false;
 
+    // Bind may run on several recording workers at once (Scene::Render with a context pool)
+    std::mutex m_updateMutex;
+
     DECLARE_NON_COPYABLE(Material);
 };
\ No newline at end of file
@@ -0,0 +1,102 @@
+#include "MaterialConstantPool.h"
+#include "Dx12/DX12Renderer.h"
+#include <algorithm>
+
+MaterialConstantPool::MaterialConstantPool(DX12Renderer& renderer)
+    : m_renderer(renderer) {
+}
+
+MaterialConstantPool::~MaterialConstantPool() {
+    for (Page& page : m_pages) {
+        if (page.buffer && page.mappedData) {
+            page.buffer->Unmap(0, nullptr);
+        }
+    }
+}
+
+MaterialConstantSlot MaterialConstantPool::Allocate(uint32 size) {
+    if (size == 0 || size > SLOT_SIZE) {
+        Platform::OutputDebugMessage("MaterialConstantPool: " + std::to_string(size) + " byte block does not fit a slot\n");
+        return {};
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_freeSlots.empty() && !AddPage()) {
+        return {};
+    }
+
+    uint32 index = m_freeSlots.back();
+    m_freeSlots.pop_back();
+    ++m_slotsUsed;
+    m_slotsPeak = std::max(m_slotsPeak, m_slotsUsed);
+    return MakeSlot(index);
+}
+
+void MaterialConstantPool::Free(const MaterialConstantSlot& slot) {
+    if (!slot.IsValid()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_openFrees.push_back(slot.index);
+}
+
+void MaterialConstantPool::CloseFrame(uint64 fenceValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (uint32 index : m_openFrees) {
+        m_pendingFrees.push_back({ index, fenceValue });
+    }
+    m_openFrees.clear();
+}
+
+void MaterialConstantPool::Recycle(uint64 completedFenceValue) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t released = 0;
+    while (released < m_pendingFrees.size() && m_pendingFrees[released].fenceValue <= completedFenceValue) {
+        m_freeSlots.push_back(m_pendingFrees[released].index);
+        --m_slotsUsed;
+        ++released;
+    }
+    m_pendingFrees.erase(m_pendingFrees.begin(), m_pendingFrees.begin() + released);
+}
+
+MaterialConstantPoolStats MaterialConstantPool::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    MaterialConstantPoolStats stats;
+    stats.pages = static_cast<uint32>(m_pages.size());
+    stats.slotsUsed = m_slotsUsed;
+    stats.slotsPeak = m_slotsPeak;
+    stats.pendingFrees = static_cast<uint32>(m_openFrees.size() + m_pendingFrees.size());
+    stats.reservedBytes = static_cast<uint64>(m_pages.size()) * SLOT_SIZE * SLOTS_PER_PAGE;
+    return stats;
+}
+
+bool MaterialConstantPool::AddPage() {
+    Page page;
+    void* mappedData = nullptr;
+    if (!m_renderer.CreateConstantBuffer(static_cast<uint64>(SLOT_SIZE) * SLOTS_PER_PAGE, page.buffer, &mappedData)) {
+        Platform::OutputDebugMessage("MaterialConstantPool: Failed to create page\n");
+        return false;
+    }
+    page.mappedData = static_cast<uint8*>(mappedData);
+    m_renderer.SetDebugName(page.buffer.Get(), "MaterialConstantPage" + std::to_string(m_pages.size()));
+
+    // Hand out low slots first
+    uint32 firstIndex = static_cast<uint32>(m_pages.size()) * SLOTS_PER_PAGE;
+    for (uint32 i = SLOTS_PER_PAGE; i > 0; --i) {
+        m_freeSlots.push_back(firstIndex + i - 1);
+    }
+    m_pages.push_back(page);
+    return true;
+}
+
+MaterialConstantSlot MaterialConstantPool::MakeSlot(uint32 index) const {
+    const Page& page = m_pages[index / SLOTS_PER_PAGE];
+    uint32 offset = (index % SLOTS_PER_PAGE) * SLOT_SIZE;
+
+    MaterialConstantSlot slot;
+    slot.index = index;
+    slot.cpuAddress = page.mappedData + offset;
+    slot.gpuAddress = page.buffer->GetGPUVirtualAddress() + offset;
+    return slot;
+}
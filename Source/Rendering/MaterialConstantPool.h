@@ -0,0 +1,75 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include "../Platform/Windows/WindowsPlatform.h"
+#include <mutex>
+
+class DX12Renderer;
+
+// One material's constants inside a MaterialConstantPool page
+struct MaterialConstantSlot {
+    static constexpr uint32 INVALID_INDEX = ~0u;
+
+    uint32 index = INVALID_INDEX;
+    void* cpuAddress = nullptr;                     // Persistently mapped, write-combined
+    D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;       // Bind as a root CBV
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+};
+
+struct MaterialConstantPoolStats {
+    uint32 pages = 0;
+    uint32 slotsUsed = 0;               // Includes slots waiting for their fence
+    uint32 slotsPeak = 0;
+    uint32 pendingFrees = 0;
+    uint64 reservedBytes = 0;
+};
+
+// Material constant blocks sub-allocated from shared upload pages instead of one
+// committed buffer per material (64 KB of heap each, whatever the material's size).
+// Every slot is SLOT_SIZE bytes, the constant buffer view alignment. Freed slots are
+// reused once the frame that freed them has completed on the GPU, with the same
+// CloseFrame / Recycle hooks as DescriptorAllocator.
+class MaterialConstantPool {
+public:
+    static constexpr uint32 SLOT_SIZE = 256;
+    static constexpr uint32 SLOTS_PER_PAGE = 256;
+
+    explicit MaterialConstantPool(DX12Renderer& renderer);
+    ~MaterialConstantPool();
+
+    // Invalid slot when size exceeds SLOT_SIZE or a page cannot be created
+    MaterialConstantSlot Allocate(uint32 size);
+    void Free(const MaterialConstantSlot& slot);
+
+    void CloseFrame(uint64 fenceValue);
+    void Recycle(uint64 completedFenceValue);
+
+    MaterialConstantPoolStats GetStats() const;
+
+private:
+    struct PendingFree {
+        uint32 index = 0;
+        uint64 fenceValue = 0;
+    };
+
+    bool AddPage();
+    MaterialConstantSlot MakeSlot(uint32 index) const;
+
+private:
+    DX12Renderer& m_renderer;
+    mutable std::mutex m_mutex;
+
+    struct Page {
+        ComPtr<ID3D12Resource> buffer;
+        uint8* mappedData = nullptr;
+    };
+    Vector<Page> m_pages;
+    Vector<uint32> m_freeSlots;
+    Vector<uint32> m_openFrees;
+    Vector<PendingFree> m_pendingFrees;
+    uint32 m_slotsUsed = 0;
+    uint32 m_slotsPeak = 0;
+
+    DECLARE_NON_COPYABLE(MaterialConstantPool);
+};
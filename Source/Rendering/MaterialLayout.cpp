@@ -0,0 +1,176 @@
+#include "MaterialLayout.h"
+#include <algorithm>
+#include <cstring>
+
+MaterialParameterId MaterialLayout::AddParameter(const String& name, MaterialParameterType type,
+                                                 uint32 textureSlot, uint32 samplerSlot) {
+    auto it = m_nameToId.find(name);
+    if (it != m_nameToId.end()) {
+        return m_entries[it->second].type == type ? it->second : INVALID_MATERIAL_PARAMETER;
+    }
+
+    MaterialLayoutEntry entry;
+    entry.name = name;
+    entry.type = type;
+    entry.size = GetConstantSize(type);
+    if (IsTexture(type)) {
+        entry.textureSlot = textureSlot;
+        entry.samplerSlot = samplerSlot;
+    } else if (entry.size > 0) {
+        // HLSL packing: move to the next register when the value would straddle one
+        uint32 offset = m_constantEnd;
+        if ((offset & 15) + entry.size > 16) {
+            offset = (offset + 15) & ~15u;
+        }
+        entry.offset = offset;
+        m_constantEnd = offset + entry.size;
+    }
+
+    MaterialParameterId id = static_cast<MaterialParameterId>(m_entries.size());
+    m_entries.push_back(entry);
+    m_nameToId.emplace(name, id);
+    return id;
+}
+
+MaterialParameterId MaterialLayout::Find(const String& name) const {
+    auto it = m_nameToId.find(name);
+    return it != m_nameToId.end() ? it->second : INVALID_MATERIAL_PARAMETER;
+}
+
+uint32 MaterialLayout::GetConstantSize(MaterialParameterType type) {
+    switch (type) {
+        case MaterialParameterType::Float:  return sizeof(float32);
+        case MaterialParameterType::Float2: return sizeof(float32) * 2;
+        case MaterialParameterType::Float3: return sizeof(float32) * 3;
+        case MaterialParameterType::Float4: return sizeof(float32) * 4;
+        case MaterialParameterType::Int:    return sizeof(int32);
+        case MaterialParameterType::Bool:   return sizeof(int32);   // HLSL bool is 32-bit
+        default:                            return 0;
+    }
+}
+
+bool MaterialLayout::IsTexture(MaterialParameterType type) {
+    return type == MaterialParameterType::Texture2D || type == MaterialParameterType::TextureCube;
+}
+
+MaterialParameterBlock::MaterialParameterBlock(const MaterialLayout& layout) {
+    Reset(layout);
+}
+
+void MaterialParameterBlock::Reset(const MaterialLayout& layout) {
+    m_layout = &layout;
+    m_data.assign(layout.GetConstantSize(), 0);
+    MarkAllDirty();
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, float32 value) {
+    return Write(id, MaterialParameterType::Float, &value, sizeof(value));
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, const DirectX::XMFLOAT2& value) {
+    return Write(id, MaterialParameterType::Float2, &value, sizeof(value));
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, const DirectX::XMFLOAT3& value) {
+    return Write(id, MaterialParameterType::Float3, &value, sizeof(value));
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, const DirectX::XMFLOAT4& value) {
+    return Write(id, MaterialParameterType::Float4, &value, sizeof(value));
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, int32 value) {
+    return Write(id, MaterialParameterType::Int, &value, sizeof(value));
+}
+
+bool MaterialParameterBlock::Set(MaterialParameterId id, bool value) {
+    int32 boolAsInt = value ? 1 : 0;
+    return Write(id, MaterialParameterType::Bool, &boolAsInt, sizeof(boolAsInt));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, float32& outValue) const {
+    return Read(id, MaterialParameterType::Float, &outValue, sizeof(outValue));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, DirectX::XMFLOAT2& outValue) const {
+    return Read(id, MaterialParameterType::Float2, &outValue, sizeof(outValue));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, DirectX::XMFLOAT3& outValue) const {
+    return Read(id, MaterialParameterType::Float3, &outValue, sizeof(outValue));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, DirectX::XMFLOAT4& outValue) const {
+    return Read(id, MaterialParameterType::Float4, &outValue, sizeof(outValue));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, int32& outValue) const {
+    return Read(id, MaterialParameterType::Int, &outValue, sizeof(outValue));
+}
+
+bool MaterialParameterBlock::Get(MaterialParameterId id, bool& outValue) const {
+    int32 boolAsInt = 0;
+    if (!Read(id, MaterialParameterType::Bool, &boolAsInt, sizeof(boolAsInt))) {
+        return false;
+    }
+    outValue = boolAsInt != 0;
+    return true;
+}
+
+bool MaterialParameterBlock::CopyFrom(const MaterialParameterBlock& source, MaterialParameterId id) {
+    if (!m_layout || source.m_layout != m_layout || !m_layout->IsValid(id)) {
+        return false;
+    }
+    const MaterialLayoutEntry& entry = m_layout->GetEntry(id);
+    return Write(id, entry.type, source.m_data.data() + entry.offset, entry.size);
+}
+
+void MaterialParameterBlock::MarkAllDirty() {
+    m_dirtyBegin = 0;
+    m_dirtyEnd = static_cast<uint32>(m_data.size());
+}
+
+uint32 MaterialParameterBlock::Flush(void* destination) {
+    if (!IsDirty()) {
+        return 0;
+    }
+
+    uint32 size = m_dirtyEnd - m_dirtyBegin;
+    std::memcpy(static_cast<uint8*>(destination) + m_dirtyBegin, m_data.data() + m_dirtyBegin, size);
+    m_dirtyBegin = 0;
+    m_dirtyEnd = 0;
+    return size;
+}
+
+bool MaterialParameterBlock::Write(MaterialParameterId id, MaterialParameterType type, const void* value, uint32 size) {
+    if (!m_layout || !m_layout->IsValid(id)) {
+        return false;
+    }
+    const MaterialLayoutEntry& entry = m_layout->GetEntry(id);
+    if (entry.type != type || entry.size == 0) {
+        return false;
+    }
+
+    uint8* destination = m_data.data() + entry.offset;
+    if (std::memcmp(destination, value, size) == 0) {
+        return true;
+    }
+    std::memcpy(destination, value, size);
+
+    if (IsDirty()) {
+        m_dirtyBegin = std::min(m_dirtyBegin, entry.offset);
+        m_dirtyEnd = std::max(m_dirtyEnd, entry.offset + size);
+    } else {
+        m_dirtyBegin = entry.offset;
+        m_dirtyEnd = entry.offset + size;
+    }
+    return true;
+}
+
+bool MaterialParameterBlock::Read(MaterialParameterId id, MaterialParameterType type, void* value, uint32 size) const {
+    if (!m_layout || !m_layout->IsValid(id) || m_layout->GetEntry(id).type != type) {
+        return false;
+    }
+    std::memcpy(value, m_data.data() + m_layout->GetEntry(id).offset, size);
+    return true;
+}
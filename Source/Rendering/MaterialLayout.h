@@ -0,0 +1,111 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include <DirectXMath.h>
+
+// Material parameter types
+enum class MaterialParameterType {
+    Float,
+    Float2,
+    Float3,
+    Float4,
+    Int,
+    Bool,
+    Texture2D,
+    TextureCube,
+    Unknown
+};
+
+// Index of a parameter in its MaterialLayout; resolve names once and keep the ID
+using MaterialParameterId = uint32;
+constexpr MaterialParameterId INVALID_MATERIAL_PARAMETER = ~0u;
+
+struct MaterialLayoutEntry {
+    String name;
+    MaterialParameterType type = MaterialParameterType::Unknown;
+    uint32 offset = 0;          // Byte offset in the constant block (constants only)
+    uint32 size = 0;            // 0 for textures
+    uint32 textureSlot = 0;     // Textures only
+    uint32 samplerSlot = 0;     // Textures only
+};
+
+// Compiled parameter layout of a material. Constants are placed with HLSL cbuffer
+// packing as they are added (a value never straddles a 16-byte register; bools take
+// 4 bytes), so the offsets match a cbuffer declaring the same fields in the same order.
+class MaterialLayout {
+public:
+    MaterialLayout() = default;
+    ~MaterialLayout() = default;
+
+    // Returns the existing ID if the name is already present with the same type,
+    // INVALID_MATERIAL_PARAMETER if it is present with another type
+    MaterialParameterId AddParameter(const String& name, MaterialParameterType type,
+                                     uint32 textureSlot = 0, uint32 samplerSlot = 0);
+
+    MaterialParameterId Find(const String& name) const;
+    const MaterialLayoutEntry& GetEntry(MaterialParameterId id) const { return m_entries[id]; }
+    const Vector<MaterialLayoutEntry>& GetEntries() const { return m_entries; }
+    uint32 GetParameterCount() const { return static_cast<uint32>(m_entries.size()); }
+    bool IsValid(MaterialParameterId id) const { return id < m_entries.size(); }
+
+    // Constant block size, rounded up to whole 16-byte registers
+    uint32 GetConstantSize() const { return (m_constantEnd + 15) & ~15u; }
+
+    static uint32 GetConstantSize(MaterialParameterType type);
+    static bool IsTexture(MaterialParameterType type);
+
+private:
+    Vector<MaterialLayoutEntry> m_entries;
+    HashMap<String, MaterialParameterId> m_nameToId;
+    uint32 m_constantEnd = 0;
+};
+
+// CPU shadow copy of a material's constants laid out by a MaterialLayout. Setters
+// write straight to the precomputed offset and widen the dirty byte range (writes
+// that do not change the value are dropped); Flush copies only that range to the
+// GPU-visible buffer.
+class MaterialParameterBlock {
+public:
+    MaterialParameterBlock() = default;
+    explicit MaterialParameterBlock(const MaterialLayout& layout);
+    ~MaterialParameterBlock() = default;
+
+    void Reset(const MaterialLayout& layout);
+
+    // Type-checked against the layout; mismatches and invalid IDs are ignored (false)
+    bool Set(MaterialParameterId id, float32 value);
+    bool Set(MaterialParameterId id, const DirectX::XMFLOAT2& value);
+    bool Set(MaterialParameterId id, const DirectX::XMFLOAT3& value);
+    bool Set(MaterialParameterId id, const DirectX::XMFLOAT4& value);
+    bool Set(MaterialParameterId id, int32 value);
+    bool Set(MaterialParameterId id, bool value);
+
+    // Take one parameter's value from a block with the same layout
+    bool CopyFrom(const MaterialParameterBlock& source, MaterialParameterId id);
+
+    bool Get(MaterialParameterId id, float32& outValue) const;
+    bool Get(MaterialParameterId id, DirectX::XMFLOAT2& outValue) const;
+    bool Get(MaterialParameterId id, DirectX::XMFLOAT3& outValue) const;
+    bool Get(MaterialParameterId id, DirectX::XMFLOAT4& outValue) const;
+    bool Get(MaterialParameterId id, int32& outValue) const;
+    bool Get(MaterialParameterId id, bool& outValue) const;
+
+    bool IsDirty() const { return m_dirtyBegin < m_dirtyEnd; }
+    void MarkAllDirty();
+
+    // Copy the dirty range to destination (same layout) and clear it; returns bytes copied
+    uint32 Flush(void* destination);
+
+    const uint8* GetData() const { return m_data.data(); }
+    uint32 GetSize() const { return static_cast<uint32>(m_data.size()); }
+
+private:
+    bool Write(MaterialParameterId id, MaterialParameterType type, const void* value, uint32 size);
+    bool Read(MaterialParameterId id, MaterialParameterType type, void* value, uint32 size) const;
+
+private:
+    const MaterialLayout* m_layout = nullptr;
+    Vector<uint8> m_data;
+    uint32 m_dirtyBegin = 0;
+    uint32 m_dirtyEnd = 0;
+};
@@ -2,12 +2,8 @@
 #include "Dx12/DX12Renderer.h"
 #include "RHI/DX12RHIContext.h"
 #include "../Platform/Windows/WindowsPlatform.h"
-
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
-
-//#pragma comment(lib, "assimp-vc143-mt.lib")
+#include "../Core/Utilities/MeshImporter.h"
+#include "../Core/Utilities/MeshGeometry.h"
 
 Mesh::Mesh() {
     Platform::OutputDebugMessage("Mesh created\n");
@@ -18,91 +14,32 @@ Mesh::~Mesh() {
 }
 
 bool Mesh::LoadFromFile(const String& filePath, DX12Renderer* renderer) {
-    Platform::OutputDebugMessage("Loading mesh from file: " + filePath + "\n");
-
-    Assimp::Importer importer;
-
-    // Configure importer
-    importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE,
-        aiPrimitiveType_POINT | aiPrimitiveType_LINE);
-
-    // Load scene
-    const aiScene* scene = importer.ReadFile(filePath,
-        aiProcess_Triangulate |
-        aiProcess_GenNormals |
-        aiProcess_FlipUVs |
-        aiProcess_CalcTangentSpace |
-        aiProcess_JoinIdenticalVertices |
-        aiProcess_SortByPType |
-        aiProcess_ImproveCacheLocality |
-        aiProcess_OptimizeMeshes |
-        aiProcess_ValidateDataStructure
-    );
-
-    if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        Platform::OutputDebugMessage("Error loading mesh: " + String(importer.GetErrorString()) + "\n");
-        return false;
-    }
-
-    if (scene->mNumMeshes == 0) {
-        Platform::OutputDebugMessage("No meshes found in file\n");
+    MeshData data = MeshImporter::LoadFromFile(filePath);
+    if (!data.IsValid()) {
+        Platform::OutputDebugMessage("Error loading mesh: " + filePath + "\n");
         return false;
     }
 
-    // For simplicity, load only the first mesh
-    const aiMesh* mesh = scene->mMeshes[0];
-
-    Platform::OutputDebugMessage("Mesh loaded - Vertices: " + std::to_string(mesh->mNumVertices) +
-                                 ", Faces: " + std::to_string(mesh->mNumFaces) + "\n");
-
-    // Clear existing data
-    m_vertices.clear();
-    m_indices.clear();
-
-    // Load vertices
-    m_vertices.reserve(mesh->mNumVertices);
-    for (uint32 i = 0; i < mesh->mNumVertices; ++i) {
-        Vertex vertex;
-
-        // Position
-        vertex.position.x = mesh->mVertices[i].x;
-        vertex.position.y = mesh->mVertices[i].y;
-        vertex.position.z = mesh->mVertices[i].z;
-
-        // Normal
-        if (mesh->HasNormals()) {
-            vertex.normal.x = mesh->mNormals[i].x;
-            vertex.normal.y = mesh->mNormals[i].y;
-            vertex.normal.z = mesh->mNormals[i].z;
-        } else {
-            vertex.normal = { 0.0f, 1.0f, 0.0f };
-        }
-
-        // Texture coordinates
-        if (mesh->mTextureCoords[0]) {
-            vertex.texCoord.x = mesh->mTextureCoords[0][i].x;
-            vertex.texCoord.y = mesh->mTextureCoords[0][i].y;
-        } else {
-            vertex.texCoord = { 0.0f, 0.0f };
-        }
+    return CreateFromData(std::move(data), renderer);
+}
 
-        m_vertices.push_back(vertex);
+bool Mesh::CreateFromData(MeshData data, DX12Renderer* renderer) {
+    if (!data.IsValid()) {
+        Platform::OutputDebugMessage("Error: Mesh data is empty\n");
+        return false;
     }
 
-    // Load indices
-    m_indices.reserve(mesh->mNumFaces * 3);
-    for (uint32 i = 0; i < mesh->mNumFaces; ++i) {
-        const aiFace& face = mesh->mFaces[i];
-        if (face.mNumIndices == 3) {
-            m_indices.push_back(face.mIndices[0]);
-            m_indices.push_back(face.mIndices[1]);
-            m_indices.push_back(face.mIndices[2]);
-        }
-    }
+    m_vertices = std::move(data.vertices);
+    m_indices = std::move(data.indices);
+    m_subMeshes = std::move(data.subMeshes);
 
     m_vertexCount = static_cast<uint32>(m_vertices.size());
     m_indexCount = static_cast<uint32>(m_indices.size());
 
+    Platform::OutputDebugMessage("Mesh created from data - Vertices: " + std::to_string(m_vertexCount) +
+                                 ", Indices: " + std::to_string(m_indexCount) +
+                                 ", Submeshes: " + std::to_string(m_subMeshes.size()) + "\n");
+
     // Create D3D12 buffers
     return CreateBuffers(renderer);
 }
@@ -110,11 +47,10 @@ bool Mesh::LoadFromFile(const String& filePath, DX12Renderer* renderer) {
 bool Mesh::CreateCube(DX12Renderer* renderer) {
     Platform::OutputDebugMessage("Creating cube mesh\n");
 
-    // Clear existing data
-    m_vertices.clear();
-    m_indices.clear();
-
-    CreateCubeVertices();
+    MeshData data = MeshGeometry::CreateCube();
+    m_vertices = std::move(data.vertices);
+    m_indices = std::move(data.indices);
+    m_subMeshes = std::move(data.subMeshes);
 
     m_vertexCount = static_cast<uint32>(m_vertices.size());
     m_indexCount = static_cast<uint32>(m_indices.size());
@@ -123,69 +59,14 @@ bool Mesh::CreateCube(DX12Renderer* renderer) {
     return CreateBuffers(renderer);
 }
 
-void Mesh::CreateCubeVertices() {
-    // Cube vertices with normals and UVs
-    m_vertices = {
-        // Front face
-        { { -1.0f, -1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f } },
-        { {  1.0f, -1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 1.0f, 1.0f } },
-        { {  1.0f,  1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 1.0f, 0.0f } },
-        { { -1.0f,  1.0f,  1.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f } },
-
-        // Back face
-        { {  1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f } },
-        { { -1.0f, -1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 1.0f } },
-        { { -1.0f,  1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 1.0f, 0.0f } },
-        { {  1.0f,  1.0f, -1.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 0.0f } },
-
-        // Top face
-        { { -1.0f,  1.0f,  1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.0f } },
-        { {  1.0f,  1.0f,  1.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 1.0f } },
-        { {  1.0f,  1.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 1.0f, 0.0f } },
-        { { -1.0f,  1.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f } },
-
-        // Bottom face
-        { { -1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 1.0f } },
-        { {  1.0f, -1.0f, -1.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 1.0f } },
-        { {  1.0f, -1.0f,  1.0f }, { 0.0f, -1.0f, 0.0f }, { 1.0f, 0.0f } },
-        { { -1.0f, -1.0f,  1.0f }, { 0.0f, -1.0f, 0.0f }, { 0.0f, 0.0f } },
-
-        // Right face
-        { {  1.0f, -1.0f,  1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f } },
-        { {  1.0f, -1.0f, -1.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f } },
-        { {  1.0f,  1.0f, -1.0f }, { 1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f } },
-        { {  1.0f,  1.0f,  1.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f } },
-
-        // Left face
-        { { -1.0f, -1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f } },
-        { { -1.0f, -1.0f,  1.0f }, { -1.0f, 0.0f, 0.0f }, { 1.0f, 1.0f } },
-        { { -1.0f,  1.0f,  1.0f }, { -1.0f, 0.0f, 0.0f }, { 1.0f, 0.0f } },
-        { { -1.0f,  1.0f, -1.0f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f } }
-    };
-
-    // Cube indices
-    m_indices = {
-        // Front face
-        0, 1, 2,  2, 3, 0,
-        // Back face
-        4, 5, 6,  6, 7, 4,
-        // Top face
-        8, 9, 10,  10, 11, 8,
-        // Bottom face
-        12, 13, 14,  14, 15, 12,
-        // Right face
-        16, 17, 18,  18, 19, 16,
-        // Left face
-        20, 21, 22,  22, 23, 20
-    };
-}
-
 bool Mesh::CreateBuffers(DX12Renderer* renderer) {
     if (!renderer || m_vertices.empty() || m_indices.empty()) {
         Platform::OutputDebugMessage("Error: Invalid renderer or empty mesh data\n");
         return false;
     }
 
+    CalculateBounds();
+
     try {
         Platform::OutputDebugMessage("Creating mesh buffers...\n");
 
@@ -281,8 +162,17 @@ void Mesh::Draw(ID3D12GraphicsCommandList* commandList) {
     commandList->IASetIndexBuffer(&m_indexBufferView);
     commandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    // Draw indexed
-    commandList->DrawIndexedInstanced(m_indexCount, 1, 0, 0, 0);
+    // Draw each submesh range of the merged buffers
+    for (const SubMesh& subMesh : m_subMeshes) {
+        commandList->DrawIndexedInstanced(subMesh.indexCount, 1, subMesh.indexStart,
+                                          static_cast<INT>(subMesh.baseVertex), 0);
+    }
+}
+
+void Mesh::Draw(IRHIContext& context) {
+    for (const SubMesh& subMesh : m_subMeshes) {
+        context.DrawIndexed(subMesh.indexCount, subMesh.indexStart, static_cast<int32>(subMesh.baseVertex));
+    }
 }
 
 void Mesh::Bind(IRHIContext& context) {
@@ -306,7 +196,10 @@ bool Mesh::CreateSphere(DX12Renderer* renderer, uint32 stacks, uint32 slices) {
     Platform::OutputDebugMessage("Creating sphere mesh with " + std::to_string(stacks) + 
                                 " stacks and " + std::to_string(slices) + " slices\n");
 
-    CreateSphereVertices(stacks, slices);
+    MeshData data = MeshGeometry::CreateSphere(stacks, slices);
+    m_vertices = std::move(data.vertices);
+    m_indices = std::move(data.indices);
+    m_subMeshes = std::move(data.subMeshes);
 
     // Set vertex and index counts
     m_vertexCount = static_cast<uint32>(m_vertices.size());
@@ -326,57 +219,6 @@ bool Mesh::CreateSphere(DX12Renderer* renderer, uint32 stacks, uint32 slices) {
     return true;
 }
 
-void Mesh::CreateSphereVertices(uint32 stacks, uint32 slices) {
-    m_vertices.clear();
-    m_indices.clear();
-
-    const float PI = 3.14159265f;
-    const float radius = 1.0f;
-
-    // Generate vertices
-    for (uint32 stack = 0; stack <= stacks; ++stack) {
-        float phi = PI * stack / stacks; // From 0 to PI
-        float sinPhi = sin(phi);
-        float cosPhi = cos(phi);
-
-        for (uint32 slice = 0; slice <= slices; ++slice) {
-            float theta = 2.0f * PI * slice / slices; // From 0 to 2*PI
-            float sinTheta = sin(theta);
-            float cosTheta = cos(theta);
-
-            // Spherical coordinates to Cartesian
-            DirectX::XMFLOAT3 position;
-            position.x = radius * sinPhi * cosTheta;
-            position.y = radius * cosPhi;
-            position.z = radius * sinPhi * sinTheta;
-
-            // Normal is the same as position for unit sphere
-            DirectX::XMFLOAT3 normal = position;
-
-            // Texture coordinates
-            DirectX::XMFLOAT2 texCoord;
-            texCoord.x = static_cast<float>(slice) / slices;
-            texCoord.y = static_cast<float>(stack) / stacks;
-
-            m_vertices.emplace_back(position, normal, texCoord);
-        }
-    }
-
-    // Generate indices
-    for (uint32 stack = 0; stack < stacks; ++stack) {
-        for (uint32 slice = 0; slice < slices; ++slice) {
-            uint32 first = stack * (slices + 1) + slice;
-            uint32 second = first + slices + 1;
-
-            // First triangle
-            m_indices.push_back(first);
-            m_indices.push_back(second);
-            m_indices.push_back(first + 1);
-
-            // Second triangle
-            m_indices.push_back(second);
-            m_indices.push_back(second + 1);
-            m_indices.push_back(first + 1);
-        }
-    }
-}
\ No newline at end of file
+void Mesh::CalculateBounds() {
+    MeshGeometry::CalculateBounds(m_vertices, m_boundsCenter, m_boundsRadius);
+}
@@ -1,37 +1,31 @@
 #pragma once
 
 #include "../Core/Utilities/Types.h"
+#include "../Core/Utilities/MeshData.h"
 #include "../Platform/Windows/WindowsPlatform.h"
 #include "Bindable/BindableBase.h"
 #include <DirectXMath.h>
 
-// Vertex structure
-struct Vertex {
-    DirectX::XMFLOAT3 position;
-    DirectX::XMFLOAT3 normal;
-    DirectX::XMFLOAT2 texCoord;
-
-    Vertex() = default;
-    Vertex(const DirectX::XMFLOAT3& pos, const DirectX::XMFLOAT3& norm, const DirectX::XMFLOAT2& uv)
-        : position(pos), normal(norm), texCoord(uv) {}
-};
-
 // Mesh class
 class Mesh {
 public:
     Mesh();
     ~Mesh();
 
-    // Load mesh from file using Assimp
+    // Load every mesh in the file's node hierarchy (see MeshImporter)
     bool LoadFromFile(const String& filePath, class DX12Renderer* renderer);
 
+    // Create GPU buffers from already imported geometry (e.g. MeshData loaded on the asset IO thread)
+    bool CreateFromData(MeshData data, class DX12Renderer* renderer);
+
     // Create primitive meshes
     bool CreateCube(class DX12Renderer* renderer);
     bool CreateSphere(class DX12Renderer* renderer, uint32 stacks = 20, uint32 slices = 20);
     //bool CreatePlane(class DX12Renderer* renderer);
 
-    // Rendering
+    // Rendering (Draw issues one indexed draw per submesh)
     void Draw(ID3D12GraphicsCommandList* commandList);
+    void Draw(class IRHIContext& context);
     void Bind(class IRHIContext& context);
 
     // Upload data when command list is recording
@@ -45,13 +39,21 @@ public:
     uint32 GetIndexCount() const { return m_indexCount; }
     const Vector<Vertex>& GetVertices() const { return m_vertices; }
     const Vector<uint32>& GetIndices() const { return m_indices; }
+    const Vector<SubMesh>& GetSubMeshes() const { return m_subMeshes; }
+
+    // Local-space bounding sphere (centered on the vertex AABB)
+    const DirectX::XMFLOAT3& GetBoundsCenter() const { return m_boundsCenter; }
+    float GetBoundsRadius() const { return m_boundsRadius; }
 
 private:
     // Mesh data
     Vector<Vertex> m_vertices;
     Vector<uint32> m_indices;
+    Vector<SubMesh> m_subMeshes;
     uint32 m_vertexCount = 0;
     uint32 m_indexCount = 0;
+    DirectX::XMFLOAT3 m_boundsCenter = { 0.0f, 0.0f, 0.0f };
+    float m_boundsRadius = 0.0f;
 
     // Bindable objects
     UniquePtr<VertexBuffer<Vertex>> m_vertexBuffer;
@@ -73,8 +75,7 @@ private:
 
     // Helper methods
     bool CreateBuffers(class DX12Renderer* renderer);
-    void CreateCubeVertices();
-    void CreateSphereVertices(uint32 stacks, uint32 slices);
+    void CalculateBounds();
 
     DECLARE_NON_COPYABLE(Mesh);
 };
\ No newline at end of file
@@ -0,0 +1,264 @@
+#include "DX12PipelineLibrary.h"
+#include "../../Core/Utilities/FileSystem.h"
+#include "../../Core/Utilities/Hash.h"
+#include <cstring>
+#include <cwchar>
+#include <filesystem>
+#include <fstream>
+
+namespace {
+    const D3D12_INPUT_ELEMENT_DESC s_positionNormalTexcoord[] = {
+        { "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 },
+        { "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D12_INPUT_CLASSIFICATION_PER_VERTEX_DATA, 0 }
+    };
+
+    DXGI_FORMAT ConvertFormat(RHIResourceFormat format) {
+        switch (format) {
+            case RHIResourceFormat::R32G32B32A32_Float:  return DXGI_FORMAT_R32G32B32A32_FLOAT;
+            case RHIResourceFormat::R32G32_Float:        return DXGI_FORMAT_R32G32_FLOAT;
+            case RHIResourceFormat::R32_Float:           return DXGI_FORMAT_R32_FLOAT;
+            case RHIResourceFormat::R8G8B8A8_Unorm:      return DXGI_FORMAT_R8G8B8A8_UNORM;
+            case RHIResourceFormat::R8G8B8A8_Unorm_sRGB: return DXGI_FORMAT_R8G8B8A8_UNORM_SRGB;
+            case RHIResourceFormat::R32_Uint:            return DXGI_FORMAT_R32_UINT;
+            case RHIResourceFormat::D32_Float:           return DXGI_FORMAT_D32_FLOAT;
+            default:                                     return DXGI_FORMAT_UNKNOWN;
+        }
+    }
+
+    D3D12_COMPARISON_FUNC ConvertComparison(RHIComparisonFunc func) {
+        switch (func) {
+            case RHIComparisonFunc::Never:        return D3D12_COMPARISON_FUNC_NEVER;
+            case RHIComparisonFunc::Less:         return D3D12_COMPARISON_FUNC_LESS;
+            case RHIComparisonFunc::Equal:        return D3D12_COMPARISON_FUNC_EQUAL;
+            case RHIComparisonFunc::LessEqual:    return D3D12_COMPARISON_FUNC_LESS_EQUAL;
+            case RHIComparisonFunc::Greater:      return D3D12_COMPARISON_FUNC_GREATER;
+            case RHIComparisonFunc::NotEqual:     return D3D12_COMPARISON_FUNC_NOT_EQUAL;
+            case RHIComparisonFunc::GreaterEqual: return D3D12_COMPARISON_FUNC_GREATER_EQUAL;
+            default:                              return D3D12_COMPARISON_FUNC_ALWAYS;
+        }
+    }
+
+    D3D12_PRIMITIVE_TOPOLOGY_TYPE ConvertTopologyType(RHIPrimitiveTopology topology) {
+        switch (topology) {
+            case RHIPrimitiveTopology::LineList:
+            case RHIPrimitiveTopology::LineStrip: return D3D12_PRIMITIVE_TOPOLOGY_TYPE_LINE;
+            case RHIPrimitiveTopology::PointList: return D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT;
+            default:                              return D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+        }
+    }
+
+    D3D12_RENDER_TARGET_BLEND_DESC ConvertBlend(RHIBlendMode mode) {
+        D3D12_RENDER_TARGET_BLEND_DESC blend = {};
+        blend.RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
+        blend.LogicOp = D3D12_LOGIC_OP_NOOP;
+        if (mode == RHIBlendMode::Opaque) {
+            return blend;
+        }
+
+        blend.BlendEnable = TRUE;
+        blend.BlendOp = D3D12_BLEND_OP_ADD;
+        blend.BlendOpAlpha = D3D12_BLEND_OP_ADD;
+        blend.SrcBlendAlpha = D3D12_BLEND_ONE;
+        blend.DestBlendAlpha = D3D12_BLEND_INV_SRC_ALPHA;
+        switch (mode) {
+            case RHIBlendMode::AlphaBlend:
+                blend.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+                blend.DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
+                break;
+            case RHIBlendMode::Additive:
+                blend.SrcBlend = D3D12_BLEND_SRC_ALPHA;
+                blend.DestBlend = D3D12_BLEND_ONE;
+                blend.DestBlendAlpha = D3D12_BLEND_ONE;
+                break;
+            default:
+                blend.SrcBlend = D3D12_BLEND_ONE;
+                blend.DestBlend = D3D12_BLEND_INV_SRC_ALPHA;
+                break;
+        }
+        return blend;
+    }
+
+    WString GetEntryName(uint64 hash) {
+        wchar_t name[20];
+        std::swprintf(name, 20, L"%016llx", static_cast<unsigned long long>(hash));
+        return name;
+    }
+}
+
+DX12PipelineLibrary::DX12PipelineLibrary(ID3D12Device* device, const String& filePath)
+    : m_device(device)
+    , m_filePath(FileSystem::NormalizePath(filePath)) {
+    ASSERT(device != nullptr, "Device cannot be null");
+}
+
+bool DX12PipelineLibrary::CreateLibrary(const void* data, uint64 size) {
+    ComPtr<ID3D12Device1> device1;
+    if (FAILED(m_device->QueryInterface(IID_PPV_ARGS(&device1)))) {
+        return false;
+    }
+
+    m_library.Reset();
+    HRESULT hr = device1->CreatePipelineLibrary(data, static_cast<SIZE_T>(size), IID_PPV_ARGS(&m_library));
+    if (FAILED(hr)) {
+        m_library.Reset();
+        return false;
+    }
+    m_library->SetName(L"Pipeline Library");
+    return true;
+}
+
+bool DX12PipelineLibrary::Load() {
+    m_fileData.clear();
+    m_isDirty = false;
+
+    Vector<uint8> fileData;
+    PipelineLibraryFileHeader header;
+    if (FileSystem::ReadFile(m_filePath, fileData) && fileData.size() >= sizeof(header)) {
+        std::memcpy(&header, fileData.data(), sizeof(header));
+        const uint8* data = fileData.data() + sizeof(header);
+        const uint64 dataSize = fileData.size() - sizeof(header);
+        if (header.magic == PIPELINE_LIBRARY_MAGIC && header.version == PIPELINE_LIBRARY_VERSION &&
+            header.dataSize == dataSize && header.dataHash == HashBytes(data, dataSize)) {
+            m_fileData.assign(data, data + dataSize);
+        } else {
+            Platform::OutputDebugMessage("DX12PipelineLibrary: Ignoring stale or corrupt " + m_filePath + "\n");
+        }
+    }
+
+    // The driver rejects libraries from another driver version or adapter; start over then
+    if (!m_fileData.empty() && CreateLibrary(m_fileData.data(), m_fileData.size())) {
+        Platform::OutputDebugMessage("DX12PipelineLibrary: Loaded " + m_filePath + " (" +
+                                     std::to_string(m_fileData.size()) + " bytes)\n");
+        return true;
+    }
+
+    m_fileData.clear();
+    if (!CreateLibrary(nullptr, 0)) {
+        Platform::OutputDebugMessage("DX12PipelineLibrary: Pipeline libraries not supported, compiling every pipeline\n");
+        return false;
+    }
+    return true;
+}
+
+bool DX12PipelineLibrary::LoadOrCreate(uint64 hash, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc,
+                                       ComPtr<ID3D12PipelineState>& outPipeline) {
+    const WString name = GetEntryName(hash);
+    if (m_library && SUCCEEDED(m_library->LoadGraphicsPipeline(name.c_str(), &desc, IID_PPV_ARGS(&outPipeline)))) {
+        ++m_stats.loaded;
+        return true;
+    }
+
+    if (FAILED(m_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(&outPipeline)))) {
+        return false;
+    }
+    ++m_stats.created;
+
+    // Only fails when the name is taken, in which case the pipeline is still usable
+    if (m_library && SUCCEEDED(m_library->StorePipeline(name.c_str(), outPipeline.Get()))) {
+        m_isDirty = true;
+    }
+    return true;
+}
+
+bool DX12PipelineLibrary::Save() {
+    if (!m_library || !m_isDirty) {
+        return true;
+    }
+
+    Vector<uint8> data(m_library->GetSerializedSize());
+    if (FAILED(m_library->Serialize(data.data(), data.size()))) {
+        Platform::OutputDebugMessage("DX12PipelineLibrary: Failed to serialize the library\n");
+        return false;
+    }
+
+    PipelineLibraryFileHeader header;
+    header.dataSize = data.size();
+    header.dataHash = HashBytes(data.data(), data.size());
+
+    std::error_code error;
+    const std::filesystem::path directory = std::filesystem::path(m_filePath).parent_path();
+    if (!directory.empty()) {
+        std::filesystem::create_directories(directory, error);
+    }
+
+    // Same temp-and-rename as ShaderCache, so a crash never leaves a truncated library
+    const String tempPath = m_filePath + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            Platform::OutputDebugMessage("DX12PipelineLibrary: Failed to write " + tempPath + "\n");
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file.good()) {
+            Platform::OutputDebugMessage("DX12PipelineLibrary: Failed to write " + tempPath + "\n");
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, m_filePath, error);
+    if (error) {
+        Platform::OutputDebugMessage("DX12PipelineLibrary: Failed to move " + tempPath + " into place\n");
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    m_isDirty = false;
+    Platform::OutputDebugMessage("DX12PipelineLibrary: Saved " + std::to_string(data.size()) + " bytes to " + m_filePath + "\n");
+    return true;
+}
+
+D3D12_GRAPHICS_PIPELINE_STATE_DESC DX12PipelineLibrary::BuildGraphicsDesc(const PipelineStateDesc& desc, ID3D12RootSignature* rootSignature,
+                                                                          ID3DBlob* vertexShader, ID3DBlob* pixelShader) {
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc = {};
+    psoDesc.InputLayout = { s_positionNormalTexcoord, _countof(s_positionNormalTexcoord) };
+    psoDesc.pRootSignature = rootSignature;
+    if (vertexShader) {
+        psoDesc.VS = { vertexShader->GetBufferPointer(), vertexShader->GetBufferSize() };
+    }
+    if (pixelShader) {
+        psoDesc.PS = { pixelShader->GetBufferPointer(), pixelShader->GetBufferSize() };
+    }
+
+    // Rasterizer
+    psoDesc.RasterizerState.FillMode = desc.fillMode == RHIFillMode::Wireframe ? D3D12_FILL_MODE_WIREFRAME : D3D12_FILL_MODE_SOLID;
+    psoDesc.RasterizerState.CullMode = desc.cullMode == RHICullMode::None  ? D3D12_CULL_MODE_NONE
+                                     : desc.cullMode == RHICullMode::Front ? D3D12_CULL_MODE_FRONT
+                                     : D3D12_CULL_MODE_BACK;
+    psoDesc.RasterizerState.FrontCounterClockwise = desc.frontCounterClockwise ? TRUE : FALSE;
+    psoDesc.RasterizerState.DepthBias = desc.depthBias;
+    psoDesc.RasterizerState.DepthBiasClamp = 0.0f;
+    psoDesc.RasterizerState.SlopeScaledDepthBias = desc.slopeScaledDepthBias;
+    psoDesc.RasterizerState.DepthClipEnable = desc.depthClipEnable ? TRUE : FALSE;
+    psoDesc.RasterizerState.MultisampleEnable = desc.sampleCount > 1 ? TRUE : FALSE;
+    psoDesc.RasterizerState.AntialiasedLineEnable = FALSE;
+    psoDesc.RasterizerState.ForcedSampleCount = 0;
+    psoDesc.RasterizerState.ConservativeRaster = D3D12_CONSERVATIVE_RASTERIZATION_MODE_OFF;
+
+    // Blend state
+    psoDesc.BlendState.AlphaToCoverageEnable = FALSE;
+    psoDesc.BlendState.IndependentBlendEnable = FALSE;
+    for (int i = 0; i < 8; ++i) {
+        psoDesc.BlendState.RenderTarget[i] = ConvertBlend(desc.blendMode);
+    }
+
+    // Depth stencil state
+    psoDesc.DepthStencilState.DepthEnable = desc.depthEnable ? TRUE : FALSE;
+    psoDesc.DepthStencilState.DepthWriteMask = desc.depthWriteEnable ? D3D12_DEPTH_WRITE_MASK_ALL : D3D12_DEPTH_WRITE_MASK_ZERO;
+    psoDesc.DepthStencilState.DepthFunc = ConvertComparison(desc.depthFunc);
+    psoDesc.DepthStencilState.StencilEnable = FALSE;
+
+    // Other settings
+    psoDesc.SampleMask = UINT_MAX;
+    psoDesc.PrimitiveTopologyType = ConvertTopologyType(desc.topology);
+    psoDesc.NumRenderTargets = desc.renderTargetCount;
+    for (uint32 i = 0; i < desc.renderTargetCount && i < 8; ++i) {
+        psoDesc.RTVFormats[i] = ConvertFormat(desc.renderTargetFormat);
+    }
+    psoDesc.DSVFormat = desc.depthEnable ? ConvertFormat(desc.depthFormat) : DXGI_FORMAT_UNKNOWN;
+    psoDesc.SampleDesc.Count = desc.sampleCount;
+    psoDesc.SampleDesc.Quality = 0;
+    return psoDesc;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "PipelineStateDesc.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+
+constexpr uint32 PIPELINE_LIBRARY_MAGIC = 0x4C4F5350; // "PSOL"
+constexpr uint32 PIPELINE_LIBRARY_VERSION = 1;
+
+struct PipelineLibraryStats {
+    uint32 loaded = 0;      // Served from the library file (no driver compile)
+    uint32 created = 0;     // Compiled by the driver and added to the library
+};
+
+#pragma pack(push, 1)
+struct PipelineLibraryFileHeader {
+    uint32 magic = PIPELINE_LIBRARY_MAGIC;
+    uint32 version = PIPELINE_LIBRARY_VERSION;
+    uint64 dataSize = 0;
+    uint64 dataHash = 0;
+};
+#pragma pack(pop)
+
+// ID3D12PipelineLibrary persisted to one file, so pipelines compiled in an earlier
+// run load without a driver compile. Entries are named by PipelineStateDesc hash.
+// A missing, truncated or foreign file (other driver or adapter) starts an empty
+// library; devices without ID3D12Device1 fall back to plain creation.
+class DX12PipelineLibrary {
+public:
+    DX12PipelineLibrary(ID3D12Device* device, const String& filePath);
+    ~DX12PipelineLibrary() = default;
+
+    bool Load();
+
+    // Stored pipeline when the library has it, otherwise a fresh one that is stored for Save
+    bool LoadOrCreate(uint64 hash, const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, ComPtr<ID3D12PipelineState>& outPipeline);
+
+    // Write the library back when new pipelines were added
+    bool Save();
+
+    // API description for desc; the input layout points at static storage
+    static D3D12_GRAPHICS_PIPELINE_STATE_DESC BuildGraphicsDesc(const PipelineStateDesc& desc, ID3D12RootSignature* rootSignature,
+                                                                 ID3DBlob* vertexShader, ID3DBlob* pixelShader);
+
+    // Accessors
+    bool IsAvailable() const { return m_library != nullptr; }
+    const String& GetFilePath() const { return m_filePath; }
+    const PipelineLibraryStats& GetStats() const { return m_stats; }
+
+private:
+    bool CreateLibrary(const void* data, uint64 size);
+
+private:
+    ID3D12Device* m_device;
+    String m_filePath;
+    ComPtr<ID3D12PipelineLibrary> m_library;
+    Vector<uint8> m_fileData;        // Must outlive m_library, which reads from it in place
+    bool m_isDirty = false;
+    PipelineLibraryStats m_stats;
+
+    DECLARE_NON_COPYABLE(DX12PipelineLibrary);
+};
@@ -0,0 +1,87 @@
+#include "PipelineStateCache.h"
+#include "../../Platform/Platform.h"
+#include <cstdio>
+#include <mutex>
+
+namespace {
+    String FormatHash(uint64 hash) {
+        char text[20];
+        std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(hash));
+        return text;
+    }
+}
+
+PipelineStateCache::PipelineStateCache(const CreateFunction& create)
+    : m_create(create) {
+    ASSERT(m_create != nullptr, "PipelineStateCache needs a create function");
+}
+
+void* PipelineStateCache::GetOrCreate(const PipelineStateDesc& desc, uint64 hash) {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        auto it = m_entries.find(hash);
+        if (it != m_entries.end() && it->second.desc == desc) {
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second.pipeline;
+        }
+    }
+
+    // Creation holds the exclusive lock, so two threads missing on the same
+    // description compile it once; warm lookups are not affected
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_entries.find(hash);
+    if (it != m_entries.end()) {
+        if (it->second.desc == desc) {
+            m_hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second.pipeline;
+        }
+
+        // Keep the first owner of the hash; the newcomer works, just uncached
+        ++m_hashCollisions;
+        ++m_misses;
+        Platform::OutputDebugMessage("PipelineStateCache: Hash collision on " + FormatHash(hash) + "\n");
+        void* pipeline = m_create(desc, hash);
+        if (!pipeline) {
+            ++m_creationFailures;
+        }
+        return pipeline;
+    }
+
+    ++m_misses;
+    void* pipeline = m_create(desc, hash);
+    if (!pipeline) {
+        ++m_creationFailures;
+        Platform::OutputDebugMessage("PipelineStateCache: Failed to create pipeline " + FormatHash(hash) + "\n");
+    }
+
+    Entry& entry = m_entries[hash];
+    entry.desc = desc;
+    entry.pipeline = pipeline;
+    return pipeline;
+}
+
+void* PipelineStateCache::Find(const PipelineStateDesc& desc, uint64 hash) const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto it = m_entries.find(hash);
+    return it != m_entries.end() && it->second.desc == desc ? it->second.pipeline : nullptr;
+}
+
+void PipelineStateCache::Clear() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+uint32 PipelineStateCache::GetCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return static_cast<uint32>(m_entries.size());
+}
+
+PipelineStateCacheStats PipelineStateCache::GetStats() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    PipelineStateCacheStats stats;
+    stats.hits = m_hits.load(std::memory_order_relaxed);
+    stats.misses = m_misses;
+    stats.creationFailures = m_creationFailures;
+    stats.hashCollisions = m_hashCollisions;
+    return stats;
+}
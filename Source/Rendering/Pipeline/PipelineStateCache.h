@@ -0,0 +1,57 @@
+#pragma once
+
+#include "PipelineStateDesc.h"
+#include <atomic>
+#include <shared_mutex>
+
+struct PipelineStateCacheStats {
+    uint32 hits = 0;
+    uint32 misses = 0;              // Each one is a pipeline creation
+    uint32 creationFailures = 0;
+    uint32 hashCollisions = 0;      // Same hash, different description; created but not cached
+};
+
+// Pipelines created on first use, keyed by PipelineStateDesc::ComputeHash. Platform
+// neutral: the API object is made by the create function (DX12Renderer backs it with
+// an ID3D12PipelineLibrary), which also keeps ownership; the cache only hands out the
+// pointer. Lookups take a shared lock, so parallel recording threads do not serialize
+// on warm pipelines. A failed creation is remembered as nullptr until Clear.
+class PipelineStateCache {
+public:
+    using CreateFunction = Function<void*(const PipelineStateDesc& desc, uint64 hash)>;
+
+    explicit PipelineStateCache(const CreateFunction& create);
+    ~PipelineStateCache() = default;
+
+    void* GetOrCreate(const PipelineStateDesc& desc) { return GetOrCreate(desc, PipelineStateDesc::ComputeHash(desc)); }
+
+    // For callers that keep the hash next to a description they bind every frame
+    void* GetOrCreate(const PipelineStateDesc& desc, uint64 hash);
+
+    // Never creates; nullptr when missing or failed
+    void* Find(const PipelineStateDesc& desc, uint64 hash) const;
+
+    // Forget every pipeline (the owner releases the API objects)
+    void Clear();
+
+    uint32 GetCount() const;
+    PipelineStateCacheStats GetStats() const;
+
+private:
+    struct Entry {
+        PipelineStateDesc desc;
+        void* pipeline = nullptr;
+    };
+
+private:
+    CreateFunction m_create;
+    mutable std::shared_mutex m_mutex;
+    HashMap<uint64, Entry> m_entries;
+
+    mutable std::atomic<uint32> m_hits{ 0 };
+    uint32 m_misses = 0;
+    uint32 m_creationFailures = 0;
+    uint32 m_hashCollisions = 0;
+
+    DECLARE_NON_COPYABLE(PipelineStateCache);
+};
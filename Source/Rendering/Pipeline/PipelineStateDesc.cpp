@@ -0,0 +1,31 @@
+#include "PipelineStateDesc.h"
+#include "../../Core/Utilities/Hash.h"
+#include <cstring>
+
+uint64 PipelineStateDesc::ComputeHash(const PipelineStateDesc& desc) {
+    // Floats go in by bit pattern; -0.0 and 0.0 hash differently, which only costs a duplicate PSO
+    uint32 slopeBits = 0;
+    std::memcpy(&slopeBits, &desc.slopeScaledDepthBias, sizeof(slopeBits));
+
+    uint64 hash = HashCombine(FNV1A_OFFSET_BASIS, PIPELINE_STATE_VERSION);
+    hash = HashCombine(hash, desc.rootSignature);
+    hash = HashCombine(hash, desc.vertexShader);
+    hash = HashCombine(hash, desc.pixelShader);
+    hash = HashCombine(hash, static_cast<uint64>(desc.vertexLayout));
+    hash = HashCombine(hash, static_cast<uint64>(desc.topology));
+    hash = HashCombine(hash, static_cast<uint64>(desc.fillMode));
+    hash = HashCombine(hash, static_cast<uint64>(desc.cullMode));
+    hash = HashCombine(hash, desc.frontCounterClockwise ? 1 : 0);
+    hash = HashCombine(hash, desc.depthClipEnable ? 1 : 0);
+    hash = HashCombine(hash, static_cast<uint64>(static_cast<uint32>(desc.depthBias)));
+    hash = HashCombine(hash, slopeBits);
+    hash = HashCombine(hash, desc.depthEnable ? 1 : 0);
+    hash = HashCombine(hash, desc.depthWriteEnable ? 1 : 0);
+    hash = HashCombine(hash, static_cast<uint64>(desc.depthFunc));
+    hash = HashCombine(hash, static_cast<uint64>(desc.blendMode));
+    hash = HashCombine(hash, desc.renderTargetCount);
+    hash = HashCombine(hash, static_cast<uint64>(desc.renderTargetFormat));
+    hash = HashCombine(hash, static_cast<uint64>(desc.depthFormat));
+    hash = HashCombine(hash, desc.sampleCount);
+    return hash;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../RHI/RHITypes.h"
+
+// Bump when the hash derivation or the meaning of a field changes, so stale
+// pipeline library entries are not picked up under a new layout
+constexpr uint32 PIPELINE_STATE_VERSION = 1;
+
+enum class RHIFillMode : uint8 {
+    Solid,
+    Wireframe
+};
+
+enum class RHICullMode : uint8 {
+    None,
+    Front,
+    Back
+};
+
+enum class RHIComparisonFunc : uint8 {
+    Never,
+    Less,
+    Equal,
+    LessEqual,
+    Greater,
+    NotEqual,
+    GreaterEqual,
+    Always
+};
+
+enum class RHIBlendMode : uint8 {
+    Opaque,
+    AlphaBlend,     // src * a + dst * (1 - a)
+    Additive,       // src * a + dst
+    Premultiplied   // src + dst * (1 - a)
+};
+
+// Vertex formats the mesh pipelines understand (one interleaved stream each)
+enum class RHIVertexLayout : uint8 {
+    PositionNormalTexcoord      // float3 position, float3 normal, float2 uv (MeshVertex)
+};
+
+// Everything that goes into a graphics pipeline, without API objects. Shaders and
+// root signatures are referred to by the hash of their bytecode / serialized blob,
+// so a description is stable across runs and can key an on-disk pipeline library.
+struct PipelineStateDesc {
+    uint64 rootSignature = 0;
+    uint64 vertexShader = 0;
+    uint64 pixelShader = 0;     // 0 for depth-only pipelines
+
+    RHIVertexLayout vertexLayout = RHIVertexLayout::PositionNormalTexcoord;
+    RHIPrimitiveTopology topology = RHIPrimitiveTopology::TriangleList;
+
+    // Rasterizer
+    RHIFillMode fillMode = RHIFillMode::Solid;
+    RHICullMode cullMode = RHICullMode::Back;
+    bool frontCounterClockwise = true;
+    bool depthClipEnable = true;
+    int32 depthBias = 0;
+    float32 slopeScaledDepthBias = 0.0f;
+
+    // Depth
+    bool depthEnable = true;
+    bool depthWriteEnable = true;
+    RHIComparisonFunc depthFunc = RHIComparisonFunc::Less;
+
+    // Output
+    RHIBlendMode blendMode = RHIBlendMode::Opaque;
+    uint32 renderTargetCount = 1;
+    RHIResourceFormat renderTargetFormat = RHIResourceFormat::R8G8B8A8_Unorm;
+    RHIResourceFormat depthFormat = RHIResourceFormat::D32_Float;
+    uint32 sampleCount = 1;
+
+    // Field by field (never the raw bytes, padding is not stable) over FNV-1a, so
+    // the value is the same on every platform and run
+    static uint64 ComputeHash(const PipelineStateDesc& desc);
+
+    bool operator==(const PipelineStateDesc& other) const = default;
+};
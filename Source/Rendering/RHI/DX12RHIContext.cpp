@@ -5,6 +5,13 @@ DX12RHIContext::DX12RHIContext(DX12Renderer* renderer)
     ASSERT(renderer != nullptr, "DX12Renderer cannot be null");
 }
 
+DX12RHIContext::DX12RHIContext(DX12Renderer* renderer, ID3D12GraphicsCommandList* commandList)
+    : m_renderer(renderer)
+    , m_commandList(commandList) {
+    ASSERT(renderer != nullptr, "DX12Renderer cannot be null");
+    ASSERT(commandList != nullptr, "Command list cannot be null");
+}
+
 void DX12RHIContext::SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) {
     auto* commandList = GetCommandList();
     ASSERT(commandList != nullptr, "Command list is null");
@@ -7,6 +7,8 @@
 class DX12RHIContext : public IRHIContext {
 public:
     DX12RHIContext(DX12Renderer* renderer);
+    // Records into commandList instead of the renderer's main command list (worker contexts)
+    DX12RHIContext(DX12Renderer* renderer, ID3D12GraphicsCommandList* commandList);
     virtual ~DX12RHIContext() = default;
 
     void SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) override;
@@ -32,7 +34,7 @@ public:
 
     RHIGraphicsAPI GetAPI() const override { return RHIGraphicsAPI::DirectX12; }
 
-    ID3D12GraphicsCommandList* GetCommandList() const { return m_renderer->GetCommandList(); }
+    ID3D12GraphicsCommandList* GetCommandList() const { return m_commandList ? m_commandList : m_renderer->GetCommandList(); }
     ID3D12Device* GetDevice() const { return m_renderer->GetDevice(); }
 
 private:
@@ -41,6 +43,7 @@ private:
 
 private:
     DX12Renderer* m_renderer = nullptr;
+    ID3D12GraphicsCommandList* m_commandList = nullptr;
     
     DECLARE_NON_COPYABLE(DX12RHIContext);
 };
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include "DX12RHIContextPool.h"
+#include <algorithm>
+
+DX12RHIContextPool::DX12RHIContextPool(DX12Renderer* renderer)
+    : m_renderer(renderer) {
+    ASSERT(renderer != nullptr, "DX12Renderer cannot be null");
+}
+
+bool DX12RHIContextPool::Initialize(uint32 contextCount, uint32 frameCount) {
+    ID3D12Device* device = m_renderer->GetDevice();
+    if (!device || contextCount == 0 || frameCount == 0) {
+        Platform::OutputDebugMessage("DX12RHIContextPool: Invalid device or counts\n");
+        return false;
+    }
+
+    m_workers.resize(contextCount);
+    m_submitList.reserve(contextCount);
+
+    for (uint32 worker = 0; worker < contextCount; ++worker) {
+        WorkerContext& workerContext = m_workers[worker];
+        workerContext.allocators.resize(frameCount);
+
+        for (uint32 frame = 0; frame < frameCount; ++frame) {
+            THROW_IF_FAILED(device->CreateCommandAllocator(
+                D3D12_COMMAND_LIST_TYPE_DIRECT,
+                IID_PPV_ARGS(&workerContext.allocators[frame])),
+                "Create worker command allocator " + std::to_string(worker));
+
+            m_renderer->SetDebugName(workerContext.allocators[frame].Get(),
+                                     "Worker " + std::to_string(worker) + " Command Allocator " + std::to_string(frame));
+        }
+
+        THROW_IF_FAILED(device->CreateCommandList(
+            0,
+            D3D12_COMMAND_LIST_TYPE_DIRECT,
+            workerContext.allocators[0].Get(),
+            nullptr,
+            IID_PPV_ARGS(&workerContext.commandList)), "Create worker command list " + std::to_string(worker));
+
+        m_renderer->SetDebugName(workerContext.commandList.Get(), "Worker " + std::to_string(worker) + " Command List");
+
+        // Command lists start in the recording state
+        THROW_IF_FAILED(workerContext.commandList->Close(), "Close initial worker command list");
+
+        workerContext.context = std::make_unique<DX12RHIContext>(m_renderer, workerContext.commandList.Get());
+    }
+
+    Platform::OutputDebugMessage("DX12RHIContextPool: Created " + std::to_string(contextCount) + " worker contexts\n");
+    return true;
+}
+
+uint32 DX12RHIContextPool::BeginRecording(uint32 requestedCount) {
+    ASSERT(!m_isRecording, "DX12RHIContextPool: BeginRecording called twice");
+
+    uint32 frameIndex = m_renderer->GetCurrentFrameIndex();
+    m_activeCount = std::clamp(requestedCount, 1u, GetMaxContextCount());
+
+    // The renderer waited on this frame's fence before BeginFrame, so its allocators are idle
+    for (uint32 i = 0; i < m_activeCount; ++i) {
+        WorkerContext& workerContext = m_workers[i];
+        ID3D12CommandAllocator* allocator = workerContext.allocators[frameIndex].Get();
+
+        THROW_IF_FAILED(allocator->Reset(), "Reset worker command allocator");
+        THROW_IF_FAILED(workerContext.commandList->Reset(allocator, nullptr), "Reset worker command list");
+
+        // A fresh list inherits nothing from the main one
+        m_renderer->ApplyFrameState(workerContext.commandList.Get());
+    }
+
+    m_isRecording = true;
+    return m_activeCount;
+}
+
+IRHIContext& DX12RHIContextPool::GetContext(uint32 index) {
+    ASSERT(m_isRecording && index < m_activeCount, "DX12RHIContextPool: Context index out of range");
+    return *m_workers[index].context;
+}
+
+void DX12RHIContextPool::EndRecording() {
+    ASSERT(m_isRecording, "DX12RHIContextPool: EndRecording without BeginRecording");
+    m_isRecording = false;
+
+    m_submitList.clear();
+    for (uint32 i = 0; i < m_activeCount; ++i) {
+        ID3D12GraphicsCommandList* commandList = m_workers[i].commandList.Get();
+        THROW_IF_FAILED(commandList->Close(), "Close worker command list");
+        m_submitList.push_back(commandList);
+    }
+
+    m_renderer->ExecuteWorkerCommandLists(m_submitList.data(), static_cast<uint32>(m_submitList.size()));
+}
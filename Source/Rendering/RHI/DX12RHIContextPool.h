@@ -0,0 +1,41 @@
+#pragma once
+
+#include "IRHIContextPool.h"
+#include "DX12RHIContext.h"
+#include "../../Platform/Windows/WindowsPlatform.h"
+
+// Per-worker DX12 command lists for parallel recording. Every worker owns one command
+// list and one allocator per frame in flight, so recording never contends on an
+// allocator and a frame's allocators are only reset after its fence has passed.
+// EndRecording submits the worker lists in index order between the main command
+// list's earlier and later work (see DX12Renderer::ExecuteWorkerCommandLists).
+class DX12RHIContextPool : public IRHIContextPool {
+public:
+    explicit DX12RHIContextPool(DX12Renderer* renderer);
+    virtual ~DX12RHIContextPool() = default;
+
+    bool Initialize(uint32 contextCount, uint32 frameCount);
+
+    uint32 BeginRecording(uint32 requestedCount) override;
+    IRHIContext& GetContext(uint32 index) override;
+    void EndRecording() override;
+
+    uint32 GetMaxContextCount() const override { return static_cast<uint32>(m_workers.size()); }
+    RHIGraphicsAPI GetAPI() const override { return RHIGraphicsAPI::DirectX12; }
+
+private:
+    struct WorkerContext {
+        Vector<ComPtr<ID3D12CommandAllocator>> allocators; // One per frame in flight
+        ComPtr<ID3D12GraphicsCommandList> commandList;
+        UniquePtr<DX12RHIContext> context;
+    };
+
+private:
+    DX12Renderer* m_renderer = nullptr;
+    Vector<WorkerContext> m_workers;
+    Vector<ID3D12CommandList*> m_submitList;
+    uint32 m_activeCount = 0;
+    bool m_isRecording = false;
+
+    DECLARE_NON_COPYABLE(DX12RHIContextPool);
+};
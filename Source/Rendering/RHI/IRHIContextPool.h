@@ -0,0 +1,45 @@
+#pragma once
+
+#include "IRHIContext.h"
+#include "../../Core/Threading/JobSystem.h"
+
+// A set of command contexts that are recorded on several threads and submitted as
+// one ordered batch: context i executes after context i - 1, whichever thread
+// finished recording first. Each context must only be used by one thread at a time.
+class IRHIContextPool {
+public:
+    virtual ~IRHIContextPool() = default;
+
+    // Prepare up to requestedCount contexts for this batch; returns how many may be used
+    virtual uint32 BeginRecording(uint32 requestedCount) = 0;
+    virtual IRHIContext& GetContext(uint32 index) = 0;
+
+    // Close the contexts and submit them in index order
+    virtual void EndRecording() = 0;
+
+    virtual uint32 GetMaxContextCount() const = 0;
+    virtual RHIGraphicsAPI GetAPI() const = 0;
+
+    // Split itemCount items into contiguous ranges of at least minItemsPerContext and
+    // record range i into context i on the job system's workers, as one batch. Since
+    // the ranges follow the submission order, the batch matches recording every item
+    // in order into one context. Returns the number of contexts used (0 for no items).
+    uint32 RecordParallel(JobSystem& jobSystem, uint32 itemCount, uint32 minItemsPerContext,
+                          const Function<void(IRHIContext&, JobRange)>& record);
+};
+
+inline uint32 IRHIContextPool::RecordParallel(JobSystem& jobSystem, uint32 itemCount, uint32 minItemsPerContext,
+                                              const Function<void(IRHIContext&, JobRange)>& record) {
+    uint32 requestedCount = JobSystem::GetPartitionCount(itemCount, jobSystem.GetWorkerCount() + 1, minItemsPerContext);
+    if (requestedCount == 0) {
+        return 0;
+    }
+
+    // The pool may grant fewer contexts than requested, partition over what it returned
+    uint32 contextCount = BeginRecording(requestedCount);
+    jobSystem.ParallelFor(contextCount, [this, &record, itemCount, contextCount](uint32 contextIndex) {
+        record(GetContext(contextIndex), JobSystem::GetPartitionRange(itemCount, contextCount, contextIndex));
+    });
+    EndRecording();
+    return contextCount;
+}
@@ -0,0 +1,59 @@
+#include "NullRHIContext.h"
+
+void NullRHIContext::SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) {
+    m_stats.bufferBinds++;
+}
+
+void NullRHIContext::SetIndexBuffer(const RHIIndexBufferView& bufferView) {
+    m_stats.bufferBinds++;
+}
+
+void NullRHIContext::SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) {
+    m_stats.bufferBinds++;
+}
+
+void NullRHIContext::SetVertexShader(const RHIShader& shader) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetPixelShader(const RHIShader& shader) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetTexture(uint32 slot, const RHITextureView& textureView) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetSampler(uint32 slot, const RHISamplerView& samplerView) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetTexture(uint32 slot, void* gpuHandle) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetSampler(uint32 slot, void* gpuHandle) {
+    m_stats.resourceBinds++;
+}
+
+void NullRHIContext::SetPrimitiveTopology(RHIPrimitiveTopology topology) {
+    m_stats.stateChanges++;
+}
+
+void NullRHIContext::SetViewport(const RHIViewport& viewport) {
+    m_stats.stateChanges++;
+}
+
+void NullRHIContext::SetScissorRect(const RHIRect& rect) {
+    m_stats.stateChanges++;
+}
+
+void NullRHIContext::DrawIndexed(uint32 indexCount, uint32 startIndexLocation, int32 baseVertexLocation) {
+    m_stats.drawCalls++;
+    m_stats.indexCount += indexCount;
+}
+
+void NullRHIContext::Draw(uint32 vertexCount, uint32 startVertexLocation) {
+    m_stats.drawCalls++;
+    m_stats.vertexCount += vertexCount;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "IRHIContext.h"
+
+// Counters gathered by NullRHIContext, so headless runs can check how much work a
+// frame would have submitted
+struct NullRHIStats {
+    uint64 drawCalls = 0;
+    uint64 indexCount = 0;
+    uint64 vertexCount = 0;
+    uint64 bufferBinds = 0;
+    uint64 resourceBinds = 0;   // Shaders, textures and samplers
+    uint64 stateChanges = 0;    // Topology, viewport and scissor
+};
+
+// IRHIContext that accepts every command and discards it. Used by the headless
+// (Linux) build and by CI perf runs to drive Scene::Render without a GPU.
+class NullRHIContext : public IRHIContext {
+public:
+    NullRHIContext() = default;
+    virtual ~NullRHIContext() = default;
+
+    void SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) override;
+    void SetIndexBuffer(const RHIIndexBufferView& bufferView) override;
+    void SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) override;
+
+    void SetVertexShader(const RHIShader& shader) override;
+    void SetPixelShader(const RHIShader& shader) override;
+
+    void SetTexture(uint32 slot, const RHITextureView& textureView) override;
+    void SetSampler(uint32 slot, const RHISamplerView& samplerView) override;
+
+    void SetTexture(uint32 slot, void* gpuHandle) override;
+    void SetSampler(uint32 slot, void* gpuHandle) override;
+
+    void SetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+    void SetViewport(const RHIViewport& viewport) override;
+    void SetScissorRect(const RHIRect& rect) override;
+
+    void DrawIndexed(uint32 indexCount, uint32 startIndexLocation = 0, int32 baseVertexLocation = 0) override;
+    void Draw(uint32 vertexCount, uint32 startVertexLocation = 0) override;
+
+    RHIGraphicsAPI GetAPI() const override { return RHIGraphicsAPI::Null; }
+
+    // Statistics
+    const NullRHIStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = {}; }
+
+private:
+    NullRHIStats m_stats;
+
+    DECLARE_NON_COPYABLE(NullRHIContext);
+};
@@ -0,0 +1,280 @@
+#include "RHICommandReplayer.h"
+#include "IRHIContext.h"
+#include "../../Core/Utilities/Hash.h"
+#include "../../Platform/Platform.h"
+
+namespace {
+    // One command with its fields unpacked; which fields are used depends on the type
+    struct DecodedCommand {
+        RHICommandType type = RHICommandType::Draw;
+        uint32 slot = 0;            // Vertex buffer slot, root parameter or texture/sampler slot
+        uint64 resource = 0;        // Buffer, texture, sampler or shader identity; GPU handle
+        uint64 view = 0;            // Buffer location, SRV identity or bytecode hash
+        uint32 size = 0;            // Buffer or bytecode size
+        uint32 extra = 0;           // Vertex stride or view slot
+        uint8 format = 0;           // Index format, topology or shader type
+        String entryPoint;
+        RHIViewport viewport;
+        RHIRect rect;
+        uint32 count = 0;
+        uint32 start = 0;
+        int32 baseVertex = 0;
+    };
+
+    bool DecodeNext(RHICommandReader& reader, DecodedCommand& command) {
+        if (!reader.ReadCommandType(command.type)) {
+            return false;
+        }
+
+        switch (command.type) {
+            case RHICommandType::SetVertexBuffer:
+                return reader.Read(command.slot) && reader.Read(command.resource) && reader.Read(command.view) &&
+                       reader.Read(command.size) && reader.Read(command.extra);
+            case RHICommandType::SetIndexBuffer:
+                return reader.Read(command.resource) && reader.Read(command.view) &&
+                       reader.Read(command.size) && reader.Read(command.format);
+            case RHICommandType::SetConstantBuffer:
+                return reader.Read(command.slot) && reader.Read(command.resource) &&
+                       reader.Read(command.view) && reader.Read(command.size);
+            case RHICommandType::SetVertexShader:
+            case RHICommandType::SetPixelShader:
+                return reader.Read(command.resource) && reader.Read(command.format) && reader.Read(command.view) &&
+                       reader.Read(command.size) && reader.ReadString(command.entryPoint);
+            case RHICommandType::SetTextureView:
+                return reader.Read(command.slot) && reader.Read(command.resource) &&
+                       reader.Read(command.view) && reader.Read(command.extra);
+            case RHICommandType::SetSamplerView:
+                return reader.Read(command.slot) && reader.Read(command.resource) && reader.Read(command.extra);
+            case RHICommandType::SetTextureHandle:
+            case RHICommandType::SetSamplerHandle:
+                return reader.Read(command.slot) && reader.Read(command.resource);
+            case RHICommandType::SetPrimitiveTopology:
+                return reader.Read(command.format);
+            case RHICommandType::SetViewport:
+                return reader.Read(command.viewport);
+            case RHICommandType::SetScissorRect:
+                return reader.Read(command.rect);
+            case RHICommandType::DrawIndexed:
+                return reader.Read(command.count) && reader.Read(command.start) && reader.Read(command.baseVertex);
+            case RHICommandType::Draw:
+                return reader.Read(command.count) && reader.Read(command.start);
+            default:
+                return false;
+        }
+    }
+
+    void* ToPointer(uint64 identity) {
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(identity));
+    }
+
+    // Pipeline state a command writes to; views and handles share the texture/sampler slots
+    enum class StateClass : uint32 {
+        VertexBuffer,
+        IndexBuffer,
+        ConstantBuffer,
+        VertexShader,
+        PixelShader,
+        Texture,
+        Sampler,
+        Topology,
+        Viewport,
+        Scissor
+    };
+
+    bool GetStateKey(const DecodedCommand& command, uint64& outKey, uint64& outValue) {
+        auto key = [](StateClass stateClass, uint32 slot) {
+            return (static_cast<uint64>(stateClass) << 32) | slot;
+        };
+
+        uint64 value = FNV1A_OFFSET_BASIS;
+        switch (command.type) {
+            case RHICommandType::SetVertexBuffer:
+                outKey = key(StateClass::VertexBuffer, command.slot);
+                value = HashCombine(HashCombine(HashCombine(value, command.view), command.size), command.extra);
+                break;
+            case RHICommandType::SetIndexBuffer:
+                outKey = key(StateClass::IndexBuffer, 0);
+                value = HashCombine(HashCombine(HashCombine(value, command.view), command.size), command.format);
+                break;
+            case RHICommandType::SetConstantBuffer:
+                outKey = key(StateClass::ConstantBuffer, command.slot);
+                value = HashCombine(HashCombine(value, command.view), command.size);
+                break;
+            case RHICommandType::SetVertexShader:
+            case RHICommandType::SetPixelShader:
+                outKey = key(command.type == RHICommandType::SetVertexShader ? StateClass::VertexShader : StateClass::PixelShader, 0);
+                value = HashCombine(HashCombine(value, command.resource), command.view);
+                break;
+            case RHICommandType::SetTextureView:
+                outKey = key(StateClass::Texture, command.slot);
+                value = HashCombine(value, command.view ? command.view : command.resource);
+                break;
+            case RHICommandType::SetTextureHandle:
+                outKey = key(StateClass::Texture, command.slot);
+                value = HashCombine(value, command.resource);
+                break;
+            case RHICommandType::SetSamplerView:
+            case RHICommandType::SetSamplerHandle:
+                outKey = key(StateClass::Sampler, command.slot);
+                value = HashCombine(value, command.resource);
+                break;
+            case RHICommandType::SetPrimitiveTopology:
+                outKey = key(StateClass::Topology, 0);
+                value = HashCombine(value, command.format);
+                break;
+            case RHICommandType::SetViewport:
+                outKey = key(StateClass::Viewport, 0);
+                value = HashBytes(&command.viewport, sizeof(command.viewport));
+                break;
+            case RHICommandType::SetScissorRect:
+                outKey = key(StateClass::Scissor, 0);
+                value = HashBytes(&command.rect, sizeof(command.rect));
+                break;
+            default:
+                return false;
+        }
+
+        outValue = value;
+        return true;
+    }
+}
+
+bool RHICommandReplayer::Replay(const RHICommandStream& stream, IRHIContext& target) {
+    RHICommandReader reader(stream);
+    DecodedCommand command;
+
+    while (!reader.IsAtEnd()) {
+        if (!DecodeNext(reader, command)) {
+            Platform::OutputDebugMessage("RHICommandReplayer: Corrupt command at offset " + std::to_string(reader.GetOffset()) + "\n");
+            return false;
+        }
+
+        switch (command.type) {
+            case RHICommandType::SetVertexBuffer: {
+                RHIVertexBufferView view;
+                view.bufferResource = ToPointer(command.resource);
+                view.bufferLocation = command.view;
+                view.sizeInBytes = command.size;
+                view.strideInBytes = command.extra;
+                target.SetVertexBuffer(command.slot, view);
+                break;
+            }
+            case RHICommandType::SetIndexBuffer: {
+                RHIIndexBufferView view;
+                view.bufferResource = ToPointer(command.resource);
+                view.bufferLocation = command.view;
+                view.sizeInBytes = command.size;
+                view.format = static_cast<RHIResourceFormat>(command.format);
+                target.SetIndexBuffer(view);
+                break;
+            }
+            case RHICommandType::SetConstantBuffer: {
+                RHIConstantBufferView view;
+                view.bufferResource = ToPointer(command.resource);
+                view.bufferLocation = command.view;
+                view.sizeInBytes = command.size;
+                target.SetConstantBuffer(command.slot, view);
+                break;
+            }
+            case RHICommandType::SetVertexShader:
+            case RHICommandType::SetPixelShader: {
+                // Bytecode is not captured; backends that need it must resolve shaderResource
+                RHIShader shader;
+                shader.shaderResource = ToPointer(command.resource);
+                shader.type = static_cast<RHIShaderType>(command.format);
+                shader.entryPoint = command.entryPoint;
+                if (command.type == RHICommandType::SetVertexShader) {
+                    target.SetVertexShader(shader);
+                } else {
+                    target.SetPixelShader(shader);
+                }
+                break;
+            }
+            case RHICommandType::SetTextureView: {
+                RHITextureView view;
+                view.textureResource = ToPointer(command.resource);
+                view.shaderResourceView = ToPointer(command.view);
+                view.slot = command.extra;
+                target.SetTexture(command.slot, view);
+                break;
+            }
+            case RHICommandType::SetSamplerView: {
+                RHISamplerView view;
+                view.samplerResource = ToPointer(command.resource);
+                view.slot = command.extra;
+                target.SetSampler(command.slot, view);
+                break;
+            }
+            case RHICommandType::SetTextureHandle:
+                target.SetTexture(command.slot, ToPointer(command.resource));
+                break;
+            case RHICommandType::SetSamplerHandle:
+                target.SetSampler(command.slot, ToPointer(command.resource));
+                break;
+            case RHICommandType::SetPrimitiveTopology:
+                target.SetPrimitiveTopology(static_cast<RHIPrimitiveTopology>(command.format));
+                break;
+            case RHICommandType::SetViewport:
+                target.SetViewport(command.viewport);
+                break;
+            case RHICommandType::SetScissorRect:
+                target.SetScissorRect(command.rect);
+                break;
+            case RHICommandType::DrawIndexed:
+                target.DrawIndexed(command.count, command.start, command.baseVertex);
+                break;
+            case RHICommandType::Draw:
+                target.Draw(command.count, command.start);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool RHICommandReplayer::Analyze(const RHICommandStream& stream, RHICommandStats& outStats) {
+    outStats = {};
+    outStats.streamBytes = stream.GetSize();
+
+    RHICommandReader reader(stream);
+    DecodedCommand command;
+    HashMap<uint64, uint64> boundState;
+
+    while (!reader.IsAtEnd()) {
+        if (!DecodeNext(reader, command)) {
+            return false;
+        }
+
+        size_t typeIndex = static_cast<size_t>(command.type);
+        outStats.commandCounts[typeIndex]++;
+        outStats.totalCommands++;
+
+        if (command.type == RHICommandType::DrawIndexed) {
+            outStats.drawCalls++;
+            outStats.indexCount += command.count;
+            continue;
+        }
+        if (command.type == RHICommandType::Draw) {
+            outStats.drawCalls++;
+            outStats.vertexCount += command.count;
+            continue;
+        }
+
+        uint64 key = 0;
+        uint64 value = 0;
+        if (GetStateKey(command, key, value)) {
+            auto [it, inserted] = boundState.try_emplace(key, value);
+            if (!inserted) {
+                if (it->second == value) {
+                    outStats.redundantCounts[typeIndex]++;
+                    outStats.redundantStateChanges++;
+                }
+                it->second = value;
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "RHICommandStream.h"
+
+class IRHIContext;
+
+// Summary of a command stream. A state change is redundant when it sets the same
+// value its slot already holds (e.g. rebinding the bound vertex buffer).
+struct RHICommandStats {
+    uint32 commandCounts[static_cast<size_t>(RHICommandType::Count)] = {};
+    uint32 redundantCounts[static_cast<size_t>(RHICommandType::Count)] = {};
+    uint64 totalCommands = 0;
+    uint64 drawCalls = 0;
+    uint64 indexCount = 0;
+    uint64 vertexCount = 0;
+    uint64 redundantStateChanges = 0;
+    uint64 streamBytes = 0;
+};
+
+// Feeds a recorded RHICommandStream back into any IRHIContext, or summarizes it.
+// Both return false when the stream is truncated or corrupt; commands before the
+// damaged one have already been replayed/counted.
+class RHICommandReplayer {
+public:
+    static bool Replay(const RHICommandStream& stream, IRHIContext& target);
+    static bool Analyze(const RHICommandStream& stream, RHICommandStats& outStats);
+};
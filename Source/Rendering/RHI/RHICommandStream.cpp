@@ -0,0 +1,108 @@
+#include "RHICommandStream.h"
+#include "../../Core/Utilities/FileSystem.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <fstream>
+
+void RHICommandStream::Clear() {
+    m_data.clear();
+    m_commandCount = 0;
+}
+
+void RHICommandStream::BeginCommand(RHICommandType type) {
+    m_data.push_back(static_cast<uint8>(type));
+    m_commandCount++;
+}
+
+void RHICommandStream::WriteString(const String& text) {
+    uint16 length = static_cast<uint16>(std::min<size_t>(text.size(), UINT16_MAX));
+    Write(length);
+    m_data.insert(m_data.end(), text.begin(), text.begin() + length);
+}
+
+void RHICommandStream::Append(const RHICommandStream& other) {
+    m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+    m_commandCount += other.m_commandCount;
+}
+
+bool RHICommandStream::SaveToFile(const String& filePath) const {
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        Platform::OutputDebugMessage("RHICommandStream: Failed to create " + filePath + "\n");
+        return false;
+    }
+
+    RHICaptureHeader header;
+    header.commandCount = m_commandCount;
+    header.dataSize = m_data.size();
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_data.data()), static_cast<std::streamsize>(m_data.size()));
+    return file.good();
+}
+
+bool RHICommandStream::LoadFromFile(const String& filePath) {
+    Clear();
+
+    Vector<uint8> fileData;
+    if (!FileSystem::ReadFile(filePath, fileData)) {
+        Platform::OutputDebugMessage("RHICommandStream: Failed to read " + filePath + "\n");
+        return false;
+    }
+
+    RHICaptureHeader header;
+    if (fileData.size() < sizeof(header)) {
+        Platform::OutputDebugMessage("RHICommandStream: " + filePath + " is too small\n");
+        return false;
+    }
+    std::memcpy(&header, fileData.data(), sizeof(header));
+
+    if (header.magic != RHI_CAPTURE_MAGIC || header.version != RHI_CAPTURE_VERSION ||
+        header.dataSize != fileData.size() - sizeof(header)) {
+        Platform::OutputDebugMessage("RHICommandStream: " + filePath + " is not a valid capture\n");
+        return false;
+    }
+
+    m_data.assign(fileData.begin() + sizeof(header), fileData.end());
+    m_commandCount = header.commandCount;
+    return true;
+}
+
+const char* RHICommandStream::GetCommandName(RHICommandType type) {
+    switch (type) {
+        case RHICommandType::SetVertexBuffer:      return "SetVertexBuffer";
+        case RHICommandType::SetIndexBuffer:       return "SetIndexBuffer";
+        case RHICommandType::SetConstantBuffer:    return "SetConstantBuffer";
+        case RHICommandType::SetVertexShader:      return "SetVertexShader";
+        case RHICommandType::SetPixelShader:       return "SetPixelShader";
+        case RHICommandType::SetTextureView:       return "SetTexture(view)";
+        case RHICommandType::SetSamplerView:       return "SetSampler(view)";
+        case RHICommandType::SetTextureHandle:     return "SetTexture(handle)";
+        case RHICommandType::SetSamplerHandle:     return "SetSampler(handle)";
+        case RHICommandType::SetPrimitiveTopology: return "SetPrimitiveTopology";
+        case RHICommandType::SetViewport:          return "SetViewport";
+        case RHICommandType::SetScissorRect:       return "SetScissorRect";
+        case RHICommandType::DrawIndexed:          return "DrawIndexed";
+        case RHICommandType::Draw:                 return "Draw";
+        default:                                   return "Unknown";
+    }
+}
+
+bool RHICommandReader::ReadCommandType(RHICommandType& outType) {
+    uint8 value = 0;
+    if (!Read(value) || value >= static_cast<uint8>(RHICommandType::Count)) {
+        return false;
+    }
+    outType = static_cast<RHICommandType>(value);
+    return true;
+}
+
+bool RHICommandReader::ReadString(String& outText) {
+    uint16 length = 0;
+    if (!Read(length) || m_size - m_offset < length) {
+        return false;
+    }
+    outText.assign(reinterpret_cast<const char*>(m_data + m_offset), length);
+    m_offset += length;
+    return true;
+}
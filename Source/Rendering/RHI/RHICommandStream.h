@@ -0,0 +1,123 @@
+#pragma once
+
+#include "RHITypes.h"
+#include <cstring>
+#include <type_traits>
+
+// Capture file layout (little endian):
+//
+//   RHICaptureHeader
+//   command data               dataSize bytes
+//
+// Each command is an RHICommandType byte followed by its fields, tightly packed.
+// Resource pointers and GPU handles are stored as 64-bit identities: they let a
+// capture be analyzed and diffed anywhere, but only the process that recorded them
+// can replay them into a live backend (and only while those resources are alive).
+
+constexpr uint32 RHI_CAPTURE_MAGIC = 0x43494852; // "RHIC"
+constexpr uint16 RHI_CAPTURE_VERSION = 1;
+
+enum class RHICommandType : uint8 {
+    SetVertexBuffer,
+    SetIndexBuffer,
+    SetConstantBuffer,
+    SetVertexShader,
+    SetPixelShader,
+    SetTextureView,
+    SetSamplerView,
+    SetTextureHandle,
+    SetSamplerHandle,
+    SetPrimitiveTopology,
+    SetViewport,
+    SetScissorRect,
+    DrawIndexed,
+    Draw,
+    Count
+};
+
+#pragma pack(push, 1)
+struct RHICaptureHeader {
+    uint32 magic = RHI_CAPTURE_MAGIC;
+    uint16 version = RHI_CAPTURE_VERSION;
+    uint16 flags = 0;
+    uint32 commandCount = 0;
+    uint64 dataSize = 0;
+};
+#pragma pack(pop)
+
+// Growable buffer of serialized IRHIContext calls
+class RHICommandStream {
+public:
+    RHICommandStream() = default;
+    ~RHICommandStream() = default;
+
+    RHICommandStream(RHICommandStream&&) = default;
+    RHICommandStream& operator=(RHICommandStream&&) = default;
+
+    void Clear();
+    void Reserve(size_t bytes) { m_data.reserve(bytes); }
+
+    // Writing
+    void BeginCommand(RHICommandType type);
+
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Command fields must be trivially copyable");
+        size_t offset = m_data.size();
+        m_data.resize(offset + sizeof(T));
+        std::memcpy(m_data.data() + offset, &value, sizeof(T));
+    }
+
+    void WriteString(const String& text);
+
+    // Append another stream's commands (e.g. per-worker recordings merged in order)
+    void Append(const RHICommandStream& other);
+
+    // Persistence
+    bool SaveToFile(const String& filePath) const;
+    bool LoadFromFile(const String& filePath);
+
+    // Accessors
+    const Vector<uint8>& GetData() const { return m_data; }
+    size_t GetSize() const { return m_data.size(); }
+    uint32 GetCommandCount() const { return m_commandCount; }
+    bool IsEmpty() const { return m_commandCount == 0; }
+
+    static const char* GetCommandName(RHICommandType type);
+
+private:
+    Vector<uint8> m_data;
+    uint32 m_commandCount = 0;
+
+    DECLARE_NON_COPYABLE(RHICommandStream);
+};
+
+// Sequential reader over an RHICommandStream; every read is bounds checked
+class RHICommandReader {
+public:
+    explicit RHICommandReader(const RHICommandStream& stream)
+        : m_data(stream.GetData().data()), m_size(stream.GetSize()) {}
+
+    bool IsAtEnd() const { return m_offset >= m_size; }
+    size_t GetOffset() const { return m_offset; }
+
+    bool ReadCommandType(RHICommandType& outType);
+
+    template<typename T>
+    bool Read(T& outValue) {
+        static_assert(std::is_trivially_copyable_v<T>, "Command fields must be trivially copyable");
+        if (m_size - m_offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&outValue, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(String& outText);
+
+private:
+    const uint8* m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_offset = 0;
+};
@@ -6,7 +6,9 @@ enum class RHIGraphicsAPI {
     DirectX12,
     DirectX11,
     Vulkan,
-    OpenGL
+    OpenGL,
+    Null,       // No GPU; headless builds and CPU-side benchmarks
+    Software    // CPU rasterizer (SoftwareRHIContext)
 };
 
 enum class RHIPrimitiveTopology {
@@ -64,6 +66,37 @@ enum class RHITextureDimension {
     Texture2DArray
 };
 
+// How a pass uses a resource. Read-only states can be combined with |, so several
+// readers in a row are served by one transition.
+enum class RHIResourceState : uint32 {
+    Common          = 0,
+    RenderTarget    = 1 << 0,
+    DepthWrite      = 1 << 1,
+    DepthRead       = 1 << 2,
+    ShaderResource  = 1 << 3,
+    UnorderedAccess = 1 << 4,
+    CopySource      = 1 << 5,
+    CopyDest        = 1 << 6,
+    Present         = 1 << 7,
+    Undefined       = 1u << 31     // Contents and state unknown (fresh or aliased memory)
+};
+
+constexpr RHIResourceState operator|(RHIResourceState a, RHIResourceState b) {
+    return static_cast<RHIResourceState>(static_cast<uint32>(a) | static_cast<uint32>(b));
+}
+
+constexpr RHIResourceState operator&(RHIResourceState a, RHIResourceState b) {
+    return static_cast<RHIResourceState>(static_cast<uint32>(a) & static_cast<uint32>(b));
+}
+
+constexpr bool IsReadOnlyState(RHIResourceState state) {
+    constexpr uint32 readOnly = static_cast<uint32>(RHIResourceState::DepthRead) |
+                                static_cast<uint32>(RHIResourceState::ShaderResource) |
+                                static_cast<uint32>(RHIResourceState::CopySource);
+    uint32 bits = static_cast<uint32>(state);
+    return bits != 0 && (bits & ~readOnly) == 0;
+}
+
 struct RHIViewport {
     float32 x = 0.0f;
     float32 y = 0.0f;
@@ -0,0 +1,164 @@
+#include "RecordingRHIContext.h"
+#include "../../Core/Utilities/Hash.h"
+
+RecordingRHIContext::RecordingRHIContext(IRHIContext* passThrough)
+    : m_passThrough(passThrough) {
+}
+
+void RecordingRHIContext::SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) {
+    m_stream.BeginCommand(RHICommandType::SetVertexBuffer);
+    m_stream.Write(slot);
+    m_stream.Write(ToIdentity(bufferView.bufferResource));
+    m_stream.Write(bufferView.bufferLocation);
+    m_stream.Write(bufferView.sizeInBytes);
+    m_stream.Write(bufferView.strideInBytes);
+
+    if (m_passThrough) {
+        m_passThrough->SetVertexBuffer(slot, bufferView);
+    }
+}
+
+void RecordingRHIContext::SetIndexBuffer(const RHIIndexBufferView& bufferView) {
+    m_stream.BeginCommand(RHICommandType::SetIndexBuffer);
+    m_stream.Write(ToIdentity(bufferView.bufferResource));
+    m_stream.Write(bufferView.bufferLocation);
+    m_stream.Write(bufferView.sizeInBytes);
+    m_stream.Write(static_cast<uint8>(bufferView.format));
+
+    if (m_passThrough) {
+        m_passThrough->SetIndexBuffer(bufferView);
+    }
+}
+
+void RecordingRHIContext::SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) {
+    m_stream.BeginCommand(RHICommandType::SetConstantBuffer);
+    m_stream.Write(rootParameterIndex);
+    m_stream.Write(ToIdentity(bufferView.bufferResource));
+    m_stream.Write(bufferView.bufferLocation);
+    m_stream.Write(bufferView.sizeInBytes);
+
+    if (m_passThrough) {
+        m_passThrough->SetConstantBuffer(rootParameterIndex, bufferView);
+    }
+}
+
+void RecordingRHIContext::SetVertexShader(const RHIShader& shader) {
+    WriteShader(RHICommandType::SetVertexShader, shader);
+
+    if (m_passThrough) {
+        m_passThrough->SetVertexShader(shader);
+    }
+}
+
+void RecordingRHIContext::SetPixelShader(const RHIShader& shader) {
+    WriteShader(RHICommandType::SetPixelShader, shader);
+
+    if (m_passThrough) {
+        m_passThrough->SetPixelShader(shader);
+    }
+}
+
+void RecordingRHIContext::SetTexture(uint32 slot, const RHITextureView& textureView) {
+    m_stream.BeginCommand(RHICommandType::SetTextureView);
+    m_stream.Write(slot);
+    m_stream.Write(ToIdentity(textureView.textureResource));
+    m_stream.Write(ToIdentity(textureView.shaderResourceView));
+    m_stream.Write(textureView.slot);
+
+    if (m_passThrough) {
+        m_passThrough->SetTexture(slot, textureView);
+    }
+}
+
+void RecordingRHIContext::SetSampler(uint32 slot, const RHISamplerView& samplerView) {
+    m_stream.BeginCommand(RHICommandType::SetSamplerView);
+    m_stream.Write(slot);
+    m_stream.Write(ToIdentity(samplerView.samplerResource));
+    m_stream.Write(samplerView.slot);
+
+    if (m_passThrough) {
+        m_passThrough->SetSampler(slot, samplerView);
+    }
+}
+
+void RecordingRHIContext::SetTexture(uint32 slot, void* gpuHandle) {
+    m_stream.BeginCommand(RHICommandType::SetTextureHandle);
+    m_stream.Write(slot);
+    m_stream.Write(ToIdentity(gpuHandle));
+
+    if (m_passThrough) {
+        m_passThrough->SetTexture(slot, gpuHandle);
+    }
+}
+
+void RecordingRHIContext::SetSampler(uint32 slot, void* gpuHandle) {
+    m_stream.BeginCommand(RHICommandType::SetSamplerHandle);
+    m_stream.Write(slot);
+    m_stream.Write(ToIdentity(gpuHandle));
+
+    if (m_passThrough) {
+        m_passThrough->SetSampler(slot, gpuHandle);
+    }
+}
+
+void RecordingRHIContext::SetPrimitiveTopology(RHIPrimitiveTopology topology) {
+    m_stream.BeginCommand(RHICommandType::SetPrimitiveTopology);
+    m_stream.Write(static_cast<uint8>(topology));
+
+    if (m_passThrough) {
+        m_passThrough->SetPrimitiveTopology(topology);
+    }
+}
+
+void RecordingRHIContext::SetViewport(const RHIViewport& viewport) {
+    m_stream.BeginCommand(RHICommandType::SetViewport);
+    m_stream.Write(viewport);
+
+    if (m_passThrough) {
+        m_passThrough->SetViewport(viewport);
+    }
+}
+
+void RecordingRHIContext::SetScissorRect(const RHIRect& rect) {
+    m_stream.BeginCommand(RHICommandType::SetScissorRect);
+    m_stream.Write(rect);
+
+    if (m_passThrough) {
+        m_passThrough->SetScissorRect(rect);
+    }
+}
+
+void RecordingRHIContext::DrawIndexed(uint32 indexCount, uint32 startIndexLocation, int32 baseVertexLocation) {
+    m_stream.BeginCommand(RHICommandType::DrawIndexed);
+    m_stream.Write(indexCount);
+    m_stream.Write(startIndexLocation);
+    m_stream.Write(baseVertexLocation);
+
+    if (m_passThrough) {
+        m_passThrough->DrawIndexed(indexCount, startIndexLocation, baseVertexLocation);
+    }
+}
+
+void RecordingRHIContext::Draw(uint32 vertexCount, uint32 startVertexLocation) {
+    m_stream.BeginCommand(RHICommandType::Draw);
+    m_stream.Write(vertexCount);
+    m_stream.Write(startVertexLocation);
+
+    if (m_passThrough) {
+        m_passThrough->Draw(vertexCount, startVertexLocation);
+    }
+}
+
+RHIGraphicsAPI RecordingRHIContext::GetAPI() const {
+    return m_passThrough ? m_passThrough->GetAPI() : RHIGraphicsAPI::Null;
+}
+
+void RecordingRHIContext::WriteShader(RHICommandType type, const RHIShader& shader) {
+    // Bytecode is identified by hash; captures stay small and still diff when shaders change
+    m_stream.BeginCommand(type);
+    m_stream.Write(ToIdentity(shader.shaderResource));
+    m_stream.Write(static_cast<uint8>(shader.type));
+    m_stream.Write(HashBytes(shader.bytecode.data(), shader.bytecode.size()));
+    m_stream.Write(static_cast<uint32>(shader.bytecode.size()));
+    m_stream.WriteString(shader.entryPoint);
+}
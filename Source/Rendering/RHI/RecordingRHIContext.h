@@ -0,0 +1,53 @@
+#pragma once
+
+#include "IRHIContext.h"
+#include "RHICommandStream.h"
+
+// IRHIContext that serializes every call into an RHICommandStream.
+// With a pass-through target the calls are forwarded after being recorded, so a
+// live frame can be captured while it renders; without one nothing is submitted.
+class RecordingRHIContext : public IRHIContext {
+public:
+    explicit RecordingRHIContext(IRHIContext* passThrough = nullptr);
+    virtual ~RecordingRHIContext() = default;
+
+    void SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) override;
+    void SetIndexBuffer(const RHIIndexBufferView& bufferView) override;
+    void SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) override;
+
+    void SetVertexShader(const RHIShader& shader) override;
+    void SetPixelShader(const RHIShader& shader) override;
+
+    void SetTexture(uint32 slot, const RHITextureView& textureView) override;
+    void SetSampler(uint32 slot, const RHISamplerView& samplerView) override;
+
+    void SetTexture(uint32 slot, void* gpuHandle) override;
+    void SetSampler(uint32 slot, void* gpuHandle) override;
+
+    void SetPrimitiveTopology(RHIPrimitiveTopology topology) override;
+    void SetViewport(const RHIViewport& viewport) override;
+    void SetScissorRect(const RHIRect& rect) override;
+
+    void DrawIndexed(uint32 indexCount, uint32 startIndexLocation = 0, int32 baseVertexLocation = 0) override;
+    void Draw(uint32 vertexCount, uint32 startVertexLocation = 0) override;
+
+    RHIGraphicsAPI GetAPI() const override;
+
+    // Recorded commands
+    RHICommandStream& GetStream() { return m_stream; }
+    const RHICommandStream& GetStream() const { return m_stream; }
+    void Reset() { m_stream.Clear(); }
+
+    IRHIContext* GetPassThrough() const { return m_passThrough; }
+
+private:
+    void WriteShader(RHICommandType type, const RHIShader& shader);
+
+    static uint64 ToIdentity(const void* pointer) { return static_cast<uint64>(reinterpret_cast<uintptr_t>(pointer)); }
+
+private:
+    RHICommandStream m_stream;
+    IRHIContext* m_passThrough = nullptr;
+
+    DECLARE_NON_COPYABLE(RecordingRHIContext);
+};
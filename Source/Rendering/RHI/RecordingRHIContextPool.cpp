@@ -0,0 +1,53 @@
+#include "RecordingRHIContextPool.h"
+#include "RHICommandReplayer.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+
+RecordingRHIContextPool::RecordingRHIContextPool(uint32 maxContextCount, IRHIContext* passThrough)
+    : m_passThrough(passThrough) {
+    // Contexts record only; forwarding happens in order once the batch is merged
+    m_contexts.resize(std::max(maxContextCount, 1u));
+    for (auto& context : m_contexts) {
+        context = std::make_unique<RecordingRHIContext>();
+    }
+}
+
+uint32 RecordingRHIContextPool::BeginRecording(uint32 requestedCount) {
+    ASSERT(!m_isRecording, "RecordingRHIContextPool: BeginRecording called twice");
+
+    m_activeCount = std::clamp(requestedCount, 1u, GetMaxContextCount());
+    for (uint32 i = 0; i < m_activeCount; ++i) {
+        m_contexts[i]->Reset();
+    }
+
+    m_isRecording = true;
+    return m_activeCount;
+}
+
+IRHIContext& RecordingRHIContextPool::GetContext(uint32 index) {
+    ASSERT(m_isRecording && index < m_activeCount, "RecordingRHIContextPool: Context index out of range");
+    return *m_contexts[index];
+}
+
+void RecordingRHIContextPool::EndRecording() {
+    ASSERT(m_isRecording, "RecordingRHIContextPool: EndRecording without BeginRecording");
+    m_isRecording = false;
+
+    for (uint32 i = 0; i < m_activeCount; ++i) {
+        const RHICommandStream& contextStream = m_contexts[i]->GetStream();
+        m_stream.Append(contextStream);
+
+        if (m_passThrough && !RHICommandReplayer::Replay(contextStream, *m_passThrough)) {
+            Platform::OutputDebugMessage("RecordingRHIContextPool: Failed to replay context " + std::to_string(i) + "\n");
+        }
+    }
+}
+
+RHIGraphicsAPI RecordingRHIContextPool::GetAPI() const {
+    return m_passThrough ? m_passThrough->GetAPI() : RHIGraphicsAPI::Null;
+}
+
+const RHICommandStream& RecordingRHIContextPool::GetContextStream(uint32 index) const {
+    ASSERT(index < m_contexts.size(), "RecordingRHIContextPool: Context index out of range");
+    return m_contexts[index]->GetStream();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "IRHIContextPool.h"
+#include "RecordingRHIContext.h"
+
+// IRHIContextPool backed by RecordingRHIContexts. EndRecording appends the per-context
+// streams to one merged stream in index order, so a parallel recording produces the
+// same stream as recording the draws serially. With a pass-through target each batch
+// is replayed into it after merging (shader bytecode is not captured, see RHICommandReplayer).
+class RecordingRHIContextPool : public IRHIContextPool {
+public:
+    explicit RecordingRHIContextPool(uint32 maxContextCount = 8, IRHIContext* passThrough = nullptr);
+    virtual ~RecordingRHIContextPool() = default;
+
+    uint32 BeginRecording(uint32 requestedCount) override;
+    IRHIContext& GetContext(uint32 index) override;
+    void EndRecording() override;
+
+    uint32 GetMaxContextCount() const override { return static_cast<uint32>(m_contexts.size()); }
+    RHIGraphicsAPI GetAPI() const override;
+
+    // Every batch merged since the last Reset
+    const RHICommandStream& GetStream() const { return m_stream; }
+    void Reset() { m_stream.Clear(); }
+
+    // Commands recorded by one context during the last batch
+    const RHICommandStream& GetContextStream(uint32 index) const;
+    uint32 GetActiveContextCount() const { return m_activeCount; }
+
+private:
+    Vector<UniquePtr<RecordingRHIContext>> m_contexts;
+    RHICommandStream m_stream;
+    IRHIContext* m_passThrough = nullptr;
+    uint32 m_activeCount = 0;
+    bool m_isRecording = false;
+
+    DECLARE_NON_COPYABLE(RecordingRHIContextPool);
+};
@@ -16,6 +16,28 @@ struct RendererConfig {
     bool vsyncEnabled = true;
     uint32 maxFramesInFlight = 2;
     uint64 gpuMemoryBudgetMB = 512;
+
+    // Texture streaming: mips up to this size stay resident, larger ones stream on demand
+    bool enableTextureStreaming = true;
+    uint64 textureStreamingBudgetMB = 256;
+    uint32 streamingResidentMipSize = 64;
+
+    // Compiled shader bytecode (see ShaderCache), relative to the working directory
+    String shaderCacheDirectory = "ShaderCache";
+
+    // Driver-compiled pipelines from earlier runs (see DX12PipelineLibrary)
+    String pipelineLibraryPath = "ShaderCache/PipelineLibrary.bin";
+
+    // Upper bound on worker command lists for parallel recording (see IRHIContextPool)
+    uint32 maxRecordingContexts = 8;
+
+    // Fewest draws worth a worker command list; smaller frames record on the main list
+    uint32 minDrawsPerRecordingContext = 64;
+
+    // Depth cleared to 0 and tested with Greater, for cameras with CameraDesc::reverseZ
+    bool reverseZ = true;
+
+    float GetDepthClearValue() const { return reverseZ ? 0.0f : 1.0f; }
 };
 
 // Clear values
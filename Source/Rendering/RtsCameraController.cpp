@@ -0,0 +1,169 @@
+#include "RtsCameraController.h"
+#include "Camera.h"
+#include "../Core/Scene/Heightfield.h"
+#include "../Core/Window/Window.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+RtsCameraController::RtsCameraController(Camera& camera, const RtsCameraDesc& desc)
+    : m_camera(camera)
+    , m_desc(desc)
+    , m_focus(desc.focus)
+    , m_yaw(desc.yaw)
+    , m_zoom(std::clamp(desc.zoom, 0.0f, 1.0f))
+    , m_targetZoom(m_zoom) {
+    ApplyToCamera();
+}
+
+void RtsCameraController::Update(float32 deltaTime) {
+    // Exponential approach: the same path whatever the frame rate
+    if (m_zoom != m_targetZoom) {
+        float32 blend = 1.0f - std::exp(-m_desc.zoomSharpness * deltaTime);
+        m_zoom += (m_targetZoom - m_zoom) * blend;
+        if (std::fabs(m_targetZoom - m_zoom) < 1.0e-4f) {
+            m_zoom = m_targetZoom;
+        }
+    }
+
+    auto held = [this](KeyCode key) { return m_keys[static_cast<uint16>(key)]; };
+
+    if (held(KeyCode::Q)) {
+        m_yaw -= m_desc.rotateSpeed * deltaTime;
+    }
+    if (held(KeyCode::E)) {
+        m_yaw += m_desc.rotateSpeed * deltaTime;
+    }
+
+    // Pan direction in screen terms: x to the right, y up the screen
+    float32 panX = 0.0f;
+    float32 panY = 0.0f;
+    if (held(KeyCode::W) || held(KeyCode::Up))    panY += 1.0f;
+    if (held(KeyCode::S) || held(KeyCode::Down))  panY -= 1.0f;
+    if (held(KeyCode::D) || held(KeyCode::Right)) panX += 1.0f;
+    if (held(KeyCode::A) || held(KeyCode::Left))  panX -= 1.0f;
+
+    if (m_hasMousePosition && m_viewportWidth > 0 && m_viewportHeight > 0) {
+        int32 margin = static_cast<int32>(m_desc.edgePanMargin);
+        if (m_mouseX < margin)                                          panX -= 1.0f;
+        if (m_mouseX >= static_cast<int32>(m_viewportWidth) - margin)   panX += 1.0f;
+        if (m_mouseY < margin)                                          panY += 1.0f;
+        if (m_mouseY >= static_cast<int32>(m_viewportHeight) - margin)  panY -= 1.0f;
+    }
+
+    float32 length = std::sqrt(panX * panX + panY * panY);
+    if (length > 0.0f) {
+        float32 step = m_desc.panSpeed * GetDistance() * deltaTime / length;
+        float32 sinYaw = std::sin(m_yaw);
+        float32 cosYaw = std::cos(m_yaw);
+        m_focus.x += (panX * cosYaw + panY * sinYaw) * step;
+        m_focus.y += (panY * cosYaw - panX * sinYaw) * step;
+    }
+
+    ClampFocus();
+    ApplyToCamera();
+}
+
+void RtsCameraController::OnKeyEvent(const KeyEvent& event) {
+    uint16 keyValue = static_cast<uint16>(event.key);
+    if (keyValue < 256) {
+        m_keys[keyValue] = event.pressed;
+    }
+}
+
+void RtsCameraController::OnMouseMoveEvent(const MouseMoveEvent& event) {
+    m_mouseX = event.x;
+    m_mouseY = event.y;
+    m_hasMousePosition = true;
+}
+
+void RtsCameraController::OnMouseWheelEvent(const MouseWheelEvent& event) {
+    // Wheel forward zooms in
+    m_targetZoom = std::clamp(m_targetZoom - event.delta * m_desc.zoomStep, 0.0f, 1.0f);
+}
+
+void RtsCameraController::SetHeightfield(const Heightfield* heightfield) {
+    m_heightfield = heightfield && heightfield->IsValid() ? heightfield : nullptr;
+    if (m_heightfield) {
+        SetBounds(m_heightfield->GetMinX(), m_heightfield->GetMinZ(), m_heightfield->GetMaxX(), m_heightfield->GetMaxZ());
+    } else {
+        ApplyToCamera();
+    }
+}
+
+void RtsCameraController::SetBounds(float32 minX, float32 minZ, float32 maxX, float32 maxZ) {
+    m_minX = minX;
+    m_minZ = minZ;
+    m_maxX = maxX;
+    m_maxZ = maxZ;
+    ClampFocus();
+    ApplyToCamera();
+}
+
+void RtsCameraController::SetViewportSize(uint32 width, uint32 height) {
+    m_viewportWidth = width;
+    m_viewportHeight = height;
+}
+
+void RtsCameraController::SetFocus(const XMFLOAT2& focus) {
+    m_focus = focus;
+    ClampFocus();
+    ApplyToCamera();
+}
+
+void RtsCameraController::SetZoom(float32 zoom) {
+    m_zoom = std::clamp(zoom, 0.0f, 1.0f);
+    m_targetZoom = m_zoom;
+    ApplyToCamera();
+}
+
+void RtsCameraController::SetYaw(float32 yaw) {
+    m_yaw = yaw;
+    ApplyToCamera();
+}
+
+float32 RtsCameraController::GetDistance() const {
+    return m_desc.minDistance + (m_desc.maxDistance - m_desc.minDistance) * std::pow(m_zoom, m_desc.zoomExponent);
+}
+
+float32 RtsCameraController::GetPitch() const {
+    return m_desc.minPitch + (m_desc.maxPitch - m_desc.minPitch) * m_zoom;
+}
+
+RtsViewParameters RtsCameraController::GetViewParameters() const {
+    RtsViewParameters parameters;
+    parameters.cullDistance = m_desc.minCullDistance + (m_desc.maxCullDistance - m_desc.minCullDistance) * m_zoom;
+    parameters.lodDistanceScale = 1.0f + (m_desc.maxLodDistanceScale - 1.0f) * m_zoom;
+    return parameters;
+}
+
+void RtsCameraController::ClampFocus() {
+    if (m_minX <= m_maxX) {
+        m_focus.x = std::clamp(m_focus.x, m_minX, m_maxX);
+    }
+    if (m_minZ <= m_maxZ) {
+        m_focus.y = std::clamp(m_focus.y, m_minZ, m_maxZ);
+    }
+}
+
+void RtsCameraController::ApplyToCamera() {
+    float32 groundHeight = m_heightfield ? m_heightfield->GetHeight(m_focus.x, m_focus.y) : 0.0f;
+    XMFLOAT3 target = { m_focus.x, groundHeight, m_focus.y };
+
+    // Back from the focus, against the view direction
+    float32 distance = GetDistance();
+    float32 pitch = GetPitch();
+    float32 horizontal = distance * std::cos(pitch);
+    XMFLOAT3 eye = {
+        target.x - std::sin(m_yaw) * horizontal,
+        target.y + distance * std::sin(pitch),
+        target.z - std::cos(m_yaw) * horizontal
+    };
+
+    // Over a ridge the eye rises and looks down more steeply rather than clipping into it
+    float32 terrainHeight = m_heightfield ? m_heightfield->GetMaxHeight(eye.x, eye.z) : 0.0f;
+    eye.y = std::max(eye.y, terrainHeight + m_desc.terrainClearance);
+
+    m_camera.LookAt(eye, target, { 0.0f, 1.0f, 0.0f });
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include <DirectXMath.h>
+
+class Camera;
+class Heightfield;
+struct KeyEvent;
+struct MouseMoveEvent;
+struct MouseWheelEvent;
+
+// RTS camera configuration. Zoom runs from 0 (closest) to 1 (farthest); distance,
+// pitch and the view parameters below all follow it.
+struct RtsCameraDesc {
+    DirectX::XMFLOAT2 focus = { 0.0f, 0.0f };   // Ground point looked at, (x, z)
+    float32 yaw = 0.0f;                         // Heading in radians; 0 looks along +z
+    float32 zoom = 0.5f;
+
+    // Zoom curve: distance = min + (max - min) * zoom^exponent, so wheel steps move
+    // less close to the ground than high above it
+    float32 minDistance = 8.0f;
+    float32 maxDistance = 120.0f;
+    float32 zoomExponent = 2.0f;
+    float32 minPitch = 0.6f;            // Radians below the horizon at zoom 0
+    float32 maxPitch = 1.2f;            // ... and at zoom 1
+    float32 zoomStep = 0.08f;           // Zoom change per wheel tick
+    float32 zoomSharpness = 12.0f;      // 1/s; the zoom closes this share of the gap per second, exponentially
+
+    // Panning, scaled by the current distance so the ground moves at the same screen speed
+    float32 panSpeed = 1.0f;            // Distances per second
+    uint32 edgePanMargin = 8;           // Pixels from the window edge that pan
+    float32 rotateSpeed = 1.5f;         // Radians per second (Q/E)
+
+    // Eye stays this far above the highest terrain around it
+    float32 terrainClearance = 2.0f;
+
+    // Zoom-linked view parameters, interpolated between zoom 0 and 1
+    float32 minCullDistance = 150.0f;
+    float32 maxCullDistance = 600.0f;
+    float32 maxLodDistanceScale = 2.0f; // 1 at zoom 0
+};
+
+// Parameters for systems that scale their work with zoom
+struct RtsViewParameters {
+    float32 cullDistance = 0.0f;        // Draws farther from the eye are skipped
+    float32 lodDistanceScale = 1.0f;    // Multiplies distances used to pick detail
+};
+
+// Drives a Camera as a top-down RTS view: edge and key panning, smoothed zoom along a
+// curve with pitch tied to it, and rotation around the focus point. The focus stays
+// inside the map bounds and the eye above the terrain.
+//
+// Terrain comes from a Heightfield, so every update costs a fixed number of lookups
+// however large the map is.
+class RtsCameraController {
+public:
+    RtsCameraController(Camera& camera, const RtsCameraDesc& desc = {});
+    ~RtsCameraController() = default;
+
+    void Update(float32 deltaTime);
+
+    // Input handling
+    void OnKeyEvent(const KeyEvent& event);
+    void OnMouseMoveEvent(const MouseMoveEvent& event);
+    void OnMouseWheelEvent(const MouseWheelEvent& event);
+
+    // Terrain to clamp against; also makes its extent the map bounds. Null keeps the
+    // eye above y = terrainClearance.
+    void SetHeightfield(const Heightfield* heightfield);
+    void SetBounds(float32 minX, float32 minZ, float32 maxX, float32 maxZ);
+    void SetViewportSize(uint32 width, uint32 height);
+
+    // Jump without smoothing
+    void SetFocus(const DirectX::XMFLOAT2& focus);
+    void SetZoom(float32 zoom);
+    void SetYaw(float32 yaw);
+
+    DirectX::XMFLOAT2 GetFocus() const { return m_focus; }
+    float32 GetZoom() const { return m_zoom; }
+    float32 GetTargetZoom() const { return m_targetZoom; }
+    float32 GetYaw() const { return m_yaw; }
+    float32 GetDistance() const;
+    float32 GetPitch() const;
+    RtsViewParameters GetViewParameters() const;
+    const RtsCameraDesc& GetDesc() const { return m_desc; }
+
+private:
+    void ClampFocus();
+
+    // Place the camera for the current focus, zoom and yaw
+    void ApplyToCamera();
+
+private:
+    Camera& m_camera;
+    const Heightfield* m_heightfield = nullptr;
+    RtsCameraDesc m_desc;
+
+    DirectX::XMFLOAT2 m_focus;
+    float32 m_yaw;
+    float32 m_zoom;
+    float32 m_targetZoom;
+
+    // Map bounds for the focus; min > max means unbounded
+    float32 m_minX = 1.0f;
+    float32 m_minZ = 1.0f;
+    float32 m_maxX = 0.0f;
+    float32 m_maxZ = 0.0f;
+
+    // Input state
+    bool m_keys[256] = {};
+    bool m_hasMousePosition = false;   // Edge panning waits for the first mouse move
+    int32 m_mouseX = 0;
+    int32 m_mouseY = 0;
+    uint32 m_viewportWidth = 0;
+    uint32 m_viewportHeight = 0;
+
+    DECLARE_NON_COPYABLE(RtsCameraController);
+};
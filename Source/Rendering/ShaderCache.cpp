@@ -0,0 +1,156 @@
+#include "ShaderCache.h"
+#include "../Core/Utilities/FileSystem.h"
+#include "../Core/Utilities/Hash.h"
+#include "../Platform/Platform.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+ShaderCache::ShaderCache(const String& cacheDirectory)
+    : m_directory(FileSystem::NormalizePath(cacheDirectory)) {
+}
+
+uint64 ShaderCache::ComputeKey(const ShaderCompileDesc& desc) {
+    uint64 key = HashCombine(FNV1A_OFFSET_BASIS, SHADER_CACHE_VERSION);
+    key = HashCombine(key, HashString(desc.source));
+    key = HashCombine(key, HashString(desc.entryPoint));
+    key = HashCombine(key, HashString(desc.target));
+    key = HashCombine(key, desc.compileFlags);
+
+    // Define order does not change the compiled result, so it must not change the key
+    Vector<const ShaderDefine*> defines;
+    defines.reserve(desc.defines.size());
+    for (const ShaderDefine& define : desc.defines) {
+        defines.push_back(&define);
+    }
+    std::sort(defines.begin(), defines.end(), [](const ShaderDefine* a, const ShaderDefine* b) {
+        return a->name != b->name ? a->name < b->name : a->value < b->value;
+    });
+    for (const ShaderDefine* define : defines) {
+        key = HashCombine(key, HashString(define->name));
+        key = HashCombine(key, HashString(define->value));
+    }
+
+    return key;
+}
+
+String ShaderCache::GetEntryFileName(uint64 key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.cso", static_cast<unsigned long long>(key));
+    return name;
+}
+
+bool ShaderCache::GetStageFromFileName(const String& filePath, String& outEntryPoint, String& outTarget) {
+    String path = FileSystem::NormalizePath(filePath);
+    std::transform(path.begin(), path.end(), path.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    auto endsWith = [&path](const char* suffix) {
+        size_t length = std::strlen(suffix);
+        return path.size() >= length && path.compare(path.size() - length, length, suffix) == 0;
+    };
+
+    if (endsWith(".vs.hlsl")) {
+        outEntryPoint = "VSMain";
+        outTarget = "vs_5_0";
+        return true;
+    }
+    if (endsWith(".ps.hlsl")) {
+        outEntryPoint = "PSMain";
+        outTarget = "ps_5_0";
+        return true;
+    }
+    return false;
+}
+
+String ShaderCache::GetEntryPath(uint64 key) const {
+    return m_directory.empty() ? GetEntryFileName(key) : m_directory + "/" + GetEntryFileName(key);
+}
+
+bool ShaderCache::Load(uint64 key, Vector<uint8>& outBytecode) {
+    Vector<uint8> fileData;
+    if (!FileSystem::ReadFile(GetEntryPath(key), fileData)) {
+        return false;
+    }
+
+    ShaderCacheFileHeader header;
+    if (fileData.size() < sizeof(header)) {
+        ++m_stats.corruptEntries;
+        return false;
+    }
+    std::memcpy(&header, fileData.data(), sizeof(header));
+
+    const uint8* bytecode = fileData.data() + sizeof(header);
+    const uint64 bytecodeSize = fileData.size() - sizeof(header);
+    if (header.magic != SHADER_CACHE_MAGIC || header.version != SHADER_CACHE_VERSION || header.key != key ||
+        header.bytecodeSize != bytecodeSize || header.bytecodeHash != HashBytes(bytecode, bytecodeSize)) {
+        Platform::OutputDebugMessage("ShaderCache: Ignoring stale or corrupt entry " + GetEntryPath(key) + "\n");
+        ++m_stats.corruptEntries;
+        return false;
+    }
+
+    outBytecode.assign(bytecode, bytecode + bytecodeSize);
+    return true;
+}
+
+bool ShaderCache::Store(uint64 key, const Vector<uint8>& bytecode) {
+    std::error_code error;
+    if (!m_directory.empty()) {
+        std::filesystem::create_directories(m_directory, error);
+    }
+
+    ShaderCacheFileHeader header;
+    header.key = key;
+    header.bytecodeSize = bytecode.size();
+    header.bytecodeHash = HashBytes(bytecode.data(), bytecode.size());
+
+    // Write to a temporary file first so a crash never leaves a truncated entry behind
+    const String path = GetEntryPath(key);
+    const String tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            Platform::OutputDebugMessage("ShaderCache: Failed to write " + tempPath + "\n");
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(bytecode.data()), static_cast<std::streamsize>(bytecode.size()));
+        if (!file.good()) {
+            Platform::OutputDebugMessage("ShaderCache: Failed to write " + tempPath + "\n");
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, path, error);
+    if (error) {
+        Platform::OutputDebugMessage("ShaderCache: Failed to move " + tempPath + " into place\n");
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    return true;
+}
+
+bool ShaderCache::GetOrCompile(const ShaderCompileDesc& desc, const CompileFunction& compile, Vector<uint8>& outBytecode) {
+    const uint64 key = ComputeKey(desc);
+    if (Load(key, outBytecode)) {
+        ++m_stats.hits;
+        return true;
+    }
+
+    ++m_stats.misses;
+    if (!compile || !compile(desc, outBytecode)) {
+        ++m_stats.compileFailures;
+        return false;
+    }
+
+    Platform::OutputDebugMessage("ShaderCache: Compiled " + desc.sourcePath + " (" + desc.entryPoint + ", " +
+                                 desc.target + ") into " + GetEntryFileName(key) + "\n");
+
+    // A failed store only costs a recompile next launch
+    Store(key, outBytecode);
+    return true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+
+// Bump when the key derivation or the compiler setup changes in a way the key does not capture
+constexpr uint32 SHADER_CACHE_VERSION = 1;
+constexpr uint32 SHADER_CACHE_MAGIC = 0x43444853; // "SHDC"
+
+struct ShaderDefine {
+    String name;
+    String value;
+};
+
+// Everything that affects the compiled bytecode
+struct ShaderCompileDesc {
+    String sourcePath;          // For diagnostics only; the key uses the source contents
+    String source;
+    String entryPoint;
+    String target;              // e.g. "vs_5_0"
+    Vector<ShaderDefine> defines;
+    uint32 compileFlags = 0;
+};
+
+struct ShaderCacheStats {
+    uint32 hits = 0;
+    uint32 misses = 0;
+    uint32 compileFailures = 0;
+    uint32 corruptEntries = 0;
+};
+
+#pragma pack(push, 1)
+struct ShaderCacheFileHeader {
+    uint32 magic = SHADER_CACHE_MAGIC;
+    uint32 version = SHADER_CACHE_VERSION;
+    uint64 key = 0;
+    uint64 bytecodeHash = 0;
+    uint64 bytecodeSize = 0;
+};
+#pragma pack(pop)
+
+// Content-addressed store of compiled shader bytecode, one file per key in the cache
+// directory. Platform neutral: the actual compiler is supplied by the caller
+// (DX12ShaderCompiler on Windows), so the same cache is filled offline by
+// Tools/ShaderCompiler and read at startup by the renderer.
+class ShaderCache {
+public:
+    using CompileFunction = Function<bool(const ShaderCompileDesc& desc, Vector<uint8>& outBytecode)>;
+
+    explicit ShaderCache(const String& cacheDirectory);
+    ~ShaderCache() = default;
+
+    // Key over source contents, entry point, target, defines (order independent) and flags
+    static uint64 ComputeKey(const ShaderCompileDesc& desc);
+    static String GetEntryFileName(uint64 key);
+
+    // Stage from the Shaders/ naming convention: "*.vs.hlsl" -> VSMain/vs_5_0, "*.ps.hlsl" -> PSMain/ps_5_0
+    static bool GetStageFromFileName(const String& filePath, String& outEntryPoint, String& outTarget);
+
+    bool Load(uint64 key, Vector<uint8>& outBytecode);
+    bool Store(uint64 key, const Vector<uint8>& bytecode);
+
+    // Cached bytecode if present, otherwise compile and store the result
+    bool GetOrCompile(const ShaderCompileDesc& desc, const CompileFunction& compile, Vector<uint8>& outBytecode);
+
+    // Accessors
+    const String& GetDirectory() const { return m_directory; }
+    const ShaderCacheStats& GetStats() const { return m_stats; }
+
+private:
+    String GetEntryPath(uint64 key) const;
+
+private:
+    String m_directory;
+    ShaderCacheStats m_stats;
+
+    DECLARE_NON_COPYABLE(ShaderCache);
+};
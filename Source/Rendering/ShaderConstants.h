@@ -0,0 +1,32 @@
+#pragma once
+
+#include <DirectXMath.h>
+
+// CPU mirrors of the cbuffers in Shaders/*.hlsl. Matrices are stored transposed, as
+// HLSL reads them column-major; shared by the DX12 renderer and the software rasterizer.
+struct ModelConstants {
+    DirectX::XMMATRIX modelMatrix;
+    DirectX::XMMATRIX normalMatrix;
+};
+
+struct ViewConstants {
+    DirectX::XMMATRIX viewMatrix;
+    DirectX::XMMATRIX projectionMatrix;
+    DirectX::XMMATRIX viewProjectionMatrix;
+    DirectX::XMFLOAT3 cameraPosition;
+    float padding;
+};
+
+struct LightConstants {
+    DirectX::XMFLOAT3 lightPosition;
+    float lightIntensity;
+    DirectX::XMFLOAT3 lightColor;
+    float padding;
+};
+
+struct MaterialConstants {
+    DirectX::XMFLOAT3 baseColor;
+    float metallic;
+    float roughness;
+    float padding[3];
+};
@@ -0,0 +1,80 @@
+#include "SoftwareFrameBuffer.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <fstream>
+
+bool SoftwareFrameBuffer::Resize(uint32 width, uint32 height) {
+    if (width == 0 || height == 0) {
+        Platform::OutputDebugMessage("SoftwareFrameBuffer: Invalid size\n");
+        return false;
+    }
+
+    m_width = width;
+    m_height = height;
+    m_color.assign(static_cast<size_t>(width) * height, 0);
+    m_depth.assign(static_cast<size_t>(width) * height, 1.0f);
+    return true;
+}
+
+void SoftwareFrameBuffer::Clear(const DirectX::XMFLOAT4& color, float depth) {
+    std::fill(m_color.begin(), m_color.end(), PackColor(color));
+    std::fill(m_depth.begin(), m_depth.end(), depth);
+}
+
+uint32 SoftwareFrameBuffer::PackColor(const DirectX::XMFLOAT4& color) {
+    auto toByte = [](float value) {
+        return static_cast<uint32>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    return toByte(color.x) | (toByte(color.y) << 8) | (toByte(color.z) << 16) | (toByte(color.w) << 24);
+}
+
+bool SoftwareFrameBuffer::SaveToBMP(const String& filePath) const {
+    if (m_color.empty()) {
+        return false;
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        Platform::OutputDebugMessage("SoftwareFrameBuffer: Failed to create " + filePath + "\n");
+        return false;
+    }
+
+    // Rows are padded to 4 bytes and stored bottom-up as BGR
+    uint32 rowSize = (m_width * 3 + 3) & ~3u;
+    uint32 imageSize = rowSize * m_height;
+
+    auto write16 = [&file](uint16 value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    auto write32 = [&file](uint32 value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+    // BITMAPFILEHEADER
+    write16(0x4D42); // "BM"
+    write32(14 + 40 + imageSize);
+    write32(0);
+    write32(14 + 40);
+
+    // BITMAPINFOHEADER
+    write32(40);
+    write32(m_width);
+    write32(m_height);
+    write16(1);
+    write16(24);
+    write32(0);
+    write32(imageSize);
+    write32(2835); // 72 DPI
+    write32(2835);
+    write32(0);
+    write32(0);
+
+    Vector<uint8> row(rowSize, 0);
+    for (uint32 y = 0; y < m_height; ++y) {
+        const uint32* source = &m_color[static_cast<size_t>(m_height - 1 - y) * m_width];
+        for (uint32 x = 0; x < m_width; ++x) {
+            row[x * 3 + 0] = static_cast<uint8>(source[x] >> 16);
+            row[x * 3 + 1] = static_cast<uint8>(source[x] >> 8);
+            row[x * 3 + 2] = static_cast<uint8>(source[x]);
+        }
+        file.write(reinterpret_cast<const char*>(row.data()), rowSize);
+    }
+
+    return file.good();
+}
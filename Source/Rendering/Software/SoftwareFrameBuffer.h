@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../../Core/Utilities/Types.h"
+#include <DirectXMath.h>
+
+// Color (RGBA8, R in the low byte) and depth (float) targets for the software rasterizer.
+// Rows are stored top to bottom.
+class SoftwareFrameBuffer {
+public:
+    SoftwareFrameBuffer() = default;
+    ~SoftwareFrameBuffer() = default;
+
+    bool Resize(uint32 width, uint32 height);
+    void Clear(const DirectX::XMFLOAT4& color, float depth = 1.0f);
+
+    // 24-bit uncompressed BMP
+    bool SaveToBMP(const String& filePath) const;
+
+    static uint32 PackColor(const DirectX::XMFLOAT4& color);
+
+    // Accessors
+    uint32 GetWidth() const { return m_width; }
+    uint32 GetHeight() const { return m_height; }
+    uint32* GetColorData() { return m_color.data(); }
+    const uint32* GetColorData() const { return m_color.data(); }
+    float* GetDepthData() { return m_depth.data(); }
+    const float* GetDepthData() const { return m_depth.data(); }
+    uint32 GetPixel(uint32 x, uint32 y) const { return m_color[static_cast<size_t>(y) * m_width + x]; }
+
+private:
+    uint32 m_width = 0;
+    uint32 m_height = 0;
+    Vector<uint32> m_color;
+    Vector<float> m_depth;
+
+    DECLARE_NON_COPYABLE(SoftwareFrameBuffer);
+};
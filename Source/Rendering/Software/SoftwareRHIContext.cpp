@@ -0,0 +1,179 @@
+#include "SoftwareRHIContext.h"
+#include "../../Core/Threading/JobSystem.h"
+#include "../../Platform/Platform.h"
+#include <algorithm>
+#include <cstring>
+
+SoftwareRHIContext::SoftwareRHIContext(JobSystem& jobSystem)
+    : m_jobSystem(jobSystem) {
+}
+
+bool SoftwareRHIContext::Initialize(uint32 width, uint32 height) {
+    if (!m_frameBuffer.Resize(width, height)) {
+        return false;
+    }
+
+    m_rasterizer.SetTarget(&m_frameBuffer);
+    return true;
+}
+
+void SoftwareRHIContext::SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) {
+    if (slot == 0) {
+        m_vertexBuffer = bufferView;
+    }
+}
+
+void SoftwareRHIContext::SetIndexBuffer(const RHIIndexBufferView& bufferView) {
+    m_indexBuffer = bufferView;
+}
+
+void SoftwareRHIContext::SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) {
+    if (rootParameterIndex < RootParameterCount) {
+        m_constantBuffers[rootParameterIndex] = reinterpret_cast<const uint8*>(static_cast<uintptr_t>(bufferView.bufferLocation));
+    }
+}
+
+void SoftwareRHIContext::SetViewport(const RHIViewport& viewport) {
+    m_rasterizer.SetViewport(viewport);
+}
+
+void SoftwareRHIContext::SetScissorRect(const RHIRect& rect) {
+    m_rasterizer.SetScissorRect(rect);
+}
+
+void SoftwareRHIContext::DrawIndexed(uint32 indexCount, uint32 startIndexLocation, int32 baseVertexLocation) {
+    if (!ValidateDrawState()) {
+        return;
+    }
+
+    const uint8* indexData = reinterpret_cast<const uint8*>(static_cast<uintptr_t>(m_indexBuffer.bufferLocation));
+    uint32 indexSize = m_indexBuffer.format == RHIResourceFormat::R16_Uint ? 2 : 4;
+    if (!indexData || (m_indexBuffer.format != RHIResourceFormat::R16_Uint && m_indexBuffer.format != RHIResourceFormat::R32_Uint) ||
+        (static_cast<uint64>(startIndexLocation) + indexCount) * indexSize > m_indexBuffer.sizeInBytes) {
+        Platform::OutputDebugMessage("SoftwareRHIContext: DrawIndexed outside the bound index buffer\n");
+        return;
+    }
+
+    m_drawIndices.resize(indexCount);
+    for (uint32 i = 0; i < indexCount; ++i) {
+        uint32 index = 0;
+        if (indexSize == 2) {
+            uint16 index16 = 0;
+            std::memcpy(&index16, indexData + (static_cast<size_t>(startIndexLocation) + i) * 2, sizeof(index16));
+            index = index16;
+        } else {
+            std::memcpy(&index, indexData + (static_cast<size_t>(startIndexLocation) + i) * 4, sizeof(index));
+        }
+        m_drawIndices[i] = static_cast<uint32>(static_cast<int64>(index) + baseVertexLocation);
+    }
+
+    SubmitDraw(m_drawIndices.data(), indexCount);
+}
+
+void SoftwareRHIContext::Draw(uint32 vertexCount, uint32 startVertexLocation) {
+    if (!ValidateDrawState()) {
+        return;
+    }
+
+    m_drawIndices.resize(vertexCount);
+    for (uint32 i = 0; i < vertexCount; ++i) {
+        m_drawIndices[i] = startVertexLocation + i;
+    }
+
+    SubmitDraw(m_drawIndices.data(), vertexCount);
+}
+
+void SoftwareRHIContext::Clear(const DirectX::XMFLOAT4& color, float depth) {
+    // Pending draws belong to the previous contents
+    Flush();
+    m_frameBuffer.Clear(color, depth);
+}
+
+void SoftwareRHIContext::Flush() {
+    m_rasterizer.Flush(m_jobSystem);
+}
+
+bool SoftwareRHIContext::ValidateDrawState() {
+    bool hasConstants = std::all_of(std::begin(m_constantBuffers), std::end(m_constantBuffers),
+                                    [](const uint8* buffer) { return buffer != nullptr; });
+    bool hasVertices = m_vertexBuffer.bufferLocation != 0 && m_vertexBuffer.strideInBytes >= sizeof(Vertex);
+    bool isTriangles = m_topology == RHIPrimitiveTopology::TriangleList || m_topology == RHIPrimitiveTopology::TriangleStrip;
+
+    if (hasConstants && hasVertices && isTriangles) {
+        return true;
+    }
+
+    // Once per context, a skipped draw is expected to repeat every frame
+    if (!m_reportedUnsupported) {
+        Platform::OutputDebugMessage("SoftwareRHIContext: Skipping draw (needs constant buffers 0-3, a Vertex-layout "
+                                     "vertex buffer and triangle topology)\n");
+        m_reportedUnsupported = true;
+    }
+    return false;
+}
+
+void SoftwareRHIContext::SubmitDraw(const uint32* indices, uint32 indexCount) {
+    if (indexCount < 3) {
+        return;
+    }
+
+    // Strips are expanded into a list, flipping every other triangle to keep the winding
+    if (m_topology == RHIPrimitiveTopology::TriangleStrip) {
+        Vector<uint32> strip(indices, indices + indexCount);
+        m_drawIndices.clear();
+        for (uint32 i = 0; i + 2 < indexCount; ++i) {
+            bool isOdd = (i & 1) != 0;
+            m_drawIndices.push_back(strip[i]);
+            m_drawIndices.push_back(strip[isOdd ? i + 2 : i + 1]);
+            m_drawIndices.push_back(strip[isOdd ? i + 1 : i + 2]);
+        }
+        indices = m_drawIndices.data();
+        indexCount = static_cast<uint32>(m_drawIndices.size());
+    }
+
+    const auto [minIt, maxIt] = std::minmax_element(indices, indices + indexCount);
+    uint32 firstVertex = *minIt;
+    uint32 lastVertex = *maxIt;
+
+    uint32 vertexBufferCount = m_vertexBuffer.sizeInBytes / m_vertexBuffer.strideInBytes;
+    if (lastVertex >= vertexBufferCount) {
+        Platform::OutputDebugMessage("SoftwareRHIContext: Draw references vertices outside the bound vertex buffer\n");
+        return;
+    }
+
+    // Constant buffers may be unaligned host memory; copy before XMMATRIX loads
+    ModelConstants model;
+    ViewConstants view;
+    LightConstants light;
+    MaterialConstants material;
+    std::memcpy(&model, m_constantBuffers[ModelConstantsSlot], sizeof(model));
+    std::memcpy(&view, m_constantBuffers[ViewConstantsSlot], sizeof(view));
+    std::memcpy(&light, m_constantBuffers[LightConstantsSlot], sizeof(light));
+    std::memcpy(&material, m_constantBuffers[MaterialConstantsSlot], sizeof(material));
+
+    // Vertex shader over the referenced range only
+    const uint8* vertexData = reinterpret_cast<const uint8*>(static_cast<uintptr_t>(m_vertexBuffer.bufferLocation));
+    uint32 vertexCount = lastVertex - firstVertex + 1;
+    m_shadedVertices.resize(vertexCount);
+
+    BasicMeshVertexShader vertexShader(model, view);
+    for (uint32 i = 0; i < vertexCount; ++i) {
+        Vertex vertex;
+        std::memcpy(&vertex, vertexData + static_cast<size_t>(firstVertex + i) * m_vertexBuffer.strideInBytes, sizeof(vertex));
+        vertexShader(vertex, m_shadedVertices[i]);
+    }
+
+    // Rebase onto the shaded range
+    Vector<uint32>& localIndices = m_drawIndices;
+    if (indices != localIndices.data()) {
+        localIndices.assign(indices, indices + indexCount);
+    }
+    for (uint32& index : localIndices) {
+        index -= firstVertex;
+    }
+
+    BasicMeshPixelShader pixelShader(light, material);
+    m_rasterizer.SubmitTriangles(m_shadedVertices.data(), vertexCount, localIndices.data(), indexCount,
+                                 BasicMeshVaryings::Count,
+                                 [pixelShader](const float* varyings) { return pixelShader(varyings); });
+}
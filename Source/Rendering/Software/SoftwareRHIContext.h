@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../RHI/IRHIContext.h"
+#include "SoftwareFrameBuffer.h"
+#include "SoftwareRasterizer.h"
+
+class JobSystem;
+
+// CPU IRHIContext that draws with the BasicMesh shaders (see SoftwareShaders.h), for
+// GPU-less validation and as a reference image. Buffer views are read through host
+// memory: bufferLocation is the CPU address of the data, and constant buffers use the
+// basic mesh root signature slots (0 model, 1 view, 2 light, 3 material). Vertex
+// buffers must use the Vertex layout. Shader and texture bindings are ignored.
+//
+// Draws are transformed and binned immediately; pixels are written on Flush.
+class SoftwareRHIContext : public IRHIContext {
+public:
+    enum RootParameter : uint32 {
+        ModelConstantsSlot = 0,
+        ViewConstantsSlot = 1,
+        LightConstantsSlot = 2,
+        MaterialConstantsSlot = 3,
+        RootParameterCount
+    };
+
+    explicit SoftwareRHIContext(JobSystem& jobSystem);
+    virtual ~SoftwareRHIContext() = default;
+
+    bool Initialize(uint32 width, uint32 height);
+
+    void SetVertexBuffer(uint32 slot, const RHIVertexBufferView& bufferView) override;
+    void SetIndexBuffer(const RHIIndexBufferView& bufferView) override;
+    void SetConstantBuffer(uint32 rootParameterIndex, const RHIConstantBufferView& bufferView) override;
+
+    void SetVertexShader(const RHIShader& shader) override {}
+    void SetPixelShader(const RHIShader& shader) override {}
+
+    void SetTexture(uint32 slot, const RHITextureView& textureView) override {}
+    void SetSampler(uint32 slot, const RHISamplerView& samplerView) override {}
+    void SetTexture(uint32 slot, void* gpuHandle) override {}
+    void SetSampler(uint32 slot, void* gpuHandle) override {}
+
+    void SetPrimitiveTopology(RHIPrimitiveTopology topology) override { m_topology = topology; }
+    void SetViewport(const RHIViewport& viewport) override;
+    void SetScissorRect(const RHIRect& rect) override;
+
+    void DrawIndexed(uint32 indexCount, uint32 startIndexLocation = 0, int32 baseVertexLocation = 0) override;
+    void Draw(uint32 vertexCount, uint32 startVertexLocation = 0) override;
+
+    RHIGraphicsAPI GetAPI() const override { return RHIGraphicsAPI::Software; }
+
+    // Frame control
+    void Clear(const DirectX::XMFLOAT4& color, float depth = 1.0f);
+    void Flush();
+
+    // Accessors
+    SoftwareFrameBuffer& GetFrameBuffer() { return m_frameBuffer; }
+    const SoftwareFrameBuffer& GetFrameBuffer() const { return m_frameBuffer; }
+    SoftwareRasterizer& GetRasterizer() { return m_rasterizer; }
+    const SoftwareRasterStats& GetStats() const { return m_rasterizer.GetStats(); }
+
+private:
+    // Runs the vertex shader over the referenced vertex range and submits triangles;
+    // indices are absolute vertex indices into the bound vertex buffer
+    void SubmitDraw(const uint32* indices, uint32 indexCount);
+    bool ValidateDrawState();
+
+private:
+    JobSystem& m_jobSystem;
+    SoftwareFrameBuffer m_frameBuffer;
+    SoftwareRasterizer m_rasterizer;
+
+    // Bound state
+    RHIVertexBufferView m_vertexBuffer;
+    RHIIndexBufferView m_indexBuffer;
+    const uint8* m_constantBuffers[RootParameterCount] = {};
+    RHIPrimitiveTopology m_topology = RHIPrimitiveTopology::TriangleList;
+
+    // Per-draw scratch
+    Vector<uint32> m_drawIndices;
+    Vector<SoftwareVertexOutput> m_shadedVertices;
+    bool m_reportedUnsupported = false;
+
+    DECLARE_NON_COPYABLE(SoftwareRHIContext);
+};
@@ -0,0 +1,452 @@
+#include "SoftwareRasterizer.h"
+#include "SoftwareFrameBuffer.h"
+#include "../../Core/Threading/JobSystem.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SOFTWARE_RASTER_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define SOFTWARE_RASTER_SSE2 0
+#endif
+
+namespace {
+    constexpr uint32 INVALID_VERTEX = ~0u;
+
+    // D3D snaps vertices to 1/256 pixel before rasterization
+    constexpr float SUBPIXEL_SCALE = 256.0f;
+
+    // Clip-space outcodes; near is z < 0 (D3D depth range)
+    constexpr uint32 CLIP_LEFT = 1 << 0;
+    constexpr uint32 CLIP_RIGHT = 1 << 1;
+    constexpr uint32 CLIP_BOTTOM = 1 << 2;
+    constexpr uint32 CLIP_TOP = 1 << 3;
+    constexpr uint32 CLIP_NEAR = 1 << 4;
+    constexpr uint32 CLIP_FAR = 1 << 5;
+
+    uint32 ComputeOutcode(const DirectX::XMFLOAT4& position) {
+        uint32 code = 0;
+        if (position.x < -position.w) code |= CLIP_LEFT;
+        if (position.x > position.w)  code |= CLIP_RIGHT;
+        if (position.y < -position.w) code |= CLIP_BOTTOM;
+        if (position.y > position.w)  code |= CLIP_TOP;
+        if (position.z < 0.0f)        code |= CLIP_NEAR;
+        if (position.z > position.w)  code |= CLIP_FAR;
+        return code;
+    }
+
+    float SnapToSubpixel(float value) {
+        return std::floor(value * SUBPIXEL_SCALE + 0.5f) / SUBPIXEL_SCALE;
+    }
+
+    SoftwareVertexOutput LerpVertex(const SoftwareVertexOutput& a, const SoftwareVertexOutput& b, float t, uint32 varyingCount) {
+        SoftwareVertexOutput result;
+        result.position.x = a.position.x + (b.position.x - a.position.x) * t;
+        result.position.y = a.position.y + (b.position.y - a.position.y) * t;
+        result.position.z = a.position.z + (b.position.z - a.position.z) * t;
+        result.position.w = a.position.w + (b.position.w - a.position.w) * t;
+        for (uint32 i = 0; i < varyingCount; ++i) {
+            result.varyings[i] = a.varyings[i] + (b.varyings[i] - a.varyings[i]) * t;
+        }
+        return result;
+    }
+
+    // Covered-lane mask and barycentrics for pixels (x .. x+3, y).
+    // rowTerm[i] is edgeB[i] * (py - edgeOriginY[i]), shared by the whole row.
+    template<typename Triangle>
+    uint32 EvaluateEdges4(const Triangle& triangle, float px, const float rowTerm[3], float outWeights[3][4]) {
+#if SOFTWARE_RASTER_SSE2
+        const __m128 pixelX = _mm_add_ps(_mm_set1_ps(px), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 invArea = _mm_set1_ps(triangle.invArea);
+        __m128 covered = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+        for (uint32 i = 0; i < 3; ++i) {
+            __m128 edge = _mm_mul_ps(_mm_set1_ps(triangle.edgeA[i]), _mm_sub_ps(pixelX, _mm_set1_ps(triangle.edgeOriginX[i])));
+            edge = _mm_add_ps(edge, _mm_set1_ps(rowTerm[i]));
+            edge = _mm_mul_ps(edge, _mm_set1_ps(triangle.edgeSign[i]));
+
+            // Top-left rule: pixels exactly on an edge belong to its top or left triangle
+            __m128 inside = _mm_cmpgt_ps(edge, zero);
+            if (triangle.edgeTopLeft[i]) {
+                inside = _mm_or_ps(inside, _mm_cmpeq_ps(edge, zero));
+            }
+            covered = _mm_and_ps(covered, inside);
+
+            _mm_storeu_ps(outWeights[i], _mm_mul_ps(edge, invArea));
+        }
+
+        return static_cast<uint32>(_mm_movemask_ps(covered));
+#else
+        uint32 covered = 0xF;
+        for (uint32 i = 0; i < 3; ++i) {
+            for (uint32 lane = 0; lane < 4; ++lane) {
+                float edge = triangle.edgeA[i] * ((px + static_cast<float>(lane)) - triangle.edgeOriginX[i]);
+                edge = (edge + rowTerm[i]) * triangle.edgeSign[i];
+
+                bool inside = edge > 0.0f || (edge == 0.0f && triangle.edgeTopLeft[i]);
+                if (!inside) {
+                    covered &= ~(1u << lane);
+                }
+                outWeights[i][lane] = edge * triangle.invArea;
+            }
+        }
+        return covered;
+#endif
+    }
+}
+
+void SoftwareRasterizer::SetTarget(SoftwareFrameBuffer* target) {
+    ClearQueue();
+    m_target = target;
+
+    uint32 width = target ? target->GetWidth() : 0;
+    uint32 height = target ? target->GetHeight() : 0;
+
+    m_viewport = {};
+    m_viewport.width = static_cast<float>(width);
+    m_viewport.height = static_cast<float>(height);
+    m_scissor = { 0, 0, static_cast<int32>(width), static_cast<int32>(height) };
+
+    m_tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    m_tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    m_tileBins.resize(static_cast<size_t>(m_tilesX) * m_tilesY);
+}
+
+void SoftwareRasterizer::SetViewport(const RHIViewport& viewport) {
+    m_viewport = viewport;
+}
+
+void SoftwareRasterizer::SetScissorRect(const RHIRect& rect) {
+    m_scissor = rect;
+}
+
+void SoftwareRasterizer::SubmitTriangles(const SoftwareVertexOutput* vertices, uint32 vertexCount,
+                                         const uint32* indices, uint32 indexCount,
+                                         uint32 varyingCount, const SoftwarePixelShader& pixelShader) {
+    if (!m_target || !vertices || !indices || indexCount < 3) {
+        return;
+    }
+
+    varyingCount = std::min(varyingCount, SOFTWARE_MAX_VARYINGS);
+
+    DrawState draw;
+    draw.pixelShader = pixelShader;
+    draw.varyingCount = varyingCount;
+    draw.minDepth = m_viewport.minDepth;
+    draw.depthRange = m_viewport.maxDepth - m_viewport.minDepth;
+    m_draws.push_back(std::move(draw));
+    uint32 drawIndex = static_cast<uint32>(m_draws.size() - 1);
+
+    // Vertices in front of the near plane are set up once and shared by their triangles
+    m_vertexRemap.assign(vertexCount, INVALID_VERTEX);
+    for (uint32 i = 0; i < vertexCount; ++i) {
+        if (vertices[i].position.z >= 0.0f && vertices[i].position.w > 0.0f) {
+            m_vertexRemap[i] = AddSetupVertex(vertices[i], varyingCount);
+        }
+    }
+
+    for (uint32 i = 0; i + 2 < indexCount; i += 3) {
+        ++m_stats.trianglesSubmitted;
+
+        uint32 i0 = indices[i];
+        uint32 i1 = indices[i + 1];
+        uint32 i2 = indices[i + 2];
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+            ++m_stats.trianglesCulled;
+            continue;
+        }
+
+        uint32 code0 = ComputeOutcode(vertices[i0].position);
+        uint32 code1 = ComputeOutcode(vertices[i1].position);
+        uint32 code2 = ComputeOutcode(vertices[i2].position);
+
+        // Entirely outside one frustum plane
+        if (code0 & code1 & code2) {
+            ++m_stats.trianglesCulled;
+            continue;
+        }
+
+        if ((code0 | code1 | code2) & CLIP_NEAR) {
+            const SoftwareVertexOutput* triangle[3] = { &vertices[i0], &vertices[i1], &vertices[i2] };
+            ClipAndSetupTriangle(triangle, varyingCount, drawIndex);
+        } else if (m_vertexRemap[i0] == INVALID_VERTEX || m_vertexRemap[i1] == INVALID_VERTEX ||
+                   m_vertexRemap[i2] == INVALID_VERTEX) {
+            // Degenerate w <= 0 without crossing the near plane
+            ++m_stats.trianglesCulled;
+        } else {
+            AddTriangle(m_vertexRemap[i0], m_vertexRemap[i1], m_vertexRemap[i2], drawIndex);
+        }
+    }
+}
+
+uint32 SoftwareRasterizer::AddSetupVertex(const SoftwareVertexOutput& vertex, uint32 varyingCount) {
+    SetupVertex setup;
+    setup.invW = 1.0f / vertex.position.w;
+
+    float ndcX = vertex.position.x * setup.invW;
+    float ndcY = vertex.position.y * setup.invW;
+    setup.x = SnapToSubpixel(m_viewport.x + (ndcX * 0.5f + 0.5f) * m_viewport.width);
+    setup.y = SnapToSubpixel(m_viewport.y + (0.5f - ndcY * 0.5f) * m_viewport.height);
+    setup.z = vertex.position.z * setup.invW;
+
+    for (uint32 i = 0; i < varyingCount; ++i) {
+        setup.varyings[i] = vertex.varyings[i] * setup.invW;
+    }
+
+    m_vertices.push_back(setup);
+    return static_cast<uint32>(m_vertices.size() - 1);
+}
+
+void SoftwareRasterizer::ClipAndSetupTriangle(const SoftwareVertexOutput* triangle[3], uint32 varyingCount, uint32 drawIndex) {
+    // Sutherland-Hodgman against z >= 0; a triangle becomes at most a quad
+    SoftwareVertexOutput clipped[4];
+    uint32 clippedCount = 0;
+
+    for (uint32 i = 0; i < 3; ++i) {
+        const SoftwareVertexOutput& current = *triangle[i];
+        const SoftwareVertexOutput& next = *triangle[(i + 1) % 3];
+        bool currentInside = current.position.z >= 0.0f;
+        bool nextInside = next.position.z >= 0.0f;
+
+        if (currentInside) {
+            clipped[clippedCount++] = current;
+        }
+        if (currentInside != nextInside) {
+            float t = current.position.z / (current.position.z - next.position.z);
+            clipped[clippedCount++] = LerpVertex(current, next, t, varyingCount);
+        }
+    }
+
+    if (clippedCount < 3) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+
+    uint32 setupIndices[4];
+    for (uint32 i = 0; i < clippedCount; ++i) {
+        setupIndices[i] = AddSetupVertex(clipped[i], varyingCount);
+    }
+
+    // Fan keeps the original winding
+    for (uint32 i = 1; i + 1 < clippedCount; ++i) {
+        AddTriangle(setupIndices[0], setupIndices[i], setupIndices[i + 1], drawIndex);
+    }
+}
+
+void SoftwareRasterizer::AddTriangle(uint32 i0, uint32 i1, uint32 i2, uint32 drawIndex) {
+    uint32 indices[3] = { i0, i1, i2 };
+    const SetupVertex* v[3] = { &m_vertices[i0], &m_vertices[i1], &m_vertices[i2] };
+
+    // Positive area is clockwise on screen (y down), i.e. a back face
+    float area = (v[1]->x - v[0]->x) * (v[2]->y - v[0]->y) - (v[1]->y - v[0]->y) * (v[2]->x - v[0]->x);
+    bool isFrontFace = area < 0.0f;
+
+    if (area == 0.0f ||
+        (m_cullMode == SoftwareCullMode::Back && !isFrontFace) ||
+        (m_cullMode == SoftwareCullMode::Front && isFrontFace)) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+
+    // Edge functions below assume positive area
+    if (area < 0.0f) {
+        std::swap(indices[1], indices[2]);
+        std::swap(v[1], v[2]);
+        area = -area;
+    }
+
+    // Bounding box of covered pixel centers, clipped to scissor and target
+    float minXf = std::min({ v[0]->x, v[1]->x, v[2]->x });
+    float maxXf = std::max({ v[0]->x, v[1]->x, v[2]->x });
+    float minYf = std::min({ v[0]->y, v[1]->y, v[2]->y });
+    float maxYf = std::max({ v[0]->y, v[1]->y, v[2]->y });
+
+    int32 clipMinX = std::max(m_scissor.left, 0);
+    int32 clipMinY = std::max(m_scissor.top, 0);
+    int32 clipMaxX = std::min(m_scissor.right, static_cast<int32>(m_target->GetWidth())) - 1;
+    int32 clipMaxY = std::min(m_scissor.bottom, static_cast<int32>(m_target->GetHeight())) - 1;
+
+    // Clamp in float first, off-screen coordinates can exceed int32
+    auto clampToInt = [](float value, int32 low, int32 high) {
+        return static_cast<int32>(std::clamp(value, static_cast<float>(low), static_cast<float>(high)));
+    };
+
+    SetupTriangle triangle;
+    triangle.minX = clampToInt(std::ceil(minXf - 0.5f), clipMinX, clipMaxX + 1);
+    triangle.maxX = clampToInt(std::floor(maxXf - 0.5f), clipMinX - 1, clipMaxX);
+    triangle.minY = clampToInt(std::ceil(minYf - 0.5f), clipMinY, clipMaxY + 1);
+    triangle.maxY = clampToInt(std::floor(maxYf - 0.5f), clipMinY - 1, clipMaxY);
+
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) {
+        ++m_stats.trianglesCulled;
+        return;
+    }
+
+    for (uint32 i = 0; i < 3; ++i) {
+        const SetupVertex* a = v[(i + 1) % 3];
+        const SetupVertex* b = v[(i + 2) % 3];
+
+        // Top edges run left to right, left edges run upwards (clockwise in y-down space)
+        triangle.edgeTopLeft[i] = (a->y == b->y && b->x > a->x) || (b->y < a->y);
+
+        // Canonical endpoint order makes the shared edge of two triangles bit-exact opposites
+        bool swapped = (b->y < a->y) || (b->y == a->y && b->x < a->x);
+        const SetupVertex* low = swapped ? b : a;
+        const SetupVertex* high = swapped ? a : b;
+
+        triangle.edgeA[i] = low->y - high->y;
+        triangle.edgeB[i] = high->x - low->x;
+        triangle.edgeOriginX[i] = low->x;
+        triangle.edgeOriginY[i] = low->y;
+        triangle.edgeSign[i] = swapped ? -1.0f : 1.0f;
+    }
+
+    triangle.invArea = 1.0f / area;
+    triangle.vertices[0] = indices[0];
+    triangle.vertices[1] = indices[1];
+    triangle.vertices[2] = indices[2];
+    triangle.drawIndex = drawIndex;
+
+    m_triangles.push_back(triangle);
+    uint32 triangleIndex = static_cast<uint32>(m_triangles.size() - 1);
+    ++m_stats.trianglesBinned;
+
+    uint32 tileMinX = static_cast<uint32>(triangle.minX) / TILE_SIZE;
+    uint32 tileMaxX = static_cast<uint32>(triangle.maxX) / TILE_SIZE;
+    uint32 tileMinY = static_cast<uint32>(triangle.minY) / TILE_SIZE;
+    uint32 tileMaxY = static_cast<uint32>(triangle.maxY) / TILE_SIZE;
+
+    for (uint32 tileY = tileMinY; tileY <= tileMaxY; ++tileY) {
+        for (uint32 tileX = tileMinX; tileX <= tileMaxX; ++tileX) {
+            m_tileBins[static_cast<size_t>(tileY) * m_tilesX + tileX].push_back(triangleIndex);
+            ++m_stats.tileTriangles;
+        }
+    }
+}
+
+void SoftwareRasterizer::Flush(JobSystem& jobSystem) {
+    if (!m_target || m_triangles.empty()) {
+        ClearQueue();
+        return;
+    }
+
+    m_activeTiles.clear();
+    for (uint32 i = 0; i < m_tileBins.size(); ++i) {
+        if (!m_tileBins[i].empty()) {
+            m_activeTiles.push_back(i);
+        }
+    }
+
+    // Counters are per tile so workers never share a cache line they write to often
+    m_tilePixelCounts.assign(m_activeTiles.size(), 0);
+    jobSystem.ParallelFor(static_cast<uint32>(m_activeTiles.size()), [this](uint32 index) {
+        RasterizeTile(m_activeTiles[index], m_tilePixelCounts[index]);
+    });
+
+    for (uint64 count : m_tilePixelCounts) {
+        m_stats.pixelsShaded += count;
+    }
+
+    ClearQueue();
+}
+
+void SoftwareRasterizer::RasterizeTile(uint32 tileIndex, uint64& outPixelsShaded) {
+    int32 tileX = static_cast<int32>(tileIndex % m_tilesX) * static_cast<int32>(TILE_SIZE);
+    int32 tileY = static_cast<int32>(tileIndex / m_tilesX) * static_cast<int32>(TILE_SIZE);
+    int32 tileMaxX = std::min(tileX + static_cast<int32>(TILE_SIZE), static_cast<int32>(m_target->GetWidth())) - 1;
+    int32 tileMaxY = std::min(tileY + static_cast<int32>(TILE_SIZE), static_cast<int32>(m_target->GetHeight())) - 1;
+
+    uint64 pixelsShaded = 0;
+    for (uint32 triangleIndex : m_tileBins[tileIndex]) {
+        RasterizeTriangle(m_triangles[triangleIndex], tileX, tileY, tileMaxX, tileMaxY, pixelsShaded);
+    }
+    outPixelsShaded = pixelsShaded;
+}
+
+void SoftwareRasterizer::RasterizeTriangle(const SetupTriangle& triangle, int32 clipMinX, int32 clipMinY,
+                                           int32 clipMaxX, int32 clipMaxY, uint64& outPixelsShaded) {
+    int32 minX = std::max(triangle.minX, clipMinX);
+    int32 maxX = std::min(triangle.maxX, clipMaxX);
+    int32 minY = std::max(triangle.minY, clipMinY);
+    int32 maxY = std::min(triangle.maxY, clipMaxY);
+    if (minX > maxX || minY > maxY) {
+        return;
+    }
+
+    const SetupVertex& v0 = m_vertices[triangle.vertices[0]];
+    const SetupVertex& v1 = m_vertices[triangle.vertices[1]];
+    const SetupVertex& v2 = m_vertices[triangle.vertices[2]];
+    const DrawState& draw = m_draws[triangle.drawIndex];
+
+    uint32 width = m_target->GetWidth();
+    uint32* colorData = m_target->GetColorData();
+    float* depthData = m_target->GetDepthData();
+
+    float weights[3][4];
+    float varyings[SOFTWARE_MAX_VARYINGS];
+
+    for (int32 y = minY; y <= maxY; ++y) {
+        float py = static_cast<float>(y) + 0.5f;
+        float rowTerm[3] = {
+            triangle.edgeB[0] * (py - triangle.edgeOriginY[0]),
+            triangle.edgeB[1] * (py - triangle.edgeOriginY[1]),
+            triangle.edgeB[2] * (py - triangle.edgeOriginY[2])
+        };
+
+        uint32* colorRow = colorData + static_cast<size_t>(y) * width;
+        float* depthRow = depthData + static_cast<size_t>(y) * width;
+
+        for (int32 x = minX; x <= maxX; x += 4) {
+            uint32 covered = EvaluateEdges4(triangle, static_cast<float>(x) + 0.5f, rowTerm, weights);
+
+            // Lanes past the right edge belong to the next tile or are off the target
+            int32 laneCount = std::min(4, maxX - x + 1);
+            covered &= (1u << laneCount) - 1u;
+
+            while (covered) {
+                uint32 lane = 0;
+                while (!(covered & (1u << lane))) {
+                    ++lane;
+                }
+                covered &= ~(1u << lane);
+
+                float b0 = weights[0][lane];
+                float b1 = weights[1][lane];
+                float b2 = weights[2][lane];
+
+                // NDC depth is linear in screen space; past the far plane is clipped
+                float z = b0 * v0.z + b1 * v1.z + b2 * v2.z;
+                if (z > 1.0f) {
+                    continue;
+                }
+
+                int32 pixelX = x + static_cast<int32>(lane);
+                float depth = draw.minDepth + z * draw.depthRange;
+                if (!(depth < depthRow[pixelX])) {
+                    continue;
+                }
+
+                // Perspective-correct varyings
+                float w = 1.0f / (b0 * v0.invW + b1 * v1.invW + b2 * v2.invW);
+                for (uint32 i = 0; i < draw.varyingCount; ++i) {
+                    varyings[i] = (b0 * v0.varyings[i] + b1 * v1.varyings[i] + b2 * v2.varyings[i]) * w;
+                }
+
+                colorRow[pixelX] = SoftwareFrameBuffer::PackColor(draw.pixelShader(varyings));
+                depthRow[pixelX] = depth;
+                ++outPixelsShaded;
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::ClearQueue() {
+    m_vertices.clear();
+    m_triangles.clear();
+    m_draws.clear();
+    for (auto& bin : m_tileBins) {
+        bin.clear();
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "SoftwareShaders.h"
+#include "../RHI/RHITypes.h"
+
+class SoftwareFrameBuffer;
+class JobSystem;
+
+// Returns the pixel color for perspective-corrected varyings
+using SoftwarePixelShader = Function<DirectX::XMFLOAT4(const float* varyings)>;
+
+// Matches the DX12 pipelines: front faces are counter-clockwise
+enum class SoftwareCullMode {
+    None,
+    Front,
+    Back
+};
+
+struct SoftwareRasterStats {
+    uint64 trianglesSubmitted = 0;   // Before clipping and culling
+    uint64 trianglesCulled = 0;      // Back-facing, degenerate or outside the frustum
+    uint64 trianglesBinned = 0;      // After near-plane clipping
+    uint64 tileTriangles = 0;        // Triangle/tile pairs handed to the rasterizer
+    uint64 pixelsShaded = 0;         // Passed coverage and the depth test
+};
+
+// Binned/tiled triangle rasterizer. SubmitTriangles clips, sets up and bins each
+// triangle into TILE_SIZE square tiles; Flush rasterizes the tiles in parallel on the
+// job system. Tiles never share pixels and keep their triangles in submission order,
+// so output is deterministic regardless of thread count.
+//
+// Coverage follows D3D: pixel centers, top-left fill rule, depth test LESS.
+class SoftwareRasterizer {
+public:
+    static constexpr uint32 TILE_SIZE = 64;
+
+    SoftwareRasterizer() = default;
+    ~SoftwareRasterizer() = default;
+
+    // Binds the target (viewport and scissor reset to cover it) and drops queued work
+    void SetTarget(SoftwareFrameBuffer* target);
+    void SetViewport(const RHIViewport& viewport);
+    void SetScissorRect(const RHIRect& rect);
+    void SetCullMode(SoftwareCullMode mode) { m_cullMode = mode; }
+
+    // Queue a triangle list; indices address vertices[0, vertexCount)
+    void SubmitTriangles(const SoftwareVertexOutput* vertices, uint32 vertexCount,
+                         const uint32* indices, uint32 indexCount,
+                         uint32 varyingCount, const SoftwarePixelShader& pixelShader);
+
+    // Rasterize everything queued since the last flush
+    void Flush(JobSystem& jobSystem);
+
+    // Accessors
+    bool HasPendingWork() const { return !m_triangles.empty(); }
+    const SoftwareRasterStats& GetStats() const { return m_stats; }
+    void ResetStats() { m_stats = {}; }
+
+private:
+    // Screen-space vertex; varyings are pre-multiplied by invW for perspective correction
+    struct SetupVertex {
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+        float invW = 0.0f;
+        float varyings[SOFTWARE_MAX_VARYINGS];
+    };
+
+    // Edge i is opposite vertex i. Each edge is evaluated from a canonical endpoint order
+    // and then negated, so two triangles sharing an edge get exactly opposite values.
+    struct SetupTriangle {
+        float edgeA[3];
+        float edgeB[3];
+        float edgeOriginX[3];
+        float edgeOriginY[3];
+        float edgeSign[3];
+        bool edgeTopLeft[3];
+        float invArea = 0.0f;
+        int32 minX = 0;
+        int32 minY = 0;
+        int32 maxX = 0;         // Inclusive
+        int32 maxY = 0;
+        uint32 vertices[3] = {};
+        uint32 drawIndex = 0;
+    };
+
+    struct DrawState {
+        SoftwarePixelShader pixelShader;
+        uint32 varyingCount = 0;
+        float minDepth = 0.0f;
+        float depthRange = 1.0f;
+    };
+
+private:
+    uint32 AddSetupVertex(const SoftwareVertexOutput& vertex, uint32 varyingCount);
+    void AddTriangle(uint32 i0, uint32 i1, uint32 i2, uint32 drawIndex);
+    void ClipAndSetupTriangle(const SoftwareVertexOutput* triangle[3], uint32 varyingCount, uint32 drawIndex);
+    void RasterizeTile(uint32 tileIndex, uint64& outPixelsShaded);
+    void RasterizeTriangle(const SetupTriangle& triangle, int32 clipMinX, int32 clipMinY,
+                           int32 clipMaxX, int32 clipMaxY, uint64& outPixelsShaded);
+    void ClearQueue();
+
+private:
+    SoftwareFrameBuffer* m_target = nullptr;
+    RHIViewport m_viewport;
+    RHIRect m_scissor;
+    SoftwareCullMode m_cullMode = SoftwareCullMode::Back;
+
+    // Tile grid over the target
+    uint32 m_tilesX = 0;
+    uint32 m_tilesY = 0;
+
+    // Queued work
+    Vector<SetupVertex> m_vertices;
+    Vector<SetupTriangle> m_triangles;
+    Vector<DrawState> m_draws;
+    Vector<Vector<uint32>> m_tileBins;
+
+    // Scratch
+    Vector<uint32> m_vertexRemap;
+    Vector<uint32> m_activeTiles;
+    Vector<uint64> m_tilePixelCounts;
+
+    SoftwareRasterStats m_stats;
+
+    DECLARE_NON_COPYABLE(SoftwareRasterizer);
+};
@@ -0,0 +1,62 @@
+#include "SoftwareShaders.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace DirectX;
+
+BasicMeshVertexShader::BasicMeshVertexShader(const ModelConstants& model, const ViewConstants& view)
+    : m_modelMatrix(XMMatrixTranspose(model.modelMatrix))
+    , m_normalMatrix(XMMatrixTranspose(model.normalMatrix))
+    , m_viewProjectionMatrix(XMMatrixTranspose(view.viewProjectionMatrix))
+    , m_cameraPosition(XMLoadFloat3(&view.cameraPosition)) {
+}
+
+void BasicMeshVertexShader::operator()(const Vertex& input, SoftwareVertexOutput& output) const {
+    XMVECTOR position = XMVectorSetW(XMLoadFloat3(&input.position), 1.0f);
+    XMVECTOR worldPosition = XMVector4Transform(position, m_modelMatrix);
+    XMStoreFloat4(&output.position, XMVector4Transform(worldPosition, m_viewProjectionMatrix));
+
+    XMVECTOR normal = XMVector4Transform(XMVectorSetW(XMLoadFloat3(&input.normal), 0.0f), m_normalMatrix);
+    XMVECTOR viewDirection = XMVector3Normalize(XMVectorSubtract(m_cameraPosition, worldPosition));
+
+    float* varyings = output.varyings;
+    XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(varyings + BasicMeshVaryings::WorldPosition), worldPosition);
+    XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(varyings + BasicMeshVaryings::Normal), XMVector3Normalize(normal));
+    varyings[BasicMeshVaryings::TexCoord + 0] = input.texCoord.x;
+    varyings[BasicMeshVaryings::TexCoord + 1] = input.texCoord.y;
+    XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(varyings + BasicMeshVaryings::ViewDirection), viewDirection);
+}
+
+BasicMeshPixelShader::BasicMeshPixelShader(const LightConstants& light, const MaterialConstants& material)
+    : m_lightPosition(light.lightPosition)
+    , m_lightColor(light.lightColor)
+    , m_baseColor(material.baseColor)
+    , m_lightIntensity(light.lightIntensity) {
+}
+
+XMFLOAT4 BasicMeshPixelShader::operator()(const float* varyings) const {
+    XMVECTOR lightPosition = XMLoadFloat3(&m_lightPosition);
+    XMVECTOR lightColor = XMLoadFloat3(&m_lightColor);
+    XMVECTOR worldPosition = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(varyings + BasicMeshVaryings::WorldPosition));
+    XMVECTOR normal = XMVector3Normalize(XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(varyings + BasicMeshVaryings::Normal)));
+
+    XMVECTOR toLight = XMVectorSubtract(lightPosition, worldPosition);
+    XMVECTOR lightDir = XMVector3Normalize(toLight);
+    float distance = XMVectorGetX(XMVector3Length(toLight));
+    float attenuation = 1.0f / (1.0f + 0.1f * distance + 0.01f * distance * distance);
+    float NdotL = std::max(0.0f, XMVectorGetX(XMVector3Dot(normal, lightDir)));
+
+    XMVECTOR ambient = XMVectorReplicate(0.1f);
+    XMVECTOR diffuse = XMVectorScale(lightColor, m_lightIntensity * NdotL * attenuation);
+
+    XMVECTOR viewDir = XMVector3Normalize(XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(varyings + BasicMeshVaryings::ViewDirection)));
+    XMVECTOR halfVector = XMVector3Normalize(XMVectorAdd(lightDir, viewDir));
+    float NdotH = std::max(0.0f, XMVectorGetX(XMVector3Dot(normal, halfVector)));
+    XMVECTOR specular = XMVectorScale(lightColor, std::pow(NdotH, 32.0f) * 0.3f * attenuation);
+
+    XMVECTOR finalColor = XMVectorAdd(XMVectorMultiply(XMLoadFloat3(&m_baseColor), XMVectorAdd(ambient, diffuse)), specular);
+
+    XMFLOAT4 result;
+    XMStoreFloat4(&result, XMVectorSetW(finalColor, 1.0f));
+    return result;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "../../Core/Utilities/MeshData.h"
+#include "../ShaderConstants.h"
+
+// Vertex shader output as the rasterizer sees it: clip-space position plus a flat
+// array of varyings that are interpolated perspective-correctly.
+constexpr uint32 SOFTWARE_MAX_VARYINGS = 12;
+
+struct SoftwareVertexOutput {
+    DirectX::XMFLOAT4 position;                 // SV_POSITION
+    float varyings[SOFTWARE_MAX_VARYINGS];
+};
+
+// C++ ports of Shaders/BasicMesh.vs.hlsl and BasicMesh.ps.hlsl. They read the same
+// constant buffer layouts (ShaderConstants.h) and follow HLSL's row-vector mul().
+namespace BasicMeshVaryings {
+    // Offsets into SoftwareVertexOutput::varyings (VertexOutput in the HLSL)
+    constexpr uint32 WorldPosition = 0;
+    constexpr uint32 Normal = 3;
+    constexpr uint32 TexCoord = 6;
+    constexpr uint32 ViewDirection = 8;
+    constexpr uint32 Count = 11;
+}
+
+class BasicMeshVertexShader {
+public:
+    BasicMeshVertexShader(const ModelConstants& model, const ViewConstants& view);
+
+    void operator()(const Vertex& input, SoftwareVertexOutput& output) const;
+
+private:
+    // Transposed back once per draw, so per-vertex work is plain XMVector4Transform
+    DirectX::XMMATRIX m_modelMatrix;
+    DirectX::XMMATRIX m_normalMatrix;
+    DirectX::XMMATRIX m_viewProjectionMatrix;
+    DirectX::XMVECTOR m_cameraPosition;
+};
+
+class BasicMeshPixelShader {
+public:
+    BasicMeshPixelShader(const LightConstants& light, const MaterialConstants& material);
+
+    // varyings are already divided back out of perspective space
+    DirectX::XMFLOAT4 operator()(const float* varyings) const;
+
+private:
+    // Stored unaligned, the shader is copied into SoftwarePixelShader callables
+    DirectX::XMFLOAT3 m_lightPosition;
+    DirectX::XMFLOAT3 m_lightColor;
+    DirectX::XMFLOAT3 m_baseColor;
+    float m_lightIntensity = 0.0f;
+};
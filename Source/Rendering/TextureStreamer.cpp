@@ -0,0 +1,252 @@
+#include "TextureStreamer.h"
+#include "Camera.h"
+#include "Bindable/Texture.h"
+#include "../Core/Threading/JobSystem.h"
+#include "../Core/Utilities/FileSystem.h"
+#include "../Core/Profiling/Profiler.h"
+#include "../Core/Memory/FrameMemory.h"
+#include "../Platform/Windows/WindowsPlatform.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+TextureStreamer::TextureStreamer(DX12Renderer& renderer, uint64 budgetBytes, uint32 residentMipSize)
+    : m_renderer(renderer)
+    , m_residentMipSize(std::max(1u, residentMipSize)) {
+    m_stats.budgetBytes = budgetBytes;
+}
+
+TextureStreamer::~TextureStreamer() {
+    // Decode jobs only capture the source path, so abandoned futures are safe to drop
+    m_entries.clear();
+}
+
+void TextureStreamer::Register(Texture* texture, uint32 tailMip) {
+    StreamingEntry& entry = m_entries[texture];
+    entry.texture = texture;
+    entry.tailMip = tailMip;
+    entry.requestedMip = tailMip;
+    entry.neededMip = tailMip;
+    entry.lastRequestFrame = m_frameNumber;
+}
+
+void TextureStreamer::Unregister(Texture* texture) {
+    m_entries.erase(texture);
+}
+
+void TextureStreamer::SetView(const Camera& camera, float viewportHeight, float lodDistanceScale) {
+    SetView(camera.GetPosition(), camera.GetFOV(), camera.GetNearPlane(), viewportHeight, lodDistanceScale);
+}
+
+void TextureStreamer::SetView(const DirectX::XMFLOAT3& cameraPosition, float fovY, float nearPlane, float viewportHeight,
+                              float lodDistanceScale) {
+    m_cameraPosition = cameraPosition;
+    m_nearPlane = nearPlane;
+    m_pixelsPerUnitAtUnitDistance = viewportHeight / (2.0f * std::tan(fovY * 0.5f) * std::max(lodDistanceScale, 1.0e-3f));
+}
+
+void TextureStreamer::RequestMip(Texture* texture, const DirectX::XMFLOAT3& worldCenter, float worldRadius) {
+    if (!texture || !texture->IsStreaming() || m_pixelsPerUnitAtUnitDistance <= 0.0f) {
+        return;
+    }
+
+    float dx = worldCenter.x - m_cameraPosition.x;
+    float dy = worldCenter.y - m_cameraPosition.y;
+    float dz = worldCenter.z - m_cameraPosition.z;
+    float distance = std::max(std::sqrt(dx * dx + dy * dy + dz * dz) - worldRadius, m_nearPlane);
+
+    float screenPixels = 2.0f * worldRadius * m_pixelsPerUnitAtUnitDistance / distance;
+    uint32 textureSize = std::max(texture->GetWidth(), texture->GetHeight());
+    RequestMip(texture, CalculateRequiredMip(textureSize, screenPixels, texture->GetMipCount()));
+}
+
+void TextureStreamer::RequestMip(Texture* texture, uint32 mip) {
+    auto it = m_entries.find(texture);
+    if (it == m_entries.end()) {
+        return;
+    }
+
+    StreamingEntry& entry = it->second;
+    entry.requestedMip = entry.requested ? std::min(entry.requestedMip, mip) : mip;
+    entry.requested = true;
+}
+
+uint32 TextureStreamer::CalculateRequiredMip(uint32 textureSize, float screenPixels, uint32 mipCount) {
+    if (mipCount == 0) {
+        return 0;
+    }
+    if (screenPixels < 1.0f) {
+        return mipCount - 1;
+    }
+
+    float texelsPerPixel = static_cast<float>(textureSize) / screenPixels;
+    if (texelsPerPixel <= 1.0f) {
+        return 0;
+    }
+
+    uint32 mip = static_cast<uint32>(std::floor(std::log2(texelsPerPixel)));
+    return std::min(mip, mipCount - 1);
+}
+
+void TextureStreamer::Update() {
+    PROFILE_SCOPE("TextureStreamer::Update");
+    ++m_frameNumber;
+    m_uploadsThisFrame = 0;
+
+    GatherFeedback();
+    ApplyCompletedLoads();
+    EvictOverBudget();
+    RequestLoads();
+    UpdateStats();
+}
+
+void TextureStreamer::GatherFeedback() {
+    for (auto& [texture, entry] : m_entries) {
+        if (entry.requested) {
+            entry.neededMip = std::min(entry.requestedMip, entry.tailMip);
+            entry.lastRequestFrame = m_frameNumber;
+        } else if (m_frameNumber - entry.lastRequestFrame > m_requestGraceFrames) {
+            // Not drawn for a while: only the tail is needed
+            entry.neededMip = entry.tailMip;
+        }
+
+        entry.requested = false;
+        entry.requestedMip = entry.tailMip;
+    }
+}
+
+void TextureStreamer::ApplyCompletedLoads() {
+    for (auto& [texture, entry] : m_entries) {
+        if (m_uploadsThisFrame >= m_maxUploadsPerFrame) {
+            break;
+        }
+        if (!entry.pending.valid() ||
+            entry.pending.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            continue;
+        }
+
+        Vector<TextureImageData> mips = entry.pending.get();
+
+        // Mips evicted while the decode was running make the result unusable; it is re-requested
+        if (texture->GetResidentMip() != entry.pendingResidentMip) {
+            continue;
+        }
+
+        uint32 expectedWidth = std::max(1u, texture->GetWidth() >> entry.pendingMip);
+        if (mips.size() != entry.pendingResidentMip - entry.pendingMip || mips[0].width != expectedWidth) {
+            Platform::OutputDebugMessage("TextureStreamer: Source changed or failed to decode: " + texture->GetSourcePath() + "\n");
+            continue;
+        }
+
+        if (texture->UpdateResidentMips(entry.pendingMip, mips)) {
+            m_stats.mipsStreamedIn += entry.pendingResidentMip - entry.pendingMip;
+            ++m_uploadsThisFrame;
+        }
+    }
+}
+
+void TextureStreamer::EvictOverBudget() {
+    UpdateStats();
+    if (m_stats.residentBytes <= m_stats.budgetBytes) {
+        return;
+    }
+
+    // Surplus mips (more detail than currently needed) go first, then the least recently needed
+    ScratchScope scratch;
+    ScratchVector<StreamingEntry*> candidates(scratch.GetResource());
+    for (auto& [texture, entry] : m_entries) {
+        if (texture->GetResidentMip() < entry.tailMip) {
+            candidates.push_back(&entry);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const StreamingEntry* a, const StreamingEntry* b) {
+        bool aSurplus = a->texture->GetResidentMip() < a->neededMip;
+        bool bSurplus = b->texture->GetResidentMip() < b->neededMip;
+        if (aSurplus != bSurplus) {
+            return aSurplus;
+        }
+        return a->lastRequestFrame < b->lastRequestFrame;
+    });
+
+    for (StreamingEntry* entry : candidates) {
+        if (m_stats.residentBytes <= m_stats.budgetBytes || m_uploadsThisFrame >= m_maxUploadsPerFrame) {
+            break;
+        }
+
+        Texture* texture = entry->texture;
+        uint32 residentMip = texture->GetResidentMip();
+
+        // Drop surplus mips in one go; mips still in use lose one level at a time
+        uint32 newMip = residentMip < entry->neededMip ? entry->neededMip : residentMip + 1;
+        newMip = std::min(newMip, entry->tailMip);
+
+        uint64 freedBytes = texture->GetMipBytes(residentMip, newMip);
+        if (texture->UpdateResidentMips(newMip, {})) {
+            m_stats.mipsEvicted += newMip - residentMip;
+            m_stats.residentBytes -= freedBytes;
+            ++m_uploadsThisFrame;
+        }
+    }
+}
+
+void TextureStreamer::RequestLoads() {
+    uint32 pendingLoads = 0;
+    for (const auto& [texture, entry] : m_entries) {
+        pendingLoads += entry.pending.valid() ? 1 : 0;
+    }
+
+    uint64 projectedBytes = m_stats.residentBytes;
+    for (auto& [texture, entry] : m_entries) {
+        if (pendingLoads >= m_maxPendingLoads) {
+            break;
+        }
+
+        uint32 residentMip = texture->GetResidentMip();
+        if (entry.pending.valid() || entry.neededMip >= residentMip) {
+            continue;
+        }
+
+        // Stream in as much detail as the budget allows
+        uint32 firstMip = entry.neededMip;
+        while (firstMip < residentMip &&
+               projectedBytes + texture->GetMipBytes(firstMip, residentMip) > m_stats.budgetBytes) {
+            ++firstMip;
+        }
+        if (firstMip == residentMip) {
+            continue;
+        }
+
+        projectedBytes += texture->GetMipBytes(firstMip, residentMip);
+        entry.pendingMip = firstMip;
+        entry.pendingResidentMip = residentMip;
+        entry.pending = JobSystem::GetGlobal().Submit([sourcePath = texture->GetSourcePath(), firstMip, residentMip]() {
+            return LoadMips(sourcePath, firstMip, residentMip);
+        });
+        ++pendingLoads;
+    }
+}
+
+void TextureStreamer::UpdateStats() {
+    m_stats.streamingTextures = static_cast<uint32>(m_entries.size());
+    m_stats.pendingLoads = 0;
+    m_stats.residentBytes = 0;
+    for (const auto& [texture, entry] : m_entries) {
+        m_stats.pendingLoads += entry.pending.valid() ? 1 : 0;
+        m_stats.residentBytes += texture->GetResidentBytes();
+    }
+}
+
+Vector<TextureImageData> TextureStreamer::LoadMips(const String& sourcePath, uint32 firstMip, uint32 endMip) {
+    PROFILE_SCOPE("TextureStreamer::LoadMips");
+    Vector<uint8> fileData;
+    if (!FileSystem::ReadFile(sourcePath, fileData)) {
+        return {};
+    }
+
+    TextureImageData image = TextureLoader::LoadFromMemory(fileData.data(), fileData.size(), sourcePath);
+    Vector<TextureImageData> mips = TextureLoader::GenerateMipChain(image, firstMip);
+    if (mips.size() > endMip - firstMip) {
+        mips.resize(endMip - firstMip);
+    }
+    return mips;
+}
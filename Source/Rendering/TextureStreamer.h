@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../Core/Utilities/Types.h"
+#include "../Core/Utilities/TextureLoader.h"
+#include <DirectXMath.h>
+#include <future>
+
+class DX12Renderer;
+class Texture;
+class Camera;
+
+struct TextureStreamerStats {
+    uint32 streamingTextures = 0;
+    uint32 pendingLoads = 0;
+    uint32 mipsStreamedIn = 0;      // Mip levels uploaded since startup
+    uint32 mipsEvicted = 0;
+    uint64 residentBytes = 0;       // GPU memory of every streaming texture's resident mips
+    uint64 budgetBytes = 0;
+};
+
+// Streams the detailed mips of streaming textures (Texture::CreateStreaming).
+//
+// Each frame, renderables report how large their texture appears on screen (RequestMip);
+// Update() then decodes missing mips on the JobSystem, uploads finished ones, and drops
+// the mips that were needed least recently while the resident set is over budget.
+class TextureStreamer {
+public:
+    TextureStreamer(DX12Renderer& renderer, uint64 budgetBytes, uint32 residentMipSize);
+    ~TextureStreamer();
+
+    // Called by streaming textures on creation/destruction
+    void Register(Texture* texture, uint32 tailMip);
+    void Unregister(Texture* texture);
+
+    // Per-frame feedback: set the view first, then report every visible streaming texture.
+    // A lodDistanceScale above 1 treats textures as that much farther away.
+    void SetView(const Camera& camera, float viewportHeight, float lodDistanceScale = 1.0f);
+    void SetView(const DirectX::XMFLOAT3& cameraPosition, float fovY, float nearPlane, float viewportHeight,
+                 float lodDistanceScale = 1.0f);
+    void RequestMip(Texture* texture, const DirectX::XMFLOAT3& worldCenter, float worldRadius);
+    void RequestMip(Texture* texture, uint32 mip);
+
+    // Main thread; the renderer calls this in BeginFrame once the frame's command list is open
+    // and the copies are recorded on it
+    void Update();
+
+    // Mip at which one texel covers about one pixel, assuming the texture spans the object once
+    static uint32 CalculateRequiredMip(uint32 textureSize, float screenPixels, uint32 mipCount);
+
+    // Settings
+    uint32 GetResidentMipSize() const { return m_residentMipSize; }
+    void SetBudget(uint64 budgetBytes) { m_stats.budgetBytes = budgetBytes; }
+    void SetMaxUploadsPerFrame(uint32 maxUploads) { m_maxUploadsPerFrame = maxUploads; }
+    const TextureStreamerStats& GetStats() const { return m_stats; }
+
+private:
+    struct StreamingEntry {
+        Texture* texture = nullptr;
+        uint32 tailMip = 0;             // Always resident
+        uint32 requestedMip = 0;        // Most detailed mip asked for during the current frame
+        bool requested = false;
+        uint32 neededMip = 0;           // Result of the last frame's requests
+        uint64 lastRequestFrame = 0;
+
+        // In-flight decode of mips [pendingMip, pendingResidentMip)
+        std::future<Vector<TextureImageData>> pending;
+        uint32 pendingMip = 0;
+        uint32 pendingResidentMip = 0;
+    };
+
+    void GatherFeedback();
+    void ApplyCompletedLoads();
+    void EvictOverBudget();
+    void RequestLoads();
+    void UpdateStats();
+
+    // Worker thread: decode the source and build mips [firstMip, endMip)
+    static Vector<TextureImageData> LoadMips(const String& sourcePath, uint32 firstMip, uint32 endMip);
+
+private:
+    DX12Renderer& m_renderer;
+    HashMap<Texture*, StreamingEntry> m_entries;
+
+    // View used to turn world bounds into screen size
+    DirectX::XMFLOAT3 m_cameraPosition = { 0.0f, 0.0f, 0.0f };
+    float m_pixelsPerUnitAtUnitDistance = 0.0f;
+    float m_nearPlane = 0.1f;
+
+    uint32 m_residentMipSize = 64;
+    uint32 m_maxUploadsPerFrame = 2;
+    uint32 m_maxPendingLoads = 4;
+    uint32 m_requestGraceFrames = 60;  // Frames a mip stays "needed" after the last request
+    uint32 m_uploadsThisFrame = 0;
+    uint64 m_frameNumber = 0;
+
+    TextureStreamerStats m_stats;
+
+    DECLARE_NON_COPYABLE(TextureStreamer);
+};
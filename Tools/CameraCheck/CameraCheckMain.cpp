@@ -0,0 +1,227 @@
+// Headless check of the camera's projection modes and cached view data.
+//
+// Usage: CameraCheck [--points N]
+//
+// For standard and reverse Z, each with a finite and an infinite far plane, checks
+// where the near and far planes land in depth, that depth is monotonic with distance,
+// that the cached view-projection, its inverse and the frustum match a fresh
+// computation and follow camera moves, and that Frustum::IntersectsSphere agrees with
+// a clip-space test on N random points. Prints the smallest distance a D32 depth
+// buffer resolves at several ranges for each mode. Exits with 1 on any failure.
+
+#include "Rendering/Camera.h"
+#include "Rendering/Frustum.h"
+#include "../Common/CheckHarness.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace CheckHarness;
+using namespace DirectX;
+
+namespace {
+    struct Mode {
+        const char* name;
+        bool reverseZ;
+        bool infiniteFarPlane;
+    };
+
+    const Mode s_modes[] = {
+        { "standard",         false, false },
+        { "standard, inf",    false, true },
+        { "reverse Z",        true,  false },
+        { "reverse Z, inf",   true,  true },
+    };
+
+    CameraDesc MakeDesc(const Mode& mode) {
+        // The engine's defaults: a 0.1 near plane, 1000 units of map
+        CameraDesc desc;
+        desc.position = { 0.0f, 0.0f, 0.0f };
+        desc.target = { 0.0f, 0.0f, -1.0f };
+        desc.nearPlane = 0.1f;
+        desc.farPlane = 1000.0f;
+        desc.reverseZ = mode.reverseZ;
+        desc.infiniteFarPlane = mode.infiniteFarPlane;
+        return desc;
+    }
+
+    // Stored depth (float32, as in a D32 buffer) of a point straight ahead
+    float32 DepthAt(const XMMATRIX& viewProjection, float32 distance) {
+        XMVECTOR clip = XMVector4Transform(XMVectorSet(0.0f, 0.0f, -distance, 1.0f), viewProjection);
+        XMFLOAT4 c;
+        XMStoreFloat4(&c, clip);
+        return c.z / c.w;
+    }
+
+    // Smallest step in distance that changes the stored depth
+    float32 ResolvableDistance(const XMMATRIX& viewProjection, float32 distance) {
+        float32 depth = DepthAt(viewProjection, distance);
+        float32 step = distance * 1.0e-9f;
+        while (step < distance && DepthAt(viewProjection, distance + step) == depth) {
+            step *= 1.1f;
+        }
+        return step;
+    }
+
+    bool InsideClip(const XMMATRIX& viewProjection, const XMFLOAT3& point) {
+        XMFLOAT4 c;
+        XMStoreFloat4(&c, XMVector4Transform(XMVectorSet(point.x, point.y, point.z, 1.0f), viewProjection));
+        return c.w > 0.0f && std::fabs(c.x) <= c.w && std::fabs(c.y) <= c.w && c.z >= 0.0f && c.z <= c.w;
+    }
+
+    float32 MaxDifference(const XMMATRIX& a, const XMMATRIX& b) {
+        XMFLOAT4X4 left;
+        XMFLOAT4X4 right;
+        XMStoreFloat4x4(&left, a);
+        XMStoreFloat4x4(&right, b);
+        float32 difference = 0.0f;
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                difference = std::fmax(difference, std::fabs(left.m[row][column] - right.m[row][column]));
+            }
+        }
+        return difference;
+    }
+
+    void CheckDepthRange() {
+        std::printf("  %-16s %10s %10s %10s %10s   resolvable distance at 10 / 100 / 500 / 1000 units\n",
+                    "mode", "near", "far", "100", "1e6");
+        float32 standardAt500 = 0.0f;
+        float32 reverseAt500 = 0.0f;
+
+        for (const Mode& mode : s_modes) {
+            Camera camera(MakeDesc(mode));
+            XMMATRIX viewProjection = camera.GetViewProjectionMatrix();
+            float32 nearDepth = DepthAt(viewProjection, 0.1f);
+            float32 farDepth = DepthAt(viewProjection, 1000.0f);
+            float32 depth100 = DepthAt(viewProjection, 100.0f);
+            float32 depthFarAway = DepthAt(viewProjection, 1.0e6f);
+
+            float32 resolvable[4];
+            const float32 distances[4] = { 10.0f, 100.0f, 500.0f, 1000.0f };
+            for (uint32 i = 0; i < 4; ++i) {
+                resolvable[i] = ResolvableDistance(viewProjection, distances[i]);
+            }
+            std::printf("  %-16s %10.6f %10.6f %10.6f %10.6f   %.2g / %.2g / %.2g / %.2g\n", mode.name, nearDepth, farDepth,
+                        depth100, depthFarAway, resolvable[0], resolvable[1], resolvable[2], resolvable[3]);
+
+            float32 expectedNear = mode.reverseZ ? 1.0f : 0.0f;
+            float32 expectedFar = mode.reverseZ ? 0.0f : 1.0f;
+            Check(std::fabs(nearDepth - expectedNear) < 1.0e-5f, "the near plane maps to the near end of the depth range");
+            if (!mode.infiniteFarPlane) {
+                Check(std::fabs(farDepth - expectedFar) < 1.0e-4f, "the far plane maps to the far end of the depth range");
+            } else {
+                Check(depthFarAway >= 0.0f && depthFarAway <= 1.0f, "an infinite far plane keeps distant points in range");
+            }
+
+            bool monotonic = true;
+            float32 previous = nearDepth;
+            for (float32 distance = 0.2f; distance < 2000.0f; distance *= 1.1f) {
+                float32 depth = DepthAt(viewProjection, distance);
+                monotonic = monotonic && (mode.reverseZ ? depth <= previous : depth >= previous);
+                previous = depth;
+            }
+            Check(monotonic, "depth is monotonic with distance");
+
+            if (!mode.reverseZ && !mode.infiniteFarPlane) {
+                standardAt500 = resolvable[2];
+            }
+            if (mode.reverseZ && mode.infiniteFarPlane) {
+                reverseAt500 = resolvable[2];
+            }
+        }
+
+        // Float spacing is finest near 0, which reverse Z puts at the far end
+        Check(reverseAt500 * 10.0f < standardAt500, "reverse Z resolves far geometry at least 10x finer");
+    }
+
+    void CheckCachedData() {
+        for (const Mode& mode : s_modes) {
+            Camera camera(MakeDesc(mode));
+            camera.LookAt({ 40.0f, 60.0f, 90.0f }, { 50.0f, 0.0f, 50.0f }, { 0.0f, 1.0f, 0.0f });
+            XMMATRIX viewProjection = camera.GetViewProjectionMatrix();
+            Check(MaxDifference(viewProjection, camera.GetViewMatrix() * camera.GetProjectionMatrix()) == 0.0f,
+                  "the cached view-projection is view times projection");
+            Check(MaxDifference(camera.GetInverseViewProjectionMatrix() * viewProjection, XMMatrixIdentity()) < 1.0e-3f,
+                  "the cached inverse undoes the view-projection");
+
+            // Moving the camera refreshes everything derived from it
+            XMFLOAT3 target = { 50.0f, 0.0f, 50.0f };
+            Check(camera.GetFrustum().IntersectsSphere(target, 0.5f), "the frustum contains the look-at target");
+            camera.SetPosition({ 40.0f, 60.0f, -200.0f });
+            camera.SetTarget({ 40.0f, 0.0f, -300.0f });
+            Check(MaxDifference(camera.GetViewProjectionMatrix(), viewProjection) > 0.0f, "moving the camera rebuilds the view-projection");
+            Check(!camera.GetFrustum().IntersectsSphere(target, 0.5f), "moving the camera rebuilds the frustum");
+
+            // Screen to world and back, at a depth inside the range
+            XMFLOAT3 world = camera.ScreenToWorld({ 0.25f, -0.5f }, mode.reverseZ ? 0.9f : 0.1f);
+            XMFLOAT4 clip;
+            XMStoreFloat4(&clip, XMVector4Transform(XMVectorSet(world.x, world.y, world.z, 1.0f), camera.GetViewProjectionMatrix()));
+            Check(std::fabs(clip.x / clip.w - 0.25f) < 1.0e-3f && std::fabs(clip.y / clip.w + 0.5f) < 1.0e-3f,
+                  "ScreenToWorld inverts the view-projection");
+        }
+    }
+
+    void CheckFrustum(uint32 pointCount) {
+        std::minstd_rand random(11);
+        std::uniform_real_distribution<float32> coordinate(-1500.0f, 1500.0f);
+
+        for (const Mode& mode : s_modes) {
+            Camera camera(MakeDesc(mode));
+            camera.LookAt({ 0.0f, 80.0f, 60.0f }, { 0.0f, 0.0f, -40.0f }, { 0.0f, 1.0f, 0.0f });
+            XMMATRIX viewProjection = camera.GetViewProjectionMatrix();
+            const Frustum& frustum = camera.GetFrustum();
+
+            uint32 mismatches = 0;
+            uint32 inside = 0;
+            for (uint32 i = 0; i < pointCount; ++i) {
+                XMFLOAT3 point = { coordinate(random), coordinate(random) * 0.2f, coordinate(random) };
+                bool expected = InsideClip(viewProjection, point);
+                // Points right on a plane may land either side after normalization
+                bool nearPlane = false;
+                for (uint32 p = 0; p < Frustum::PLANE_COUNT; ++p) {
+                    const XMFLOAT4& plane = frustum.GetPlane(p);
+                    nearPlane = nearPlane || std::fabs(plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w) < 1.0e-2f;
+                }
+                if (!nearPlane && frustum.IntersectsSphere(point, 0.0f) != expected) {
+                    ++mismatches;
+                }
+                inside += expected ? 1 : 0;
+            }
+            std::printf("  %-16s %u of %u random points inside, %u disagreements\n", mode.name, inside, pointCount, mismatches);
+            Check(mismatches == 0, "the SIMD sphere test agrees with clip space for points");
+            Check(inside > 0, "some random points are visible");
+
+            // Beyond the far plane: culled only when there is one
+            XMFLOAT3 forward = camera.GetForward();
+            XMFLOAT3 eye = camera.GetPosition();
+            XMFLOAT3 distant = { eye.x + forward.x * 5000.0f, eye.y + forward.y * 5000.0f, eye.z + forward.z * 5000.0f };
+            Check(frustum.IntersectsSphere(distant, 1.0f) == mode.infiniteFarPlane, "the far plane culls only when finite");
+
+            XMFLOAT3 behind = { eye.x - forward.x * 10.0f, eye.y - forward.y * 10.0f, eye.z - forward.z * 10.0f };
+            Check(!frustum.IntersectsSphere(behind, 1.0f), "spheres behind the camera are culled");
+            Check(frustum.IntersectsSphere(behind, 20.0f), "spheres around the camera intersect");
+        }
+
+        Frustum everything;
+        Check(everything.IntersectsSphere({ 1.0e9f, -1.0e9f, 0.0f }, 0.0f), "a default frustum contains everything");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 pointCount = 100000;
+
+    Arguments arguments(argc, argv, "Usage: CameraCheck [--points N]");
+    arguments.Option("--points", pointCount);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("Camera projection\n\n");
+    CheckDepthRange();
+    std::printf("\n");
+    CheckCachedData();
+    CheckFrustum(pointCount > 0 ? pointCount : 1);
+
+    return Finish();
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core/Utilities/Types.h"
+#include "Platform/Platform.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Shared scaffolding of the headless Check tools and benchmarks: failure counting, a
+// busy-wait for timing tests, "--name value" arguments and the closing summary line,
+// whose result is the exit code ctest looks at.
+namespace CheckHarness {
+    inline uint32 s_failures = 0;
+
+    inline void Check(bool condition, const char* what) {
+        if (!condition) {
+            std::printf("  FAILED  %s\n", what);
+            ++s_failures;
+        }
+    }
+
+    // Busy-waits, so the time counts as work in profiler zones and frame timings
+    inline void Spin(uint32 microseconds) {
+        int64 end = Platform::GetPerformanceCounter() + Platform::GetPerformanceFrequency() * microseconds / 1000000;
+        while (Platform::GetPerformanceCounter() < end) {
+        }
+    }
+
+    // Prints "passed" or "FAILED" with the failure count; returns the exit code
+    inline int Finish() {
+        std::printf("\n  %s (%u failures)\n", s_failures == 0 ? "passed" : "FAILED", s_failures);
+        return s_failures == 0 ? 0 : 1;
+    }
+
+    // Command line of "--name value" options and "--name" switches in any order. Read
+    // every option the tool knows, then Validate rejects anything left over.
+    class Arguments {
+    public:
+        Arguments(int argc, char** argv, const char* usage)
+            : m_argc(argc), m_argv(argv), m_usage(usage), m_used(argc > 0 ? argc : 0, false) {
+        }
+
+        // Each returns true if the option was given; the last occurrence wins
+        bool Option(const char* name, uint32& value) {
+            const char* text = Find(name);
+            if (text) {
+                value = static_cast<uint32>(std::strtoul(text, nullptr, 10));
+            }
+            return text != nullptr;
+        }
+
+        bool Option(const char* name, float64& value) {
+            const char* text = Find(name);
+            if (text) {
+                value = std::strtod(text, nullptr);
+            }
+            return text != nullptr;
+        }
+
+        bool Option(const char* name, String& value) {
+            const char* text = Find(name);
+            if (text) {
+                value = text;
+            }
+            return text != nullptr;
+        }
+
+        bool Switch(const char* name) {
+            bool found = false;
+            for (int i = 1; i < m_argc; ++i) {
+                if (!m_used[i] && std::strcmp(m_argv[i], name) == 0) {
+                    m_used[i] = true;
+                    found = true;
+                }
+            }
+            return found;
+        }
+
+        // False, after printing the usage line, if any argument was not recognized
+        bool Validate() const {
+            for (int i = 1; i < m_argc; ++i) {
+                if (!m_used[i]) {
+                    PrintUsage();
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void PrintUsage() const {
+            std::printf("%s\n", m_usage);
+        }
+
+    private:
+        // Value of the last "name value" pair, or null
+        const char* Find(const char* name) {
+            const char* text = nullptr;
+            for (int i = 1; i + 1 < m_argc; ++i) {
+                if (!m_used[i] && std::strcmp(m_argv[i], name) == 0) {
+                    m_used[i] = true;
+                    m_used[i + 1] = true;
+                    text = m_argv[++i];
+                }
+            }
+            return text;
+        }
+
+    private:
+        int m_argc;
+        char** m_argv;
+        const char* m_usage;
+        Vector<bool> m_used;
+    };
+}
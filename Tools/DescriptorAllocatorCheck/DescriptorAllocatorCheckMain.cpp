@@ -0,0 +1,201 @@
+// Headless check of the bindless DescriptorAllocator, with a streaming churn benchmark.
+//
+// Usage: DescriptorAllocatorCheck [--frames N] [--capacity N] [--seed N]
+//
+// Verifies that persistent indices are stable and only reused after their fence has
+// completed, that free ranges coalesce back into one, and that the transient ring
+// never hands out a range still owned by a frame in flight. The benchmark then mimics
+// texture streaming (mixed 1..8 descriptor sets allocated and freed every frame, with
+// three frames in flight) and reports fragmentation and allocate/free cost.
+// Exits with 1 on any failure.
+
+#include "Rendering/Descriptors/DescriptorAllocator.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+using namespace CheckHarness;
+
+namespace {
+    constexpr uint32 FRAMES_IN_FLIGHT = 3;
+
+    void CheckPersistent() {
+        DescriptorAllocator allocator(16, 0);
+
+        uint32 a = allocator.AllocatePersistent(4);
+        uint32 b = allocator.AllocatePersistent(4);
+        uint32 c = allocator.AllocatePersistent(8);
+        Check(a == 0 && b == 4 && c == 8, "allocations pack from the start");
+        Check(allocator.AllocatePersistent() == INVALID_DESCRIPTOR_INDEX, "full region fails");
+        Check(allocator.GetStats().failedAllocations == 1, "failure is counted");
+
+        // A freed range stays owned until its frame's fence has completed
+        allocator.FreePersistent(b, 4);
+        Check(allocator.AllocatePersistent() == INVALID_DESCRIPTOR_INDEX, "free is deferred until CloseFrame");
+        allocator.CloseFrame(10);
+        allocator.Recycle(9);
+        Check(allocator.AllocatePersistent() == INVALID_DESCRIPTOR_INDEX, "free is deferred until the fence completes");
+        Check(allocator.GetStats().pendingFrees == 1, "pending free is reported");
+        allocator.Recycle(10);
+        Check(allocator.GetStats().persistentUsed == 12, "completed free is returned");
+
+        // Best fit: a single descriptor goes into the smallest hole
+        allocator.FreePersistent(c, 8);
+        allocator.CloseFrame(11);
+        allocator.Recycle(11);
+        Check(allocator.AllocatePersistent(2) == b, "best fit prefers the smaller hole");
+        allocator.FreePersistent(b, 2);
+
+        // Freeing everything coalesces back into one range
+        allocator.FreePersistent(a, 4);
+        allocator.CloseFrame(12);
+        allocator.Recycle(12);
+        DescriptorAllocatorStats stats = allocator.GetStats();
+        Check(stats.persistentUsed == 0, "everything is free");
+        Check(stats.freeRanges == 1 && stats.largestFreeRange == 16, "free ranges coalesce");
+        Check(allocator.GetFragmentation() == 0.0f, "no fragmentation when empty");
+        Check(stats.persistentPeak == 16, "peak is tracked");
+        Check(allocator.AllocatePersistent(16) == 0, "coalesced range serves a full allocation");
+    }
+
+    void CheckTransient() {
+        constexpr uint32 persistent = 8;
+        DescriptorAllocator allocator(persistent, 10);
+
+        uint32 first = allocator.AllocateTransient(4);
+        Check(first == persistent, "transient region follows the persistent one");
+        Check(allocator.AllocateTransient(4) == persistent + 4, "transient ranges are linear");
+        allocator.CloseFrame(1);
+
+        // 2 left at the end of the ring; a 3 range skips them and wraps, but the
+        // front is still owned by frame 1
+        Check(allocator.AllocateTransient(3) == INVALID_DESCRIPTOR_INDEX, "ring does not overwrite frames in flight");
+        uint32 pending = allocator.AllocateTransient(1);
+        Check(pending == persistent + 8, "the end of the ring is used while it fits");
+        allocator.CloseFrame(2);
+        allocator.Recycle(1);
+        uint32 wrapped = allocator.AllocateTransient(3);
+        Check(wrapped == persistent, "ranges never straddle the end of the ring");
+        allocator.CloseFrame(3);
+
+        Check(allocator.AllocateTransient(11) == INVALID_DESCRIPTOR_INDEX, "oversized transient range fails");
+        Check(allocator.GetStats().transientUsed == 5, "skipped end counts until its frame completes");
+        allocator.Recycle(3);
+        Check(allocator.GetStats().transientUsed == 0, "completed frames release the ring");
+        Check(allocator.GetStats().transientPeak == 9, "transient peak is tracked");
+
+        // An empty ring restarts at its beginning instead of waiting on the skipped end
+        allocator.CloseFrame(4);
+        allocator.Recycle(4);
+        Check(allocator.AllocateTransient(10) == persistent, "ring is fully reusable");
+    }
+
+    struct LiveSet {
+        uint32 index;
+        uint32 count;
+    };
+
+    void Benchmark(uint32 frameCount, uint32 capacity, uint32 seed) {
+        DescriptorAllocator allocator(capacity, 1024);
+        std::mt19937 random(seed);
+        std::uniform_int_distribution<uint32> setSize(1, 8);
+
+        Vector<LiveSet> live;
+        uint64 allocations = 0;
+        uint64 frees = 0;
+        uint64 allocateTicks = 0;
+        uint64 freeTicks = 0;
+        float32 worstFragmentation = 0.0f;
+        uint32 worstFreeRanges = 0;
+
+        // Fill to about three quarters, then churn around that level
+        uint32 target = capacity * 3 / 4;
+        for (uint32 frame = 1; frame <= frameCount; ++frame) {
+            if (frame > FRAMES_IN_FLIGHT) {
+                allocator.Recycle(frame - FRAMES_IN_FLIGHT);
+            }
+
+            uint32 churn = 16 + random() % 48;
+            for (uint32 i = 0; i < churn && !live.empty(); ++i) {
+                size_t victim = random() % live.size();
+                uint64 begin = Platform::GetPerformanceCounter();
+                allocator.FreePersistent(live[victim].index, live[victim].count);
+                freeTicks += Platform::GetPerformanceCounter() - begin;
+                ++frees;
+                live[victim] = live.back();
+                live.pop_back();
+            }
+
+            while (allocator.GetStats().persistentUsed < target) {
+                uint32 count = setSize(random);
+                uint64 begin = Platform::GetPerformanceCounter();
+                uint32 index = allocator.AllocatePersistent(count);
+                allocateTicks += Platform::GetPerformanceCounter() - begin;
+                ++allocations;
+                if (index == INVALID_DESCRIPTOR_INDEX) {
+                    break;
+                }
+                live.push_back({ index, count });
+            }
+
+            allocator.AllocateTransient(32 + random() % 64);
+            allocator.CloseFrame(frame);
+
+            worstFragmentation = std::max(worstFragmentation, allocator.GetFragmentation());
+            worstFreeRanges = std::max(worstFreeRanges, allocator.GetStats().freeRanges);
+        }
+
+        DescriptorAllocatorStats stats = allocator.GetStats();
+        double nsPerTick = 1.0e9 / static_cast<double>(Platform::GetPerformanceFrequency());
+        std::printf("  churn           %u frames, %u descriptors, %llu allocations, %llu frees\n",
+                    frameCount, capacity, static_cast<unsigned long long>(allocations), static_cast<unsigned long long>(frees));
+        std::printf("  occupancy       %u used, %u peak, %u pending, %u failed\n",
+                    stats.persistentUsed, stats.persistentPeak, stats.pendingFrees, stats.failedAllocations);
+        std::printf("  fragmentation   %.3f final, %.3f worst, %u free ranges (worst %u), largest %u\n",
+                    allocator.GetFragmentation(), worstFragmentation, stats.freeRanges, worstFreeRanges, stats.largestFreeRange);
+        std::printf("  transient       %u peak of %u\n", stats.transientPeak, stats.transientCapacity);
+        std::printf("  cost            %.1f ns allocate, %.1f ns free\n",
+                    allocations ? allocateTicks * nsPerTick / allocations : 0.0,
+                    frees ? freeTicks * nsPerTick / frees : 0.0);
+
+        // Drain everything; the region must come back as one range
+        for (const LiveSet& set : live) {
+            allocator.FreePersistent(set.index, set.count);
+        }
+        allocator.CloseFrame(frameCount + 1);
+        allocator.Recycle(frameCount + 1);
+        stats = allocator.GetStats();
+        Check(stats.persistentUsed == 0 && stats.freeRanges == 1, "churned region coalesces after draining");
+        Check(stats.transientUsed == 0, "transient ring drains");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 frameCount = 10000;
+    uint32 capacity = 4096;
+    uint32 seed = 1;
+
+    Arguments arguments(argc, argv, "Usage: DescriptorAllocatorCheck [--frames N] [--capacity N] [--seed N]");
+    arguments.Option("--frames", frameCount);
+    arguments.Option("--capacity", capacity);
+    arguments.Option("--seed", seed);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    if (capacity < 64) {
+        arguments.PrintUsage();
+        return 1;
+    }
+
+    std::printf("Descriptor allocator\n\n");
+    CheckPersistent();
+    CheckTransient();
+    if (frameCount > 0) {
+        Benchmark(frameCount, capacity, seed);
+    }
+
+    return Finish();
+}
@@ -0,0 +1,201 @@
+// Headless check of the fixed-step simulation loop.
+//
+// Usage: FixedTimestepCheck [--steps N]
+//
+// Runs the same scene through FixedTimestep at 144 Hz, 60 Hz and with jittery frame
+// times and verifies that after N simulation steps every run reached bit-identical
+// transforms (the old variable-delta update is shown for comparison). Also checks the
+// catch-up clamp on long frames, the interpolation alpha, and that transforms blend
+// from the previous step to the current one (rotations along the shortest arc).
+// Exits with 1 on any failure.
+
+#include "Core/Application/FixedTimestep.h"
+#include "Core/Scene/Scene.h"
+#include "Core/Entity/Entity.h"
+#include "Core/Entity/TransformComponent.h"
+#include "../Common/CheckHarness.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+
+using namespace CheckHarness;
+using namespace DirectX;
+
+namespace {
+    float32 MaxDifference(const XMMATRIX& a, const XMMATRIX& b) {
+        XMFLOAT4X4 left;
+        XMFLOAT4X4 right;
+        XMStoreFloat4x4(&left, a);
+        XMStoreFloat4x4(&right, b);
+        float32 difference = 0.0f;
+        for (int row = 0; row < 4; ++row) {
+            for (int column = 0; column < 4; ++column) {
+                difference = std::fmax(difference, std::fabs(left(row, column) - right(row, column)));
+            }
+        }
+        return difference;
+    }
+
+    // Units that accelerate and turn, so the result depends on how time is sliced
+    class DriftScene : public Scene {
+    public:
+        DriftScene() {
+            for (uint32 i = 0; i < 8; ++i) {
+                Entity* unit = SpawnEntity<Entity>();
+                unit->GetComponent<TransformComponent>()->SetPosition(static_cast<float>(i), 0.0f, 0.0f);
+                m_units.push_back(unit);
+            }
+        }
+
+        void Update(float deltaTime) override {
+            for (size_t i = 0; i < m_units.size(); ++i) {
+                TransformComponent* transform = m_units[i]->GetComponent<TransformComponent>();
+                m_speed += deltaTime * 0.5f;
+                XMFLOAT3 forward = transform->GetForward();
+                transform->AddPosition(forward.x * m_speed * deltaTime, 0.0f, forward.z * m_speed * deltaTime);
+                transform->AddRotation(0.0f, deltaTime * (0.3f + 0.1f * static_cast<float>(i)), 0.0f);
+            }
+            Scene::Update(deltaTime);
+        }
+
+        Vector<XMFLOAT3> GetPositions() const {
+            Vector<XMFLOAT3> positions;
+            for (Entity* unit : m_units) {
+                positions.push_back(unit->GetComponent<TransformComponent>()->GetPosition());
+            }
+            return positions;
+        }
+
+    private:
+        Vector<Entity*> m_units;
+        float m_speed = 1.0f;
+    };
+
+    // Feeds frames of the given lengths until the simulation has run stepCount steps
+    template<typename NextFrame>
+    Vector<XMFLOAT3> RunFixed(uint32 stepCount, NextFrame nextFrame, uint32& outFrames) {
+        DriftScene scene;
+        FixedTimestep timestep(30.0f, 1000);
+        uint32 simulated = 0;
+        outFrames = 0;
+        while (simulated < stepCount) {
+            uint32 steps = timestep.Advance(nextFrame());
+            for (uint32 i = 0; i < steps && simulated < stepCount; ++i, ++simulated) {
+                scene.Simulate(timestep.GetStepSeconds());
+            }
+            ++outFrames;
+        }
+        return scene.GetPositions();
+    }
+
+    void CheckDeterminism(uint32 stepCount) {
+        std::mt19937 random(11);
+        std::uniform_real_distribution<float32> jitter(0.004f, 0.045f);
+
+        uint32 frames144 = 0;
+        uint32 frames60 = 0;
+        uint32 framesJitter = 0;
+        Vector<XMFLOAT3> at144 = RunFixed(stepCount, []() { return 1.0f / 144.0f; }, frames144);
+        Vector<XMFLOAT3> at60 = RunFixed(stepCount, []() { return 1.0f / 60.0f; }, frames60);
+        Vector<XMFLOAT3> atJitter = RunFixed(stepCount, [&]() { return jitter(random); }, framesJitter);
+
+        bool same = std::memcmp(at144.data(), at60.data(), at144.size() * sizeof(XMFLOAT3)) == 0 &&
+                    std::memcmp(at144.data(), atJitter.data(), at144.size() * sizeof(XMFLOAT3)) == 0;
+        std::printf("  fixed steps     %u steps after %u / %u / %u frames (144 Hz / 60 Hz / jitter): %s\n",
+                    stepCount, frames144, frames60, framesJitter, same ? "identical" : "DIFFERENT");
+        Check(same, "fixed steps give the same state at any frame rate");
+
+        // The old loop: one update per frame with the frame's delta
+        DriftScene variable144;
+        DriftScene variable60;
+        float32 seconds = static_cast<float32>(stepCount) / 30.0f;
+        for (uint32 i = 0; i < static_cast<uint32>(seconds * 144.0f + 0.5f); ++i) {
+            variable144.Update(1.0f / 144.0f);
+        }
+        for (uint32 i = 0; i < static_cast<uint32>(seconds * 60.0f + 0.5f); ++i) {
+            variable60.Update(1.0f / 60.0f);
+        }
+        XMFLOAT3 a = variable144.GetPositions().back();
+        XMFLOAT3 b = variable60.GetPositions().back();
+        std::printf("  variable delta  last unit differs by %.4f between 144 Hz and 60 Hz\n",
+                    std::sqrt((a.x - b.x) * (a.x - b.x) + (a.z - b.z) * (a.z - b.z)));
+    }
+
+    void CheckClampAndAlpha() {
+        FixedTimestep timestep(20.0f, 5);
+        Check(timestep.Advance(0.025f) == 0 && std::fabs(timestep.GetAlpha() - 0.5f) < 1.0e-4f, "partial step becomes alpha");
+        Check(timestep.Advance(0.030f) == 1 && std::fabs(timestep.GetAlpha() - 0.1f) < 1.0e-4f, "a full step is run");
+        Check(timestep.Advance(-1.0f) == 0 && timestep.Advance(0.0f) == 0, "empty frames run nothing");
+
+        // A two-second stall runs the limit and drops the rest
+        uint32 steps = timestep.Advance(2.0f);
+        const FixedTimestepStats& stats = timestep.GetStats();
+        std::printf("  2 s stall       %u steps, %.3f s dropped, alpha %.3f\n", steps, stats.droppedSeconds, timestep.GetAlpha());
+        Check(steps == 5 && stats.clampedFrames == 1, "catch-up is clamped");
+        Check(std::fabs(stats.droppedSeconds - 1.75) < 0.05 && timestep.GetAlpha() >= 0.0f && timestep.GetAlpha() < 1.0f,
+              "clamped time is dropped, the partial step is kept");
+        Check(timestep.Advance(1.0f / 144.0f) <= 1 && timestep.GetStats().clampedFrames == 1, "next frame does not catch up");
+        Check(std::fabs(timestep.GetSimulationTime() - static_cast<float64>(timestep.GetStepCount()) * 0.05) < 1.0e-9,
+              "simulation time counts steps");
+
+        timestep.Reset();
+        Check(timestep.GetStepCount() == 0 && timestep.GetAlpha() == 0.0f && timestep.GetStats().clampedFrames == 0, "reset");
+    }
+
+    void CheckInterpolation() {
+        TransformComponent transform;
+        transform.SetPosition(0.0f, 0.0f, 0.0f);
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(0.0f), transform.GetWorldMatrix()) == 0.0f,
+              "nothing to blend from before the first step");
+
+        transform.SavePreviousState();
+        transform.SetPosition(10.0f, 0.0f, 4.0f);
+        transform.SetRotation(0.0f, XM_PIDIV2, 0.0f);
+        transform.SetScale(3.0f);
+
+        XMMATRIX halfway = XMMatrixScaling(2.0f, 2.0f, 2.0f) * XMMatrixRotationY(XM_PIDIV4) * XMMatrixTranslation(5.0f, 0.0f, 2.0f);
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(0.5f), halfway) < 1.0e-4f, "halfway blends position, rotation and scale");
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(0.0f), XMMatrixIdentity()) < 1.0e-4f, "alpha 0 is the previous step");
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(1.0f), transform.GetWorldMatrix()) == 0.0f, "alpha 1 is the current step");
+
+        // 350 to 10 degrees passes through 0, not 180
+        transform.SetRotation(0.0f, XMConvertToRadians(350.0f), 0.0f);
+        transform.SetScale(1.0f);
+        transform.SetPosition(0.0f, 0.0f, 0.0f);
+        transform.SavePreviousState();
+        transform.SetRotation(0.0f, XMConvertToRadians(10.0f), 0.0f);
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(0.5f), XMMatrixIdentity()) < 1.0e-4f, "rotation takes the short way");
+
+        transform.SetPosition(100.0f, 0.0f, 0.0f);
+        transform.ResetInterpolation();
+        Check(MaxDifference(transform.GetInterpolatedWorldMatrix(0.25f), transform.GetWorldMatrix()) == 0.0f, "teleports do not blend");
+
+        // Scene::Simulate keeps the state from before the step
+        DriftScene scene;
+        TransformComponent* unit = scene.GetEntities().back()->GetComponent<TransformComponent>();
+        XMMATRIX before = unit->GetWorldMatrix();
+        scene.Simulate(1.0f / 30.0f);
+        Check(MaxDifference(unit->GetInterpolatedWorldMatrix(0.0f), before) < 1.0e-5f &&
+              MaxDifference(unit->GetInterpolatedWorldMatrix(1.0f), unit->GetWorldMatrix()) == 0.0f,
+              "simulate blends from the previous step");
+        Check(scene.GetInterpolationAlpha() == 1.0f, "unsimulated scenes render the current state");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 stepCount = 3000;
+
+    Arguments arguments(argc, argv, "Usage: FixedTimestepCheck [--steps N]");
+    arguments.Option("--steps", stepCount);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("Fixed timestep\n\n");
+    CheckDeterminism(stepCount > 0 ? stepCount : 1);
+    CheckClampAndAlpha();
+    CheckInterpolation();
+
+    return Finish();
+}
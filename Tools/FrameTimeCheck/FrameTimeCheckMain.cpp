@@ -0,0 +1,229 @@
+// Headless check of the frame-time statistics kept by Timer.
+//
+// Usage: FrameTimeCheck [--skip-timer]
+//
+// Feeds synthetic frame times into FrameTimeStats and verifies the nearest-rank
+// percentiles, the rolling window and its histogram, both hitch thresholds (absolute
+// and relative to the window average) and that a hitch is attributed to the profiler
+// zone with the most self time. Then ticks a real Timer across short sleeps and one
+// long one, which must be reported as a hitch. --skip-timer leaves out the sleeps for
+// machines where wall-clock timing is unreliable. Exits with 1 on any failure.
+
+#include "Core/Application/Timer.h"
+#include "Core/Profiling/Profiler.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <random>
+#include <thread>
+
+using namespace CheckHarness;
+
+namespace {
+    bool Near(float32 a, float32 b) {
+        return std::fabs(a - b) < 1.0e-3f;
+    }
+
+    void CheckPercentiles() {
+        FrameTimeStatsConfig config;
+        config.windowSize = 100;
+        config.hitchThresholdMs = 1000.0f;
+        config.hitchAverageRatio = 0.0f;
+        FrameTimeStats stats(config);
+
+        Vector<float32> frames(100);
+        std::iota(frames.begin(), frames.end(), 1.0f);
+        std::shuffle(frames.begin(), frames.end(), std::mt19937(7));
+        for (float32 frameTimeMs : frames) {
+            stats.AddFrame(frameTimeMs);
+        }
+
+        FrameTimeSummary summary = stats.GetSummary();
+        std::printf("  1..100 ms       p50 %.1f  p95 %.1f  p99 %.1f  max %.1f  avg %.2f\n",
+                    summary.p50Ms, summary.p95Ms, summary.p99Ms, summary.maxMs, summary.averageMs);
+        Check(summary.frameCount == 100, "summary covers the window");
+        Check(Near(summary.p50Ms, 50.0f) && Near(summary.p95Ms, 95.0f) && Near(summary.p99Ms, 99.0f),
+              "percentiles use the nearest rank");
+        Check(Near(summary.maxMs, 100.0f) && Near(summary.averageMs, 50.5f), "max and average");
+        Check(Near(stats.GetPercentile(90.0f), 90.0f) && Near(stats.GetPercentile(0.0f), 1.0f) &&
+              Near(stats.GetPercentile(100.0f), 100.0f), "arbitrary percentiles");
+        Check(stats.GetHitchCount() == 0, "no hitches under the thresholds");
+
+        FrameTimeStats empty;
+        Check(empty.GetSummary().frameCount == 0 && empty.GetPercentile(99.0f) == 0.0f, "empty window reports zeros");
+    }
+
+    void CheckWindowAndHistogram() {
+        FrameTimeStatsConfig config;
+        config.windowSize = 10;
+        config.hitchThresholdMs = 1000.0f;
+        config.hitchAverageRatio = 0.0f;
+        config.histogramBucketMs = 2.0f;
+        config.histogramBucketCount = 8;
+        FrameTimeStats stats(config);
+
+        // Ten long frames, then ten short ones push them out of the window
+        for (uint32 i = 0; i < 10; ++i) {
+            stats.AddFrame(100.0f);
+        }
+        Check(stats.GetHistogram()[7] == 10, "frames past the last bucket land in it");
+        for (uint32 i = 0; i < 10; ++i) {
+            stats.AddFrame(i < 5 ? 1.0f : 3.5f);
+        }
+
+        const Vector<uint32>& histogram = stats.GetHistogram();
+        uint32 total = std::accumulate(histogram.begin(), histogram.end(), 0u);
+        FrameTimeSummary summary = stats.GetSummary();
+        Check(stats.GetFrameCount() == 20 && summary.frameCount == 10, "window keeps only the last frames");
+        Check(total == 10 && histogram[0] == 5 && histogram[1] == 5 && histogram[7] == 0, "histogram follows the window");
+        Check(Near(summary.maxMs, 3.5f) && Near(summary.averageMs, 2.25f), "evicted frames leave the summary");
+        std::printf("%s", stats.FormatHistogram().c_str());
+
+        stats.Reset();
+        Check(stats.GetSummary().frameCount == 0 && stats.GetHistogram()[0] == 0 && stats.GetFrameCount() == 0,
+              "reset clears the window");
+    }
+
+    void CheckHitches() {
+        // Defaults: 50 ms, or 3x the window average
+        FrameTimeStats stats;
+        uint32 reported = 0;
+        for (uint32 i = 0; i < 300; ++i) {
+            float32 frameTimeMs = 16.0f;
+            if (i == 100) {
+                frameTimeMs = 40.0f;    // Under 3 x 16 ms: not a hitch
+            } else if (i == 200) {
+                frameTimeMs = 49.0f;    // Over 3 x the average, under 50 ms
+            } else if (i == 250) {
+                frameTimeMs = 120.0f;
+            }
+            reported += stats.AddFrame(frameTimeMs) ? 1 : 0;
+        }
+        Check(stats.GetHitchCount() == 2 && reported == 2, "hitches over either threshold are counted");
+        Check(stats.GetRecentHitches().size() == 2 && stats.GetRecentHitches()[0].frameIndex == 200 &&
+              stats.GetRecentHitches()[1].frameIndex == 250, "hitches keep their frame index");
+        Check(stats.GetRecentHitches()[1].zone == nullptr, "hitches without a profile have no zone");
+
+        FrameTimeStatsConfig config;
+        config.hitchThresholdMs = 30.0f;
+        config.hitchAverageRatio = 0.0f;
+        config.hitchHistory = 4;
+        stats.SetConfig(config);
+        for (uint32 i = 0; i < 100; ++i) {
+            stats.AddFrame(i % 10 == 0 ? 31.0f : 1.0f);
+        }
+        Check(stats.GetHitchCount() == 10, "absolute threshold alone");
+        Check(stats.GetRecentHitches().size() == 4 && stats.GetRecentHitches().back().frameIndex == 90,
+              "only the latest hitches are kept");
+
+        config.hitchThresholdMs = 50.0f;
+        config.hitchAverageRatio = 2.0f;
+        stats.SetConfig(config);
+        stats.AddFrame(0.0f);
+        Check(!stats.AddFrame(0.0f), "idle frames are not hitches");
+        Check(!stats.AddFrame(30.0f), "zero average falls back to the absolute threshold");
+    }
+
+    void CheckAttribution() {
+        Profiler& profiler = Profiler::GetGlobal();
+        profiler.SetThreadName("Main");
+        profiler.EndFrame();
+
+        {
+            PROFILE_SCOPE("Application::Frame");
+            {
+                PROFILE_SCOPE("Scene::Update");
+                Spin(500);
+                {
+                    PROFILE_SCOPE("Pathfinding::Solve");
+                    Spin(3000);
+                }
+            }
+            {
+                PROFILE_SCOPE("Scene::Render");
+                Spin(500);
+            }
+        }
+        // Busier in its own zone, but not on the thread the frame waited on
+        std::thread worker([]() {
+            Profiler::GetGlobal().SetThreadName("Worker");
+            PROFILE_SCOPE("AssetManager::Load");
+            Spin(3500);
+        });
+        worker.join();
+        profiler.EndFrame();
+
+        const ProfileFrame* frame = profiler.GetLastFrame();
+        FrameTimeStats stats;
+        Check(stats.AddFrame(60.0f, frame), "long frame is a hitch");
+        const FrameHitch& hitch = stats.GetRecentHitches().back();
+        std::printf("  hitch           %.1f ms, slowest zone %s (%.2f ms self)\n",
+                    hitch.frameTimeMs, hitch.zone ? hitch.zone : "(none)", hitch.zoneSelfMs);
+        Check(hitch.zone && std::strcmp(hitch.zone, "Pathfinding::Solve") == 0, "hitch names the slowest zone");
+        Check(hitch.zoneSelfMs >= 2.9f, "hitch carries the zone's self time");
+
+        ProfileFrame emptyFrame;
+        float32 selfMs = 1.0f;
+        Check(FrameTimeStats::FindSlowestZone(emptyFrame, selfMs) == nullptr && selfMs == 0.0f, "empty profile has no zone");
+    }
+
+    void CheckTimer() {
+        using namespace std::chrono_literals;
+
+        FrameTimeStatsConfig config;
+        config.hitchAverageRatio = 0.0f;
+        Timer timer;
+        timer.GetFrameStats().SetConfig(config);
+        timer.Reset();
+
+        for (uint32 i = 0; i < 10; ++i) {
+            std::this_thread::sleep_for(2ms);
+            timer.Tick();
+        }
+        std::this_thread::sleep_for(60ms);
+        timer.Tick();
+        float32 hitchDelta = timer.GetDeltaTime();
+
+        const FrameTimeStats& stats = timer.GetFrameStats();
+        FrameTimeSummary summary = stats.GetSummary();
+        std::printf("  timer           %u frames, p50 %.2f ms, max %.2f ms, %llu hitches\n",
+                    summary.frameCount, summary.p50Ms, summary.maxMs, static_cast<unsigned long long>(stats.GetHitchCount()));
+        Check(hitchDelta >= 0.059f && hitchDelta < 1.0f, "delta time follows the clock");
+        Check(summary.frameCount == 11 && timer.GetFrameCount() == 11, "every tick is a frame");
+        Check(summary.p50Ms >= 2.0f && Near(summary.maxMs, hitchDelta * 1000.0f), "window holds tick deltas");
+        Check(stats.GetHitchCount() >= 1 && stats.GetRecentHitches().back().frameIndex == 10, "long frame is a hitch");
+        Check(stats.GetRecentHitches().back().zone == nullptr, "frames profiled before the reset are not attributed");
+
+        timer.Stop();
+        std::this_thread::sleep_for(60ms);
+        timer.Start();
+        timer.Tick();
+        Check(timer.GetDeltaTime() < 0.05f, "paused time is not a frame");
+    }
+}
+
+int main(int argc, char** argv) {
+    bool runTimer = true;
+
+    Arguments arguments(argc, argv, "Usage: FrameTimeCheck [--skip-timer]");
+    runTimer = !arguments.Switch("--skip-timer");
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("Frame time statistics\n\n");
+    CheckPercentiles();
+    CheckWindowAndHistogram();
+    CheckHitches();
+    CheckAttribution();
+    if (runTimer) {
+        CheckTimer();
+    }
+
+    return Finish();
+}
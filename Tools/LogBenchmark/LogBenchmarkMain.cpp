@@ -0,0 +1,244 @@
+// Headless check and microbenchmark of the asynchronous logger.
+//
+// Usage: LogBenchmark [--calls N] [--threads N]
+//
+// Checks that {} placeholders format every argument type, that long strings are cut to
+// the record instead of overflowing it, and that concurrent producers lose nothing
+// they were not told about (every message is either written, in per-thread order, or
+// counted as dropped). Then times the caller's cost per log call:
+//   stripped  level below LOG_COMPILED_LEVEL
+//   disabled  level below the runtime level
+//   enabled   formatted lazily by the drain thread, one and several producer threads
+//   eager     the old pattern: build the string with std::to_string on the caller
+// Exits with 1 on any failure.
+
+// Strip Trace here regardless of the build type, so all three cases can be timed
+#define LOG_COMPILED_LEVEL 1
+
+#include "Core/Logging/Logger.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace CheckHarness;
+
+namespace {
+    String GetLogPath() {
+        return (std::filesystem::temp_directory_path() / "LogBenchmark.log").string();
+    }
+
+    // Message text of every line in the log file (after the "[time level] " prefix)
+    Vector<String> ReadMessages(const String& path) {
+        Vector<String> messages;
+        std::ifstream file(path);
+        String line;
+        while (std::getline(file, line)) {
+            size_t prefixEnd = line.find("] ");
+            messages.push_back(prefixEnd != String::npos ? line.substr(prefixEnd + 2) : line);
+        }
+        return messages;
+    }
+
+    void CheckFormatting() {
+        String path = GetLogPath();
+        {
+            Logger logger(64);
+            logger.SetSinks(0);
+            Check(logger.OpenFile(path), "log file opens");
+
+            enum class Team : uint8 { Red = 2 };
+            String name = "Harvester";
+            int32 value = -7;
+            logger.Write(LogLevel::Info, "Scene: Registered entity {} ({})", 42u, name);
+            logger.Write(LogLevel::Info, "{} {} {} {}", value, 0.5f, true, Team::Red);
+            logger.Write(LogLevel::Info, "Missing {} and {}", "one");
+            logger.Write(LogLevel::Info, "Long {} then {}", String(1000, 'x'), 1);
+            logger.Flush();
+            Check(logger.GetStats().written == 4, "flush waits for every record");
+        }
+
+        Vector<String> messages = ReadMessages(path);
+        Check(messages.size() == 4, "one line per message");
+        if (messages.size() == 4) {
+            Check(messages[0] == "Scene: Registered entity 42 (Harvester)", "unsigned and string arguments");
+            Check(messages[1] == "-7 0.5 true 2", "signed, float, bool and enum arguments");
+            Check(messages[2] == "Missing one and {}", "placeholders without arguments are kept");
+            Check(messages[3].size() > 200 && messages[3].size() < Logger::RECORD_SIZE &&
+                  messages[3].compare(0, 5, "Long ") == 0 && messages[3].find('1') == String::npos,
+                  "long strings are cut to the record");
+        }
+        std::filesystem::remove(path);
+    }
+
+    void CheckProducers(uint32 threadCount) {
+        constexpr uint32 messagesPerThread = 20000;
+        String path = GetLogPath();
+        LoggerStats stats;
+        {
+            // Small ring so producers overrun the drain thread
+            Logger logger(256);
+            logger.SetSinks(0);
+            logger.OpenFile(path);
+
+            Vector<std::thread> threads;
+            for (uint32 t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&logger, t]() {
+                    for (uint32 i = 0; i < messagesPerThread; ++i) {
+                        logger.Write(LogLevel::Info, "{} {}", t, i);
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            logger.Flush();
+            stats = logger.GetStats();
+        }
+
+        Vector<int64> lastIndex(threadCount, -1);
+        uint64 received = 0;
+        bool ordered = true;
+        for (const String& message : ReadMessages(path)) {
+            unsigned thread = 0;
+            unsigned index = 0;
+            if (std::sscanf(message.c_str(), "%u %u", &thread, &index) != 2 || thread >= threadCount) {
+                continue;   // "messages dropped" notices
+            }
+            ordered = ordered && static_cast<int64>(index) > lastIndex[thread];
+            lastIndex[thread] = index;
+            ++received;
+        }
+        std::filesystem::remove(path);
+
+        uint64 sent = static_cast<uint64>(threadCount) * messagesPerThread;
+        std::printf("  producers       %u threads, %llu sent, %llu written, %llu dropped\n", threadCount,
+                    static_cast<unsigned long long>(sent), static_cast<unsigned long long>(stats.written),
+                    static_cast<unsigned long long>(stats.dropped));
+        Check(received == stats.written, "every written message reaches the file");
+        Check(stats.written + stats.dropped == sent, "every message is written or counted as dropped");
+        Check(ordered, "messages of one thread keep their order");
+    }
+
+    double NanosecondsPerCall(int64 ticks, uint64 calls) {
+        return calls ? static_cast<double>(ticks) * 1.0e9 / static_cast<double>(Platform::GetPerformanceFrequency()) / calls : 0.0;
+    }
+
+    // Times batches that fit the ring, flushing between them, so nothing is dropped
+    template<typename Func>
+    double TimeBatches(uint32 calls, Func&& logCall) {
+        Logger& logger = Logger::GetGlobal();
+        constexpr uint32 batch = Logger::DEFAULT_CAPACITY / 2;
+        int64 ticks = 0;
+        for (uint32 done = 0; done < calls; done += batch) {
+            uint32 count = std::min(batch, calls - done);
+            int64 begin = Platform::GetPerformanceCounter();
+            for (uint32 i = 0; i < count; ++i) {
+                logCall(done + i);
+            }
+            ticks += Platform::GetPerformanceCounter() - begin;
+            logger.Flush();
+        }
+        return NanosecondsPerCall(ticks, calls);
+    }
+
+    void Benchmark(uint32 calls, uint32 threadCount) {
+        Logger& logger = Logger::GetGlobal();
+        logger.SetSinks(0);
+        logger.SetLevel(LogLevel::Info);
+        String name = "Harvester";
+        float32 red = 0.25f;
+        float32 green = 0.5f;
+        float32 blue = 1.0f;
+        LoggerStats before = logger.GetStats();
+
+        int64 begin = Platform::GetPerformanceCounter();
+        for (uint32 i = 0; i < calls; ++i) {
+            LOG_TRACE("MeshComponent: {} objectIndex={} color=({}, {}, {})", name, i, red, green, blue);
+        }
+        double stripped = NanosecondsPerCall(Platform::GetPerformanceCounter() - begin, calls);
+
+        begin = Platform::GetPerformanceCounter();
+        for (uint32 i = 0; i < calls; ++i) {
+            LOG_DEBUG("MeshComponent: {} objectIndex={} color=({}, {}, {})", name, i, red, green, blue);
+        }
+        double disabled = NanosecondsPerCall(Platform::GetPerformanceCounter() - begin, calls);
+
+        double enabled = TimeBatches(calls, [&](uint32 i) {
+            LOG_INFO("MeshComponent: {} objectIndex={} color=({}, {}, {})", name, i, red, green, blue);
+        });
+
+        // Producers sharing the ring, each logging its share of half the ring per round
+        uint32 batch = std::max(1u, Logger::DEFAULT_CAPACITY / 2 / threadCount);
+        uint32 rounds = std::max(1u, calls / (batch * threadCount));
+        std::atomic<int64> contendedTicks{ 0 };
+        for (uint32 round = 0; round < rounds; ++round) {
+            Vector<std::thread> threads;
+            for (uint32 t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&, t]() {
+                    int64 start = Platform::GetPerformanceCounter();
+                    for (uint32 i = 0; i < batch; ++i) {
+                        LOG_INFO("MeshComponent: {} objectIndex={} color=({}, {}, {})", name, t * batch + i, red, green, blue);
+                    }
+                    contendedTicks += Platform::GetPerformanceCounter() - start;
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+            logger.Flush();
+        }
+        uint64 contendedCalls = static_cast<uint64>(rounds) * batch * threadCount;
+        double contended = NanosecondsPerCall(contendedTicks.load(), contendedCalls);
+
+        // What MeshComponent::Render used to do per draw before the sink
+        uint64 characters = 0;
+        begin = Platform::GetPerformanceCounter();
+        for (uint32 i = 0; i < calls; ++i) {
+            String message = "MeshComponent: " + name + " objectIndex=" + std::to_string(i) + " color=(" +
+                             std::to_string(red) + ", " + std::to_string(green) + ", " + std::to_string(blue) + ")\n";
+            characters += message.size();
+        }
+        double eager = NanosecondsPerCall(Platform::GetPerformanceCounter() - begin, calls);
+
+        LoggerStats after = logger.GetStats();
+        std::printf("  stripped        %8.2f ns/call\n", stripped);
+        std::printf("  disabled        %8.2f ns/call\n", disabled);
+        std::printf("  enabled         %8.2f ns/call\n", enabled);
+        std::printf("  enabled x%-2u     %8.2f ns/call\n", threadCount, contended);
+        std::printf("  eager string    %8.2f ns/call (%llu characters, sink not included)\n", eager,
+                    static_cast<unsigned long long>(characters));
+        Check(after.dropped == before.dropped, "batched benchmark drops nothing");
+        Check(after.written - before.written == calls + contendedCalls, "every enabled call is written");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 calls = 1000000;
+    uint32 threadCount = 4;
+
+    Arguments arguments(argc, argv, "Usage: LogBenchmark [--calls N] [--threads N]");
+    arguments.Option("--calls", calls);
+    arguments.Option("--threads", threadCount);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    if (threadCount == 0) {
+        arguments.PrintUsage();
+        return 1;
+    }
+
+    std::printf("Logger\n\n");
+    CheckFormatting();
+    CheckProducers(threadCount);
+    if (calls > 0) {
+        Benchmark(calls, threadCount);
+    }
+
+    return Finish();
+}
@@ -0,0 +1,287 @@
+// Headless check and microbenchmark of compiled material layouts.
+//
+// Usage: MaterialUpdateBenchmark [--materials N] [--frames N] [--updates N]
+//
+// Checks that MaterialLayout places constants with HLSL cbuffer packing (against the
+// MaterialConstants block of Shaders/BasicMesh.ps.hlsl) and that MaterialParameterBlock
+// tracks the dirty byte range. Then simulates a frame loop over N materials, each
+// changing a few parameters per frame and uploading, three ways:
+//   legacy   name lookup per set, every parameter re-packed through a type switch
+//   by name  MaterialLayout::Find per set, dirty-range upload
+//   by ID    IDs resolved once, dirty-range upload
+// Exits with 1 on any failure.
+
+#include "Rendering/MaterialLayout.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+using namespace CheckHarness;
+
+namespace {
+    // A lit material: what Material::CreateLit declares plus a few tuning values
+    const struct {
+        const char* name;
+        MaterialParameterType type;
+    } s_litParameters[] = {
+        { "Albedo", MaterialParameterType::Float4 },
+        { "Metallic", MaterialParameterType::Float },
+        { "Roughness", MaterialParameterType::Float },
+        { "EmissiveColor", MaterialParameterType::Float3 },
+        { "EmissiveStrength", MaterialParameterType::Float },
+        { "UVScale", MaterialParameterType::Float2 },
+        { "UVOffset", MaterialParameterType::Float2 },
+        { "TeamColor", MaterialParameterType::Float4 },
+        { "AlphaCutoff", MaterialParameterType::Float },
+        { "UseVertexColor", MaterialParameterType::Bool },
+        { "DiffuseTexture", MaterialParameterType::Texture2D },
+    };
+    constexpr uint32 LIT_PARAMETER_COUNT = sizeof(s_litParameters) / sizeof(s_litParameters[0]);
+
+    void CheckPacking() {
+        // cbuffer MaterialConstants { float3 BaseColor; float Metallic; float Roughness; float3 Padding3; }
+        MaterialLayout layout;
+        MaterialParameterId baseColor = layout.AddParameter("BaseColor", MaterialParameterType::Float3);
+        MaterialParameterId metallic = layout.AddParameter("Metallic", MaterialParameterType::Float);
+        MaterialParameterId roughness = layout.AddParameter("Roughness", MaterialParameterType::Float);
+        MaterialParameterId padding = layout.AddParameter("Padding3", MaterialParameterType::Float3);
+        Check(layout.GetEntry(baseColor).offset == 0, "float3 starts the block");
+        Check(layout.GetEntry(metallic).offset == 12, "float fills the float3's register");
+        Check(layout.GetEntry(roughness).offset == 16, "next float starts a register");
+        Check(layout.GetEntry(padding).offset == 20, "float3 packs behind a float");
+        Check(layout.GetConstantSize() == 32, "block rounds to whole registers");
+
+        // A float3 after two floats would straddle; a float4 always starts a register
+        MaterialLayout straddle;
+        straddle.AddParameter("A", MaterialParameterType::Float2);
+        straddle.AddParameter("B", MaterialParameterType::Float);
+        MaterialParameterId c = straddle.AddParameter("C", MaterialParameterType::Float3);
+        MaterialParameterId d = straddle.AddParameter("D", MaterialParameterType::Bool);
+        MaterialParameterId e = straddle.AddParameter("E", MaterialParameterType::Float4);
+        MaterialParameterId texture = straddle.AddParameter("T", MaterialParameterType::Texture2D, 3);
+        Check(straddle.GetEntry(c).offset == 16, "float3 never straddles a register");
+        Check(straddle.GetEntry(d).offset == 28, "bool is a 32-bit slot");
+        Check(straddle.GetEntry(e).offset == 32, "float4 starts a register");
+        Check(straddle.GetEntry(texture).size == 0 && straddle.GetEntry(texture).textureSlot == 3, "textures take no constant space");
+        Check(straddle.GetConstantSize() == 48, "textures do not grow the block");
+        Check(straddle.AddParameter("C", MaterialParameterType::Float3) == c, "re-adding returns the same ID");
+        Check(straddle.AddParameter("C", MaterialParameterType::Float) == INVALID_MATERIAL_PARAMETER, "type conflict is rejected");
+        Check(straddle.Find("Missing") == INVALID_MATERIAL_PARAMETER, "unknown name has no ID");
+
+        // Dirty range covers exactly the written bytes
+        MaterialParameterBlock block(layout);
+        uint8 gpu[32] = {};
+        Check(block.Flush(gpu) == 32, "new block uploads in full");
+        Check(block.Flush(gpu) == 0, "clean block uploads nothing");
+        block.Set(metallic, 0.5f);
+        block.Set(metallic, 0.5f);
+        Check(block.Flush(gpu) == 4, "one float uploads four bytes");
+        block.Set(metallic, 0.5f);
+        Check(!block.IsDirty(), "unchanged value does not dirty");
+        block.Set(roughness, 0.25f);
+        block.Set(baseColor, DirectX::XMFLOAT3(1.0f, 0.0f, 0.0f));
+        Check(block.Flush(gpu) == 20, "dirty range spans the written parameters");
+        block.Set(roughness, 7);
+        Check(!block.IsDirty(), "wrong type is ignored");
+
+        float32 value = 0.0f;
+        std::memcpy(&value, gpu + 16, sizeof(value));
+        Check(value == 0.25f && block.Get(roughness, value) && value == 0.25f, "value lands at its offset");
+    }
+
+    // The pre-layout Material: name map, 16-byte aligned slots, full re-pack on change
+    struct LegacyMaterial {
+        struct Parameter {
+            MaterialParameterType type;
+            float32 value[4] = {};
+            uint32 offset = 0;
+        };
+        Vector<Parameter> parameters;
+        std::unordered_map<String, uint32> nameToIndex;
+        Vector<uint8> gpu;
+        bool needsUpdate = true;
+
+        LegacyMaterial() {
+            uint32 offset = 0;
+            for (uint32 i = 0; i < LIT_PARAMETER_COUNT; ++i) {
+                Parameter parameter;
+                parameter.type = s_litParameters[i].type;
+                if (s_litParameters[i].type != MaterialParameterType::Texture2D) {
+                    parameter.offset = (offset + 15) & ~15u;
+                    offset = parameter.offset + MaterialLayout::GetConstantSize(parameter.type);
+                }
+                parameters.push_back(parameter);
+                nameToIndex[s_litParameters[i].name] = i;
+            }
+            gpu.assign((offset + 15) & ~15u, 0);
+        }
+
+        void Set(const String& name, float32 value) {
+            auto it = nameToIndex.find(name);
+            if (it != nameToIndex.end() && parameters[it->second].type == MaterialParameterType::Float) {
+                parameters[it->second].value[0] = value;
+                needsUpdate = true;
+            }
+        }
+
+        void Set(const String& name, const DirectX::XMFLOAT4& value) {
+            auto it = nameToIndex.find(name);
+            if (it != nameToIndex.end() && parameters[it->second].type == MaterialParameterType::Float4) {
+                std::memcpy(parameters[it->second].value, &value, sizeof(value));
+                needsUpdate = true;
+            }
+        }
+
+        uint32 Update() {
+            if (!needsUpdate) {
+                return 0;
+            }
+            uint32 bytes = 0;
+            for (const Parameter& parameter : parameters) {
+                uint8* destination = gpu.data() + parameter.offset;
+                switch (parameter.type) {
+                    case MaterialParameterType::Float:  std::memcpy(destination, parameter.value, 4); bytes += 4; break;
+                    case MaterialParameterType::Float2: std::memcpy(destination, parameter.value, 8); bytes += 8; break;
+                    case MaterialParameterType::Float3: std::memcpy(destination, parameter.value, 12); bytes += 12; break;
+                    case MaterialParameterType::Float4: std::memcpy(destination, parameter.value, 16); bytes += 16; break;
+                    case MaterialParameterType::Bool: {
+                        int32 boolAsInt = parameter.value[0] != 0.0f ? 1 : 0;
+                        std::memcpy(destination, &boolAsInt, 4);
+                        bytes += 4;
+                        break;
+                    }
+                    default: break;
+                }
+            }
+            needsUpdate = false;
+            return bytes;
+        }
+    };
+
+    struct CompiledMaterial {
+        MaterialLayout layout;
+        MaterialParameterBlock constants;
+        Vector<uint8> gpu;
+
+        CompiledMaterial() {
+            for (uint32 i = 0; i < LIT_PARAMETER_COUNT; ++i) {
+                layout.AddParameter(s_litParameters[i].name, s_litParameters[i].type);
+            }
+            constants.Reset(layout);
+            gpu.assign(layout.GetConstantSize(), 0);
+            constants.Flush(gpu.data());
+        }
+    };
+
+    struct Result {
+        double nsPerMaterial;
+        uint64 bytesUploaded;
+        float32 checksum;
+    };
+
+    double Seconds(uint64 begin) {
+        return static_cast<double>(Platform::GetPerformanceCounter() - begin) / static_cast<double>(Platform::GetPerformanceFrequency());
+    }
+
+    // Per frame every material animates its team color pulse and, for `updates` of them, roughness
+    Result RunLegacy(uint32 materialCount, uint32 frameCount, uint32 updates) {
+        Vector<LegacyMaterial> materials(materialCount);
+        uint64 bytes = 0;
+        uint64 begin = Platform::GetPerformanceCounter();
+        for (uint32 frame = 0; frame < frameCount; ++frame) {
+            float32 pulse = static_cast<float32>(frame % 64) / 64.0f;
+            for (uint32 m = 0; m < materialCount; ++m) {
+                materials[m].Set("TeamColor", DirectX::XMFLOAT4(pulse, 0.2f, 0.2f, 1.0f));
+                if (m < updates) {
+                    materials[m].Set("Roughness", pulse);
+                }
+                bytes += materials[m].Update();
+            }
+        }
+        double seconds = Seconds(begin);
+        float32 checksum = 0.0f;
+        std::memcpy(&checksum, materials.back().gpu.data() + materials.back().parameters[7].offset, sizeof(checksum));
+        return { seconds * 1.0e9 / (static_cast<double>(materialCount) * frameCount), bytes, checksum };
+    }
+
+    Result RunCompiled(uint32 materialCount, uint32 frameCount, uint32 updates, bool resolveOnce) {
+        Vector<CompiledMaterial> materials(materialCount);
+        MaterialParameterId teamColor = materials[0].layout.Find("TeamColor");
+        MaterialParameterId roughness = materials[0].layout.Find("Roughness");
+
+        uint64 bytes = 0;
+        uint64 begin = Platform::GetPerformanceCounter();
+        for (uint32 frame = 0; frame < frameCount; ++frame) {
+            float32 pulse = static_cast<float32>(frame % 64) / 64.0f;
+            for (uint32 m = 0; m < materialCount; ++m) {
+                CompiledMaterial& material = materials[m];
+                material.constants.Set(resolveOnce ? teamColor : material.layout.Find("TeamColor"),
+                                       DirectX::XMFLOAT4(pulse, 0.2f, 0.2f, 1.0f));
+                if (m < updates) {
+                    material.constants.Set(resolveOnce ? roughness : material.layout.Find("Roughness"), pulse);
+                }
+                bytes += material.constants.Flush(material.gpu.data());
+            }
+        }
+        double seconds = Seconds(begin);
+        float32 checksum = 0.0f;
+        std::memcpy(&checksum, materials.back().gpu.data() + materials.back().layout.GetEntry(teamColor).offset, sizeof(checksum));
+        return { seconds * 1.0e9 / (static_cast<double>(materialCount) * frameCount), bytes, checksum };
+    }
+
+    void Benchmark(uint32 materialCount, uint32 frameCount, uint32 updates) {
+        MaterialLayout layout;
+        for (uint32 i = 0; i < LIT_PARAMETER_COUNT; ++i) {
+            layout.AddParameter(s_litParameters[i].name, s_litParameters[i].type);
+        }
+        LegacyMaterial legacyLayout;
+        std::printf("  layout          %u parameters, %u bytes packed (%zu bytes 16-byte aligned)\n",
+                    LIT_PARAMETER_COUNT, layout.GetConstantSize(), legacyLayout.gpu.size());
+        std::printf("  workload        %u materials x %u frames, team color every frame, roughness on %u\n\n",
+                    materialCount, frameCount, updates);
+
+        Result legacy = RunLegacy(materialCount, frameCount, updates);
+        Result byName = RunCompiled(materialCount, frameCount, updates, false);
+        Result byId = RunCompiled(materialCount, frameCount, updates, true);
+
+        auto print = [&](const char* label, const Result& result) {
+            std::printf("  %-14s  %7.1f ns/material  %8.1f KB uploaded/frame  %.2fx\n", label, result.nsPerMaterial,
+                        static_cast<double>(result.bytesUploaded) / frameCount / 1024.0, legacy.nsPerMaterial / result.nsPerMaterial);
+        };
+        print("legacy", legacy);
+        print("by name", byName);
+        print("by ID", byId);
+
+        Check(legacy.checksum == byName.checksum && byName.checksum == byId.checksum, "all paths upload the same value");
+        Check(byId.bytesUploaded < legacy.bytesUploaded, "dirty ranges upload less than full re-packs");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 materialCount = 2000;
+    uint32 frameCount = 500;
+    uint32 updates = 200;
+
+    Arguments arguments(argc, argv, "Usage: MaterialUpdateBenchmark [--materials N] [--frames N] [--updates N]");
+    arguments.Option("--materials", materialCount);
+    arguments.Option("--frames", frameCount);
+    arguments.Option("--updates", updates);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    if (materialCount == 0) {
+        arguments.PrintUsage();
+        return 1;
+    }
+
+    std::printf("Material parameter updates\n\n");
+    CheckPacking();
+    if (frameCount > 0) {
+        Benchmark(materialCount, frameCount, updates);
+    }
+
+    return Finish();
+}
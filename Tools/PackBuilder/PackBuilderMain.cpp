@@ -0,0 +1,75 @@
+// Offline packer: bundles loose asset files into a memory-mappable .pak archive.
+//
+// Usage: PackBuilder <output.pak> <file-or-directory>... [--compress none|lz4|zstd] [--align N]
+//
+// Directories are added recursively under their own name, so "PackBuilder Assets.pak Assets"
+// stores "Assets/Textures/a.bmp" as "assets/textures/a.bmp" and the game's paths resolve unchanged.
+// Use "--prefix path" before an input to place it under a different pack path.
+
+#include "Core/Assets/PackBuilder.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+    void PrintUsage() {
+        std::printf("Usage: PackBuilder <output.pak> <file-or-directory>... "
+                    "[--compress none|lz4|zstd] [--align N] [--prefix path]\n");
+    }
+
+    bool ParseCompression(const char* name, PackCompression& outCompression) {
+        if (std::strcmp(name, "none") == 0) { outCompression = PackCompression::None; return true; }
+        if (std::strcmp(name, "lz4") == 0)  { outCompression = PackCompression::LZ4;  return true; }
+        if (std::strcmp(name, "zstd") == 0) { outCompression = PackCompression::Zstd; return true; }
+        return false;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    PackBuilder builder;
+    String outputPath = argv[1];
+    String prefix;
+
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--compress") == 0 && i + 1 < argc) {
+            PackCompression compression;
+            if (!ParseCompression(argv[++i], compression)) {
+                std::fprintf(stderr, "Unknown compression '%s'\n", argv[i]);
+                return 1;
+            }
+            builder.SetCompression(compression);
+        } else if (std::strcmp(argv[i], "--align") == 0 && i + 1 < argc) {
+            builder.SetAlignment(static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10)));
+        } else if (std::strcmp(argv[i], "--prefix") == 0 && i + 1 < argc) {
+            prefix = argv[++i];
+        } else {
+            std::filesystem::path input(argv[i]);
+            bool added = std::filesystem::is_directory(input)
+                ? builder.AddDirectory(input.string(), prefix.empty() ? input.filename().string() : prefix)
+                : builder.AddFile(input.string(), prefix.empty() ? input.filename().string()
+                                                                 : prefix + "/" + input.filename().string());
+            if (!added) {
+                std::fprintf(stderr, "Failed to add '%s'\n", argv[i]);
+                return 1;
+            }
+        }
+    }
+
+    PackBuildStats stats;
+    if (!builder.Write(outputPath, &stats)) {
+        std::fprintf(stderr, "Failed to write '%s'\n", outputPath.c_str());
+        return 1;
+    }
+
+    std::printf("%s: %u entries (%u compressed), %llu -> %llu bytes\n",
+                outputPath.c_str(), stats.entryCount, stats.compressedEntries,
+                static_cast<unsigned long long>(stats.originalBytes),
+                static_cast<unsigned long long>(stats.storedBytes));
+    return 0;
+}
@@ -0,0 +1,332 @@
+// Headless benchmark of the pipelined simulation and render threads.
+//
+// Usage: PipelineBenchmark [--frames N] [--entities N] [--churn N] [--simulate-ms N] [--render-ms N]
+//                          [--skip-overlap]
+//
+// Runs the same scene twice through RenderThread: serially (every packet drawn inline
+// after it is built, the old single-threaded loop) and pipelined (packets drawn on the
+// render thread while the next frame is simulated). The simulation and the "GPU
+// submission" are busy loops of the given length so the numbers do not depend on a
+// device. Every frame the simulation also destroys and respawns a few units while the
+// previous packet may still be drawing them. Reports frame time (throughput) and
+// build-to-drawn latency for both, and checks that the render thread sees every
+// packet, in order, exactly as it was built, and that the resources of units destroyed
+// under an in-flight packet are released on the render thread. Unless --skip-overlap
+// is given, pipelining must also beat the serial frame time on a multi-core machine.
+// Exits with 1 on any failure.
+
+#include "Core/Application/FrameTimeStats.h"
+#include "Core/Scene/Scene.h"
+#include "Core/Scene/RenderPacket.h"
+#include "Core/Entity/Entity.h"
+#include "Core/Entity/TransformComponent.h"
+#include "Core/Threading/RenderThread.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+using namespace CheckHarness;
+using namespace DirectX;
+
+namespace {
+    volatile float32 s_checksum = 0.0f;
+
+    float64 TicksToMilliseconds(int64 ticks) {
+        return static_cast<float64>(ticks) * 1000.0 / static_cast<float64>(Platform::GetPerformanceFrequency());
+    }
+
+    void Spin(float64 milliseconds) {
+        int64 begin = Platform::GetPerformanceCounter();
+        while (TicksToMilliseconds(Platform::GetPerformanceCounter() - begin) < milliseconds) {
+        }
+    }
+
+    // Which thread released each unit resource, by resource index
+    class ReleaseLog {
+    public:
+        explicit ReleaseLog(std::thread::id simulationThread) : m_simulationThread(simulationThread) {}
+
+        void Record(uint32 index) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (index >= m_onSimulationThread.size()) {
+                m_onSimulationThread.resize(index + 1, false);
+            }
+            m_onSimulationThread[index] = std::this_thread::get_id() == m_simulationThread;
+        }
+
+        bool ReleasedOnSimulationThread(uint32 index) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return index < m_onSimulationThread.size() && m_onSimulationThread[index];
+        }
+
+    private:
+        std::thread::id m_simulationThread;
+        std::mutex m_mutex;
+        Vector<bool> m_onSimulationThread;
+    };
+
+    // Stand-in for a unit's mesh: packets hold it the way they hold meshes
+    // and textures, and its destructor notes the thread that dropped the last reference
+    class UnitResource {
+    public:
+        UnitResource(ReleaseLog& log, uint32 index, EntityID entity) : m_log(log), m_index(index), m_entity(entity) {}
+        ~UnitResource() { m_log.Record(m_index); }
+
+        uint32 GetIndex() const { return m_index; }
+        EntityID GetEntity() const { return m_entity; }
+
+    private:
+        ReleaseLog& m_log;
+        uint32 m_index;
+        EntityID m_entity;
+    };
+
+    // RenderDraw::mesh carries the resource; it is only ever cast back, never used as a Mesh
+    SharedPtr<Mesh> AsMesh(const SharedPtr<UnitResource>& resource) {
+        return SharedPtr<Mesh>(resource, reinterpret_cast<Mesh*>(resource.get()));
+    }
+
+    const UnitResource* FromMesh(const SharedPtr<Mesh>& mesh) {
+        return reinterpret_cast<const UnitResource*>(mesh.get());
+    }
+
+    // Units that move every step; the first one sits at x = frame index so the render
+    // side can tell which frame a packet was built from. Every step destroys and
+    // respawns churnCount of the others, so the count stays the same.
+    class BenchmarkScene : public Scene {
+    public:
+        BenchmarkScene(uint32 entityCount, uint32 churnCount, ReleaseLog& log) : m_churnCount(churnCount), m_log(log) {
+            for (uint32 i = 0; i < entityCount; ++i) {
+                Unit& unit = m_units.emplace_back();
+                Spawn(unit, static_cast<float>(i));
+            }
+        }
+
+        void Update(float deltaTime) override {
+            // Units 1.. are destroyed round robin, while the previous packet may still draw them
+            for (uint32 i = 0; i < m_churnCount && m_units.size() > 1; ++i) {
+                Unit& unit = m_units[1 + m_nextDestroyed++ % (m_units.size() - 1)];
+                float position = unit.entity->GetComponent<TransformComponent>()->GetPosition().z;
+                uint32 index = unit.resource->GetIndex();
+                WeakPtr<UnitResource> watch = unit.resource;
+
+                DestroyEntity(unit.entity);
+                unit.resource.reset();
+                ++m_destroyed;
+                if (!watch.expired()) {
+                    m_inFlight.push_back(index);    // Only a packet can still hold it
+                }
+                Spawn(unit, position);
+            }
+
+            for (size_t i = 1; i < m_units.size(); ++i) {
+                m_units[i].entity->GetComponent<TransformComponent>()->AddRotation(0.0f, deltaTime, 0.0f);
+            }
+            Scene::Update(deltaTime);
+        }
+
+        void SetFrame(uint64 frameIndex) {
+            if (!m_units.empty()) {
+                m_units[0].entity->GetComponent<TransformComponent>()->SetPosition(static_cast<float>(frameIndex), 0.0f, 0.0f);
+            }
+        }
+
+        // Headless entities have no meshes, so every transform becomes a draw
+        void BuildRenderPacket(RenderPacket& packet) override {
+            Scene::BuildRenderPacket(packet);
+            for (const Unit& unit : m_units) {
+                RenderDraw& draw = packet.draws.emplace_back();
+                XMStoreFloat4x4(&draw.world, unit.entity->GetComponent<TransformComponent>()->GetWorldMatrix());
+                draw.mesh = AsMesh(unit.resource);
+                draw.entity = unit.entity->GetID();
+            }
+        }
+
+        uint64 GetDestroyedCount() const { return m_destroyed; }
+
+        // Resources whose entity was destroyed while a packet still referenced them
+        const Vector<uint32>& GetInFlightReleases() const { return m_inFlight; }
+
+    private:
+        struct Unit {
+            Entity* entity = nullptr;
+            SharedPtr<UnitResource> resource;
+        };
+
+        void Spawn(Unit& unit, float position) {
+            unit.entity = SpawnEntity<Entity>();
+            unit.entity->GetComponent<TransformComponent>()->SetPosition(0.0f, 0.0f, position);
+            unit.resource = std::make_shared<UnitResource>(m_log, m_nextResource++, unit.entity->GetID());
+        }
+
+    private:
+        Vector<Unit> m_units;
+        uint32 m_churnCount;
+        ReleaseLog& m_log;
+        uint32 m_nextResource = 0;
+        uint64 m_nextDestroyed = 0;
+        uint64 m_destroyed = 0;
+        Vector<uint32> m_inFlight;
+    };
+
+    struct RunResult {
+        float64 frameMs = 0.0;          // Wall time per frame
+        FrameTimeSummary latency;       // Simulation start to drawn
+        RenderThreadStats stats;
+        uint64 rendered = 0;
+        uint64 destroyed = 0;               // Units destroyed during the run
+        uint64 destroyedInFlight = 0;       // ... while a packet still referenced their resource
+        uint64 releasedOnSimulation = 0;    // ... whose resource was then released by the simulation thread
+        bool ordered = true;
+        bool intact = true;
+    };
+
+    RunResult Run(bool pipelined, uint32 frameCount, uint32 entityCount, uint32 churnCount, float64 simulateMs, float64 renderMs) {
+        RunResult result;
+        FrameTimeStatsConfig latencyConfig;
+        latencyConfig.windowSize = frameCount;
+        FrameTimeStats latency(latencyConfig);
+        uint64 expectedFrame = 0;
+
+        ReleaseLog releaseLog(std::this_thread::get_id());
+        BenchmarkScene scene(entityCount, churnCount, releaseLog);
+        RenderThread renderThread;
+        renderThread.SetRenderFunction([&](const RenderPacket& packet) {
+            // Read the whole packet, as submission would
+            float32 checksum = 0.0f;
+            bool resourcesMatch = true;
+            for (const RenderDraw& draw : packet.draws) {
+                checksum += draw.world.m[3][0] + draw.world.m[3][2];
+                resourcesMatch = resourcesMatch && draw.mesh && FromMesh(draw.mesh)->GetEntity() == draw.entity;
+            }
+            s_checksum = checksum;
+            Spin(renderMs);
+
+            result.ordered = result.ordered && packet.frameIndex == expectedFrame;
+            result.intact = result.intact && resourcesMatch && packet.draws.size() == entityCount &&
+                            (entityCount == 0 || packet.draws[0].world.m[3][0] == static_cast<float>(packet.frameIndex));
+            ++expectedFrame;
+            ++result.rendered;
+            latency.AddFrame(static_cast<float32>(TicksToMilliseconds(Platform::GetPerformanceCounter() - packet.buildCounter)));
+        });
+        if (pipelined) {
+            Check(renderThread.Start("PipelineBenchmark Render"), "render thread starts");
+        }
+
+        int64 begin = Platform::GetPerformanceCounter();
+        for (uint32 frame = 0; frame < frameCount; ++frame) {
+            RenderPacket& packet = renderThread.BeginPacket();
+            scene.SetFrame(packet.frameIndex);
+            scene.Simulate(1.0f / 30.0f);
+            Spin(simulateMs);
+            scene.BuildRenderPacket(packet);
+            renderThread.SubmitPacket();
+        }
+        renderThread.Stop();
+        int64 ticks = Platform::GetPerformanceCounter() - begin;
+
+        // Stop has emptied the packets, so every in-flight resource has been released
+        result.destroyed = scene.GetDestroyedCount();
+        for (uint32 index : scene.GetInFlightReleases()) {
+            ++result.destroyedInFlight;
+            result.releasedOnSimulation += releaseLog.ReleasedOnSimulationThread(index) ? 1 : 0;
+        }
+
+        result.frameMs = frameCount ? TicksToMilliseconds(ticks) / frameCount : 0.0;
+        result.latency = latency.GetSummary();
+        result.stats = renderThread.GetStats();
+        return result;
+    }
+
+    void Print(const char* name, const RunResult& result) {
+        std::printf("  %-9s  frame %6.2f ms (%6.1f fps)  latency p50 %6.2f  p95 %6.2f  p99 %6.2f ms  "
+                    "sim waited %.3f s, render idle %.3f s\n",
+                    name, result.frameMs, result.frameMs > 0.0 ? 1000.0 / result.frameMs : 0.0,
+                    result.latency.p50Ms, result.latency.p95Ms, result.latency.p99Ms,
+                    result.stats.producerWaitSeconds, result.stats.renderIdleSeconds);
+        std::printf("  %-9s  destroyed %llu units, %llu while in flight, %llu of those released by the simulation\n",
+                    "", static_cast<unsigned long long>(result.destroyed),
+                    static_cast<unsigned long long>(result.destroyedInFlight),
+                    static_cast<unsigned long long>(result.releasedOnSimulation));
+    }
+
+    void CheckRun(const RunResult& result, uint32 frameCount) {
+        Check(result.rendered == frameCount && result.stats.packetsRendered == frameCount, "every packet is rendered");
+        Check(result.ordered, "packets are rendered in order");
+        Check(result.intact, "packets are rendered as they were built");
+    }
+
+    // Resources of units destroyed under an in-flight packet must not be released on the
+    // simulation thread, where they would race the renderer's own use of them
+    void CheckInFlightReleases(const RunResult& pipelined, float64 renderMs) {
+        Check(pipelined.releasedOnSimulation == 0, "in-flight resources are released on the render thread");
+        if (renderMs > 0.0 && pipelined.destroyed > 0) {
+            Check(pipelined.destroyedInFlight > 0, "units are destroyed while their packet is in flight");
+        }
+    }
+
+    void CheckStartStop() {
+        RenderThread renderThread;
+        Check(!renderThread.Start(), "no render function, no thread");
+
+        uint32 rendered = 0;
+        renderThread.SetRenderFunction([&](const RenderPacket&) { ++rendered; });
+        Check(renderThread.Start() && !renderThread.Start(), "one thread at a time");
+        renderThread.BeginPacket();
+        renderThread.SubmitPacket();
+        renderThread.WaitForIdle();
+        Check(rendered == 1, "wait for idle drains the packet");
+        renderThread.Stop();
+        Check(!renderThread.IsRunning(), "stop joins");
+
+        // Stopped threads keep rendering inline
+        renderThread.BeginPacket();
+        renderThread.SubmitPacket();
+        Check(rendered == 2, "inline rendering after stop");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 frameCount = 240;
+    uint32 entityCount = 2000;
+    float64 simulateMs = 4.0;
+    float64 renderMs = 4.0;
+    uint32 churnCount = 20;
+
+    Arguments arguments(argc, argv, "Usage: PipelineBenchmark [--frames N] [--entities N] [--churn N] "
+                                    "[--simulate-ms N] [--render-ms N] [--skip-overlap]");
+    arguments.Option("--frames", frameCount);
+    arguments.Option("--entities", entityCount);
+    arguments.Option("--churn", churnCount);
+    arguments.Option("--simulate-ms", simulateMs);
+    arguments.Option("--render-ms", renderMs);
+    bool checkOverlap = !arguments.Switch("--skip-overlap");
+    if (!arguments.Validate()) {
+        return 1;
+    }
+    frameCount = frameCount > 0 ? frameCount : 1;
+
+    std::printf("Pipelined rendering: %u frames, %u entities (%u destroyed per frame), %.1f ms simulation, %.1f ms render\n\n",
+                frameCount, entityCount, churnCount, simulateMs, renderMs);
+    CheckStartStop();
+
+    RunResult serial = Run(false, frameCount, entityCount, churnCount, simulateMs, renderMs);
+    RunResult pipelined = Run(true, frameCount, entityCount, churnCount, simulateMs, renderMs);
+    Print("serial", serial);
+    Print("pipelined", pipelined);
+    CheckRun(serial, frameCount);
+    CheckRun(pipelined, frameCount);
+    CheckInFlightReleases(pipelined, renderMs);
+
+    // Overlap needs a second core and both sides to have work
+    if (std::thread::hardware_concurrency() >= 2 && simulateMs > 0.0 && renderMs > 0.0) {
+        std::printf("\n  speedup %.2fx\n", pipelined.frameMs > 0.0 ? serial.frameMs / pipelined.frameMs : 0.0);
+        if (checkOverlap) {
+            Check(pipelined.frameMs < serial.frameMs * 0.8, "pipelining overlaps simulation and rendering");
+        }
+    }
+
+    return Finish();
+}
@@ -0,0 +1,219 @@
+// Headless check of pipeline description hashing and PipelineStateCache.
+//
+// Usage: PipelineStateCheck [--threads N] [--iterations N]
+//
+// Verifies that PipelineStateDesc::ComputeHash matches a recorded value (so pipeline
+// library entries written on one machine or build are found by the next), that every
+// field reaches the hash, and that the cache creates each description once: on
+// repeat lookups, after a failed creation, on a forced hash collision and under
+// concurrent first use. Finishes with warm lookup timings. Exits with 1 on any failure.
+
+#include "Rendering/Pipeline/PipelineStateCache.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+using namespace CheckHarness;
+
+namespace {
+    // ComputeHash of a default PipelineStateDesc; changes only with PIPELINE_STATE_VERSION
+    constexpr uint64 DEFAULT_DESC_HASH = 0x727a3b9ce8786b8bull;
+
+    // Cache whose pipelines are fake handles; counts the creations it is asked for
+    struct FakeDevice {
+        std::atomic<uint32> creations{ 0 };
+        std::atomic<uint64> nextHandle{ 1 };
+        bool failCreation = false;
+
+        PipelineStateCache::CreateFunction MakeCreate() {
+            return [this](const PipelineStateDesc&, uint64) -> void* {
+                creations.fetch_add(1);
+                if (failCreation) {
+                    return nullptr;
+                }
+                return reinterpret_cast<void*>(static_cast<uintptr_t>(nextHandle.fetch_add(1) * 16));
+            };
+        }
+    };
+
+    PipelineStateDesc MakeVariant(uint32 index) {
+        PipelineStateDesc desc;
+        desc.rootSignature = 0x1000 + index % 3;
+        desc.vertexShader = 0x2000 + index % 5;
+        desc.pixelShader = 0x3000 + index;
+        desc.fillMode = index % 2 ? RHIFillMode::Wireframe : RHIFillMode::Solid;
+        desc.cullMode = index % 2 ? RHICullMode::None : RHICullMode::Back;
+        return desc;
+    }
+
+    void CheckHashing() {
+        PipelineStateDesc desc;
+        uint64 hash = PipelineStateDesc::ComputeHash(desc);
+        std::printf("  default hash    %016llx\n", static_cast<unsigned long long>(hash));
+        Check(hash == DEFAULT_DESC_HASH, "default description hash matches the recorded value");
+        Check(PipelineStateDesc::ComputeHash(PipelineStateDesc()) == hash, "equal descriptions hash equal");
+
+        // Every field must reach the hash, or two pipelines would share a library entry
+        using Mutator = void (*)(PipelineStateDesc&);
+        const Mutator mutators[] = {
+            [](PipelineStateDesc& d) { d.rootSignature = 1; },
+            [](PipelineStateDesc& d) { d.vertexShader = 1; },
+            [](PipelineStateDesc& d) { d.pixelShader = 1; },
+            [](PipelineStateDesc& d) { d.topology = RHIPrimitiveTopology::LineList; },
+            [](PipelineStateDesc& d) { d.fillMode = RHIFillMode::Wireframe; },
+            [](PipelineStateDesc& d) { d.cullMode = RHICullMode::None; },
+            [](PipelineStateDesc& d) { d.frontCounterClockwise = false; },
+            [](PipelineStateDesc& d) { d.depthClipEnable = false; },
+            [](PipelineStateDesc& d) { d.depthBias = 4; },
+            [](PipelineStateDesc& d) { d.slopeScaledDepthBias = 1.5f; },
+            [](PipelineStateDesc& d) { d.depthEnable = false; },
+            [](PipelineStateDesc& d) { d.depthWriteEnable = false; },
+            [](PipelineStateDesc& d) { d.depthFunc = RHIComparisonFunc::GreaterEqual; },
+            [](PipelineStateDesc& d) { d.blendMode = RHIBlendMode::AlphaBlend; },
+            [](PipelineStateDesc& d) { d.renderTargetCount = 2; },
+            [](PipelineStateDesc& d) { d.renderTargetFormat = RHIResourceFormat::R8G8B8A8_Unorm_sRGB; },
+            [](PipelineStateDesc& d) { d.depthFormat = RHIResourceFormat::R32_Float; },
+            [](PipelineStateDesc& d) { d.sampleCount = 4; },
+        };
+
+        Vector<uint64> hashes = { hash };
+        for (Mutator mutate : mutators) {
+            PipelineStateDesc changed;
+            mutate(changed);
+            hashes.push_back(PipelineStateDesc::ComputeHash(changed));
+        }
+        bool isUnique = true;
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            for (size_t j = i + 1; j < hashes.size(); ++j) {
+                isUnique &= hashes[i] != hashes[j];
+            }
+        }
+        Check(isUnique, "every field changes the hash");
+    }
+
+    void CheckCache() {
+        FakeDevice device;
+        PipelineStateCache cache(device.MakeCreate());
+
+        PipelineStateDesc solid = MakeVariant(0);
+        PipelineStateDesc wireframe = MakeVariant(1);
+        void* first = cache.GetOrCreate(solid);
+        Check(first != nullptr, "first lookup creates");
+        Check(cache.GetOrCreate(solid) == first, "second lookup returns the same pipeline");
+        Check(cache.GetOrCreate(wireframe) != first, "another description gets another pipeline");
+        Check(device.creations == 2, "two descriptions, two creations");
+        Check(cache.Find(solid, PipelineStateDesc::ComputeHash(solid)) == first, "Find sees created pipelines");
+
+        // A colliding hash must neither return nor evict the other description's pipeline
+        uint64 solidHash = PipelineStateDesc::ComputeHash(solid);
+        void* collided = cache.GetOrCreate(wireframe, solidHash);
+        Check(collided != nullptr && collided != first, "collision creates a separate pipeline");
+        Check(cache.GetOrCreate(solid) == first, "collision keeps the first owner cached");
+        Check(cache.GetStats().hashCollisions == 1, "collision is counted");
+
+        // Failures are remembered, so a broken variant does not recompile every frame
+        device.failCreation = true;
+        PipelineStateDesc broken = MakeVariant(2);
+        Check(cache.GetOrCreate(broken) == nullptr, "failed creation returns nullptr");
+        uint32 creations = device.creations;
+        Check(cache.GetOrCreate(broken) == nullptr && device.creations == creations, "failed creation is not retried");
+        Check(cache.GetStats().creationFailures == 1, "failure is counted");
+        device.failCreation = false;
+
+        cache.Clear();
+        Check(cache.GetCount() == 0, "Clear empties the cache");
+        Check(cache.GetOrCreate(broken) != nullptr, "Clear allows a retry");
+    }
+
+    void CheckConcurrentFirstUse(uint32 threadCount) {
+        constexpr uint32 variantCount = 64;
+        FakeDevice device;
+        PipelineStateCache cache(device.MakeCreate());
+
+        std::atomic<bool> start{ false };
+        std::atomic<uint32> failedLookups{ 0 };
+        Vector<std::thread> threads;
+        for (uint32 t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t]() {
+                while (!start.load()) {
+                    std::this_thread::yield();
+                }
+                for (uint32 i = 0; i < variantCount; ++i) {
+                    uint32 variant = (i + t * 7) % variantCount;
+                    if (!cache.GetOrCreate(MakeVariant(variant))) {
+                        failedLookups.fetch_add(1);
+                    }
+                }
+            });
+        }
+        start = true;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        Check(failedLookups == 0, "concurrent lookups all succeed");
+        Check(device.creations == variantCount, "concurrent first use creates each pipeline once");
+        Check(cache.GetCount() == variantCount, "every variant is cached");
+        std::printf("  concurrent      %u threads x %u variants, %u creations\n", threadCount, variantCount, device.creations.load());
+    }
+
+    void Benchmark(uint32 iterations) {
+        constexpr uint32 variantCount = 32;
+        FakeDevice device;
+        PipelineStateCache cache(device.MakeCreate());
+
+        Vector<PipelineStateDesc> descs;
+        Vector<uint64> hashes;
+        for (uint32 i = 0; i < variantCount; ++i) {
+            descs.push_back(MakeVariant(i));
+            hashes.push_back(PipelineStateDesc::ComputeHash(descs.back()));
+            cache.GetOrCreate(descs.back(), hashes.back());
+        }
+
+        auto measure = [&](bool precomputedHash) {
+            uintptr_t sink = 0;
+            uint64 begin = Platform::GetPerformanceCounter();
+            for (uint32 i = 0; i < iterations; ++i) {
+                uint32 v = i % variantCount;
+                void* pipeline = precomputedHash ? cache.GetOrCreate(descs[v], hashes[v]) : cache.GetOrCreate(descs[v]);
+                sink += reinterpret_cast<uintptr_t>(pipeline);
+            }
+            double seconds = static_cast<double>(Platform::GetPerformanceCounter() - begin) /
+                             static_cast<double>(Platform::GetPerformanceFrequency());
+            Check(sink != 0, "benchmark lookups hit");
+            return seconds * 1.0e9 / iterations;
+        };
+
+        std::printf("  warm lookup     %.1f ns (hash precomputed), %.1f ns (hash per lookup), %u iterations\n",
+                    measure(true), measure(false), iterations);
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 threadCount = 8;
+    uint32 iterations = 1000000;
+
+    Arguments arguments(argc, argv, "Usage: PipelineStateCheck [--threads N] [--iterations N]");
+    arguments.Option("--threads", threadCount);
+    arguments.Option("--iterations", iterations);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    if (threadCount == 0) {
+        arguments.PrintUsage();
+        return 1;
+    }
+
+    std::printf("Pipeline state cache\n\n");
+    CheckHashing();
+    CheckCache();
+    CheckConcurrentFirstUse(threadCount);
+    if (iterations > 0) {
+        Benchmark(iterations);
+    }
+
+    return Finish();
+}
@@ -0,0 +1,214 @@
+// Headless check of the CPU profiler, with a per-zone overhead benchmark.
+//
+// Usage: ProfilerCheck [--zones N] [--budget-ns N] [--trace path.json]
+//
+// Records nested zones on the main thread and on a worker, then verifies the per-frame
+// hierarchy (merged calls, total and self time), that zones are collected once, and
+// that the Chrome trace export has one track per thread and one event per zone. The
+// benchmark times N empty zones enabled and disabled and reports the cost against the
+// 50 ns target. Timing depends on the machine and build, so it only fails the run when
+// --budget-ns is given; use that in optimized builds without sanitizers. --trace writes
+// the recorded frames for chrome://tracing or ui.perfetto.dev. Exits with 1 on any
+// failure.
+
+#include "Core/Profiling/Profiler.h"
+#include "Platform/Platform.h"
+#include "../Common/CheckHarness.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+using namespace CheckHarness;
+
+namespace {
+    constexpr double TARGET_ZONE_NANOSECONDS = 50.0;
+
+    void SimulateUpdate() {
+        PROFILE_SCOPE("Scene::Update");
+        for (uint32 i = 0; i < 3; ++i) {
+            PROFILE_SCOPE("Entity::Update");
+            Spin(50);
+        }
+    }
+
+    void SimulateFrame() {
+        PROFILE_SCOPE("Application::Frame");
+        SimulateUpdate();
+        {
+            PROFILE_SCOPE("Scene::Render");
+            Spin(100);
+        }
+    }
+
+    const ProfileNode* FindNode(const ProfileThreadFrame& thread, const char* name) {
+        for (const ProfileNode& node : thread.nodes) {
+            if (std::strcmp(node.name, name) == 0) {
+                return &node;
+            }
+        }
+        return nullptr;
+    }
+
+    void CheckHierarchy() {
+        Profiler& profiler = Profiler::GetGlobal();
+        profiler.SetThreadName("Main");
+
+        // Start from an empty frame so earlier zones are not counted
+        profiler.EndFrame();
+        SimulateFrame();
+        std::thread worker([]() {
+            Profiler::GetGlobal().SetThreadName("Worker");
+            PROFILE_SCOPE("AssetManager::Load");
+            Spin(200);
+        });
+        worker.join();
+        profiler.EndFrame();
+
+        const ProfileFrame* frame = profiler.GetLastFrame();
+        Check(frame && frame->threads.size() == 2, "one entry per thread with zones");
+        if (!frame || frame->threads.size() != 2) {
+            return;
+        }
+
+        const ProfileThreadFrame& main = frame->threads[0];
+        Check(main.zones.size() == 6, "every zone of the frame is collected");
+        Check(main.nodes.size() == 4, "repeated zones merge into one node");
+
+        const ProfileNode* root = FindNode(main, "Application::Frame");
+        const ProfileNode* update = FindNode(main, "Scene::Update");
+        const ProfileNode* entity = FindNode(main, "Entity::Update");
+        const ProfileNode* render = FindNode(main, "Scene::Render");
+        Check(root && update && entity && render, "every zone name has a node");
+        if (root && update && entity && render) {
+            Check(root->parent == ProfileNode::NO_PARENT && root->depth == 0, "frame zone is the root");
+            Check(&main.nodes[update->parent] == root && &main.nodes[render->parent] == root, "scene zones nest under the frame");
+            Check(&main.nodes[entity->parent] == update && entity->depth == 2, "entity zones nest under the update");
+            Check(entity->calls == 3 && update->calls == 1, "calls are counted");
+            Check(update->totalTicks >= entity->totalTicks && update->selfTicks == update->totalTicks - entity->totalTicks,
+                  "self time excludes children");
+            Check(profiler.TicksToMicroseconds(entity->totalTicks) >= 140.0, "zone time matches the work");
+            Check(root->totalTicks <= frame->end - frame->begin, "zones fit inside their frame");
+        }
+
+        const ProfileThreadFrame& worker2 = frame->threads[1];
+        Check(profiler.GetThreadName(worker2.threadIndex) == "Worker", "thread names are kept");
+        Check(worker2.nodes.size() == 1 && worker2.nodes[0].calls == 1, "worker zone is recorded");
+
+        profiler.EndFrame();
+        Check(profiler.GetLastFrame()->threads.empty(), "zones are collected only once");
+
+        std::printf("%s", profiler.FormatFrame(*frame).c_str());
+    }
+
+    void CheckExport(const String& tracePath) {
+        Profiler& profiler = Profiler::GetGlobal();
+        String path = tracePath.empty() ? (std::filesystem::temp_directory_path() / "ProfilerCheck.json").string() : tracePath;
+        Check(profiler.ExportChromeTrace(path), "trace is written");
+
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        String json = content.str();
+
+        size_t zoneCount = 0;
+        for (const ProfileFrame& frame : profiler.GetFrames()) {
+            for (const ProfileThreadFrame& thread : frame.threads) {
+                zoneCount += thread.zones.size();
+            }
+        }
+
+        size_t events = 0;
+        size_t threadNames = 0;
+        for (size_t at = json.find("\"ph\":\"X\""); at != String::npos; at = json.find("\"ph\":\"X\"", at + 1)) {
+            ++events;
+        }
+        for (size_t at = json.find("\"thread_name\""); at != String::npos; at = json.find("\"thread_name\"", at + 1)) {
+            ++threadNames;
+        }
+        Check(json.compare(0, 1, "{") == 0 && json.find("]}") != String::npos, "trace is a JSON object");
+        Check(events == zoneCount, "one complete event per zone");
+        Check(threadNames == profiler.GetStats().threadCount, "one track name per thread");
+        Check(json.find("\"Worker\"") != String::npos, "track names are exported");
+
+        if (tracePath.empty()) {
+            std::filesystem::remove(path);
+        } else {
+            std::printf("  trace           %s (%zu events)\n", path.c_str(), events);
+        }
+    }
+
+    // budgetNanoseconds of 0 only reports the zone cost
+    void Benchmark(uint32 zoneCount, double budgetNanoseconds) {
+        Profiler& profiler = Profiler::GetGlobal();
+        double nsPerTick = 1.0e9 / static_cast<double>(Platform::GetPerformanceFrequency());
+
+        // Batches that fit the thread buffer, collected between runs
+        uint32 batch = ProfileThreadBuffer::CAPACITY / 2;
+        int64 enabledTicks = 0;
+        for (uint32 done = 0; done < zoneCount; done += batch) {
+            uint32 count = std::min(batch, zoneCount - done);
+            int64 begin = Platform::GetPerformanceCounter();
+            for (uint32 i = 0; i < count; ++i) {
+                PROFILE_SCOPE("Benchmark::Zone");
+            }
+            enabledTicks += Platform::GetPerformanceCounter() - begin;
+            profiler.EndFrame();
+        }
+
+        Profiler::SetEnabled(false);
+        int64 begin = Platform::GetPerformanceCounter();
+        for (uint32 i = 0; i < zoneCount; ++i) {
+            PROFILE_SCOPE("Benchmark::Zone");
+        }
+        int64 disabledTicks = Platform::GetPerformanceCounter() - begin;
+        Profiler::SetEnabled(true);
+
+        // Collecting and aggregating a frame of zones
+        for (uint32 i = 0; i < batch; ++i) {
+            PROFILE_SCOPE("Benchmark::Zone");
+        }
+        begin = Platform::GetPerformanceCounter();
+        profiler.EndFrame();
+        int64 collectTicks = Platform::GetPerformanceCounter() - begin;
+
+        double enabled = enabledTicks * nsPerTick / zoneCount;
+        double disabled = disabledTicks * nsPerTick / zoneCount;
+        ProfilerStats stats = profiler.GetStats();
+        std::printf("  zone            %.2f ns enabled (target %.0f ns), %.2f ns disabled (%u zones)\n", enabled,
+                    budgetNanoseconds > 0.0 ? budgetNanoseconds : TARGET_ZONE_NANOSECONDS, disabled, zoneCount);
+        std::printf("  end frame       %.1f us for %u zones\n", collectTicks * nsPerTick / 1000.0, batch);
+        std::printf("  recorded        %llu zones, %llu dropped, %u threads\n",
+                    static_cast<unsigned long long>(stats.zonesRecorded), static_cast<unsigned long long>(stats.zonesDropped),
+                    stats.threadCount);
+        if (budgetNanoseconds > 0.0) {
+            Check(enabled < budgetNanoseconds, "enabled zone costs under the budget");
+        }
+        Check(stats.zonesDropped == 0, "no zones dropped");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 zoneCount = 1000000;
+    float64 budgetNanoseconds = 0.0;
+    String tracePath;
+
+    Arguments arguments(argc, argv, "Usage: ProfilerCheck [--zones N] [--budget-ns N] [--trace path.json]");
+    arguments.Option("--zones", zoneCount);
+    arguments.Option("--budget-ns", budgetNanoseconds);
+    arguments.Option("--trace", tracePath);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("Profiler\n\n");
+    CheckHierarchy();
+    CheckExport(tracePath);
+    if (zoneCount > 0) {
+        Benchmark(zoneCount, budgetNanoseconds);
+    }
+
+    return Finish();
+}
@@ -0,0 +1,122 @@
+// Offline analysis of RHI command captures written by RecordingRHIContext.
+//
+// Usage: RHIReplay <capture.rhic> [--iterations N] [--diff other.rhic]
+//
+// Prints per-command counts, draw totals and redundant state changes, then replays
+// the capture into a NullRHIContext N times to measure CPU submission cost.
+// With --diff, the counts of a second capture (e.g. from another build) are shown
+// side by side with their deltas.
+
+#include "Rendering/RHI/RHICommandReplayer.h"
+#include "Rendering/RHI/NullRHIContext.h"
+#include "Platform/Platform.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+    void PrintUsage() {
+        std::printf("Usage: RHIReplay <capture.rhic> [--iterations N] [--diff other.rhic]\n");
+    }
+
+    bool LoadAndAnalyze(const String& path, RHICommandStream& outStream, RHICommandStats& outStats) {
+        if (!outStream.LoadFromFile(path)) {
+            std::fprintf(stderr, "RHIReplay: Failed to load '%s'\n", path.c_str());
+            return false;
+        }
+        if (!RHICommandReplayer::Analyze(outStream, outStats)) {
+            std::fprintf(stderr, "RHIReplay: '%s' contains a corrupt command\n", path.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    void PrintStats(const String& path, const RHICommandStats& stats) {
+        std::printf("%s: %llu commands, %llu bytes\n", path.c_str(),
+                    static_cast<unsigned long long>(stats.totalCommands), static_cast<unsigned long long>(stats.streamBytes));
+        std::printf("  %-22s %10s %10s\n", "command", "count", "redundant");
+        for (size_t i = 0; i < static_cast<size_t>(RHICommandType::Count); ++i) {
+            if (stats.commandCounts[i] == 0) {
+                continue;
+            }
+            std::printf("  %-22s %10u %10u\n", RHICommandStream::GetCommandName(static_cast<RHICommandType>(i)),
+                        stats.commandCounts[i], stats.redundantCounts[i]);
+        }
+        std::printf("  draws %llu, indices %llu, vertices %llu, redundant state changes %llu\n",
+                    static_cast<unsigned long long>(stats.drawCalls), static_cast<unsigned long long>(stats.indexCount),
+                    static_cast<unsigned long long>(stats.vertexCount), static_cast<unsigned long long>(stats.redundantStateChanges));
+    }
+
+    void PrintDiff(const RHICommandStats& base, const RHICommandStats& other) {
+        auto row = [](const char* name, long long a, long long b) {
+            if (a != 0 || b != 0) {
+                std::printf("  %-22s %10lld %10lld %+10lld\n", name, a, b, b - a);
+            }
+        };
+
+        std::printf("\n  %-22s %10s %10s %10s\n", "diff", "base", "other", "delta");
+        for (size_t i = 0; i < static_cast<size_t>(RHICommandType::Count); ++i) {
+            row(RHICommandStream::GetCommandName(static_cast<RHICommandType>(i)), base.commandCounts[i], other.commandCounts[i]);
+        }
+        row("draw calls", static_cast<long long>(base.drawCalls), static_cast<long long>(other.drawCalls));
+        row("indices", static_cast<long long>(base.indexCount), static_cast<long long>(other.indexCount));
+        row("redundant state", static_cast<long long>(base.redundantStateChanges), static_cast<long long>(other.redundantStateChanges));
+        row("stream bytes", static_cast<long long>(base.streamBytes), static_cast<long long>(other.streamBytes));
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    String capturePath = argv[1];
+    String diffPath;
+    uint32 iterations = 1000;
+
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--diff") == 0 && i + 1 < argc) {
+            diffPath = argv[++i];
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    RHICommandStream stream;
+    RHICommandStats stats;
+    if (!LoadAndAnalyze(capturePath, stream, stats)) {
+        return 1;
+    }
+    PrintStats(capturePath, stats);
+
+    // CPU cost of decoding and submitting the stream, with the backend cost removed
+    if (iterations > 0) {
+        NullRHIContext context;
+        int64 start = Platform::GetPerformanceCounter();
+        for (uint32 i = 0; i < iterations; ++i) {
+            RHICommandReplayer::Replay(stream, context);
+        }
+        int64 elapsed = Platform::GetPerformanceCounter() - start;
+
+        double seconds = static_cast<double>(elapsed) / static_cast<double>(Platform::GetPerformanceFrequency());
+        double perReplayUs = seconds * 1e6 / iterations;
+        double perCommandNs = stats.totalCommands ? perReplayUs * 1e3 / static_cast<double>(stats.totalCommands) : 0.0;
+        std::printf("  replay: %.2f us per capture, %.1f ns per command (%u iterations)\n",
+                    perReplayUs, perCommandNs, iterations);
+    }
+
+    if (!diffPath.empty()) {
+        RHICommandStream otherStream;
+        RHICommandStats otherStats;
+        if (!LoadAndAnalyze(diffPath, otherStream, otherStats)) {
+            return 1;
+        }
+        PrintDiff(stats, otherStats);
+    }
+
+    return 0;
+}
@@ -0,0 +1,317 @@
+// Headless check of the RTS camera controller and the heightfield it clamps against.
+//
+// Usage: RtsCameraCheck [--updates N]
+//
+// Checks heightfield lookups against the function and mesh they were built from, and
+// that the precomputed max heights never fall below the terrain around a point. Then
+// drives an RtsCameraController: zoom smoothing is the same at 40 and 240 fps, pitch
+// and view parameters follow zoom, panning (keys and screen edges) respects the map
+// bounds, and the eye never dips under the terrain. Finally times N updates on a
+// small and a 256x larger map, which should cost about the same. Exits with 1 on any
+// failure.
+
+#include "Rendering/RtsCameraController.h"
+#include "Rendering/Camera.h"
+#include "Core/Scene/Heightfield.h"
+#include "Core/Utilities/MeshGeometry.h"
+#include "Core/Window/Window.h"
+#include "../Common/CheckHarness.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace CheckHarness;
+using namespace DirectX;
+
+namespace {
+    // Rolling hills with a few sharp ridges
+    float32 TerrainHeight(float32 x, float32 z) {
+        float32 hills = 6.0f * std::sin(x * 0.05f) * std::cos(z * 0.07f);
+        float32 ridge = std::max(0.0f, 12.0f - std::fabs(x - 40.0f) * 3.0f);
+        return hills + ridge;
+    }
+
+    HeightfieldDesc MakeDesc(uint32 samples, float32 cellSize) {
+        HeightfieldDesc desc;
+        desc.columns = samples;
+        desc.rows = samples;
+        desc.cellSize = cellSize;
+        desc.originX = -0.5f * cellSize * static_cast<float32>(samples - 1);
+        desc.originZ = desc.originX;
+        desc.maxHeightRadius = 3.0f;
+        return desc;
+    }
+
+    // Highest bilinear height within radius, by brute force
+    float32 HighestAround(const Heightfield& heightfield, float32 x, float32 z, float32 radius) {
+        float32 highest = heightfield.GetHeight(x, z);
+        const int32 steps = 12;
+        for (int32 i = -steps; i <= steps; ++i) {
+            for (int32 j = -steps; j <= steps; ++j) {
+                float32 dx = radius * static_cast<float32>(i) / steps;
+                float32 dz = radius * static_cast<float32>(j) / steps;
+                if (dx * dx + dz * dz <= radius * radius) {
+                    highest = std::max(highest, heightfield.GetHeight(x + dx, z + dz));
+                }
+            }
+        }
+        return highest;
+    }
+
+    void CheckHeightfield() {
+        Heightfield heightfield;
+        Check(!heightfield.Build(MakeDesc(1, 1.0f), TerrainHeight), "a grid under 2x2 samples is rejected");
+        Check(heightfield.Build(MakeDesc(257, 1.0f), TerrainHeight), "the function heightfield builds");
+
+        std::minstd_rand random(5);
+        std::uniform_real_distribution<float32> coordinate(-127.0f, 127.0f);
+        float32 worstError = 0.0f;
+        float32 worstShortfall = 0.0f;
+        float32 totalExcess = 0.0f;
+        const uint32 pointCount = 2000;
+        for (uint32 i = 0; i < pointCount; ++i) {
+            float32 x = coordinate(random);
+            float32 z = coordinate(random);
+            // Away from the ridge crest the terrain is smooth enough for bilinear to track it
+            if (std::fabs(x - 40.0f) > 1.0f) {
+                worstError = std::max(worstError, std::fabs(heightfield.GetHeight(x, z) - TerrainHeight(x, z)));
+            }
+            float32 highest = HighestAround(heightfield, x, z, heightfield.GetMaxHeightRadius());
+            float32 maxHeight = heightfield.GetMaxHeight(x, z);
+            worstShortfall = std::max(worstShortfall, highest - maxHeight);
+            totalExcess += maxHeight - highest;
+        }
+        std::printf("  function  257x257: worst bilinear error %.4f, max height worst shortfall %.4f, mean excess %.3f\n",
+                    worstError, worstShortfall, totalExcess / pointCount);
+        Check(worstError < 0.02f, "bilinear heights follow the function");
+        Check(worstShortfall <= 1.0e-4f, "max heights cover the terrain within the radius");
+        Check(std::fabs(heightfield.GetHeight(40.0f, 0.0f) - TerrainHeight(40.0f, 0.0f)) < 1.0e-4f,
+              "heights at samples are exact");
+        Check(heightfield.GetHeight(-1.0e6f, 0.0f) == heightfield.GetHeight(heightfield.GetMinX(), 0.0f),
+              "points outside take the nearest edge");
+
+        // A 4x4 box and a pillar thinner than a cell, on a base of 1
+        MeshData mesh;
+        auto addBox = [&mesh](const XMFLOAT3& center, const XMFLOAT3& halfSize) {
+            MeshData cube = MeshGeometry::CreateCube();
+            uint32 baseVertex = static_cast<uint32>(mesh.vertices.size());
+            for (Vertex& vertex : cube.vertices) {
+                vertex.position = { center.x + vertex.position.x * halfSize.x, center.y + vertex.position.y * halfSize.y,
+                                    center.z + vertex.position.z * halfSize.z };
+                mesh.vertices.push_back(vertex);
+            }
+            for (uint32 index : cube.indices) {
+                mesh.indices.push_back(baseVertex + index);
+            }
+        };
+        addBox({ 10.0f, 3.0f, 10.0f }, { 2.0f, 3.0f, 2.0f });
+        addBox({ -10.3f, 10.0f, 5.3f }, { 0.1f, 10.0f, 0.1f });
+
+        HeightfieldDesc meshDesc = MakeDesc(65, 1.0f);
+        meshDesc.baseHeight = 1.0f;
+        meshDesc.maxHeightRadius = 2.0f;
+        Heightfield meshField;
+        Check(meshField.BuildFromMesh(meshDesc, mesh), "the mesh heightfield builds");
+        std::printf("  mesh      65x65: box top %.3f, beside it %.3f, pillar height %.3f max %.3f\n",
+                    meshField.GetHeight(10.0f, 10.0f), meshField.GetHeight(14.0f, 10.0f),
+                    meshField.GetHeight(-10.3f, 5.3f), meshField.GetMaxHeight(-10.3f, 5.3f));
+        Check(std::fabs(meshField.GetHeight(10.0f, 10.0f) - 6.0f) < 1.0e-4f, "samples under a box take its top");
+        Check(meshField.GetHeight(20.0f, -20.0f) == 1.0f, "samples under no triangle take the base height");
+        Check(meshField.GetMaxHeight(13.5f, 10.0f) >= 6.0f, "max heights reach past the box edge");
+        Check(meshField.GetMaxHeight(-10.3f, 5.3f) >= 20.0f && meshField.GetMaxHeight(-8.6f, 5.3f) >= 20.0f,
+              "a pillar thinner than a cell still raises the max heights around it");
+        Check(meshField.GetMaxHeight(0.0f, -20.0f) == 1.0f, "open ground keeps the base height");
+    }
+
+    // Zoom from 0 toward 1 after one big wheel-out, a quarter of a second later
+    float32 ZoomAfterQuarterSecond(uint32 framesPerSecond, const RtsCameraDesc& desc) {
+        Camera camera;
+        RtsCameraController controller(camera, desc);
+        controller.SetZoom(0.0f);
+        controller.OnMouseWheelEvent({ -1.0f / desc.zoomStep, 0, 0 });
+        float32 step = 1.0f / static_cast<float32>(framesPerSecond);
+        for (uint32 i = 0; i < framesPerSecond / 4; ++i) {
+            controller.Update(step);
+        }
+        return controller.GetZoom();
+    }
+
+    void CheckZoom() {
+        RtsCameraDesc desc;
+        float32 slow = ZoomAfterQuarterSecond(40, desc);
+        float32 fast = ZoomAfterQuarterSecond(240, desc);
+        std::printf("  zoom after 0.25 s: %.4f at 40 fps, %.4f at 240 fps\n", slow, fast);
+        Check(std::fabs(slow - fast) < 1.0e-3f, "zoom smoothing does not depend on the frame rate");
+        Check(slow > 0.5f && slow < 1.0f, "zoom moves toward the target without jumping there");
+
+        Camera camera;
+        RtsCameraController controller(camera, desc);
+        controller.SetZoom(0.5f);
+        controller.OnMouseWheelEvent({ 100.0f, 0, 0 });
+        Check(controller.GetTargetZoom() == 0.0f, "the zoom target is clamped");
+        for (uint32 i = 0; i < 600; ++i) {
+            controller.Update(1.0f / 60.0f);
+        }
+        Check(controller.GetZoom() == 0.0f, "zoom settles on the target");
+
+        float32 previousDistance = 0.0f;
+        float32 previousPitch = 0.0f;
+        float32 previousCull = 0.0f;
+        bool increasing = true;
+        bool pitchMatches = true;
+        for (uint32 step = 0; step <= 10; ++step) {
+            controller.SetZoom(static_cast<float32>(step) / 10.0f);
+            float32 distance = controller.GetDistance();
+            float32 pitch = controller.GetPitch();
+            RtsViewParameters parameters = controller.GetViewParameters();
+            if (step > 0) {
+                increasing = increasing && distance > previousDistance && pitch > previousPitch &&
+                             parameters.cullDistance > previousCull;
+            }
+            pitchMatches = pitchMatches && std::fabs(camera.GetForward().y + std::sin(pitch)) < 1.0e-4f;
+            previousDistance = distance;
+            previousPitch = pitch;
+            previousCull = parameters.cullDistance;
+        }
+        Check(increasing, "distance, pitch and cull distance grow with zoom");
+        Check(pitchMatches, "the camera looks down at the zoom's pitch");
+
+        controller.SetZoom(0.0f);
+        Check(std::fabs(controller.GetDistance() - desc.minDistance) < 1.0e-4f, "zoom 0 is the closest distance");
+        Check(controller.GetViewParameters().lodDistanceScale == 1.0f, "zoom 0 keeps full detail");
+    }
+
+    void CheckPanning(const Heightfield& heightfield) {
+        Camera camera;
+        RtsCameraController controller(camera, {});
+        controller.SetHeightfield(&heightfield);
+        controller.SetViewportSize(1280, 720);
+        controller.SetFocus({ 0.0f, 0.0f });
+
+        // The cursor in the middle of the window does nothing
+        controller.OnMouseMoveEvent({ 640, 360, 0, 0 });
+        controller.Update(0.1f);
+        Check(controller.GetFocus().x == 0.0f && controller.GetFocus().y == 0.0f, "no panning away from the edges");
+
+        // Left edge, looking along +z: moves toward -x
+        controller.OnMouseMoveEvent({ 2, 360, 0, 0 });
+        controller.Update(0.1f);
+        XMFLOAT2 focus = controller.GetFocus();
+        float32 expected = controller.GetDistance() * controller.GetDesc().panSpeed * 0.1f;
+        Check(std::fabs(focus.x + expected) < 1.0e-3f && std::fabs(focus.y) < 1.0e-4f,
+              "the left edge pans left by distance x pan speed x time");
+
+        // Turned a quarter to the right, the top edge moves along +x
+        controller.SetFocus({ 0.0f, 0.0f });
+        controller.SetYaw(XM_PIDIV2);
+        controller.OnMouseMoveEvent({ 640, 0, 0, 0 });
+        controller.Update(0.1f);
+        Check(controller.GetFocus().x > 0.0f && std::fabs(controller.GetFocus().y) < 1.0e-3f,
+              "panning follows the camera heading");
+        controller.OnMouseMoveEvent({ 640, 360, 0, 0 });
+
+        // Holding a key for a long time stops at the map edge
+        controller.SetYaw(0.0f);
+        controller.OnKeyEvent({ KeyCode::W, true, false });
+        controller.OnKeyEvent({ KeyCode::D, true, false });
+        for (uint32 i = 0; i < 2000; ++i) {
+            controller.Update(1.0f / 60.0f);
+        }
+        controller.OnKeyEvent({ KeyCode::W, false, false });
+        controller.OnKeyEvent({ KeyCode::D, false, false });
+        focus = controller.GetFocus();
+        std::printf("  after 33 s of panning: focus (%.2f, %.2f), map corner (%.2f, %.2f)\n", focus.x, focus.y,
+                    heightfield.GetMaxX(), heightfield.GetMaxZ());
+        Check(focus.x == heightfield.GetMaxX() && focus.y == heightfield.GetMaxZ(), "panning stops at the map bounds");
+    }
+
+    void CheckTerrainClamp(const Heightfield& heightfield) {
+        Camera camera;
+        RtsCameraDesc desc;
+        RtsCameraController controller(camera, desc);
+        controller.SetHeightfield(&heightfield);
+
+        std::minstd_rand random(9);
+        std::uniform_real_distribution<float32> unit(0.0f, 1.0f);
+        uint32 clamped = 0;
+        float32 worstClearance = 1.0e9f;
+        const uint32 poseCount = 5000;
+        for (uint32 i = 0; i < poseCount; ++i) {
+            float32 x = heightfield.GetMinX() + unit(random) * (heightfield.GetMaxX() - heightfield.GetMinX());
+            float32 z = heightfield.GetMinZ() + unit(random) * (heightfield.GetMaxZ() - heightfield.GetMinZ());
+            controller.SetYaw(unit(random) * XM_2PI);
+            controller.SetZoom(unit(random) * 0.3f);
+            controller.SetFocus({ x, z });
+
+            XMFLOAT3 eye = camera.GetPosition();
+            float32 free = heightfield.GetHeight(x, z) + controller.GetDistance() * std::sin(controller.GetPitch());
+            clamped += eye.y > free + 1.0e-3f ? 1 : 0;
+            float32 highest = HighestAround(heightfield, eye.x, eye.z, heightfield.GetMaxHeightRadius());
+            worstClearance = std::min(worstClearance, eye.y - highest);
+        }
+        std::printf("  %u random close-up poses: %u lifted over terrain, lowest clearance %.3f (wanted %.3f)\n",
+                    poseCount, clamped, worstClearance, desc.terrainClearance);
+        Check(clamped > 0, "some poses needed clamping");
+        Check(worstClearance >= desc.terrainClearance - 1.0e-3f, "the eye keeps its clearance above nearby terrain");
+    }
+
+    // Nanoseconds per update while panning across the map
+    float64 TimeUpdates(const Heightfield& heightfield, uint32 updateCount) {
+        Camera camera;
+        RtsCameraController controller(camera, {});
+        controller.SetHeightfield(&heightfield);
+        controller.SetViewportSize(1280, 720);
+        controller.OnKeyEvent({ KeyCode::E, true, false });
+
+        std::minstd_rand random(3);
+        std::uniform_real_distribution<float32> unit(0.0f, 1.0f);
+        auto start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < updateCount; ++i) {
+            // Jump around so lookups do not stay in cache
+            if (i % 16 == 0) {
+                controller.SetFocus({ heightfield.GetMinX() + unit(random) * (heightfield.GetMaxX() - heightfield.GetMinX()),
+                                      heightfield.GetMinZ() + unit(random) * (heightfield.GetMaxZ() - heightfield.GetMinZ()) });
+            }
+            controller.OnMouseMoveEvent({ static_cast<int32>(i % 1280), static_cast<int32>(i % 720), 0, 0 });
+            controller.Update(1.0f / 60.0f);
+        }
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<float64, std::nano>(end - start).count() / updateCount;
+    }
+
+    void CheckUpdateCost(uint32 updateCount) {
+        Heightfield small;
+        Heightfield large;
+        small.Build(MakeDesc(129, 2.0f), TerrainHeight);
+        large.Build(MakeDesc(2049, 0.125f), TerrainHeight);
+
+        TimeUpdates(small, updateCount / 10 + 1);
+        float64 smallCost = TimeUpdates(small, updateCount);
+        float64 largeCost = TimeUpdates(large, updateCount);
+        std::printf("  update: %.0f ns on 129x129, %.0f ns on 2049x2049\n", smallCost, largeCost);
+        Check(largeCost < smallCost * 4.0, "update cost does not grow with the map");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 updateCount = 200000;
+
+    Arguments arguments(argc, argv, "Usage: RtsCameraCheck [--updates N]");
+    arguments.Option("--updates", updateCount);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("RTS camera\n\n");
+    CheckHeightfield();
+    CheckZoom();
+
+    Heightfield terrain;
+    terrain.Build(MakeDesc(257, 1.0f), TerrainHeight);
+    CheckPanning(terrain);
+    CheckTerrainClamp(terrain);
+    CheckUpdateCost(updateCount > 0 ? updateCount : 1);
+
+    return Finish();
+}
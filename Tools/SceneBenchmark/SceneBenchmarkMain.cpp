@@ -0,0 +1,696 @@
+// Headless benchmark of the per-frame scene work on a synthetic RTS battlefield.
+//
+// Usage: SceneBenchmark [--units N] [--frames N] [--warmup N] [--rhi null|recording]
+//                       [--json PATH|-]
+//
+// Spawns N units (TransformComponent plus a render proxy) spread over a map that
+// grows with the unit count, then runs M frames of:
+//   update  Scene::Simulate; every unit steers and moves
+//   cull    sphere against the camera frustum (the camera pans across the map)
+//   sort    64-bit keys: pipeline, material, mesh, then front to back
+//   submit  frame graph compile, then state changes and DrawIndexed into a Null or
+//           Recording RHI context
+// Each frame starts with FrameMemory::BeginFrame and ends with the profiler's
+// EndFrame, as in Application::MainLoop. Reports percentiles per phase, heap
+// allocations per frame and per phase, and memory (heap high-water mark, bytes per
+// unit, frame and scratch arena peaks, process peak) along with MemoryTracker's
+// per-tag and per-pool counts, taken while the scene is alive. With --json the
+// report is written as JSON (to stdout for "-") so CI can track regressions
+// without a GPU. Exits with 1 on bad arguments or if a frame submits the wrong work.
+//
+// MeshComponent needs the DX12 renderer for its mesh and material, so units carry a
+// RenderProxy instead: the same per-unit data (mesh, material, bounds) with stand-in
+// GPU handles.
+
+#include "Core/Application/FrameTimeStats.h"
+#include "Core/Scene/Scene.h"
+#include "Core/Entity/Entity.h"
+#include "Core/Entity/Component.h"
+#include "Core/Entity/TransformComponent.h"
+#include "Core/Memory/FrameMemory.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+#include "Rendering/Camera.h"
+#include "Rendering/FrameGraph/FrameGraph.h"
+#include "Rendering/RHI/NullRHIContext.h"
+#include "Rendering/RHI/RecordingRHIContext.h"
+#include "Platform/Platform.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <new>
+#include <random>
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+using namespace DirectX;
+
+// Every heap allocation in the process goes through these, so phases can be charged
+// with what they allocate. The size is kept in front of the block for the live count.
+namespace {
+    constexpr size_t ALLOCATION_HEADER = 16;
+
+    std::atomic<uint64> s_allocationCount{ 0 };
+    std::atomic<uint64> s_allocatedBytes{ 0 };
+    std::atomic<int64> s_liveBytes{ 0 };
+    std::atomic<int64> s_peakLiveBytes{ 0 };
+
+    void* TrackedAllocate(size_t size) {
+        void* block = std::malloc(size + ALLOCATION_HEADER);
+        if (!block) {
+            throw std::bad_alloc();
+        }
+        *static_cast<size_t*>(block) = size;
+
+        s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+        s_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        int64 live = s_liveBytes.fetch_add(static_cast<int64>(size), std::memory_order_relaxed) + static_cast<int64>(size);
+        int64 peak = s_peakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak && !s_peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+        return static_cast<uint8*>(block) + ALLOCATION_HEADER;
+    }
+
+    void TrackedFree(void* pointer) {
+        if (!pointer) {
+            return;
+        }
+        void* block = static_cast<uint8*>(pointer) - ALLOCATION_HEADER;
+        s_liveBytes.fetch_sub(static_cast<int64>(*static_cast<size_t*>(block)), std::memory_order_relaxed);
+        std::free(block);
+    }
+}
+
+void* operator new(size_t size) { return TrackedAllocate(size); }
+void* operator new[](size_t size) { return TrackedAllocate(size); }
+void operator delete(void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { TrackedFree(pointer); }
+
+namespace {
+    uint32 s_failures = 0;
+
+    void PrintUsage() {
+        std::printf("Usage: SceneBenchmark [--units N] [--frames N] [--warmup N] [--rhi null|recording] [--json PATH|-]\n");
+    }
+
+    void Check(bool condition, const char* what) {
+        if (!condition) {
+            std::fprintf(stderr, "  FAILED  %s\n", what);
+            ++s_failures;
+        }
+    }
+
+    float64 TicksToMilliseconds(int64 ticks) {
+        return static_cast<float64>(ticks) * 1000.0 / static_cast<float64>(Platform::GetPerformanceFrequency());
+    }
+
+    uint64 GetPeakResidentBytes() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters = {};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+            return static_cast<uint64>(counters.PeakWorkingSetSize);
+        }
+        return 0;
+#else
+        rusage usage = {};
+        if (getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+    #if defined(__APPLE__)
+        return static_cast<uint64>(usage.ru_maxrss);
+    #else
+        return static_cast<uint64>(usage.ru_maxrss) * 1024;  // Kilobytes on Linux
+    #endif
+#endif
+    }
+
+    constexpr uint32 MESH_KIND_COUNT = 6;       // Infantry, vehicles, buildings, ...
+    constexpr uint32 MATERIAL_KIND_COUNT = 24;  // Team colors times unit types
+    constexpr uint32 PIPELINE_COUNT = 3;        // Basic, textured, emissive
+    constexpr uint32 CONSTANT_STRIDE = 256;     // Per-object constants, CBV aligned
+
+    // What a unit draws; the stand-in for MeshComponent
+    class RenderProxy : public Component {
+    public:
+        uint16 meshKind = 0;
+        uint16 materialKind = 0;
+        uint8 pipeline = 0;
+        float32 boundingRadius = 1.0f;
+        bool isVisible = true;
+    };
+
+    // Steers towards a waypoint and picks a new one on arrival
+    class UnitMovement : public Component {
+    public:
+        UnitMovement(float32 mapSize, uint32 seed) : m_mapSize(mapSize), m_random(seed) {}
+
+        void BeginPlay() override {
+            PickWaypoint();
+        }
+
+        void Update(float deltaTime) override {
+            TransformComponent* transform = GetOwner()->GetComponent<TransformComponent>();
+            const XMFLOAT3& position = transform->GetPosition();
+            float32 dx = m_waypoint.x - position.x;
+            float32 dz = m_waypoint.y - position.z;
+            float32 distance = std::sqrt(dx * dx + dz * dz);
+            if (distance < 0.5f) {
+                PickWaypoint();
+                return;
+            }
+
+            float32 step = std::min(distance, m_speed * deltaTime);
+            transform->AddPosition(dx / distance * step, 0.0f, dz / distance * step);
+            transform->SetRotation(0.0f, std::atan2(dx, dz), 0.0f);
+        }
+
+    private:
+        void PickWaypoint() {
+            std::uniform_real_distribution<float32> coordinate(0.0f, m_mapSize);
+            std::uniform_real_distribution<float32> speed(2.0f, 8.0f);
+            m_waypoint = { coordinate(m_random), coordinate(m_random) };
+            m_speed = speed(m_random);
+        }
+
+        float32 m_mapSize;
+        std::minstd_rand m_random;
+        XMFLOAT2 m_waypoint = { 0.0f, 0.0f };
+        float32 m_speed = 4.0f;
+    };
+
+    struct VisibleDraw {
+        uint64 sortKey = 0;
+        const RenderProxy* proxy = nullptr;
+        XMFLOAT4X4 world;
+    };
+
+    // Stand-in GPU objects, addressed only by their handles
+    struct MeshGeometry {
+        RHIVertexBufferView vertexBuffer;
+        RHIIndexBufferView indexBuffer;
+        uint32 indexCount = 0;
+    };
+
+    struct MaterialBinding {
+        RHIShader vertexShader;
+        RHIShader pixelShader;
+        RHITextureView diffuse;
+        RHISamplerView sampler;
+    };
+
+    struct BenchmarkResources {
+        MeshGeometry meshes[MESH_KIND_COUNT];
+        MaterialBinding materials[MATERIAL_KIND_COUNT];
+
+        BenchmarkResources() {
+            static const uint32 indexCounts[MESH_KIND_COUNT] = { 36, 240, 960, 1800, 3600, 7200 };
+            for (uint32 i = 0; i < MESH_KIND_COUNT; ++i) {
+                meshes[i].vertexBuffer.bufferLocation = 0x10000ull * (i + 1);
+                meshes[i].vertexBuffer.sizeInBytes = indexCounts[i] * 32;
+                meshes[i].vertexBuffer.strideInBytes = 32;
+                meshes[i].indexBuffer.bufferLocation = 0x20000000ull + 0x10000ull * i;
+                meshes[i].indexBuffer.sizeInBytes = indexCounts[i] * 4;
+                meshes[i].indexCount = indexCounts[i];
+            }
+            for (uint32 i = 0; i < MATERIAL_KIND_COUNT; ++i) {
+                materials[i].vertexShader.type = RHIShaderType::Vertex;
+                materials[i].vertexShader.entryPoint = "main";
+                materials[i].pixelShader.type = RHIShaderType::Pixel;
+                materials[i].pixelShader.entryPoint = "main";
+                materials[i].diffuse.shaderResourceView = reinterpret_cast<void*>(static_cast<uintptr_t>(0x1000 + i));
+            }
+        }
+    };
+
+    enum Phase : uint32 {
+        PHASE_UPDATE,
+        PHASE_CULL,
+        PHASE_SORT,
+        PHASE_SUBMIT,
+        PHASE_FRAME,
+        PHASE_COUNT
+    };
+    const char* const s_phaseNames[PHASE_COUNT] = { "update", "cull", "sort", "submit", "frame" };
+
+    struct PhaseResult {
+        FrameTimeSummary time;
+        uint64 allocations = 0;     // Over the measured frames
+        uint64 allocatedBytes = 0;
+    };
+
+    struct BenchmarkResult {
+        uint32 units = 0;
+        uint32 frames = 0;
+        float32 mapSize = 0.0f;
+        const char* rhi = "null";
+        PhaseResult phases[PHASE_COUNT];
+        uint64 visibleDraws = 0;        // Over the measured frames
+        uint64 drawCalls = 0;
+        uint64 stateChanges = 0;        // Shader, texture and buffer binds
+        float64 spawnMs = 0.0;
+        uint64 sceneBytes = 0;          // Heap held by the spawned scene
+        int64 heapPeakBytes = 0;
+        uint64 frameArenaPeakBytes = 0;     // This thread's FrameMemory arenas
+        uint64 scratchArenaPeakBytes = 0;
+        uint64 arenaBlockAllocations = 0;
+        uint64 peakResidentBytes = 0;
+        MemoryTagStats tracked[static_cast<uint32>(MemoryTag::COUNT)];
+        String trackedReport;
+    };
+
+    class BenchmarkScene : public Scene {
+    public:
+        BenchmarkScene(uint32 unitCount, float32 mapSize) {
+            SetName("Benchmark Scene");
+            std::minstd_rand random(7);
+            std::uniform_real_distribution<float32> coordinate(0.0f, mapSize);
+            std::uniform_real_distribution<float32> scale(0.5f, 1.5f);
+            for (uint32 i = 0; i < unitCount; ++i) {
+                Entity* unit = SpawnEntity<Entity>();
+                TransformComponent* transform = unit->GetComponent<TransformComponent>();
+                transform->SetPosition(coordinate(random), 0.0f, coordinate(random));
+                transform->SetScale(scale(random));
+
+                RenderProxy* proxy = unit->AddComponent<RenderProxy>();
+                proxy->meshKind = static_cast<uint16>(random() % MESH_KIND_COUNT);
+                proxy->materialKind = static_cast<uint16>(random() % MATERIAL_KIND_COUNT);
+                proxy->pipeline = static_cast<uint8>(proxy->materialKind % PIPELINE_COUNT);
+                proxy->boundingRadius = 0.9f + 0.4f * proxy->meshKind;
+
+                // A fifth of the units (buildings) never move
+                if (i % 5 != 0) {
+                    unit->AddComponent<UnitMovement>(mapSize, static_cast<uint32>(random()));
+                }
+            }
+        }
+    };
+
+    class SceneBenchmark {
+    public:
+        SceneBenchmark(BenchmarkScene& scene, float32 mapSize, IRHIContext& context)
+            : m_scene(scene), m_mapSize(mapSize), m_context(context), m_visible(FrameMemory::GetFrameResource()) {
+            CameraDesc cameraDesc;
+            cameraDesc.fovY = XM_PIDIV4;
+            cameraDesc.aspectRatio = 16.0f / 9.0f;
+            cameraDesc.nearPlane = 0.5f;
+            cameraDesc.farPlane = 400.0f;
+            m_camera = std::make_unique<Camera>(cameraDesc);
+        }
+
+        // One frame; fills the phase timings (ticks) and allocation deltas
+        void RunFrame(uint32 frame, int64 outTicks[PHASE_COUNT], uint64 outAllocations[PHASE_COUNT],
+                      uint64 outBytes[PHASE_COUNT]) {
+            uint64 frameAllocations = s_allocationCount.load(std::memory_order_relaxed);
+            uint64 frameBytes = s_allocatedBytes.load(std::memory_order_relaxed);
+            int64 frameBegin = Platform::GetPerformanceCounter();
+            FrameMemory::BeginFrame();
+
+            for (uint32 phase = 0; phase < PHASE_FRAME; ++phase) {
+                uint64 allocations = s_allocationCount.load(std::memory_order_relaxed);
+                uint64 bytes = s_allocatedBytes.load(std::memory_order_relaxed);
+                int64 begin = Platform::GetPerformanceCounter();
+                switch (phase) {
+                    case PHASE_UPDATE: { PROFILE_SCOPE("SceneBenchmark::Update"); Update(frame); break; }
+                    case PHASE_CULL: { PROFILE_SCOPE("SceneBenchmark::Cull"); Cull(); break; }
+                    case PHASE_SORT: { PROFILE_SCOPE("SceneBenchmark::Sort"); Sort(); break; }
+                    case PHASE_SUBMIT: { PROFILE_SCOPE("SceneBenchmark::Submit"); Submit(); break; }
+                }
+                outTicks[phase] = Platform::GetPerformanceCounter() - begin;
+                outAllocations[phase] = s_allocationCount.load(std::memory_order_relaxed) - allocations;
+                outBytes[phase] = s_allocatedBytes.load(std::memory_order_relaxed) - bytes;
+            }
+
+            Profiler::GetGlobal().EndFrame();
+            outTicks[PHASE_FRAME] = Platform::GetPerformanceCounter() - frameBegin;
+            outAllocations[PHASE_FRAME] = s_allocationCount.load(std::memory_order_relaxed) - frameAllocations;
+            outBytes[PHASE_FRAME] = s_allocatedBytes.load(std::memory_order_relaxed) - frameBytes;
+        }
+
+        // Valid until the next RunFrame
+        const ScratchVector<VisibleDraw>& GetVisibleDraws() const { return m_visible; }
+        uint64 GetStateChanges() const { return m_stateChanges; }
+        bool IsFrameGraphCompiled() const { return m_frameGraph.IsCompiled(); }
+
+    private:
+        void Update(uint32 frame) {
+            m_scene.Simulate(1.0f / 30.0f);
+
+            // The camera pans in a circle over the battlefield, as a player scrolling would
+            float32 angle = static_cast<float32>(frame) * 0.01f;
+            float32 center = m_mapSize * 0.5f;
+            float32 radius = m_mapSize * 0.3f;
+            XMFLOAT3 target = { center + std::cos(angle) * radius, 0.0f, center + std::sin(angle) * radius };
+            m_camera->LookAt({ target.x, 60.0f, target.z - 45.0f }, target, { 0.0f, 1.0f, 0.0f });
+        }
+
+        void Cull() {
+            const Frustum& frustum = m_camera->GetFrustum();
+            XMFLOAT3 eye = m_camera->GetPosition();
+
+            // Frame memory, like the engine's per-frame temporaries: the old list went with
+            // BeginFrame, so start over at last frame's size
+            m_visible = ScratchVector<VisibleDraw>(FrameMemory::GetFrameResource());
+            m_visible.reserve(m_lastVisibleCount);
+            for (const PoolPtr<Entity>& entity : m_scene.GetEntities()) {
+                if (!entity->IsActive()) {
+                    continue;
+                }
+                const RenderProxy* proxy = entity->GetComponent<RenderProxy>();
+                if (!proxy || !proxy->isVisible) {
+                    continue;
+                }
+
+                const TransformComponent* transform = entity->GetComponent<TransformComponent>();
+                const XMFLOAT3& position = transform->GetPosition();
+                const XMFLOAT3& scale = transform->GetScale();
+                float32 radius = proxy->boundingRadius * std::max(scale.x, std::max(scale.y, scale.z));
+                if (!frustum.IntersectsSphere(position, radius)) {
+                    continue;
+                }
+
+                float32 dx = position.x - eye.x;
+                float32 dy = position.y - eye.y;
+                float32 dz = position.z - eye.z;
+                uint32 depth = static_cast<uint32>(std::min(std::sqrt(dx * dx + dy * dy + dz * dz) * 256.0f, 4294967040.0f));
+
+                VisibleDraw& draw = m_visible.emplace_back();
+                draw.sortKey = (static_cast<uint64>(proxy->pipeline) << 60) |
+                               (static_cast<uint64>(proxy->materialKind) << 48) |
+                               (static_cast<uint64>(proxy->meshKind) << 36) |
+                               (depth >> 4);
+                draw.proxy = proxy;
+                XMStoreFloat4x4(&draw.world, transform->GetWorldMatrix());
+            }
+            m_lastVisibleCount = m_visible.size();
+        }
+
+        void Sort() {
+            std::sort(m_visible.begin(), m_visible.end(),
+                      [](const VisibleDraw& a, const VisibleDraw& b) { return a.sortKey < b.sortKey; });
+        }
+
+        void Submit() {
+            BuildFrameGraph();
+
+            RHIViewport viewport;
+            viewport.width = 1920.0f;
+            viewport.height = 1080.0f;
+            m_context.SetViewport(viewport);
+            m_context.SetScissorRect({ 0, 0, 1920, 1080 });
+            m_context.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+
+            int32 material = -1;
+            int32 mesh = -1;
+            m_stateChanges = 0;
+            for (size_t i = 0; i < m_visible.size(); ++i) {
+                const RenderProxy& proxy = *m_visible[i].proxy;
+                if (proxy.materialKind != material) {
+                    material = proxy.materialKind;
+                    const MaterialBinding& binding = m_resources.materials[material];
+                    m_context.SetVertexShader(binding.vertexShader);
+                    m_context.SetPixelShader(binding.pixelShader);
+                    m_context.SetTexture(0, binding.diffuse);
+                    m_context.SetSampler(0, binding.sampler);
+                    m_stateChanges += 4;
+                }
+                const MeshGeometry& geometry = m_resources.meshes[proxy.meshKind];
+                if (proxy.meshKind != mesh) {
+                    mesh = proxy.meshKind;
+                    m_context.SetVertexBuffer(0, geometry.vertexBuffer);
+                    m_context.SetIndexBuffer(geometry.indexBuffer);
+                    m_stateChanges += 2;
+                }
+
+                // Per-object constants live in a ring; only the view into it changes
+                RHIConstantBufferView constants;
+                constants.bufferLocation = 0x40000000ull + static_cast<uint64>(i) * CONSTANT_STRIDE;
+                constants.sizeInBytes = CONSTANT_STRIDE;
+                m_context.SetConstantBuffer(0, constants);
+                m_context.DrawIndexed(geometry.indexCount);
+            }
+        }
+
+        // Same graph as DX12Renderer::BuildFrameGraph, compiled with estimated sizes
+        void BuildFrameGraph() {
+            m_frameGraph.Reset();
+
+            RHITextureDesc backBufferDesc;
+            backBufferDesc.width = 1920;
+            backBufferDesc.height = 1080;
+            backBufferDesc.format = RHIResourceFormat::R8G8B8A8_Unorm;
+            FrameGraphResource backBuffer = m_frameGraph.ImportTexture("BackBuffer", backBufferDesc, nullptr,
+                                                                       RHIResourceState::Present, RHIResourceState::Present);
+
+            RHITextureDesc depthDesc = backBufferDesc;
+            depthDesc.format = RHIResourceFormat::D32_Float;
+            FrameGraphResource depth = m_frameGraph.ImportTexture("DepthStencil", depthDesc, nullptr,
+                                                                  RHIResourceState::DepthWrite, RHIResourceState::DepthWrite);
+
+            m_frameGraph.AddPass("Scene",
+                [&](FrameGraphPassBuilder& builder) {
+                    builder.Write(backBuffer, RHIResourceState::RenderTarget);
+                    builder.Write(depth, RHIResourceState::DepthWrite);
+                },
+                [](FrameGraphPassContext&) {});
+            m_frameGraph.Compile();
+        }
+
+    private:
+        BenchmarkScene& m_scene;
+        float32 m_mapSize;
+        IRHIContext& m_context;
+        UniquePtr<Camera> m_camera;
+        BenchmarkResources m_resources;
+        FrameGraph m_frameGraph;
+        ScratchVector<VisibleDraw> m_visible;
+        size_t m_lastVisibleCount = 0;
+        uint64 m_stateChanges = 0;
+    };
+
+    // Runs the whole benchmark; the heap counters are only read between phases
+    BenchmarkResult Run(uint32 unitCount, uint32 frameCount, uint32 warmupCount, bool recording) {
+        BenchmarkResult result;
+        result.units = unitCount;
+        result.frames = frameCount;
+        result.rhi = recording ? "recording" : "null";
+        // Keep the unit density constant: about 16 square units each
+        result.mapSize = std::sqrt(static_cast<float32>(unitCount)) * 4.0f;
+
+        // Recording forwards to the null context, which counts the work either way
+        NullRHIContext nullContext;
+        RecordingRHIContext recordingContext(&nullContext);
+        IRHIContext& context = recording ? static_cast<IRHIContext&>(recordingContext) : nullContext;
+
+        int64 liveBeforeScene = s_liveBytes.load();
+        int64 spawnBegin = Platform::GetPerformanceCounter();
+        BenchmarkScene scene(unitCount, result.mapSize);
+        scene.BeginPlay();
+        result.spawnMs = TicksToMilliseconds(Platform::GetPerformanceCounter() - spawnBegin);
+        result.sceneBytes = static_cast<uint64>(std::max<int64>(s_liveBytes.load() - liveBeforeScene, 0));
+
+        SceneBenchmark benchmark(scene, result.mapSize, context);
+        FrameTimeStatsConfig statsConfig;
+        statsConfig.windowSize = frameCount;
+        Vector<FrameTimeStats> phaseStats(PHASE_COUNT, FrameTimeStats(statsConfig));
+        bool submittedAll = true;
+        bool sorted = true;
+        bool compiledGraph = true;
+
+        for (uint32 frame = 0; frame < warmupCount + frameCount; ++frame) {
+            nullContext.ResetStats();
+            recordingContext.Reset();
+
+            int64 ticks[PHASE_COUNT];
+            uint64 allocations[PHASE_COUNT];
+            uint64 bytes[PHASE_COUNT];
+            benchmark.RunFrame(frame, ticks, allocations, bytes);
+            if (frame < warmupCount) {
+                continue;
+            }
+
+            for (uint32 phase = 0; phase < PHASE_COUNT; ++phase) {
+                phaseStats[phase].AddFrame(static_cast<float32>(TicksToMilliseconds(ticks[phase])));
+                result.phases[phase].allocations += allocations[phase];
+                result.phases[phase].allocatedBytes += bytes[phase];
+            }
+
+            const ScratchVector<VisibleDraw>& visible = benchmark.GetVisibleDraws();
+            uint64 drawCalls = nullContext.GetStats().drawCalls;
+            result.visibleDraws += visible.size();
+            result.drawCalls += drawCalls;
+            result.stateChanges += benchmark.GetStateChanges();
+
+            submittedAll = submittedAll && drawCalls == visible.size();
+            sorted = sorted && std::is_sorted(visible.begin(), visible.end(),
+                                              [](const VisibleDraw& a, const VisibleDraw& b) { return a.sortKey < b.sortKey; });
+            compiledGraph = compiledGraph && benchmark.IsFrameGraphCompiled();
+        }
+
+        for (uint32 phase = 0; phase < PHASE_COUNT; ++phase) {
+            result.phases[phase].time = phaseStats[phase].GetSummary();
+        }
+        Check(submittedAll, "one draw call per visible unit");
+        Check(sorted, "draws are submitted in key order");
+        Check(result.visibleDraws > 0, "the camera sees part of the battlefield");
+        Check(compiledGraph, "the frame graph compiles every frame");
+        result.heapPeakBytes = s_peakLiveBytes.load();
+        const LinearArenaStats& frameArena = FrameMemory::GetFrameArena().GetStats();
+        const LinearArenaStats& scratchArena = FrameMemory::GetScratchArena().GetStats();
+        result.frameArenaPeakBytes = frameArena.peakBytes;
+        result.scratchArenaPeakBytes = scratchArena.peakBytes;
+        result.arenaBlockAllocations = frameArena.blockAllocations + scratchArena.blockAllocations;
+        for (uint32 tag = 0; tag < static_cast<uint32>(MemoryTag::COUNT); ++tag) {
+            result.tracked[tag] = MemoryTracker::GetStats(static_cast<MemoryTag>(tag));
+        }
+        result.trackedReport = MemoryTracker::FormatReport();
+        result.peakResidentBytes = GetPeakResidentBytes();
+        return result;
+    }
+
+    void PrintReport(const BenchmarkResult& result) {
+        float64 frames = result.frames;
+        std::printf("Scene benchmark: %u units on a %.0f x %.0f map, %u frames, %s RHI\n\n",
+                    result.units, result.mapSize, result.mapSize, result.frames, result.rhi);
+        std::printf("  %-7s %9s %9s %9s %9s %9s %12s %12s\n", "phase", "mean ms", "p50", "p95", "p99", "max",
+                    "allocs/frm", "bytes/frm");
+        for (uint32 phase = 0; phase < PHASE_COUNT; ++phase) {
+            const PhaseResult& p = result.phases[phase];
+            std::printf("  %-7s %9.3f %9.3f %9.3f %9.3f %9.3f %12.1f %12.0f\n", s_phaseNames[phase],
+                        p.time.averageMs, p.time.p50Ms, p.time.p95Ms, p.time.p99Ms, p.time.maxMs,
+                        p.allocations / frames, p.allocatedBytes / frames);
+        }
+        std::printf("\n  %.0f visible draws and %.0f state changes per frame\n",
+                    result.visibleDraws / frames, result.stateChanges / frames);
+        std::printf("  spawn %.1f ms, scene %.1f MB (%.0f bytes per unit), heap peak %.1f MB, process peak %.1f MB\n",
+                    result.spawnMs, result.sceneBytes / 1048576.0, result.units ? static_cast<float64>(result.sceneBytes) / result.units : 0.0,
+                    result.heapPeakBytes / 1048576.0, result.peakResidentBytes / 1048576.0);
+        std::printf("  arenas: frame peak %llu bytes, scratch peak %llu bytes, %llu blocks taken from the heap\n",
+                    static_cast<unsigned long long>(result.frameArenaPeakBytes),
+                    static_cast<unsigned long long>(result.scratchArenaPeakBytes),
+                    static_cast<unsigned long long>(result.arenaBlockAllocations));
+        std::printf("\n  Tracked memory:\n%s", result.trackedReport.c_str());
+    }
+
+    String FormatJson(const BenchmarkResult& result) {
+        float64 frames = result.frames;
+        char number[512];
+        String json = "{\n";
+        std::snprintf(number, sizeof(number),
+                      "  \"config\": {\"units\": %u, \"frames\": %u, \"mapSize\": %.1f, \"rhi\": \"%s\"},\n",
+                      result.units, result.frames, result.mapSize, result.rhi);
+        json += number;
+
+        json += "  \"phases\": {\n";
+        for (uint32 phase = 0; phase < PHASE_COUNT; ++phase) {
+            const PhaseResult& p = result.phases[phase];
+            std::snprintf(number, sizeof(number),
+                          "    \"%s\": {\"meanMs\": %.4f, \"p50Ms\": %.4f, \"p95Ms\": %.4f, \"p99Ms\": %.4f, \"maxMs\": %.4f, "
+                          "\"allocationsPerFrame\": %.2f, \"allocatedBytesPerFrame\": %.1f}%s\n",
+                          s_phaseNames[phase], p.time.averageMs, p.time.p50Ms, p.time.p95Ms, p.time.p99Ms, p.time.maxMs,
+                          p.allocations / frames, p.allocatedBytes / frames, phase + 1 < PHASE_COUNT ? "," : "");
+            json += number;
+        }
+        json += "  },\n";
+
+        std::snprintf(number, sizeof(number),
+                      "  \"render\": {\"visibleDrawsPerFrame\": %.1f, \"drawCallsPerFrame\": %.1f, \"stateChangesPerFrame\": %.1f},\n",
+                      result.visibleDraws / frames, result.drawCalls / frames, result.stateChanges / frames);
+        json += number;
+        std::snprintf(number, sizeof(number),
+                      "  \"memory\": {\"spawnMs\": %.2f, \"sceneBytes\": %llu, \"bytesPerUnit\": %.1f, "
+                      "\"heapPeakBytes\": %lld, \"frameArenaPeakBytes\": %llu, \"scratchArenaPeakBytes\": %llu, "
+                      "\"arenaBlockAllocations\": %llu, \"peakResidentBytes\": %llu},\n",
+                      result.spawnMs, static_cast<unsigned long long>(result.sceneBytes),
+                      result.units ? static_cast<float64>(result.sceneBytes) / result.units : 0.0,
+                      static_cast<long long>(result.heapPeakBytes), static_cast<unsigned long long>(result.frameArenaPeakBytes),
+                      static_cast<unsigned long long>(result.scratchArenaPeakBytes),
+                      static_cast<unsigned long long>(result.arenaBlockAllocations),
+                      static_cast<unsigned long long>(result.peakResidentBytes));
+        json += number;
+
+        json += "  \"tracked\": {\n";
+        for (uint32 tag = 0; tag < static_cast<uint32>(MemoryTag::COUNT); ++tag) {
+            const MemoryTagStats& t = result.tracked[tag];
+            std::snprintf(number, sizeof(number),
+                          "    \"%s\": {\"liveBytes\": %llu, \"peakBytes\": %llu, \"liveAllocations\": %llu, \"totalAllocations\": %llu}%s\n",
+                          MemoryTracker::GetTagName(static_cast<MemoryTag>(tag)), static_cast<unsigned long long>(t.liveBytes),
+                          static_cast<unsigned long long>(t.peakBytes), static_cast<unsigned long long>(t.liveAllocations),
+                          static_cast<unsigned long long>(t.totalAllocations), tag + 1 < static_cast<uint32>(MemoryTag::COUNT) ? "," : "");
+            json += number;
+        }
+        json += "  }\n";
+        json += "}\n";
+        return json;
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 unitCount = 10000;
+    uint32 frameCount = 300;
+    uint32 warmupCount = 10;
+    bool recording = false;
+    const char* jsonPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--units") == 0 && i + 1 < argc) {
+            unitCount = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frameCount = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+            warmupCount = static_cast<uint32>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--rhi") == 0 && i + 1 < argc) {
+            ++i;
+            if (std::strcmp(argv[i], "null") != 0 && std::strcmp(argv[i], "recording") != 0) {
+                PrintUsage();
+                return 1;
+            }
+            recording = std::strcmp(argv[i], "recording") == 0;
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    if (unitCount == 0 || frameCount == 0) {
+        PrintUsage();
+        return 1;
+    }
+
+    BenchmarkResult result = Run(unitCount, frameCount, warmupCount, recording);
+    bool jsonToStdout = jsonPath && std::strcmp(jsonPath, "-") == 0;
+    if (!jsonToStdout) {
+        PrintReport(result);
+    }
+
+    if (jsonPath) {
+        String json = FormatJson(result);
+        if (jsonToStdout) {
+            std::fwrite(json.data(), 1, json.size(), stdout);
+        } else {
+            std::ofstream file(jsonPath, std::ios::binary);
+            file.write(json.data(), static_cast<std::streamsize>(json.size()));
+            if (!file) {
+                std::fprintf(stderr, "Failed to write %s\n", jsonPath);
+                return 1;
+            }
+            std::printf("\n  Report written to %s\n", jsonPath);
+        }
+    }
+
+    if (s_failures != 0) {
+        std::fprintf(stderr, "  FAILED (%u failures)\n", s_failures);
+    }
+    return s_failures == 0 ? 0 : 1;
+}
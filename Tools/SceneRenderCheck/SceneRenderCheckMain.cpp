@@ -0,0 +1,266 @@
+// Headless check of parallel scene recording.
+//
+// Usage: SceneRenderCheck [--frames N]
+//
+// Checks JobSystem::GetPartitionRange and GetPartitionCount on their edge cases (no
+// items, fewer items than partitions, uneven splits) and exhaustively over small
+// counts. Then records scenes of various sizes, with some entities and components
+// inactive, both serially into a RecordingRHIContext and in parallel through a
+// RecordingRHIContextPool on job systems of 1 to 8 workers, for several pool sizes
+// and minimum entities per context. The merged parallel stream must match the serial
+// one byte for byte, N frames in a row. A visibility filter must record the same
+// stream as a serial pass over a scene where the filtered entities are inactive.
+// Exits with 1 on any failure.
+
+#include "Core/Scene/Scene.h"
+#include "Core/Entity/Entity.h"
+#include "Core/Entity/Component.h"
+#include "Core/Threading/JobSystem.h"
+#include "Rendering/RHI/RecordingRHIContext.h"
+#include "Rendering/RHI/RecordingRHIContextPool.h"
+#include "../Common/CheckHarness.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace CheckHarness;
+
+namespace {
+    // Draws a stand-in mesh whose buffers and index count identify the entity, so any
+    // reordering or duplication changes the stream
+    class DrawProxy : public Component {
+    public:
+        explicit DrawProxy(uint32 id) : m_id(id) {}
+
+        void Render(IRHIContext& context) override {
+            RHIVertexBufferView vertices;
+            vertices.bufferLocation = 0x10000ull + m_id * 64ull;
+            vertices.sizeInBytes = 64;
+            vertices.strideInBytes = 16;
+            context.SetVertexBuffer(0, vertices);
+
+            RHIConstantBufferView constants;
+            constants.bufferLocation = 0x80000000ull + m_id * 256ull;
+            constants.sizeInBytes = 256;
+            context.SetConstantBuffer(1, constants);
+
+            context.SetPrimitiveTopology(RHIPrimitiveTopology::TriangleList);
+            context.DrawIndexed(36 + m_id % 7, m_id % 3, 0);
+        }
+
+    private:
+        uint32 m_id;
+    };
+
+    // Second component on some entities: draw order within an entity must hold too
+    class SelectionRing : public Component {
+    public:
+        explicit SelectionRing(uint32 id) : m_id(id) {}
+
+        void Render(IRHIContext& context) override {
+            context.SetPrimitiveTopology(RHIPrimitiveTopology::LineList);
+            context.Draw(32, m_id);
+        }
+
+    private:
+        uint32 m_id;
+    };
+
+    void PopulateScene(Scene& scene, uint32 entityCount) {
+        for (uint32 i = 0; i < entityCount; ++i) {
+            Entity* entity = scene.SpawnEntity<Entity>();
+            DrawProxy* proxy = entity->AddComponent<DrawProxy>(i);
+            if (i % 4 == 1) {
+                entity->AddComponent<SelectionRing>(i);
+            }
+
+            // Inactive entities and components are skipped by both paths
+            if (i % 11 == 5) {
+                entity->SetActive(false);
+            }
+            if (i % 13 == 7) {
+                proxy->SetActive(false);
+            }
+        }
+    }
+
+    uint32 CountActiveEntities(const Scene& scene) {
+        uint32 count = 0;
+        for (const auto& entity : scene.GetEntities()) {
+            if (entity && entity->IsActive()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void CheckPartitionCount() {
+        Check(JobSystem::GetPartitionCount(0, 8, 1) == 0, "no items need no partitions");
+        Check(JobSystem::GetPartitionCount(0, 0, 0) == 0, "no items need no partitions whatever the limits");
+        Check(JobSystem::GetPartitionCount(5, 8, 1) == 5, "fewer items than partitions gives one item each");
+        Check(JobSystem::GetPartitionCount(5, 8, 32) == 1, "fewer items than the minimum gives one partition");
+        Check(JobSystem::GetPartitionCount(64, 8, 32) == 2, "minimum items per partition limits the count");
+        Check(JobSystem::GetPartitionCount(65, 8, 32) == 2, "partial minimum does not add a partition");
+        Check(JobSystem::GetPartitionCount(1000, 8, 32) == 8, "maximum partitions limits the count");
+        Check(JobSystem::GetPartitionCount(100, 4, 0) == 4, "zero minimum counts as one");
+        Check(JobSystem::GetPartitionCount(100, 0, 1) == 1, "zero maximum still gives one partition");
+    }
+
+    void CheckPartitionRange() {
+        auto matches = [](JobRange range, uint32 begin, uint32 end) {
+            return range.begin == begin && range.end == end;
+        };
+
+        bool emptyCount = true;
+        for (uint32 i = 0; i < 4; ++i) {
+            emptyCount &= JobSystem::GetPartitionRange(0, 4, i).GetCount() == 0;
+        }
+        Check(emptyCount, "no items gives empty partitions");
+
+        Check(matches(JobSystem::GetPartitionRange(10, 4, 0), 0, 3) && matches(JobSystem::GetPartitionRange(10, 4, 1), 3, 6) &&
+              matches(JobSystem::GetPartitionRange(10, 4, 2), 6, 8) && matches(JobSystem::GetPartitionRange(10, 4, 3), 8, 10),
+              "remainder goes to the first partitions");
+
+        bool fewItems = true;
+        for (uint32 i = 0; i < 8; ++i) {
+            JobRange range = JobSystem::GetPartitionRange(3, 8, i);
+            fewItems &= i < 3 ? matches(range, i, i + 1) : range.GetCount() == 0 && range.begin == 3;
+        }
+        Check(fewItems, "fewer items than partitions leaves the last partitions empty");
+
+        Check(JobSystem::GetPartitionRange(10, 0, 0).GetCount() == 0, "zero partitions gives an empty range");
+        Check(JobSystem::GetPartitionRange(10, 4, 4).GetCount() == 0, "index past the partitions gives an empty range");
+
+        // Every split covers [0, count) in order with sizes that never grow and differ by at most one
+        bool covered = true;
+        for (uint32 count = 0; count <= 200 && covered; ++count) {
+            for (uint32 partitions = 1; partitions <= 16 && covered; ++partitions) {
+                uint32 next = 0;
+                uint32 firstSize = JobSystem::GetPartitionRange(count, partitions, 0).GetCount();
+                uint32 previousSize = firstSize;
+                for (uint32 i = 0; i < partitions; ++i) {
+                    JobRange range = JobSystem::GetPartitionRange(count, partitions, i);
+                    covered &= range.begin == next && range.end >= range.begin;
+                    covered &= range.GetCount() <= previousSize && firstSize - range.GetCount() <= 1;
+                    previousSize = range.GetCount();
+                    next = range.end;
+                }
+                covered &= next == count;
+            }
+        }
+        Check(covered, "partitions cover every count contiguously and evenly");
+    }
+
+    void CheckRecording(uint32 frameCount) {
+        const uint32 entityCounts[] = { 0, 1, 7, 32, 33, 100, 257 };
+        const uint32 workerCounts[] = { 1, 2, 3, 8 };
+        const uint32 poolSizes[] = { 1, 3, 8 };
+        const uint32 minEntities[] = { 0, 1, 5, 32, 1000 };
+
+        uint32 runs = 0;
+        uint32 mismatches = 0;
+        uint32 wrongContextCounts = 0;
+        uint32 maxContexts = 0;
+
+        for (uint32 workerCount : workerCounts) {
+            JobSystem jobSystem(workerCount);
+            for (uint32 entityCount : entityCounts) {
+                Scene scene;
+                PopulateScene(scene, entityCount);
+                const uint32 activeCount = CountActiveEntities(scene);
+
+                RecordingRHIContext serial;
+                scene.Render(static_cast<IRHIContext&>(serial));
+
+                for (uint32 poolSize : poolSizes) {
+                    RecordingRHIContextPool pool(poolSize);
+                    for (uint32 minimum : minEntities) {
+                        scene.SetMinEntitiesPerRenderContext(minimum);
+                        uint32 expectedContexts = std::min(
+                            JobSystem::GetPartitionCount(activeCount, workerCount + 1, minimum), poolSize);
+
+                        // The pool is reused frame after frame, as a renderer would
+                        for (uint32 frame = 0; frame < frameCount; ++frame) {
+                            pool.Reset();
+                            scene.Render(pool, jobSystem);
+                            ++runs;
+
+                            const RHICommandStream& parallel = pool.GetStream();
+                            if (parallel.GetData() != serial.GetStream().GetData() ||
+                                parallel.GetCommandCount() != serial.GetStream().GetCommandCount()) {
+                                ++mismatches;
+                            }
+                            if (activeCount > 0 && pool.GetActiveContextCount() != expectedContexts) {
+                                ++wrongContextCounts;
+                            }
+                            maxContexts = std::max(maxContexts, activeCount > 0 ? pool.GetActiveContextCount() : 0u);
+                        }
+                    }
+                }
+            }
+        }
+
+        std::printf("  recordings      %u parallel, up to %u contexts, %u mismatched\n", runs, maxContexts, mismatches);
+        Check(runs > 0 && mismatches == 0, "parallel recording matches serial recording");
+        Check(wrongContextCounts == 0, "context count follows the partition count and pool size");
+    }
+
+    void CheckVisibilityFilter() {
+        JobSystem jobSystem(3);
+        auto isVisible = [](const Entity& entity) { return entity.GetID() % 3 != 0; };
+
+        // Reference: the same entities, with the invisible ones switched off
+        Scene filtered;
+        PopulateScene(filtered, 100);
+        Scene reference;
+        PopulateScene(reference, 100);
+        for (const auto& entity : reference.GetEntities()) {
+            if (!isVisible(*entity)) {
+                entity->SetActive(false);
+            }
+        }
+
+        RecordingRHIContext serial;
+        reference.Render(static_cast<IRHIContext&>(serial));
+        RecordingRHIContextPool pool(4);
+        filtered.SetMinEntitiesPerRenderContext(8);
+        filtered.Render(pool, jobSystem, isVisible);
+        Check(!serial.GetStream().IsEmpty() && pool.GetStream().GetData() == serial.GetStream().GetData(),
+              "filtered parallel recording matches serial recording of the visible entities");
+
+        pool.Reset();
+        filtered.Render(pool, jobSystem, [](const Entity&) { return false; });
+        Check(pool.GetStream().IsEmpty(), "filtering out every entity records nothing");
+    }
+
+    void CheckInactiveScene() {
+        JobSystem jobSystem(2);
+        Scene scene;
+        PopulateScene(scene, 50);
+        scene.SetActive(false);
+
+        RecordingRHIContext serial;
+        scene.Render(static_cast<IRHIContext&>(serial));
+        RecordingRHIContextPool pool(4);
+        scene.Render(pool, jobSystem);
+        Check(serial.GetStream().IsEmpty() && pool.GetStream().IsEmpty(), "inactive scene records nothing");
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32 frameCount = 3;
+
+    Arguments arguments(argc, argv, "Usage: SceneRenderCheck [--frames N]");
+    arguments.Option("--frames", frameCount);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    std::printf("Scene recording\n\n");
+    CheckPartitionCount();
+    CheckPartitionRange();
+    CheckRecording(frameCount > 0 ? frameCount : 1);
+    CheckVisibilityFilter();
+    CheckInactiveScene();
+
+    return Finish();
+}
@@ -0,0 +1,249 @@
+// Headless check of the shader bytecode cache.
+//
+// Usage: ShaderCacheCheck [--directory path]
+//
+// Verifies that ShaderCache::ComputeKey matches a recorded value (so entries written by
+// Tools/ShaderCompiler are found by the renderer on another machine), ignores define
+// order and changes with the source, entry point, target, defines and flags. Then
+// round-trips entries through a scratch cache directory and makes sure truncated,
+// corrupt and misnamed entries are rejected and recompiled rather than loaded.
+// Exits with 1 on any failure.
+
+#include "Rendering/ShaderCache.h"
+#include "Core/Utilities/FileSystem.h"
+#include "../Common/CheckHarness.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace CheckHarness;
+
+namespace {
+    // ComputeKey of MakeDesc(); changes only with SHADER_CACHE_VERSION
+    constexpr uint64 RECORDED_KEY = 0x6386a81f12818183ull;
+
+    ShaderCompileDesc MakeDesc() {
+        ShaderCompileDesc desc;
+        desc.sourcePath = "Shaders/Basic.vs.hlsl";
+        desc.source = "float4 VSMain(float3 position : POSITION) : SV_Position { return float4(position, 1); }";
+        desc.entryPoint = "VSMain";
+        desc.target = "vs_5_0";
+        desc.defines = { { "USE_FOG", "1" }, { "MAX_LIGHTS", "4" }, { "SHADOWS", "" } };
+        return desc;
+    }
+
+    // Stand-in compiler: bytecode derived from the description, so a wrong entry shows up
+    struct FakeCompiler {
+        uint32 compilations = 0;
+        bool fail = false;
+
+        ShaderCache::CompileFunction MakeCompile() {
+            return [this](const ShaderCompileDesc& desc, Vector<uint8>& outBytecode) {
+                ++compilations;
+                if (fail) {
+                    return false;
+                }
+                outBytecode.assign(desc.source.begin(), desc.source.end());
+                outBytecode.push_back(static_cast<uint8>(desc.defines.size()));
+                return true;
+            };
+        }
+    };
+
+    void WriteFile(const String& path, const Vector<uint8>& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    void CheckKeys() {
+        const ShaderCompileDesc desc = MakeDesc();
+        const uint64 key = ShaderCache::ComputeKey(desc);
+        std::printf("  recorded key    %016llx\n", static_cast<unsigned long long>(key));
+        Check(key == RECORDED_KEY, "key matches the recorded value");
+        Check(ShaderCache::ComputeKey(MakeDesc()) == key, "equal descriptions give equal keys");
+
+        ShaderCompileDesc reordered = desc;
+        reordered.defines = { desc.defines[2], desc.defines[0], desc.defines[1] };
+        Check(ShaderCache::ComputeKey(reordered) == key, "define order does not change the key");
+
+        ShaderCompileDesc renamed = desc;
+        renamed.sourcePath = "Shaders/Copy.vs.hlsl";
+        Check(ShaderCache::ComputeKey(renamed) == key, "source path does not change the key");
+
+        // Everything the compiler sees must reach the key, or two shaders would share an entry
+        struct Variant {
+            const char* what;
+            void (*mutate)(ShaderCompileDesc&);
+        };
+        const Variant variants[] = {
+            { "source changes the key",       [](ShaderCompileDesc& d) { d.source += " "; } },
+            { "entry point changes the key",  [](ShaderCompileDesc& d) { d.entryPoint = "VSMainShadow"; } },
+            { "target changes the key",       [](ShaderCompileDesc& d) { d.target = "vs_5_1"; } },
+            { "compile flags change the key", [](ShaderCompileDesc& d) { d.compileFlags = 1; } },
+            { "define value changes the key", [](ShaderCompileDesc& d) { d.defines[1].value = "8"; } },
+            { "define name changes the key",  [](ShaderCompileDesc& d) { d.defines[0].name = "USE_FOG2"; } },
+            { "added define changes the key", [](ShaderCompileDesc& d) { d.defines.push_back({ "DEBUG", "1" }); } },
+            { "removed define changes the key", [](ShaderCompileDesc& d) { d.defines.pop_back(); } },
+            // Name and value are hashed separately, so moving text between them is a new key
+            { "define split changes the key", [](ShaderCompileDesc& d) { d.defines[2] = { "SHADOW", "S" }; } },
+        };
+        for (const Variant& variant : variants) {
+            ShaderCompileDesc changed = desc;
+            variant.mutate(changed);
+            Check(ShaderCache::ComputeKey(changed) != key, variant.what);
+        }
+
+        String entryPoint;
+        String target;
+        Check(ShaderCache::GetStageFromFileName("Shaders/Basic.VS.hlsl", entryPoint, target) &&
+              entryPoint == "VSMain" && target == "vs_5_0", "vertex stage comes from the file name");
+        Check(ShaderCache::GetStageFromFileName("Shaders\\Basic.ps.hlsl", entryPoint, target) &&
+              entryPoint == "PSMain" && target == "ps_5_0", "pixel stage comes from the file name");
+        Check(!ShaderCache::GetStageFromFileName("Shaders/Common.hlsli", entryPoint, target),
+              "include files have no stage");
+    }
+
+    void CheckRoundTrip(const String& directory) {
+        ShaderCache cache(directory);
+        const uint64 key = ShaderCache::ComputeKey(MakeDesc());
+
+        Vector<uint8> loaded;
+        Check(!cache.Load(key, loaded), "missing entry does not load");
+        Check(cache.GetStats().corruptEntries == 0, "missing entry is not counted as corrupt");
+
+        Vector<uint8> bytecode;
+        for (uint32 i = 0; i < 4096; ++i) {
+            bytecode.push_back(static_cast<uint8>(i * 31 + 7));
+        }
+        Check(cache.Store(key, bytecode), "entry is stored");
+        Check(cache.Load(key, loaded) && loaded == bytecode, "stored entry loads back unchanged");
+        Check(!std::filesystem::exists(directory + "/" + ShaderCache::GetEntryFileName(key) + ".tmp"),
+              "no temporary file is left behind");
+
+        Vector<uint8> empty;
+        Check(cache.Store(key + 1, empty) && cache.Load(key + 1, loaded) && loaded.empty(),
+              "empty bytecode round-trips");
+
+        // A second cache over the same directory sees the entries, as the renderer does
+        // after Tools/ShaderCompiler filled it
+        ShaderCache reopened(directory);
+        Check(reopened.Load(key, loaded) && loaded == bytecode, "entry loads through another cache");
+    }
+
+    void CheckGetOrCompile(const String& directory) {
+        ShaderCache cache(directory);
+        FakeCompiler compiler;
+        const ShaderCompileDesc desc = MakeDesc();
+
+        Vector<uint8> first;
+        Check(cache.GetOrCompile(desc, compiler.MakeCompile(), first), "first use compiles");
+        Vector<uint8> second;
+        Check(cache.GetOrCompile(desc, compiler.MakeCompile(), second) && second == first, "second use loads");
+        Check(compiler.compilations == 1, "compiled once");
+        Check(cache.GetStats().hits == 1 && cache.GetStats().misses == 1, "one hit and one miss");
+
+        ShaderCompileDesc other = desc;
+        other.target = "vs_5_1";
+        compiler.fail = true;
+        Vector<uint8> failed;
+        Check(!cache.GetOrCompile(other, compiler.MakeCompile(), failed), "compile failure is reported");
+        Check(cache.GetStats().compileFailures == 1, "compile failure is counted");
+        Check(!std::filesystem::exists(directory + "/" + ShaderCache::GetEntryFileName(ShaderCache::ComputeKey(other))),
+              "failed compile stores nothing");
+    }
+
+    void CheckCorruption(const String& directory) {
+        ShaderCache cache(directory);
+        FakeCompiler compiler;
+        const ShaderCompileDesc desc = MakeDesc();
+        const uint64 key = ShaderCache::ComputeKey(desc);
+        const String path = directory + "/" + ShaderCache::GetEntryFileName(key);
+
+        Vector<uint8> bytecode;
+        Check(cache.GetOrCompile(desc, compiler.MakeCompile(), bytecode), "entry is compiled");
+        Vector<uint8> good;
+        Check(FileSystem::ReadFile(path, good) && good.size() > sizeof(ShaderCacheFileHeader), "entry is on disk");
+        if (good.size() <= sizeof(ShaderCacheFileHeader)) {
+            return;
+        }
+
+        struct Damage {
+            const char* what;
+            void (*apply)(Vector<uint8>&);
+        };
+        const Damage damages[] = {
+            { "truncated header is rejected",  [](Vector<uint8>& d) { d.resize(sizeof(ShaderCacheFileHeader) / 2); } },
+            { "empty file is rejected",        [](Vector<uint8>& d) { d.clear(); } },
+            { "truncated bytecode is rejected", [](Vector<uint8>& d) { d.pop_back(); } },
+            { "appended bytes are rejected",   [](Vector<uint8>& d) { d.push_back(0); } },
+            { "flipped bytecode is rejected",  [](Vector<uint8>& d) { d.back() ^= 0x01; } },
+            { "wrong magic is rejected",       [](Vector<uint8>& d) { d[0] ^= 0xFF; } },
+            { "old version is rejected", [](Vector<uint8>& d) {
+                  uint32 version = SHADER_CACHE_VERSION - 1;
+                  std::memcpy(d.data() + offsetof(ShaderCacheFileHeader, version), &version, sizeof(version));
+              } },
+        };
+
+        uint32 expectedCorrupt = 0;
+        for (const Damage& damage : damages) {
+            Vector<uint8> data = good;
+            damage.apply(data);
+            WriteFile(path, data);
+
+            Vector<uint8> loaded;
+            Check(!cache.Load(key, loaded), damage.what);
+            Check(cache.GetStats().corruptEntries == ++expectedCorrupt, "rejected entry is counted as corrupt");
+        }
+
+        // An intact entry filed under another key must not be served for that key
+        ShaderCompileDesc other = desc;
+        other.entryPoint = "VSMainShadow";
+        const uint64 otherKey = ShaderCache::ComputeKey(other);
+        WriteFile(directory + "/" + ShaderCache::GetEntryFileName(otherKey), good);
+        Vector<uint8> loaded;
+        Check(!cache.Load(otherKey, loaded), "entry under the wrong key is rejected");
+
+        // A damaged entry costs one recompile and is replaced
+        Vector<uint8> damaged = good;
+        damaged.back() ^= 0x01;
+        WriteFile(path, damaged);
+        uint32 compilations = compiler.compilations;
+        Vector<uint8> recompiled;
+        Check(cache.GetOrCompile(desc, compiler.MakeCompile(), recompiled) && recompiled == bytecode,
+              "damaged entry is recompiled");
+        Check(compiler.compilations == compilations + 1, "damaged entry compiles once");
+        Check(cache.Load(key, loaded) && loaded == bytecode, "damaged entry is replaced");
+    }
+}
+
+int main(int argc, char** argv) {
+    String directory = (std::filesystem::temp_directory_path() / "ShaderCacheCheck").string();
+
+    Arguments arguments(argc, argv, "Usage: ShaderCacheCheck [--directory path]");
+    arguments.Option("--directory", directory);
+    if (!arguments.Validate()) {
+        return 1;
+    }
+
+    // Each check gets its own subdirectory, emptied first so earlier runs cannot
+    // satisfy it; nothing else in the directory is touched
+    const char* subdirectories[] = { "RoundTrip", "GetOrCompile", "Corruption" };
+    std::error_code error;
+    for (const char* subdirectory : subdirectories) {
+        std::filesystem::remove_all(directory + "/" + subdirectory, error);
+    }
+
+    std::printf("Shader cache\n\n");
+    CheckKeys();
+    CheckRoundTrip(directory + "/RoundTrip");
+    CheckGetOrCompile(directory + "/GetOrCompile");
+    CheckCorruption(directory + "/Corruption");
+
+    for (const char* subdirectory : subdirectories) {
+        std::filesystem::remove_all(directory + "/" + subdirectory, error);
+    }
+    std::filesystem::remove(directory, error);   // Only if now empty
+    return Finish();
+}
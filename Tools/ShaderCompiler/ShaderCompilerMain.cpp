@@ -0,0 +1,119 @@
+// Offline shader compiler: fills the bytecode cache read by DX12Renderer::LoadShader.
+//
+// Usage: ShaderCompiler <shaders-dir> <cache-dir> [--debug]
+//
+// Every "*.vs.hlsl" / "*.ps.hlsl" file is compiled with the same flags the renderer uses
+// for the matching build configuration (--debug for Debug builds), so the keys line up
+// and the game finds every shader already compiled.
+
+#include "Rendering/ShaderCache.h"
+#include "Rendering/Dx12/DX12ShaderCompiler.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    void PrintUsage() {
+        std::printf("Usage: ShaderCompiler <shaders-dir> <cache-dir> [--debug]\n");
+    }
+
+    // Text mode, like DX12Renderer::LoadShaderSource, so line endings hash the same
+    bool ReadSource(const String& filePath, String& outSource) {
+        std::ifstream file(filePath);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        outSource = buffer.str();
+        return !outSource.empty();
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        PrintUsage();
+        return 1;
+    }
+
+    String shadersDirectory = argv[1];
+    String cacheDirectory = argv[2];
+    bool debug = false;
+
+    for (int i = 3; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--debug") == 0) {
+            debug = true;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_directory(shadersDirectory, ec)) {
+        std::fprintf(stderr, "ShaderCompiler: '%s' is not a directory\n", shadersDirectory.c_str());
+        return 1;
+    }
+
+    ShaderCache cache(cacheDirectory);
+    uint32 shaderCount = 0;
+    uint32 failedCount = 0;
+
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(shadersDirectory, ec)) {
+        if (!entry.is_regular_file() || entry.path().extension() != ".hlsl") {
+            continue;
+        }
+
+        // Match the path the renderer passes to LoadShader ("Shaders/Foo.vs.hlsl")
+        String filePath = entry.path().generic_string();
+        String relativePath = "Shaders/" + std::filesystem::relative(entry.path(), shadersDirectory).generic_string();
+
+        ShaderCompileDesc desc;
+        desc.sourcePath = relativePath;
+        desc.compileFlags = DX12ShaderCompiler::GetDefaultCompileFlags(debug);
+
+        if (!ShaderCache::GetStageFromFileName(filePath, desc.entryPoint, desc.target)) {
+            std::printf("  skipped   %s (no stage suffix)\n", relativePath.c_str());
+            continue;
+        }
+
+        if (!ReadSource(filePath, desc.source)) {
+            std::fprintf(stderr, "ShaderCompiler: Failed to read '%s'\n", filePath.c_str());
+            ++failedCount;
+            continue;
+        }
+
+        String errors;
+        auto compile = [&errors](const ShaderCompileDesc& compileDesc, Vector<uint8>& outBytecode) {
+            return DX12ShaderCompiler::Compile(compileDesc, outBytecode, &errors);
+        };
+
+        uint32 missesBefore = cache.GetStats().misses;
+        Vector<uint8> bytecode;
+        ++shaderCount;
+
+        if (!cache.GetOrCompile(desc, compile, bytecode)) {
+            std::fprintf(stderr, "%s\nShaderCompiler: Failed to compile '%s'\n", errors.c_str(), relativePath.c_str());
+            ++failedCount;
+            continue;
+        }
+
+        bool compiled = cache.GetStats().misses != missesBefore;
+        std::printf("  %-9s %s (%s %s, %zu bytes)\n", compiled ? "compiled" : "cached",
+                    relativePath.c_str(), desc.entryPoint.c_str(), desc.target.c_str(), bytecode.size());
+    }
+
+    if (ec) {
+        std::fprintf(stderr, "ShaderCompiler: Failed to enumerate '%s': %s\n", shadersDirectory.c_str(), ec.message().c_str());
+        return 1;
+    }
+
+    const ShaderCacheStats& stats = cache.GetStats();
+    std::printf("%u shaders: %u compiled, %u cached, %u failed -> %s\n",
+                shaderCount, stats.misses - stats.compileFailures, stats.hits, failedCount, cacheDirectory.c_str());
+
+    return failedCount == 0 ? 0 : 1;
+}
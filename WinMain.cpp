@@ -1,12 +1,19 @@
 #include "Source/Core/Application/Application.h"
 #include "Source/Platform/Windows/WindowsPlatform.h"
 #include "Source/Core/Scene/Scene.h"
+#include "Source/Core/Scene/RenderPacket.h"
+#include "Source/Core/Scene/Heightfield.h"
 #include "Source/Core/Entity/Entity.h"
 #include "Source/Core/Entity/MeshComponent.h"
 #include "Source/Core/Entity/TransformComponent.h"
 #include "Source/Rendering/Dx12/DX12Renderer.h"
 #include "Source/Rendering/Material.h"
 #include "Source/Rendering/Bindable/Texture.h"
+#include "Source/Rendering/TextureStreamer.h"
+#include "Source/Rendering/RHI/RecordingRHIContextPool.h"
+#include "Source/Core/Threading/JobSystem.h"
+#include "Source/Core/Utilities/FileSystem.h"
+#include "Source/Core/Utilities/MeshGeometry.h"
 #include <DirectXMath.h>
 
 class GameScene : public Scene {
@@ -152,6 +159,8 @@ public:
         Scene::Update(deltaTime);
     }
 
+    using Scene::Render;
+
     void Render(DX12Renderer* renderer) override {
         if (!renderer) return;
 
@@ -165,6 +174,34 @@ public:
         Scene::Render(renderer);
     }
 
+    void BuildRenderPacket(RenderPacket& packet) override {
+        packet.hasLight = true;
+        packet.light = GetLight();
+
+        Scene::BuildRenderPacket(packet);
+    }
+
+    // The cubes in world space, for the camera to stay above
+    MeshData BuildTerrainMesh() const {
+        MeshData terrain;
+        for (Entity* entity : { m_cubeEntity, m_secondCube }) {
+            if (!entity) continue;
+
+            DirectX::XMMATRIX world = entity->GetComponent<TransformComponent>()->GetWorldMatrix();
+            MeshData cube = MeshGeometry::CreateCube();
+            uint32 baseVertex = static_cast<uint32>(terrain.vertices.size());
+            for (Vertex& vertex : cube.vertices) {
+                DirectX::XMStoreFloat3(&vertex.position,
+                    DirectX::XMVector3TransformCoord(DirectX::XMLoadFloat3(&vertex.position), world));
+                terrain.vertices.push_back(vertex);
+            }
+            for (uint32 index : cube.indices) {
+                terrain.indices.push_back(baseVertex + index);
+            }
+        }
+        return terrain;
+    }
+
     void OnEntitySpawned(Entity* entity) override {
         Platform::OutputDebugMessage("GameScene: Entity spawned - " + entity->GetName() + "\n");
     }
@@ -186,25 +223,31 @@ private:
         }
     }
 
-    void UpdateLightConstants(DX12Renderer* renderer) {
-        if (!renderer) return;
-        
+    RenderLight GetLight() const {
         // Point light position above and to the side of the scene
-        DirectX::XMFLOAT3 lightPosition = { 5.0f, 8.0f, -3.0f };
-        DirectX::XMFLOAT3 lightColor = { 1.0f, 0.95f, 0.8f };
-        float lightIntensity = 10.0f; // Increased intensity for point light
+        RenderLight light;
+        light.position = { 5.0f, 8.0f, -3.0f };
+        light.color = { 1.0f, 0.95f, 0.8f };
+        light.intensity = 10.0f; // Increased intensity for point light
 
         static int frameCount = 0;
         if (frameCount % 60 == 0) { // Debug every 60 frames
             Platform::OutputDebugMessage("Light position: (" + 
-                std::to_string(lightPosition.x) + ", " + 
-                std::to_string(lightPosition.y) + ", " + 
-                std::to_string(lightPosition.z) + ")\n");
+                std::to_string(light.position.x) + ", " + 
+                std::to_string(light.position.y) + ", " + 
+                std::to_string(light.position.z) + ")\n");
         }
         frameCount++;
 
+        return light;
+    }
+
+    void UpdateLightConstants(DX12Renderer* renderer) {
+        if (!renderer) return;
+
         // Update light constants through renderer
-        renderer->UpdateLightConstants(lightPosition, lightColor, lightIntensity);
+        RenderLight light = GetLight();
+        renderer->UpdateLightConstants(light.position, light.color, light.intensity);
     }
 
     void UploadTextureData(DX12Renderer* renderer) {
@@ -229,6 +272,7 @@ private:
 class RTSApplication : public Application {
 private:
     UniquePtr<GameScene> m_gameScene;
+    Heightfield m_terrain;
 
 public:
     RTSApplication() : Application(CreateConfig()) {
@@ -258,6 +302,12 @@ private:
         config.cameraDesc.moveSpeed = 12.0f;
         config.cameraDesc.mouseSensitivity = 0.002f;
         config.cameraDesc.scrollSensitivity = 2.5f;
+        config.cameraDesc.infiniteFarPlane = true;  // Reverse Z keeps the far side of the map resolved
+
+        // RTS view over the scene
+        config.rtsCamera = true;
+        config.rtsCameraDesc.focus = { 2.0f, 0.0f };
+        config.rtsCameraDesc.zoom = 0.2f;
 
         return config;
     }
@@ -273,6 +323,11 @@ protected:
             return false;
         }
 
+        // Packed assets (built with Tools/PackBuilder) take priority over the loose Assets folder
+        if (FileSystem::FileExists("Assets.pak")) {
+            FileSystem::MountPack("Assets.pak");
+        }
+
         m_gameScene = std::make_unique<GameScene>();
 
         m_gameScene->Initialize();
@@ -290,18 +345,30 @@ protected:
             return false;
         }
 
+        // Flat ground with the cubes on it; the camera clamps against this instead of the meshes
+        HeightfieldDesc terrainDesc;
+        terrainDesc.columns = 161;
+        terrainDesc.rows = 161;
+        terrainDesc.cellSize = 0.5f;
+        terrainDesc.originX = -40.0f;
+        terrainDesc.originZ = -40.0f;
+        terrainDesc.maxHeightRadius = 2.0f;
+        if (m_terrain.BuildFromMesh(terrainDesc, m_gameScene->BuildTerrainMesh()) && GetCameraController()) {
+            GetCameraController()->SetHeightfield(&m_terrain);
+        }
+
         Platform::OutputDebugMessage("RTSApplication: Initialized successfully!\n");
         Platform::OutputDebugMessage("Textured cubes loaded automatically on startup!\n");
         Platform::OutputDebugMessage("Controls:\n");
-        Platform::OutputDebugMessage("  WASD - Move camera\n");
-        Platform::OutputDebugMessage("  Right mouse + drag - Look around\n");
+        Platform::OutputDebugMessage("  WASD / arrows / screen edges - Pan camera\n");
+        Platform::OutputDebugMessage("  Q/E - Rotate camera\n");
         Platform::OutputDebugMessage("  Mouse wheel - Zoom\n");
-        Platform::OutputDebugMessage("  R - Reset camera\n");
         Platform::OutputDebugMessage("  F1 - Show entity count\n");
         Platform::OutputDebugMessage("  F2 - Spawn new cube\n");
         Platform::OutputDebugMessage("  F3 - Spawn colored cube\n");
         Platform::OutputDebugMessage("  F4 - Spawn additional cube with bricks.dds texture\n");
         Platform::OutputDebugMessage("  F5 - Spawn additional cube with bricks2.dds texture\n");
+        Platform::OutputDebugMessage("  F9 - Capture RHI command stream to FrameCapture.rhic\n");
         Platform::OutputDebugMessage("  T - Toggle wireframe mode\n");
         Platform::OutputDebugMessage("  ESC - Exit\n");
 
@@ -317,11 +384,13 @@ protected:
         }
     }
 
-    void OnUpdate(float32 deltaTime) override {
+    void OnFixedUpdate(float32 stepSeconds) override {
         if (m_gameScene) {
-            m_gameScene->Update(deltaTime);
+            m_gameScene->Simulate(stepSeconds);
         }
+    }
 
+    void OnUpdate(float32 deltaTime) override {
         static float32 fpsTimer = 0.0f;
         fpsTimer += deltaTime;
         if (fpsTimer >= 1.0f) {
@@ -333,21 +402,38 @@ protected:
         }
     }
 
-    void OnRender() override {
+    void OnBuildRenderPacket(RenderPacket& packet) override {
+        if (m_gameScene) {
+            m_gameScene->SetInterpolationAlpha(packet.interpolationAlpha);
+            m_gameScene->BuildRenderPacket(packet);
+        }
+    }
+
+    // Runs on the render thread: everything it needs is in the packet
+    void OnRender(const RenderPacket& packet) override {
         DX12Renderer* dx12Renderer = static_cast<DX12Renderer*>(GetRenderer());
         if (!dx12Renderer) return;
 
-        if (GetCamera()) {
-            DirectX::XMMATRIX viewMatrix = GetCamera()->GetViewMatrix();
-            DirectX::XMMATRIX projMatrix = GetCamera()->GetProjectionMatrix();
-            DirectX::XMFLOAT3 cameraPosition = GetCamera()->GetPosition();
+        // Reset object index for consistent material assignment
+        dx12Renderer->ResetObjectIndex();
+
+        if (packet.hasView) {
+            const RenderView& view = packet.view;
+            dx12Renderer->UpdateViewConstants(DirectX::XMLoadFloat4x4(&view.view),
+                                              DirectX::XMLoadFloat4x4(&view.projection), view.position);
 
-            dx12Renderer->UpdateViewConstants(viewMatrix, projMatrix, cameraPosition);
+            // Screen-size feedback for texture streaming is measured against this view
+            if (TextureStreamer* streamer = dx12Renderer->GetTextureStreamer()) {
+                streamer->SetView(view.position, view.fovY, view.nearPlane, view.viewportHeight, view.lodDistanceScale);
+            }
         }
 
-        if (m_gameScene) {
-            m_gameScene->Render(dx12Renderer);
+        if (packet.hasLight) {
+            dx12Renderer->UpdateLightConstants(packet.light.position, packet.light.color, packet.light.intensity);
         }
+
+        // Recorded across the worker command lists once the packet is large enough
+        MeshComponent::DrawAll(dx12Renderer, packet.draws, JobSystem::GetGlobal());
     }
 
     void OnKeyEvent(const KeyEvent& event) override {
@@ -367,6 +453,8 @@ protected:
 
                 case KeyCode::F2:
                     if (m_gameScene) {
+                        // Creates GPU resources, which the render thread must not be using
+                        WaitForRenderThread();
                         auto newEntity = m_gameScene->SpawnEntity<Entity>();
                         newEntity->SetName("Runtime Cube " + std::to_string(m_gameScene->GetEntityCount()));
 
@@ -386,6 +474,7 @@ protected:
 
                 case KeyCode::F3:
                     if (m_gameScene) {
+                        WaitForRenderThread();
                         auto newEntity = m_gameScene->SpawnEntity<Entity>();
                         newEntity->SetName("Colored Cube " + std::to_string(m_gameScene->GetEntityCount()));
 
@@ -414,6 +503,7 @@ protected:
 
                 case KeyCode::F4:
                     if (m_gameScene) {
+                        WaitForRenderThread();
                         auto newEntity = m_gameScene->SpawnEntity<Entity>();
                         newEntity->SetName("Textured Cube (bricks.dds)");
 
@@ -436,6 +526,7 @@ protected:
 
                 case KeyCode::F5:
                     if (m_gameScene) {
+                        WaitForRenderThread();
                         auto newEntity = m_gameScene->SpawnEntity<Entity>();
                         newEntity->SetName("Textured Cube (bricks2.dds)");
 
@@ -456,8 +547,32 @@ protected:
                     }
                     break;
 
+                case KeyCode::F9:
+                    if (m_gameScene && GetCamera()) {
+                        // Record what the RHI path would submit for the entities in view (nothing
+                        // reaches the GPU), using the parallel path so the capture also exercises
+                        // worker ordering
+                        WaitForRenderThread();
+                        RecordingRHIContextPool recorder;
+                        const Frustum& frustum = GetCamera()->GetFrustum();
+                        m_gameScene->Render(recorder, JobSystem::GetGlobal(), [&frustum](const Entity& entity) {
+                            // Entities without mesh bounds are kept
+                            MeshComponent* mesh = entity.GetComponent<MeshComponent>();
+                            DirectX::XMFLOAT3 center;
+                            float radius = 0.0f;
+                            return !mesh || !mesh->GetWorldBounds(center, radius) || frustum.IntersectsSphere(center, radius);
+                        });
+                        if (recorder.GetStream().SaveToFile("FrameCapture.rhic")) {
+                            Platform::OutputDebugMessage("Captured " + std::to_string(recorder.GetStream().GetCommandCount()) +
+                                                        " RHI commands from " + std::to_string(recorder.GetActiveContextCount()) +
+                                                        " contexts to FrameCapture.rhic\n");
+                        }
+                    }
+                    break;
+
                 case KeyCode::T:
                     {
+                        WaitForRenderThread();
                         DX12Renderer* dx12Renderer = static_cast<DX12Renderer*>(GetRenderer());
                         if (dx12Renderer) {
                             bool currentMode = dx12Renderer->IsWireframeMode();